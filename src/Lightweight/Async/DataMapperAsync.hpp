@@ -14,6 +14,7 @@
 
 #include <optional>
 #include <string>
+#include <tuple>
 #include <utility>
 #include <vector>
 
@@ -54,4 +55,14 @@ Async::Task<void> DataMapper::LoadRelationsAsync(Record& record)
     return Async::RunAsync(_connection.AsyncBackend(), [this, &record] { LoadRelations(record); });
 }
 
+template <typename... Records, DataMapperOptions... QueryOptions>
+Async::Task<std::tuple<std::vector<Records>...>> DataMapper::QueryManyAsync(
+    SqlRenderedSelect<Records, QueryOptions>... queries)
+{
+    return Async::RunAsync(_connection.AsyncBackend(),
+                           [this, ... queries = std::move(queries)]() -> std::tuple<std::vector<Records>...> {
+                               return QueryMany(queries...);
+                           });
+}
+
 } // namespace Lightweight
@@ -6,7 +6,7 @@
 // Core headers (SqlConnection, SqlStatement, DataMapper, Pool) include this to declare their
 // async member functions without pulling in <coroutine> or the full async runtime. The heavy
 // definitions are provided by the corresponding `.cpp` files and by the `Async/*.hpp` template
-// bodies (e.g. DataMapperAsync.hpp, Backend.hpp), which include the complete headers.
+// bodies (e.g. DataMapperAsync.hpp, Backend.hpp, Generator.hpp), which include the complete headers.
 // <stop_token> is included in full because it is lightweight (no <coroutine>) and the cancellation
 // token (a @c std::stop_token) appears as a defaulted argument on async declarations.
 
@@ -19,6 +19,9 @@ namespace Lightweight::Async
 template <typename T>
 class Task;
 
+template <typename T>
+class Generator;
+
 class IExecutor;
 class IResumeScheduler;
 class IAsyncBackend;
@@ -0,0 +1,191 @@
+// SPDX-License-Identifier: Apache-2.0
+#pragma once
+
+#include "Task.hpp"
+
+#include <coroutine>
+#include <exception>
+#include <optional>
+#include <type_traits>
+#include <utility>
+
+namespace Lightweight::Async
+{
+
+template <typename T>
+class Generator;
+
+namespace detail
+{
+
+    /// Promise type for @ref Generator.
+    ///
+    /// Reuses @ref TaskPromiseBase for the lazy start and the consumer hand-off: both @c co_yield and
+    /// the final suspension symmetric-transfer back to the coroutine that awaited @c Generator::Next.
+    /// Only one yielded value is ever held at a time, which is what gives the consumer backpressure.
+    ///
+    /// @tparam T The value type yielded by the generator.
+    template <typename T>
+    class GeneratorPromise final: public TaskPromiseBase
+    {
+      public:
+        Generator<T> get_return_object() noexcept;
+
+        /// Stores @p value and suspends the producer, resuming the awaiting consumer.
+        TaskFinalAwaiter yield_value(T value) noexcept(std::is_nothrow_move_constructible_v<T>)
+        {
+            _value.emplace(std::move(value));
+            return {};
+        }
+
+        void return_void() noexcept {}
+
+        void unhandled_exception() noexcept
+        {
+            _exception = std::current_exception();
+        }
+
+        /// Moves out the last yielded value (if any), or rethrows the captured exception.
+        [[nodiscard]] std::optional<T> Take()
+        {
+            if (_exception)
+                std::rethrow_exception(std::exchange(_exception, {}));
+            return std::exchange(_value, std::nullopt);
+        }
+
+      private:
+        std::optional<T> _value {};
+        std::exception_ptr _exception {};
+    };
+
+} // namespace detail
+
+/// @ingroup Async
+/// A lazy, move-only asynchronous generator coroutine.
+///
+/// A @c Generator<T> produces a sequence of @c T values one at a time. Its body may @c co_await any
+/// awaitable (typically an offloaded @ref Task, such as one block fetch on a connection's strand) and
+/// hands values to the consumer with @c co_yield. The body only runs while the consumer is awaiting
+/// @ref Next, so the consumer fully controls the pace: a slow consumer simply keeps the producer
+/// suspended, and at most one yielded value is buffered.
+///
+/// Exceptions thrown inside the body are rethrown from the @c co_await of @ref Next. Destroying the
+/// generator before it is exhausted destroys the suspended producer frame (running its destructors),
+/// which is how a consumer abandons a stream early.
+///
+/// @code
+/// auto rows = stmt.StreamDirectAsync("SELECT * FROM Big", 500);
+/// while (auto block = co_await rows.Next())
+///     co_await SendToClient(*block);
+/// @endcode
+///
+/// @tparam T The value type yielded by the generator.
+template <typename T>
+class [[nodiscard]] Generator
+{
+  public:
+    /// The coroutine promise type required by the C++ coroutine machinery.
+    using promise_type = detail::GeneratorPromise<T>;
+
+    /// The typed coroutine handle owned by this Generator.
+    using Handle = std::coroutine_handle<promise_type>;
+
+    /// Constructs an empty Generator that owns no coroutine.
+    Generator() noexcept = default;
+
+    /// Adopts ownership of the coroutine identified by @p handle (used by the promise).
+    /// @param handle The coroutine handle to take ownership of.
+    explicit Generator(Handle handle) noexcept:
+        _handle { handle }
+    {
+    }
+
+    /// Move-constructs from @p other, leaving it empty.
+    /// @param other The Generator to move from.
+    Generator(Generator&& other) noexcept:
+        _handle { std::exchange(other._handle, {}) }
+    {
+    }
+
+    /// Move-assigns from @p other, destroying any currently-owned coroutine first.
+    /// @param other The Generator to move from.
+    /// @return A reference to this Generator.
+    Generator& operator=(Generator&& other) noexcept
+    {
+        if (this != &other)
+        {
+            if (_handle)
+                _handle.destroy();
+            _handle = std::exchange(other._handle, {});
+        }
+        return *this;
+    }
+
+    Generator(Generator const&) = delete;
+    Generator& operator=(Generator const&) = delete;
+
+    ~Generator()
+    {
+        if (_handle)
+            _handle.destroy();
+    }
+
+    /// @return true if this Generator owns a coroutine frame.
+    [[nodiscard]] bool IsValid() const noexcept
+    {
+        return static_cast<bool>(_handle);
+    }
+
+    /// @return true if the Generator is empty or its body has run to completion.
+    [[nodiscard]] bool IsDone() const noexcept
+    {
+        return !_handle || _handle.done();
+    }
+
+    /// Resumes the producer until it yields its next value or completes.
+    ///
+    /// Must not be called again before the previous @c Next awaitable has been resumed.
+    ///
+    /// @return An awaitable producing the next value, or @c std::nullopt once the sequence ended.
+    ///         Rethrows any exception that escaped the generator body.
+    [[nodiscard]] auto Next() noexcept
+    {
+        struct Awaiter
+        {
+            Handle coro;
+
+            [[nodiscard]] bool await_ready() const noexcept
+            {
+                return !coro || coro.done();
+            }
+
+            [[nodiscard]] std::coroutine_handle<> await_suspend(std::coroutine_handle<> awaiting) noexcept
+            {
+                coro.promise().SetContinuation(awaiting);
+                return coro;
+            }
+
+            std::optional<T> await_resume()
+            {
+                if (!coro)
+                    return std::nullopt;
+                return coro.promise().Take();
+            }
+        };
+        return Awaiter { _handle };
+    }
+
+  private:
+    Handle _handle {};
+};
+
+namespace detail
+{
+    template <typename T>
+    Generator<T> GeneratorPromise<T>::get_return_object() noexcept
+    {
+        return Generator<T> { std::coroutine_handle<GeneratorPromise<T>>::from_promise(*this) };
+    }
+} // namespace detail
+
+} // namespace Lightweight::Async
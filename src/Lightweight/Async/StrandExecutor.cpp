@@ -15,7 +15,7 @@ StrandExecutor::StrandExecutor(IExecutor& underlying):
 void StrandExecutor::Post(Work work)
 {
     // Enqueue and, if no drain is currently active, claim it and schedule one. The claim is made
-    // under the queue's lock (atomically with the push), closing the push-vs-end-drain race.
+    // by the same atomic update that accounts for the push, closing the push-vs-end-drain race.
     if (!_state->queue.PushAndClaimDrain(std::move(work)))
         return;
 
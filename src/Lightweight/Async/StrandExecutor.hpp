@@ -43,7 +43,7 @@ class LIGHTWEIGHT_API StrandExecutor final: public IExecutor, public IResumeSche
   private:
     /// Mutable strand state, heap-allocated so in-flight drain closures can keep it alive
     /// independently of the @c StrandExecutor wrapper's lifetime. The serialized FIFO and its
-    /// drain-active flag live in @ref detail::SerialDrainQueue, which guards both under one lock.
+    /// drain ownership live in @ref detail::SerialDrainQueue, which posting threads update lock-free.
     struct State
     {
         IExecutor& underlying; ///< Borrowed executor that runs the serialized work.
@@ -2,11 +2,22 @@
 
 #include "ThreadPoolExecutor.hpp"
 
+#include <atomic>
+#include <condition_variable>
+#include <coroutine>
 #include <cstdint>
 #include <cstdio>
+#include <deque>
 #include <limits>
+#include <memory>
+#include <mutex>
+#include <ranges>
 #include <stdexcept>
+#include <thread>
+#include <type_traits>
 #include <utility>
+#include <variant>
+#include <vector>
 
 #include <exec/async_scope.hpp>
 #include <exec/static_thread_pool.hpp>
@@ -45,68 +56,304 @@ namespace
     {
         scope.spawn(stdexec::schedule(pool.get_scheduler()) | stdexec::then(std::move(fn)));
     }
+
+    /// Runs @p work on a worker. Like the stdexec path, an exception escaping it terminates.
+    void RunWork(Work& work) noexcept
+    {
+        if (work)
+            work();
+    }
+
+    /// @ref ThreadPoolScheduling::Shared: stdexec-backed state. The @c scope is declared after the
+    /// @c pool so it is destroyed first: the destructor drains it (sync_wait(on_empty())) before the
+    /// pool's own destructor stops and joins the workers.
+    class SharedPool
+    {
+      public:
+        explicit SharedPool(std::uint32_t workerCount):
+            _pool { workerCount }
+        {
+        }
+
+        SharedPool(SharedPool const&) = delete;
+        SharedPool& operator=(SharedPool const&) = delete;
+        SharedPool(SharedPool&&) = delete;
+        SharedPool& operator=(SharedPool&&) = delete;
+
+        ~SharedPool()
+        {
+            // Drain: block until every spawned work item has completed, restoring the "drain then join"
+            // teardown barrier the hand-rolled pool used to provide. async_scope additionally requires the
+            // scope to be empty before it is destroyed.
+            //
+            // A destructor is implicitly noexcept, and sync_wait can throw (e.g. bad_alloc constructing its
+            // wait state). Swallow it: there is nothing safe to do from a destructor, and letting it escape
+            // would call std::terminate. The residual risk is that on such a failure the scope may still be
+            // non-empty when the members are destroyed; this is an OOM-only corner that we cannot do better
+            // about here.
+            try
+            {
+                stdexec::sync_wait(_scope.on_empty());
+            }
+            catch (...)
+            {
+                // A destructor must not throw. The only realistic cause is OOM allocating sync_wait's wait
+                // state; we cannot drain further, so emit a best-effort diagnostic and continue teardown
+                // rather than letting the exception escape and call std::terminate.
+                std::fputs("ThreadPoolExecutor: failed to drain in-flight work during destruction.\n", stderr);
+            }
+        }
+
+        void Post(Work work)
+        {
+            SpawnOn(_scope, _pool, [work = std::move(work)]() mutable noexcept { RunWork(work); });
+        }
+
+        void Resume(std::coroutine_handle<> handle)
+        {
+            // Spawn the resume directly rather than wrapping it in a Work and routing through Post(): this
+            // honors IResumeScheduler's contract of avoiding a std::function allocation (and the extra
+            // indirection) on the coroutine-resume path.
+            SpawnOn(_scope, _pool, [handle]() noexcept {
+                if (handle)
+                    handle.resume();
+            });
+        }
+
+      private:
+        exec::static_thread_pool _pool;
+        exec::async_scope _scope;
+    };
+
+    class WorkStealingPool;
+
+    /// The work-stealing pool (and worker index) the current thread is a worker of, if any.
+    struct CurrentWorker
+    {
+        WorkStealingPool const* pool = nullptr;
+        std::size_t index = 0;
+    };
+
+    thread_local CurrentWorker t_currentWorker {};
+
+    /// @ref ThreadPoolScheduling::WorkStealing: one run queue per worker plus stealing.
+    ///
+    /// A Post from one of this pool's workers lands on that worker's own queue, which is what keeps a
+    /// strand on the worker whose coroutine just resumed and re-scheduled it. Posts from other threads
+    /// are spread round-robin. Workers take from the front of their own queue and, when it is empty,
+    /// from the front of the others', so the item that has waited longest is the one that moves. Each
+    /// queue has its own lock, which only its owner and the occasional thief ever take.
+    class WorkStealingPool
+    {
+      public:
+        explicit WorkStealingPool(std::size_t workerCount)
+        {
+            _queues.reserve(workerCount);
+            for ([[maybe_unused]] auto const _: std::views::iota(std::size_t { 0 }, workerCount))
+                _queues.push_back(std::make_unique<RunQueue>());
+
+            _threads.reserve(workerCount);
+            try
+            {
+                for (auto const index: std::views::iota(std::size_t { 0 }, workerCount))
+                    _threads.emplace_back([this, index] { WorkerLoop(index); });
+            }
+            catch (...)
+            {
+                StopAndJoin();
+                throw;
+            }
+        }
+
+        WorkStealingPool(WorkStealingPool const&) = delete;
+        WorkStealingPool& operator=(WorkStealingPool const&) = delete;
+        WorkStealingPool(WorkStealingPool&&) = delete;
+        WorkStealingPool& operator=(WorkStealingPool&&) = delete;
+
+        ~WorkStealingPool()
+        {
+            // Drain: work still running may post more, and each such item is counted before its parent
+            // finishes, so _outstanding only reaches zero once the pool is truly quiescent.
+            {
+                std::unique_lock lock(_sleepMutex);
+                _idle.wait(lock, [this] { return _outstanding.load(std::memory_order_acquire) == 0; });
+            }
+            StopAndJoin();
+        }
+
+        void Post(Work work)
+        {
+            _outstanding.fetch_add(1, std::memory_order_relaxed);
+            auto const target = t_currentWorker.pool == this
+                                    ? t_currentWorker.index
+                                    : _nextQueue.fetch_add(1, std::memory_order_relaxed) % _queues.size();
+            try
+            {
+                auto& queue = *_queues[target];
+                std::scoped_lock const lock(queue.mutex);
+                queue.items.push_back(std::move(work));
+            }
+            catch (...)
+            {
+                Complete();
+                throw;
+            }
+
+            // Pairs with the sleeper registration in WorkerLoop (both sequentially consistent): either
+            // the sleeper sees this item, or we see the sleeper and wake it.
+            _queued.fetch_add(1, std::memory_order_seq_cst);
+            if (_sleepers.load(std::memory_order_seq_cst) > 0)
+            {
+                {
+                    std::scoped_lock const lock(_sleepMutex);
+                }
+                _wake.notify_one();
+            }
+        }
+
+        void Resume(std::coroutine_handle<> handle)
+        {
+            Post([handle] {
+                if (handle)
+                    handle.resume();
+            });
+        }
+
+      private:
+        struct RunQueue
+        {
+            std::mutex mutex;
+            std::deque<Work> items;
+        };
+
+        void WorkerLoop(std::size_t index)
+        {
+            t_currentWorker = CurrentWorker { .pool = this, .index = index };
+            Work work;
+            while (true)
+            {
+                if (TryTake(index, work))
+                {
+                    RunWork(work);
+                    work = nullptr; // release captures before accounting the item as finished
+                    Complete();
+                    continue;
+                }
+
+                std::unique_lock lock(_sleepMutex);
+                _sleepers.fetch_add(1, std::memory_order_seq_cst);
+                _wake.wait(lock, [this] {
+                    return _queued.load(std::memory_order_seq_cst) > 0 || _stopping.load(std::memory_order_acquire);
+                });
+                _sleepers.fetch_sub(1, std::memory_order_relaxed);
+                if (_stopping.load(std::memory_order_acquire) && _queued.load(std::memory_order_acquire) == 0)
+                    return;
+            }
+        }
+
+        /// Takes the oldest item of worker @p index's own queue, else steals the oldest item of another.
+        bool TryTake(std::size_t index, Work& out)
+        {
+            for (auto const offset: std::views::iota(std::size_t { 0 }, _queues.size()))
+            {
+                auto& queue = *_queues[(index + offset) % _queues.size()];
+                std::scoped_lock const lock(queue.mutex);
+                if (queue.items.empty())
+                    continue;
+                out = std::move(queue.items.front());
+                queue.items.pop_front();
+                _queued.fetch_sub(1, std::memory_order_acq_rel);
+                return true;
+            }
+            return false;
+        }
+
+        /// Accounts one posted item as finished and wakes the draining destructor on the last one.
+        void Complete() noexcept
+        {
+            if (_outstanding.fetch_sub(1, std::memory_order_acq_rel) == 1)
+            {
+                {
+                    std::scoped_lock const lock(_sleepMutex);
+                }
+                _idle.notify_all();
+            }
+        }
+
+        void StopAndJoin() noexcept
+        {
+            {
+                std::scoped_lock const lock(_sleepMutex);
+                _stopping.store(true, std::memory_order_release);
+            }
+            _wake.notify_all();
+            for (auto& thread: _threads)
+                thread.join();
+        }
+
+        std::vector<std::unique_ptr<RunQueue>> _queues;
+        std::vector<std::thread> _threads;
+        std::atomic<std::size_t> _nextQueue { 0 };   ///< Round-robin cursor for posts from non-workers.
+        std::atomic<std::size_t> _queued { 0 };      ///< Items sitting in any run queue.
+        std::atomic<std::size_t> _outstanding { 0 }; ///< Items posted and not yet finished.
+        std::atomic<std::size_t> _sleepers { 0 };    ///< Workers waiting (or about to wait) on _wake.
+        std::atomic<bool> _stopping { false };
+        std::mutex _sleepMutex;
+        std::condition_variable _wake; ///< Signalled when work is queued or the pool stops.
+        std::condition_variable _idle; ///< Signalled when _outstanding drops to zero.
+    };
+
 } // namespace
 
-/// stdexec-backed state for @ref ThreadPoolExecutor. The @c scope is declared after the @c pool so it
-/// is destroyed first: ~ThreadPoolExecutor drains it (sync_wait(on_empty())) before the pool's own
-/// destructor stops and joins the workers.
+/// Scheduler state behind a @ref ThreadPoolExecutor: the implementation of the configured
+/// @ref ThreadPoolScheduling. Destroying it drains every in-flight item, then joins the workers.
 struct ThreadPoolExecutor::Impl
 {
-    exec::static_thread_pool pool;
-    exec::async_scope scope;
+    std::variant<std::monostate, SharedPool, WorkStealingPool> scheduler;
 
-    explicit Impl(std::uint32_t workerCount):
-        pool { workerCount }
+    Impl(std::uint32_t workerCount, ThreadPoolScheduling scheduling)
     {
+        switch (scheduling)
+        {
+            case ThreadPoolScheduling::Shared:
+                scheduler.emplace<SharedPool>(workerCount);
+                return;
+            case ThreadPoolScheduling::WorkStealing:
+                scheduler.emplace<WorkStealingPool>(workerCount);
+                return;
+        }
+        throw std::invalid_argument { "ThreadPoolExecutor: unknown scheduling mode." };
     }
 };
 
-ThreadPoolExecutor::ThreadPoolExecutor(std::size_t threadCount):
+ThreadPoolExecutor::ThreadPoolExecutor(std::size_t threadCount, ThreadPoolScheduling scheduling):
     _threadCount { threadCount },
-    _impl { std::make_unique<Impl>(ToWorkerCount(threadCount)) }
+    _scheduling { scheduling },
+    _impl { std::make_unique<Impl>(ToWorkerCount(threadCount), scheduling) }
 {
 }
 
-ThreadPoolExecutor::~ThreadPoolExecutor()
-{
-    // Drain: block until every spawned work item has completed, restoring the "drain then join"
-    // teardown barrier the hand-rolled pool used to provide. async_scope additionally requires the
-    // scope to be empty before it is destroyed.
-    //
-    // A destructor is implicitly noexcept, and sync_wait can throw (e.g. bad_alloc constructing its
-    // wait state). Swallow it: there is nothing safe to do from a destructor, and letting it escape
-    // would call std::terminate. The residual risk is that on such a failure the scope may still be
-    // non-empty when ~Impl runs; this is an OOM-only corner that we cannot do better about here.
-    try
-    {
-        stdexec::sync_wait(_impl->scope.on_empty());
-    }
-    catch (...)
-    {
-        // A destructor must not throw. The only realistic cause is OOM allocating sync_wait's wait
-        // state; we cannot drain further, so emit a best-effort diagnostic and continue teardown
-        // rather than letting the exception escape and call std::terminate.
-        std::fputs("ThreadPoolExecutor: failed to drain in-flight work during destruction.\n", stderr);
-    }
-}
+// Destroying the Impl drains in-flight work and joins the workers (see SharedPool / WorkStealingPool).
+ThreadPoolExecutor::~ThreadPoolExecutor() = default;
 
 void ThreadPoolExecutor::Post(Work work)
 {
-    SpawnOn(_impl->scope, _impl->pool, [work = std::move(work)]() mutable noexcept {
-        if (work)
-            work();
-    });
+    std::visit(
+        [&work]<typename Scheduler>(Scheduler& scheduler) {
+            if constexpr (!std::is_same_v<Scheduler, std::monostate>)
+                scheduler.Post(std::move(work));
+        },
+        _impl->scheduler);
 }
 
 void ThreadPoolExecutor::Resume(std::coroutine_handle<> handle)
 {
-    // Spawn the resume directly rather than wrapping it in a Work and routing through Post(): this
-    // honors IResumeScheduler's contract of avoiding a std::function allocation (and the extra
-    // indirection) on the coroutine-resume path.
-    SpawnOn(_impl->scope, _impl->pool, [handle]() noexcept {
-        if (handle)
-            handle.resume();
-    });
+    std::visit(
+        [handle]<typename Scheduler>(Scheduler& scheduler) {
+            if constexpr (!std::is_same_v<Scheduler, std::monostate>)
+                scheduler.Resume(handle);
+        },
+        _impl->scheduler);
 }
 
 } // namespace Lightweight::Async
@@ -5,11 +5,27 @@
 #include "Executor.hpp"
 
 #include <cstddef>
+#include <cstdint>
 #include <memory>
 
 namespace Lightweight::Async
 {
 
+/// @ingroup Async
+/// How a @ref ThreadPoolExecutor distributes posted work over its worker threads.
+enum class ThreadPoolScheduling : std::uint8_t
+{
+    /// Every posted item is spawned onto stdexec's @c exec::static_thread_pool. The default.
+    Shared,
+
+    /// Every worker owns a run queue. Work posted from a worker (a strand drain scheduled by a
+    /// coroutine that just resumed there) stays on that worker, so a connection's strand keeps
+    /// running on the thread whose caches already hold its state. An idle worker steals the oldest
+    /// queued item from a busy one; because a strand schedules one drain closure for all of its
+    /// queued work, a steal moves a whole strand rather than single items of it.
+    WorkStealing,
+};
+
 /// @ingroup Async
 /// A fixed-size pool of worker threads that run posted work concurrently.
 ///
@@ -20,6 +36,9 @@ namespace Lightweight::Async
 /// destructor can wait for every in-flight item to finish, draining and joining. The pool must
 /// therefore outlive every coroutine that can resume on it.
 ///
+/// With @ref ThreadPoolScheduling::WorkStealing the pool instead runs its own connection-affine
+/// workers (see there); the drain-then-join teardown is the same in both modes.
+///
 /// The stdexec machinery lives in a pimpl defined in the translation unit, so this public header
 /// pulls in no stdexec headers — keeping them out of the C++20 module's global module fragment and
 /// off every downstream consumer that does not opt in.
@@ -29,9 +48,11 @@ class LIGHTWEIGHT_API ThreadPoolExecutor final: public IExecutor, public IResume
     /// Constructs the pool and starts @p threadCount worker threads.
     ///
     /// @param threadCount Number of worker threads to start (must be >= 1).
+    /// @param scheduling How posted work is distributed over the workers.
     /// @throws std::invalid_argument if @p threadCount is 0 or exceeds the supported maximum
     ///         (@c std::uint32_t, the width the underlying stdexec pool accepts).
-    explicit ThreadPoolExecutor(std::size_t threadCount);
+    explicit ThreadPoolExecutor(std::size_t threadCount,
+                                ThreadPoolScheduling scheduling = ThreadPoolScheduling::Shared);
 
     ThreadPoolExecutor(ThreadPoolExecutor const&) = delete;
     ThreadPoolExecutor& operator=(ThreadPoolExecutor const&) = delete;
@@ -57,13 +78,21 @@ class LIGHTWEIGHT_API ThreadPoolExecutor final: public IExecutor, public IResume
         return _threadCount;
     }
 
+    /// @return the scheduling mode the pool was constructed with.
+    [[nodiscard]] ThreadPoolScheduling Scheduling() const noexcept
+    {
+        return _scheduling;
+    }
+
   private:
-    /// Holds the stdexec @c static_thread_pool and @c async_scope; defined in the .cpp so the
-    /// stdexec headers never reach this public header (nor the module's global module fragment).
+    /// The scheduler behind the selected @ref ThreadPoolScheduling (the stdexec @c static_thread_pool
+    /// and @c async_scope, or the work-stealing workers); defined in the .cpp so the stdexec headers
+    /// never reach this public header (nor the module's global module fragment).
     struct Impl;
 
-    std::size_t _threadCount;    ///< Configured worker count (exposed via ThreadCount()).
-    std::unique_ptr<Impl> _impl; ///< stdexec pool + scope; destroyed (and drained) in ~ThreadPoolExecutor.
+    std::size_t _threadCount;           ///< Configured worker count (exposed via ThreadCount()).
+    ThreadPoolScheduling _scheduling;   ///< Configured mode (exposed via Scheduling()).
+    std::unique_ptr<Impl> _impl;        ///< Scheduler state; destroyed (and drained) in ~ThreadPoolExecutor.
 };
 
 } // namespace Lightweight::Async
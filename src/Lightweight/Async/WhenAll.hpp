@@ -0,0 +1,223 @@
+// SPDX-License-Identifier: Apache-2.0
+#pragma once
+
+#include "Task.hpp"
+
+#include <array>
+#include <atomic>
+#include <coroutine>
+#include <cstddef>
+#include <exception>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+
+namespace Lightweight::Async
+{
+
+namespace detail
+{
+
+    /// Counts outstanding @ref WhenAll children and remembers whom to resume once all have finished.
+    ///
+    /// The count starts at children + 1: the extra arrival is made by @c WhenAllAwaitable::await_suspend
+    /// once it has started every child, so a child finishing on another thread can never resume the
+    /// awaiting coroutine while await_suspend is still running.
+    class WhenAllLatch
+    {
+      public:
+        explicit WhenAllLatch(std::size_t count) noexcept:
+            _count { count }
+        {
+        }
+
+        /// @return true for the last arrival, which is responsible for resuming the continuation.
+        [[nodiscard]] bool Arrive() noexcept
+        {
+            return _count.fetch_sub(1, std::memory_order_acq_rel) == 1;
+        }
+
+        void SetContinuation(std::coroutine_handle<> continuation) noexcept
+        {
+            _continuation = continuation;
+        }
+
+        [[nodiscard]] std::coroutine_handle<> Continuation() const noexcept
+        {
+            return _continuation;
+        }
+
+      private:
+        std::atomic<std::size_t> _count;
+        std::coroutine_handle<> _continuation {};
+    };
+
+    class WhenAllDriver;
+
+    /// Promise of the per-child driver coroutine. At final suspension it arrives at the latch and, if it
+    /// was the last child to finish, symmetric-transfers to the coroutine awaiting @ref WhenAll.
+    class WhenAllDriverPromise
+    {
+      public:
+        WhenAllDriver get_return_object() noexcept;
+
+        [[nodiscard]] std::suspend_always initial_suspend() noexcept
+        {
+            return {};
+        }
+
+        [[nodiscard]] auto final_suspend() noexcept
+        {
+            struct FinalAwaiter
+            {
+                [[nodiscard]] bool await_ready() const noexcept
+                {
+                    return false;
+                }
+
+                [[nodiscard]] std::coroutine_handle<> await_suspend(
+                    std::coroutine_handle<WhenAllDriverPromise> coro) const noexcept
+                {
+                    auto* latch = coro.promise()._latch;
+                    return latch->Arrive() ? latch->Continuation() : std::noop_coroutine();
+                }
+
+                void await_resume() const noexcept {}
+            };
+            return FinalAwaiter {};
+        }
+
+        void return_void() noexcept {}
+
+        /// The driver body catches everything into the child's result slot, so nothing can escape.
+        void unhandled_exception() noexcept
+        {
+            std::terminate();
+        }
+
+        void SetLatch(WhenAllLatch& latch) noexcept
+        {
+            _latch = &latch;
+        }
+
+      private:
+        WhenAllLatch* _latch = nullptr;
+    };
+
+    /// RAII owner of one child's driver coroutine.
+    class WhenAllDriver
+    {
+      public:
+        using promise_type = WhenAllDriverPromise;
+        using Handle = std::coroutine_handle<promise_type>;
+
+        explicit WhenAllDriver(Handle handle) noexcept:
+            _handle { handle }
+        {
+        }
+
+        WhenAllDriver(WhenAllDriver&& other) noexcept:
+            _handle { std::exchange(other._handle, {}) }
+        {
+        }
+
+        WhenAllDriver(WhenAllDriver const&) = delete;
+        WhenAllDriver& operator=(WhenAllDriver const&) = delete;
+        WhenAllDriver& operator=(WhenAllDriver&&) = delete;
+
+        ~WhenAllDriver()
+        {
+            if (_handle)
+                _handle.destroy();
+        }
+
+        /// Starts the child; it runs inline until its first real suspension.
+        void Start(WhenAllLatch& latch)
+        {
+            _handle.promise().SetLatch(latch);
+            _handle.resume();
+        }
+
+      private:
+        Handle _handle;
+    };
+
+    inline WhenAllDriver WhenAllDriverPromise::get_return_object() noexcept
+    {
+        return WhenAllDriver { std::coroutine_handle<WhenAllDriverPromise>::from_promise(*this) };
+    }
+
+    /// Driver coroutine: awaits @p task and stores its value or exception into @p result.
+    template <typename T>
+    WhenAllDriver MakeWhenAllDriver(Task<T> task, CoroutineResult<T>* result)
+    {
+        try
+        {
+            result->SetValue(co_await std::move(task));
+        }
+        catch (...)
+        {
+            result->SetException();
+        }
+    }
+
+    /// Starts every driver and suspends the awaiting coroutine until the last one has finished.
+    template <std::size_t N>
+    class WhenAllAwaitable
+    {
+      public:
+        explicit WhenAllAwaitable(std::array<WhenAllDriver, N>& drivers) noexcept:
+            _drivers { drivers }
+        {
+        }
+
+        [[nodiscard]] bool await_ready() const noexcept
+        {
+            return N == 0;
+        }
+
+        bool await_suspend(std::coroutine_handle<> awaiting)
+        {
+            _latch.SetContinuation(awaiting);
+            for (auto& driver: _drivers)
+                driver.Start(_latch);
+            // Suspend unless every child already finished inline, in which case resume right away.
+            return !_latch.Arrive();
+        }
+
+        void await_resume() const noexcept {}
+
+      private:
+        std::array<WhenAllDriver, N>& _drivers;
+        WhenAllLatch _latch { N + 1 };
+    };
+
+} // namespace detail
+
+/// @ingroup Async
+/// Runs several tasks concurrently and completes once all of them have completed.
+///
+/// All children are started together, so tasks that offload to different executors (e.g. to the
+/// strands of different pooled connections) overlap instead of running one after another. The
+/// awaiting coroutine resumes wherever the last child finished. If any child throws, the first
+/// failing child's exception (in argument order) is rethrown after all children have finished.
+///
+/// @tparam Ts The (non-void) result types of the tasks.
+/// @param tasks The tasks to run (consumed).
+/// @return A Task producing a tuple of every child's result, in argument order.
+template <typename... Ts>
+    requires(!std::is_void_v<Ts> && ...)
+[[nodiscard]] Task<std::tuple<Ts...>> WhenAll(Task<Ts>... tasks)
+{
+    auto results = std::tuple<detail::CoroutineResult<Ts>...> {};
+    {
+        auto drivers = [&]<std::size_t... I>(std::index_sequence<I...>) {
+            return std::array<detail::WhenAllDriver, sizeof...(Ts)> { detail::MakeWhenAllDriver(
+                std::move(tasks), &std::get<I>(results))... };
+        }(std::index_sequence_for<Ts...> {});
+        co_await detail::WhenAllAwaitable<sizeof...(Ts)> { drivers };
+    }
+    co_return std::apply([](auto&... result) { return std::tuple<Ts...> { result.Take()... }; }, results);
+}
+
+} // namespace Lightweight::Async
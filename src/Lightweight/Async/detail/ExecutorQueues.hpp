@@ -3,10 +3,13 @@
 
 #include "../Executor.hpp"
 
+#include <atomic>
 #include <condition_variable>
 #include <cstddef>
 #include <deque>
+#include <memory>
 #include <mutex>
+#include <thread>
 #include <utility>
 
 namespace Lightweight::Async::detail
@@ -99,14 +102,38 @@ class PumpQueue
 
 /// Serialized-drain FIFO of @ref Work items used by @ref StrandExecutor.
 ///
-/// Guards the pending queue and a single "a drain is scheduled/running" flag under @b one lock so
-/// the push-vs-end-drain race is closed without a second mutex: @ref PushAndClaimDrain enqueues and
-/// atomically decides whether the caller must schedule a fresh drain, and @ref PopOrEndDrain pops
-/// the next item or clears the flag when the queue empties. The drain closure runs on the strand's
-/// underlying (now stdexec-backed) executor, so the strand owns no thread of its own.
+/// Producers never take a lock: items are linked into an intrusive multi-producer/single-consumer
+/// list (Vyukov's algorithm) with one atomic exchange, and a single atomic @c _pending counter decides
+/// who owns the drain. The counter covers every item that has been pushed but not yet @e finished,
+/// so it only returns to zero once the running item has completed; the producer that moves it off
+/// zero claims the drain (@ref PushAndClaimDrain) and the drain ends exactly when the consumer brings
+/// it back to zero (@ref PopOrEndDrain). At most one drain therefore runs at a time, which is the
+/// strand's serialization guarantee, without the producers contending on a mutex.
 class SerialDrainQueue
 {
   public:
+    SerialDrainQueue():
+        _tail { std::make_unique<Node>() },
+        _head { _tail.get() }
+    {
+    }
+
+    SerialDrainQueue(SerialDrainQueue const&) = delete;
+    SerialDrainQueue& operator=(SerialDrainQueue const&) = delete;
+    SerialDrainQueue(SerialDrainQueue&&) = delete;
+    SerialDrainQueue& operator=(SerialDrainQueue&&) = delete;
+
+    ~SerialDrainQueue()
+    {
+        // Only reached once no drain can run any more; discard whatever was never drained.
+        // The remaining sentinel is released by _tail.
+        Work discarded;
+        while (TryPop(discarded))
+        {
+            discarded = Work {};
+        }
+    }
+
     /// Enqueues @p work and, if no drain is currently active, claims the drain.
     ///
     /// @param work The work item to enqueue (consumed).
@@ -114,36 +141,60 @@ class SerialDrainQueue
     ///         false if a drain is already active and will pick up this item.
     bool PushAndClaimDrain(Work work)
     {
-        std::scoped_lock const lock(_mutex);
-        _queue.push_back(std::move(work));
-        if (_draining)
-            return false;
-        _draining = true;
-        return true;
+        // The list owns the node from the moment it is linked until the drain adopts it in TryPop().
+        auto node = std::make_unique<Node>();
+        node->work = std::move(work);
+        Node* previous = _head.exchange(node.get(), std::memory_order_acq_rel);
+        previous->next.store(node.release(), std::memory_order_release);
+        return _pending.fetch_add(1, std::memory_order_acq_rel) == 0;
     }
 
-    /// Pops the next item, or ends the drain when the queue is empty.
+    /// Completes the previously popped item (if any), then pops the next one or ends the drain.
+    ///
+    /// Must only be called by the drain that holds the claim.
     ///
     /// @param out Receives the popped item when one is available.
-    /// @return true if an item was popped; false if the queue was empty (the drain flag is then
-    ///         cleared under the lock so the next @ref PushAndClaimDrain re-schedules a drain).
+    /// @return true if an item was popped; false if the queue was empty (the drain is then released,
+    ///         so the next @ref PushAndClaimDrain re-schedules one).
     bool PopOrEndDrain(Work& out)
     {
-        std::scoped_lock const lock(_mutex);
-        if (_queue.empty())
+        if (_holdingItem)
         {
-            _draining = false;
-            return false;
+            // Cleared before the release below, so the next drain (possibly on another thread) never
+            // races on it.
+            _holdingItem = false;
+            if (_pending.fetch_sub(1, std::memory_order_acq_rel) == 1)
+                return false;
         }
-        out = std::move(_queue.front());
-        _queue.pop_front();
+        // _pending guarantees an item exists; it may merely not be linked yet by its producer.
+        while (!TryPop(out))
+            std::this_thread::yield();
+        _holdingItem = true;
         return true;
     }
 
   private:
-    std::mutex _mutex;
-    std::deque<Work> _queue;
-    bool _draining = false; ///< true while a single drain closure is scheduled/running.
+    struct Node
+    {
+        std::atomic<Node*> next;
+        Work work;
+    };
+
+    /// Consumer-side pop; false if the list is empty or its next node is still being linked.
+    bool TryPop(Work& out)
+    {
+        Node* next = _tail->next.load(std::memory_order_acquire);
+        if (!next)
+            return false;
+        out = std::move(next->work);
+        _tail.reset(next); // `next` becomes the new (now valueless) sentinel; the old one is freed.
+        return true;
+    }
+
+    std::unique_ptr<Node> _tail;        ///< Sentinel before the oldest item; touched by the drain only.
+    std::atomic<Node*> _head;           ///< Most recently pushed node; producers exchange it.
+    std::atomic<std::size_t> _pending { 0 }; ///< Items pushed and not yet finished; non-zero while draining.
+    bool _holdingItem = false;          ///< Drain-only: the last popped item has not been accounted yet.
 };
 
 } // namespace Lightweight::Async::detail
@@ -19,19 +19,41 @@ namespace Lightweight::detail
 /// drains-then-stops. (The async executors deliberately do not share this primitive — they own
 /// the smaller, purpose-built queues in @c Async/detail/ExecutorQueues.hpp.)
 ///
+/// An optional capacity turns the queue into a backpressure point: @ref Push then blocks while the
+/// queue holds @c capacity items, so a fast producer cannot outrun its consumers unboundedly.
+///
 /// @tparam T The element type stored in the queue.
 template <typename T>
 class BlockingQueue
 {
   public:
+    /// Constructs an unbounded queue.
+    BlockingQueue() = default;
+
+    /// Constructs a queue holding at most @p capacity items (0 = unbounded).
+    explicit BlockingQueue(std::size_t capacity) noexcept:
+        _capacity { capacity }
+    {
+    }
+
     /// Enqueues @p item and notifies one blocked waiter.
-    void Push(T item)
+    ///
+    /// On a bounded queue this blocks while the queue is full. Once the queue is marked finished
+    /// the item is dropped instead, so producers never deadlock against consumers that gave up.
+    ///
+    /// @return true if the item was enqueued; false if the queue was already finished.
+    bool Push(T item)
     {
         {
-            std::scoped_lock const lock(_mutex);
+            std::unique_lock lock(_mutex);
+            if (_capacity > 0)
+                _notFull.wait(lock, [&] { return _queue.size() < _capacity || _finished; });
+            if (_finished && _capacity > 0)
+                return false;
             _queue.push_back(std::move(item));
         }
         _condition.notify_one();
+        return true;
     }
 
     /// Blocks until an item is available or the queue is marked finished and empty, then pops.
@@ -45,6 +67,9 @@ class BlockingQueue
             return false;
         out = std::move(_queue.front());
         _queue.pop_front();
+        lock.unlock();
+        if (_capacity > 0)
+            _notFull.notify_one();
         return true;
     }
 
@@ -56,6 +81,7 @@ class BlockingQueue
             _finished = true;
         }
         _condition.notify_all();
+        _notFull.notify_all();
     }
 
     /// @return true if the queue is currently empty.
@@ -75,7 +101,9 @@ class BlockingQueue
   private:
     mutable std::mutex _mutex;
     std::condition_variable _condition;
+    std::condition_variable _notFull; ///< Signalled when a bounded queue drops below its capacity.
     std::deque<T> _queue;
+    std::size_t _capacity = 0; ///< Maximum number of queued items; 0 = unbounded.
     bool _finished = false; ///< Set by MarkFinished(); makes WaitAndPop drain-then-stop.
 };
 
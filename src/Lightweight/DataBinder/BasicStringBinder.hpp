@@ -5,13 +5,17 @@
 #include "Core.hpp"
 #include "UnicodeConverter.hpp"
 
+#include <algorithm>
 #include <cassert>
 #include <cstddef>
 #include <cstring>
 #include <memory>
 #include <optional>
 #include <ranges>
+#include <string>
+#include <string_view>
 #include <utility>
+#include <vector>
 
 namespace Lightweight
 {
@@ -187,6 +191,95 @@ namespace detail
                           indicator);
     }
 
+    /// Stages one string column of a batch into a column-wise, fixed-stride buffer and binds it.
+    ///
+    /// Every row gets a slot of the batch's longest value (plus one code unit), so the driver can
+    /// address row @c i at @c buffer + i*stride, as @c SQL_PARAM_BIND_BY_COLUMN requires. The buffer and
+    /// the per-row length indicators are taken from @p cb and therefore live until the batch has
+    /// executed.
+    ///
+    /// @param viewAt Returns the value of row @c i as a view of code units, or @c std::nullopt for NULL.
+    ///               Called twice per row: once to size the slots, once to copy.
+    template <typename CodeUnit, typename GetView>
+    SQLRETURN BindStagedStringColumn(SQLHSTMT stmt,
+                                     SQLUSMALLINT column,
+                                     std::size_t rowCount,
+                                     GetView const& viewAt,
+                                     SqlDataBinderCallback& cb) noexcept
+    {
+        static_assert(sizeof(CodeUnit) == 1 || sizeof(CodeUnit) == 2, "Bind as SQL_C_CHAR or SQL_C_WCHAR");
+        constexpr bool IsWide = sizeof(CodeUnit) == 2;
+
+        std::size_t maxLength = 0;
+        for (auto const i: std::views::iota(std::size_t { 0 }, rowCount))
+            if (auto const view = viewAt(i); view)
+                maxLength = (std::max) (maxLength, view->size());
+
+        auto const stride = (maxLength + 1) * sizeof(CodeUnit);
+        auto* const buffer = cb.ProvideBatchStagingBuffer(rowCount * stride);
+        auto* const indicators = cb.ProvideInputIndicators(rowCount);
+        for (auto const i: std::views::iota(std::size_t { 0 }, rowCount))
+        {
+            auto const view = viewAt(i);
+            if (!view)
+            {
+                indicators[i] = SQL_NULL_DATA;
+                continue;
+            }
+            auto const byteCount = view->size() * sizeof(CodeUnit);
+            if (byteCount != 0)
+                std::memcpy(buffer + (i * stride), view->data(), byteCount);
+            indicators[i] = static_cast<SQLLEN>(byteCount);
+        }
+
+        auto const sqlType = [&]() -> SQLSMALLINT {
+            if constexpr (IsWide)
+                return maxLength > SqlOptimalMaxColumnSize ? SQL_WLONGVARCHAR : SQL_WVARCHAR;
+            else
+                return maxLength > SqlOptimalMaxColumnSize ? SQL_LONGVARCHAR : SQL_VARCHAR;
+        }();
+
+        return SQLBindParameter(stmt,
+                                column,
+                                SQL_PARAM_INPUT,
+                                IsWide ? SQL_C_WCHAR : SQL_C_CHAR,
+                                sqlType,
+                                (std::max) (maxLength, std::size_t { 1 }),
+                                0,
+                                (SQLPOINTER) buffer,
+                                static_cast<SQLLEN>(stride),
+                                indicators);
+    }
+
+    /// Transcodes a batch of values to UTF-16 once, and stages them via @ref BindStagedStringColumn.
+    ///
+    /// @param valueAt Returns a pointer to the value of row @c i, or @c nullptr for NULL.
+    /// @param toUtf16 Converts one value to a @c std::u16string.
+    template <typename GetValue, typename ToUtf16Fn>
+    SQLRETURN BindStagedUtf16Column(SQLHSTMT stmt,
+                                    SQLUSMALLINT column,
+                                    std::size_t rowCount,
+                                    GetValue const& valueAt,
+                                    ToUtf16Fn const& toUtf16,
+                                    SqlDataBinderCallback& cb) noexcept
+    {
+        auto transcoded = std::vector<std::optional<std::u16string>>(rowCount);
+        for (auto const i: std::views::iota(std::size_t { 0 }, rowCount))
+            if (auto const* value = valueAt(i); value)
+                transcoded[i] = toUtf16(*value);
+
+        return BindStagedStringColumn<char16_t>(
+            stmt,
+            column,
+            rowCount,
+            [&](std::size_t i) -> std::optional<std::u16string_view> {
+                if (!transcoded[i])
+                    return std::nullopt;
+                return std::u16string_view { *transcoded[i] };
+            },
+            cb);
+    }
+
 } // namespace detail
 
 // SqlDataBinder<> specialization for ANSI character strings
@@ -265,7 +358,7 @@ struct SqlDataBinder<AnsiStringType>
     {
         size_t maxLen = 0;
         SQLLEN* indicators = cb.ProvideInputIndicators(rowCount);
-        for (size_t i = 0; i < rowCount; ++i)
+        for (auto const i: std::views::iota(0UZ, rowCount))
         {
             auto const len = StringTraits::Size(&values[i]);
             indicators[i] = static_cast<SQLLEN>(len);
@@ -287,6 +380,44 @@ struct SqlDataBinder<AnsiStringType>
                                 indicators);
     }
 
+    /// Binds a column of a column-wise staged batch (see @c SqlStatement::ExecuteBatch(rows, accessors...)).
+    ///
+    /// The values are copied into one fixed-stride buffer sized to the batch's longest value, so any
+    /// string type (heap-backed or inline) binds as a single parameter array. On PostgreSQL the batch is
+    /// transcoded to UTF-16 once, mirroring @ref InputParameter.
+    ///
+    /// @param valueAt Returns a pointer to the value of row @c i, or @c nullptr for NULL.
+    template <typename GetValue>
+    static SQLRETURN BatchStagedInputParameter(SQLHSTMT stmt,
+                                               SQLUSMALLINT column,
+                                               std::size_t rowCount,
+                                               GetValue const& valueAt,
+                                               SqlDataBinderCallback& cb) noexcept
+    {
+        if (cb.ServerType() == SqlServerType::POSTGRESQL)
+            return detail::BindStagedUtf16Column(
+                stmt,
+                column,
+                rowCount,
+                valueAt,
+                [](AnsiStringType const& value) {
+                    return ToUtf16(std::u8string_view { reinterpret_cast<char8_t const*>(StringTraits::Data(&value)),
+                                                        StringTraits::Size(&value) });
+                },
+                cb);
+
+        return detail::BindStagedStringColumn<char>(
+            stmt,
+            column,
+            rowCount,
+            [&](std::size_t i) -> std::optional<std::string_view> {
+                if (auto const* value = valueAt(i); value)
+                    return std::string_view { StringTraits::Data(value), StringTraits::Size(value) };
+                return std::nullopt;
+            },
+            cb);
+    }
+
     /// Binds an inline fixed-capacity string column of a native row-wise batch zero-copy.
     ///
     /// Only available for fixed-capacity string types (those exposing @c ::Capacity, e.g.
@@ -657,6 +788,30 @@ struct SqlDataBinder<Utf16StringType>
                                 indicator);
     }
 
+    /// Binds a column of a column-wise staged batch: the values are copied into one fixed-stride
+    /// buffer sized to the batch's longest value.
+    ///
+    /// @param valueAt Returns a pointer to the value of row @c i, or @c nullptr for NULL.
+    template <typename GetValue>
+    static SQLRETURN BatchStagedInputParameter(SQLHSTMT stmt,
+                                               SQLUSMALLINT column,
+                                               std::size_t rowCount,
+                                               GetValue const& valueAt,
+                                               SqlDataBinderCallback& cb) noexcept
+    {
+        using CharType = StringTraits::CharType;
+        return detail::BindStagedStringColumn<CharType>(
+            stmt,
+            column,
+            rowCount,
+            [&](std::size_t i) -> std::optional<std::basic_string_view<CharType>> {
+                if (auto const* value = valueAt(i); value)
+                    return std::basic_string_view<CharType> { StringTraits::Data(value), StringTraits::Size(value) };
+                return std::nullopt;
+            },
+            cb);
+    }
+
     static SQLRETURN OutputColumn(
         SQLHSTMT stmt, SQLUSMALLINT column, Utf16StringType* result, SQLLEN* indicator, SqlDataBinderCallback& cb) noexcept
     {
@@ -760,6 +915,26 @@ struct SqlDataBinder<Utf32StringType>
                                 indicator);
     }
 
+    /// Binds a column of a column-wise staged batch: the batch is transcoded to UTF-16 once and copied
+    /// into one fixed-stride buffer sized to its longest value.
+    ///
+    /// @param valueAt Returns a pointer to the value of row @c i, or @c nullptr for NULL.
+    template <typename GetValue>
+    static SQLRETURN BatchStagedInputParameter(SQLHSTMT stmt,
+                                               SQLUSMALLINT column,
+                                               std::size_t rowCount,
+                                               GetValue const& valueAt,
+                                               SqlDataBinderCallback& cb) noexcept
+    {
+        return detail::BindStagedUtf16Column(
+            stmt,
+            column,
+            rowCount,
+            valueAt,
+            [](Utf32StringType const& value) { return ToUtf16(detail::SqlViewHelper<Utf32StringType>::View(value)); },
+            cb);
+    }
+
     static SQLRETURN OutputColumn(
         SQLHSTMT stmt, SQLUSMALLINT column, Utf32StringType* result, SQLLEN* indicator, SqlDataBinderCallback& cb) noexcept
     {
@@ -18,13 +18,140 @@
     #include <uuid/uuid.h>
 #endif
 
+#include <algorithm>
+#include <array>
+#include <bit>
+#include <chrono>
+#include <functional>
 #include <memory>
 #include <random>
 #include <ranges>
+#include <span>
+#include <thread>
+#include <utility>
 
 namespace Lightweight
 {
 
+namespace
+{
+    /// Per-thread generator state for @ref SqlGuid::CreateSequential() and the portable
+    /// SqlGuid::Create() fallback, so that neither constructs a `std::random_device` per call nor
+    /// shares state (and therefore locks or atomics) between threads.
+    class GuidGenerator
+    {
+      public:
+        GuidGenerator() noexcept
+        {
+            // Mix in the thread id and clock so that threads still diverge should random_device
+            // be deterministic on some platform.
+            _state = static_cast<uint64_t>(std::chrono::steady_clock::now().time_since_epoch().count())
+                     ^ std::hash<std::thread::id> {}(std::this_thread::get_id()) ^ RandomDeviceSeed();
+        }
+
+        /// SplitMix64: fast, statistically sound, and needs a single word of state.
+        uint64_t Next() noexcept
+        {
+            auto z = (_state += 0x9E37'79B9'7F4A'7C15);
+            z = (z ^ (z >> 30)) * 0xBF58'476D'1CE4'E5B9;
+            z = (z ^ (z >> 27)) * 0x94D0'49BB'1331'11EB;
+            return z ^ (z >> 31);
+        }
+
+        /// Fills @p bytes with random bytes, one Next() value per 8 bytes.
+        void Fill(std::span<uint8_t> bytes) noexcept
+        {
+            for (auto const word: bytes | std::views::chunk(sizeof(uint64_t)))
+            {
+                auto const value = Next();
+                for (auto&& [index, byte]: std::views::enumerate(word))
+                    byte = static_cast<uint8_t>(value >> (8 * index));
+            }
+        }
+
+        /// Returns the millisecond timestamp and counter of the next sequential GUID of @p sequence.
+        ///
+        /// The counter restarts at a random value (with headroom) on every new millisecond, and when it
+        /// would overflow, the timestamp is advanced instead, so successive values strictly increase even
+        /// if the system clock stalls or steps backwards. Each sequence keeps its own clock, as their
+        /// counters differ in width.
+        std::pair<uint64_t, uint32_t> NextTick(SqlGuidSequence sequence, unsigned counterBits) noexcept
+        {
+            auto& [lastMillis, counter] = _ticks[static_cast<size_t>(sequence)];
+            auto const now = static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::milliseconds>(
+                                                       std::chrono::system_clock::now().time_since_epoch())
+                                                       .count());
+            auto const counterLimit = uint32_t { 1 } << counterBits;
+            if (now > lastMillis)
+            {
+                lastMillis = now;
+                counter = static_cast<uint32_t>(Next()) & ((counterLimit >> 1) - 1);
+            }
+            else if (++counter == counterLimit)
+            {
+                ++lastMillis;
+                counter = static_cast<uint32_t>(Next()) & ((counterLimit >> 1) - 1);
+            }
+            return { lastMillis, counter };
+        }
+
+      private:
+        /// Returns 64 bits from std::random_device, or 0 if no entropy source is available (the
+        /// clock/thread seed alone still yields unique GUIDs).
+        static uint64_t RandomDeviceSeed() noexcept
+        {
+            try
+            {
+                std::random_device rd;
+                return (uint64_t { rd() } << 32) | rd();
+            }
+            catch (...)
+            {
+                return 0;
+            }
+        }
+
+        struct Tick
+        {
+            uint64_t lastMillis {};
+            uint32_t counter {};
+        };
+
+        uint64_t _state {};
+        std::array<Tick, 2> _ticks {};
+    };
+
+    GuidGenerator& ThreadGuidGenerator() noexcept
+    {
+        thread_local GuidGenerator generator;
+        return generator;
+    }
+
+    // Sets the RFC 9562 variant bits (10xx) in byte 8.
+    constexpr void SetVariant(SqlGuid& guid) noexcept
+    {
+        guid.data[8] = (guid.data[8] & 0b0011'1111) | 0b1000'0000;
+    }
+
+    // Sets the version nibble in byte 6.
+    constexpr void SetVersion(SqlGuid& guid, uint8_t version) noexcept
+    {
+        guid.data[6] = static_cast<uint8_t>((guid.data[6] & 0b0000'1111) | (version << 4));
+    }
+
+    // Turns the big-endian Data1, Data2 and Data3 fields of @p guid into the host byte order of an SQLGUID.
+    void ToNativeFieldOrder(SqlGuid& guid) noexcept
+    {
+        if constexpr (std::endian::native == std::endian::little)
+        {
+            auto const bytes = std::span { guid.data };
+            std::ranges::reverse(bytes.first(4));
+            std::ranges::reverse(bytes.subspan(4, 2));
+            std::ranges::reverse(bytes.subspan(6, 2));
+        }
+    }
+} // namespace
+
 SqlGuid SqlGuid::Create() noexcept
 {
     SqlGuid guid {};
@@ -65,20 +192,57 @@ SqlGuid SqlGuid::Create() noexcept
 
 #else
 
-    std::random_device rd;
-    std::mt19937 gen(rd());
-    std::uniform_int_distribution<unsigned short> dis(0, 255);
+    ThreadGuidGenerator().Fill(guid.data);
+    SetVersion(guid, 4);
+    SetVariant(guid);
 
-    for (auto& byte: guid.data)
-        byte = static_cast<uint8_t>(dis(gen));
+#endif
+    return guid;
+}
 
-    // Set the version to 4
-    guid.data[6] = (guid.data[6] & 0b0000'1111) | 0b0100'0000;
+SqlGuid SqlGuid::CreateSequential(SqlGuidSequence sequence) noexcept
+{
+    auto& generator = ThreadGuidGenerator();
+    SqlGuid guid {};
 
-    // Set the variant to 2
-    guid.data[8] = (guid.data[8] & 0b0011'1111) | 0b1000'0000;
+    switch (sequence)
+    {
+        case SqlGuidSequence::UuidV7: {
+            // unix_ts_ms (48) | ver (4) | rand_a (12) | var (2) | rand_b (62)
+            // rand_a and the top 6 bits of rand_b carry an 18-bit per-thread counter (RFC 9562, method 1).
+            auto const [millis, counter] = generator.NextTick(sequence, 18);
+            generator.Fill(std::span { guid.data }.subspan(9));
+            for (auto const i: std::views::iota(0, 6))
+                guid.data[i] = static_cast<uint8_t>(millis >> (8 * (5 - i)));
+            guid.data[6] = static_cast<uint8_t>(counter >> 14);
+            guid.data[7] = static_cast<uint8_t>(counter >> 6);
+            guid.data[8] = static_cast<uint8_t>(counter & 0b0011'1111);
+            SetVersion(guid, 7);
+            SetVariant(guid);
+            break;
+        }
+        case SqlGuidSequence::SqlServer: {
+            // SQL Server compares bytes 10..15 first, then 8..9, then the rest: timestamp into 10..15,
+            // a 14-bit counter below the variant bits in 8..9, and random bytes everywhere else.
+            auto const [millis, counter] = generator.NextTick(sequence, 14);
+            generator.Fill(std::span { guid.data }.first(8));
+            for (auto const i: std::views::iota(0, 6))
+                guid.data[10 + i] = static_cast<uint8_t>(millis >> (8 * (5 - i)));
+            guid.data[8] = static_cast<uint8_t>(counter >> 8);
+            guid.data[9] = static_cast<uint8_t>(counter);
+            SetVersion(guid, 8);
+            SetVariant(guid);
+            break;
+        }
+    }
+    return guid;
+}
 
-#endif
+SqlGuid SqlGuid::CreateSequentialFor(SqlServerType serverType) noexcept
+{
+    auto guid = CreateSequential(SequenceFor(serverType));
+    if (SqlConnection::BindsGuidNatively(serverType))
+        ToNativeFieldOrder(guid);
     return guid;
 }
 
@@ -97,9 +261,9 @@ std::optional<SqlGuid> SqlGuid::TryParse(std::string_view const& text) noexcept
     if (text[8] != '-' || text[13] != '-' || text[18] != '-' || text[23] != '-')
         return std::nullopt;
 
-    // Version must be 1, 2, 3, 4, or 5
+    // Version must be 1 to 8 (RFC 9562)
     auto const version = text[14];
-    if (!('1' <= version && version <= '5'))
+    if (!('1' <= version && version <= '8'))
         return std::nullopt;
 
     // Variant nibble at position 19 must be a valid hex digit
@@ -3,16 +3,36 @@
 #pragma once
 
 #include "../SqlColumnTypeDefinitions.hpp"
+#include "../SqlConnection.hpp"
 #include "Core.hpp"
 
 #include <charconv>
 #include <format>
 #include <optional>
+#include <ranges>
 #include <string>
 
 namespace Lightweight
 {
 
+/// Byte layout of the time-ordered GUIDs produced by @ref SqlGuid::CreateSequential().
+///
+/// Random GUID keys scatter inserts across a clustered index. Sequential GUIDs place the creation
+/// timestamp in the bytes the database compares first, so consecutive inserts land on the same
+/// (last) index page.
+///
+/// @ingroup DataTypes
+enum class SqlGuidSequence : uint8_t
+{
+    /// RFC 9562 UUIDv7: 48-bit Unix millisecond timestamp in the leading bytes, big-endian.
+    /// Sorts by creation time wherever GUIDs are compared byte-wise or as text (e.g. SQLite).
+    UuidV7,
+
+    /// SQL Server `uniqueidentifier` sort order: the timestamp occupies the last six bytes, which
+    /// SQL Server compares first (the same scheme as `NEWSEQUENTIALID()`).
+    SqlServer,
+};
+
 /// Represents a GUID (Globally Unique Identifier).
 ///
 /// @ingroup DataTypes
@@ -24,6 +44,26 @@ struct LIGHTWEIGHT_API SqlGuid
     /// Creates a new non-empty GUID.
     static SqlGuid Create() noexcept;
 
+    /// Creates a new non-empty, time-ordered GUID for use as an index-friendly key.
+    ///
+    /// GUIDs created on the same thread strictly increase in the sort order of @p sequence; GUIDs
+    /// from different threads are ordered by their millisecond timestamp. Generation uses a
+    /// per-thread counter and random generator and never locks.
+    static SqlGuid CreateSequential(SqlGuidSequence sequence = SqlGuidSequence::UuidV7) noexcept;
+
+    /// Creates a new time-ordered GUID that @p serverType stores and sorts in creation order.
+    ///
+    /// Picks the layout with SequenceFor(). Where the driver binds GUIDs natively as @c SQLGUID
+    /// structs, whose Data1, Data2 and Data3 fields are native-endian, those fields are written in
+    /// host byte order, so the server sees the intended timestamp and version bits.
+    static SqlGuid CreateSequentialFor(SqlServerType serverType) noexcept;
+
+    /// Returns the sequential GUID layout that matches the GUID sort order of @p serverType.
+    static SqlGuidSequence SequenceFor(SqlServerType serverType) noexcept
+    {
+        return SqlConnection::SortsGuidsFromTheEnd(serverType) ? SqlGuidSequence::SqlServer : SqlGuidSequence::UuidV7;
+    }
+
     /// Parses a GUID from a string.
     static std::optional<SqlGuid> TryParse(std::string_view const& text) noexcept;
 
@@ -73,9 +113,9 @@ constexpr SqlGuid SqlGuid::UnsafeParse(std::string_view const& text) noexcept
     if (text[8] != '-' || text[13] != '-' || text[18] != '-' || text[23] != '-')
         return { "\x02" };
 
-    // Version must be 1, 2, 3, 4, or 5
+    // Version must be 1 to 8 (RFC 9562)
     auto const version = text[14];
-    if (!('1' <= version && version <= '5'))
+    if (!('1' <= version && version <= '8'))
         return { "\x03" };
 
     // Variant nibble at position 19 must be a valid hex digit
@@ -147,6 +187,46 @@ struct LIGHTWEIGHT_API SqlDataBinder<SqlGuid>
                                     SqlGuid const& value,
                                     SqlDataBinderCallback& cb) noexcept;
 
+    /// Binds a column of a column-wise staged batch: the GUIDs are copied into a contiguous array
+    /// (or, where GUIDs bind as text, formatted into fixed 36-character text slots, mirroring InputParameter).
+    ///
+    /// @param valueAt Returns a pointer to the value of row @c i, or @c nullptr for NULL.
+    template <typename GetValue>
+    static SQLRETURN BatchStagedInputParameter(SQLHSTMT stmt,
+                                               SQLUSMALLINT column,
+                                               std::size_t rowCount,
+                                               GetValue const& valueAt,
+                                               SqlDataBinderCallback& cb) noexcept
+    {
+        constexpr std::size_t TextLength = 36;
+        auto* const indicators = cb.ProvideInputIndicators(rowCount);
+
+        if (!SqlConnection::BindsGuidNatively(cb.ServerType()))
+        {
+            constexpr std::size_t Stride = TextLength + 1;
+            auto* const text = reinterpret_cast<char*>(cb.ProvideBatchStagingBuffer(rowCount * Stride));
+            for (auto const i: std::views::iota(0UZ, rowCount))
+            {
+                auto const* value = valueAt(i);
+                indicators[i] = value ? static_cast<SQLLEN>(TextLength) : SQLLEN { SQL_NULL_DATA };
+                if (value)
+                    std::format_to(text + (i * Stride), "{}", *value);
+            }
+            return SQLBindParameter(
+                stmt, column, SQL_PARAM_INPUT, SQL_C_CHAR, SQL_VARCHAR, TextLength, 0, (SQLPOINTER) text, Stride, indicators);
+        }
+
+        auto* const guids = reinterpret_cast<SqlGuid*>(cb.ProvideBatchStagingBuffer(rowCount * sizeof(SqlGuid)));
+        for (auto const i: std::views::iota(0UZ, rowCount))
+        {
+            auto const* value = valueAt(i);
+            indicators[i] = value ? SQLLEN { sizeof(SqlGuid) } : SQLLEN { SQL_NULL_DATA };
+            guids[i] = value ? *value : SqlGuid {};
+        }
+        return SQLBindParameter(
+            stmt, column, SQL_PARAM_INPUT, SQL_C_GUID, SQL_GUID, sizeof(SqlGuid), 0, (SQLPOINTER) guids, sizeof(SqlGuid), indicators);
+    }
+
     static SQLRETURN OutputColumn(
         SQLHSTMT stmt, SQLUSMALLINT column, SqlGuid* result, SQLLEN* indicator, SqlDataBinderCallback& cb) noexcept;
 
@@ -14,6 +14,7 @@
 #include <cstddef>
 #include <cstring>
 #include <format>
+#include <ranges>
 #include <source_location>
 #include <string>
 
@@ -347,6 +348,59 @@ struct SqlDataBinder<SqlNumeric<Precision, Scale>>
     }
 
 
+    /// Binds a column of a column-wise staged batch.
+    ///
+    /// Only the representation that @ref InputParameter would bind is copied into a contiguous array,
+    /// i.e. the doubles where native numeric support is broken, and the @c SQL_NUMERIC_STRUCT values
+    /// (with the type's Precision/Scale) everywhere else. Unlike the row-wise path, NULL rows are
+    /// supported, as the indicators are staged alongside.
+    ///
+    /// @param valueAt Returns a pointer to the value of row @c i, or @c nullptr for NULL.
+    template <typename GetValue>
+    static SQLRETURN BatchStagedInputParameter(SQLHSTMT stmt,
+                                               SQLUSMALLINT column,
+                                               std::size_t rowCount,
+                                               GetValue const& valueAt,
+                                               SqlDataBinderCallback& cb) noexcept
+    {
+        auto* const indicators = cb.ProvideInputIndicators(rowCount);
+        auto const stage = [&]<typename Staged>(auto const& project) -> Staged* {
+            auto* const staged = reinterpret_cast<Staged*>(cb.ProvideBatchStagingBuffer(rowCount * sizeof(Staged)));
+            for (auto const i: std::views::iota(0UZ, rowCount))
+            {
+                auto const* value = valueAt(i);
+                indicators[i] = value ? SQLLEN { 0 } : SQLLEN { SQL_NULL_DATA };
+                staged[i] = value ? project(*value) : Staged {};
+            }
+            return staged;
+        };
+
+        if (NativeNumericSupportIsBroken(cb.ServerType()))
+        {
+            auto* const values =
+                stage.template operator()<double>([](ValueType const& value) { return static_cast<double>(value.nativeValue); });
+            return SQLBindParameter(
+                stmt, column, SQL_PARAM_INPUT, SQL_C_DOUBLE, SQL_DOUBLE, 0, 0, (SQLPOINTER) values, sizeof(double), indicators);
+        }
+
+        auto* const values = stage.template operator()<SQL_NUMERIC_STRUCT>([](ValueType const& value) {
+            auto numeric = value.sqlValue;
+            numeric.precision = static_cast<SQLCHAR>(Precision);
+            numeric.scale = static_cast<SQLSCHAR>(Scale);
+            return numeric;
+        });
+        return SQLBindParameter(stmt,
+                                column,
+                                SQL_PARAM_INPUT,
+                                SQL_C_NUMERIC,
+                                SQL_NUMERIC,
+                                static_cast<SQLULEN>(Precision),
+                                static_cast<SQLSMALLINT>(Scale),
+                                (SQLPOINTER) values,
+                                sizeof(SQL_NUMERIC_STRUCT),
+                                indicators);
+    }
+
     static LIGHTWEIGHT_FORCE_INLINE SQLRETURN OutputColumn(
         SQLHSTMT stmt, SQLUSMALLINT column, ValueType* result, SQLLEN* indicator, SqlDataBinderCallback& cb) noexcept
     {
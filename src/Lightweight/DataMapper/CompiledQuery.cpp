@@ -0,0 +1,91 @@
+// SPDX-License-Identifier: Apache-2.0
+
+#include "CompiledQuery.hpp"
+
+#include <charconv>
+#include <format>
+#include <ranges>
+#include <stdexcept>
+
+namespace Lightweight
+{
+
+namespace
+{
+    // Delimits argument markers in the rendered statement; it cannot occur in SQL the builder renders.
+    constexpr char ArgumentMarkerDelimiter = '\x1e';
+} // namespace
+
+detail::RawSqlCondition detail::MakeCompiledQueryArgumentMarker(std::size_t index)
+{
+    return RawSqlCondition { std::format("{0}{1}{0}", ArgumentMarkerDelimiter, index) };
+}
+
+SqlCompiledQueryPlan detail::ResolveCompiledQueryPlan(std::string_view renderedQuery,
+                                                      std::vector<SqlVariant> renderedInputs,
+                                                      std::size_t argumentCount)
+{
+    auto plan = SqlCompiledQueryPlan {};
+    plan.query.reserve(renderedQuery.size());
+    plan.argumentMarkers.resize(argumentCount);
+
+    auto nextInput = renderedInputs.begin();
+    auto position = SQLSMALLINT { 0 };
+    auto quote = char { 0 };
+    auto resumeAt = std::size_t { 0 }; // past the argument marker just consumed
+    for (auto const i: std::views::iota(0UZ, renderedQuery.size()))
+    {
+        if (i < resumeAt)
+            continue;
+        auto const c = renderedQuery[i];
+
+        // Markers inside string literals or quoted identifiers are text. A doubled quote ends and
+        // immediately reopens the quoted section, which leaves the state right as well.
+        if (quote != 0)
+        {
+            if (c == quote)
+                quote = 0;
+            plan.query += c;
+            continue;
+        }
+
+        switch (c)
+        {
+            case '\'':
+            case '"':
+                quote = c;
+                plan.query += c;
+                break;
+            case '?':
+                if (nextInput == renderedInputs.end())
+                    throw std::invalid_argument { "Compiled query has more parameter markers than bound values" };
+                plan.constants.emplace_back(++position, std::move(*nextInput++));
+                plan.query += '?';
+                break;
+            case ArgumentMarkerDelimiter: {
+                auto const end = renderedQuery.find(ArgumentMarkerDelimiter, i + 1);
+                auto argument = std::size_t {};
+                if (end == std::string_view::npos
+                    || std::from_chars(renderedQuery.data() + i + 1, renderedQuery.data() + end, argument).ec != std::errc {}
+                    || argument >= argumentCount)
+                {
+                    throw std::invalid_argument { "Compiled query contains a malformed argument marker" };
+                }
+                plan.argumentMarkers[argument].push_back(++position);
+                plan.query += '?';
+                resumeAt = end + 1;
+                break;
+            }
+            default:
+                plan.query += c;
+                break;
+        }
+    }
+
+    if (nextInput != renderedInputs.end())
+        throw std::invalid_argument { "Compiled query has more bound values than parameter markers" };
+
+    return plan;
+}
+
+} // namespace Lightweight
@@ -0,0 +1,137 @@
+// SPDX-License-Identifier: Apache-2.0
+#pragma once
+
+#include "../Api.hpp"
+#include "../DataBinder/SqlVariant.hpp"
+#include "../SqlServerType.hpp"
+#include "QueryBuilders.hpp"
+
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <utility>
+#include <vector>
+
+namespace Lightweight
+{
+
+/// @ingroup DataMapper
+/// The statement a SqlCompiledQuery renders to on one database type.
+struct SqlCompiledQueryPlan
+{
+    /// The rendered statement, with a plain `?` for every parameter marker.
+    std::string query;
+    /// The 1-based marker positions bound to each call argument, indexed by argument.
+    std::vector<std::vector<SQLSMALLINT>> argumentMarkers;
+    /// The values the build function bound by itself, with their 1-based marker positions.
+    std::vector<std::pair<SQLSMALLINT, SqlVariant>> constants;
+};
+
+namespace detail
+{
+    /// What a compiled query's build function receives in place of its @p index-th call argument.
+    [[nodiscard]] LIGHTWEIGHT_API RawSqlCondition MakeCompiledQueryArgumentMarker(std::size_t index);
+
+    /// Splits a statement rendered with argument markers into its SQL text and its binding plan.
+    ///
+    /// @param renderedQuery  the statement as rendered by the query builder.
+    /// @param renderedInputs the values the query builder bound, one per plain `?` in @p renderedQuery.
+    /// @param argumentCount  the number of call arguments of the compiled query.
+    [[nodiscard]] LIGHTWEIGHT_API SqlCompiledQueryPlan ResolveCompiledQueryPlan(std::string_view renderedQuery,
+                                                                                std::vector<SqlVariant> renderedInputs,
+                                                                                std::size_t argumentCount);
+
+    template <typename>
+    using SqlCompiledQueryArgument = RawSqlCondition;
+} // namespace detail
+
+/// @ingroup DataMapper
+/// @brief A DataMapper query whose SQL is rendered once and then executed with typed arguments.
+///
+/// Created by @c DataMapper::Compile. The build function shapes the query on a DataMapper query
+/// builder, receiving a placeholder for each call argument, which it uses wherever a value would go.
+/// It runs once per database type; afterwards a call only binds its arguments (through their
+/// @c SqlDataBinder, without going through @c SqlVariant), executes and fetches. Re-executing the
+/// same compiled query on a DataMapper back to back also skips re-preparing the statement.
+///
+/// The build function must only shape the query, not execute it. Values it uses directly are bound
+/// as they were at compile time. Copies of a compiled query share their rendered statements, which
+/// may be used from several threads, each with its own DataMapper.
+///
+/// @code
+/// static auto const adultsNamed = dm.Compile<Person, int, std::string_view>([](auto& query, auto minAge, auto name) {
+///     return query.Where(FieldNameOf<&Person::age>, ">=", minAge).Where(FieldNameOf<&Person::name>, name);
+/// });
+/// auto const people = adultsNamed.All(dm, 18, "Alice");
+/// @endcode
+template <typename Record, DataMapperOptions QueryOptions, typename... Params>
+class SqlCompiledQuery
+{
+  public:
+    /// The query builder the build function shapes.
+    using Builder = SqlAllFieldsQueryBuilder<Record, QueryOptions>;
+
+    /// Shapes the query on the builder, given one placeholder per call argument.
+    using BuildFunction = std::function<void(Builder&, detail::SqlCompiledQueryArgument<Params> const&...)>;
+
+    /// Constructs a compiled query from its build function; see @c DataMapper::Compile.
+    explicit SqlCompiledQuery(BuildFunction build):
+        _state { std::make_shared<State>(std::move(build)) }
+    {
+    }
+
+    /// Executes the query with @p params and returns all records found.
+    [[nodiscard]] std::vector<Record> All(DataMapper& dm, Params const&... params) const;
+
+    /// Executes the query with @p params and returns the first record found, if any.
+    [[nodiscard]] std::optional<Record> First(DataMapper& dm, Params const&... params) const;
+
+    /// @return the statement that All() executes on the database type of @p dm, rendering it on first use.
+    [[nodiscard]] SqlCompiledQueryPlan const& AllPlan(DataMapper& dm) const
+    {
+        return PlanFor(dm, Shape::All);
+    }
+
+    /// @return the statement that First() executes on the database type of @p dm, rendering it on first use.
+    [[nodiscard]] SqlCompiledQueryPlan const& FirstPlan(DataMapper& dm) const
+    {
+        return PlanFor(dm, Shape::First);
+    }
+
+  private:
+    enum class Shape : std::uint8_t
+    {
+        All,
+        First,
+    };
+
+    static constexpr std::size_t ShapeCount = 2;
+    static constexpr std::size_t ServerTypeCount = static_cast<std::size_t>(SqlServerType::MYSQL) + 1;
+
+    struct State
+    {
+        explicit State(BuildFunction build):
+            build { std::move(build) }
+        {
+        }
+
+        BuildFunction build;
+        std::mutex mutex;
+        /// Rendered plans per database type and shape, published once rendered.
+        std::array<std::atomic<SqlCompiledQueryPlan const*>, ServerTypeCount * ShapeCount> plans {};
+        std::vector<std::unique_ptr<SqlCompiledQueryPlan const>> ownedPlans;
+    };
+
+    SqlCompiledQueryPlan const& PlanFor(DataMapper& dm, Shape shape) const;
+
+    std::shared_ptr<State> _state;
+};
+
+} // namespace Lightweight
@@ -2,14 +2,17 @@
 #pragma once
 
 #include "../Async/Backend.hpp"
+#include "../Async/Generator.hpp"
 #include "../SqlConnection.hpp"
 #include "../SqlDataBinder.hpp"
 #include "../SqlLogger.hpp"
 #include "../SqlRealName.hpp"
 #include "../SqlStatement.hpp"
+#include "../SqlTransaction.hpp"
 #include "../Utils.hpp"
 #include "BelongsTo.hpp"
 #include "CollectDifferences.hpp"
+#include "CompiledQuery.hpp"
 #include "CompositeForeignKey.hpp"
 #include "Field.hpp"
 #include "HasMany.hpp"
@@ -17,13 +20,22 @@
 #include "HasOneThrough.hpp"
 #include "QueryBuilders.hpp"
 #include "Record.hpp"
+#include "RecordCache.hpp"
 
 #include <reflection-cpp/reflection.hpp>
 
+#include <algorithm>
+#include <array>
+#include <bit>
 #include <cassert>
 #include <concepts>
 #include <memory>
+#include <optional>
 #include <ranges>
+#include <span>
+#include <stdexcept>
+#include <stop_token>
+#include <string>
 #include <tuple>
 #include <type_traits>
 #include <utility>
@@ -50,6 +62,25 @@ namespace detail
     }
 } // namespace detail
 
+/// Tuning of the chunked bulk deletes DataMapper::DeleteAll() and DataMapper::DeleteByIds().
+///
+/// @ingroup DataMapper
+struct DataMapperDeleteOptions
+{
+    /// Maximum number of keys deleted by one DELETE statement.
+    ///
+    /// Keys that cannot be bound as a single array parameter are additionally capped so that a
+    /// statement stays within the parameter limits of all supported backends.
+    std::size_t chunkSize { 1000 };
+
+    /// Commits after every this many chunks, bounding the lock footprint and transaction log growth
+    /// of large deletes; `0` leaves transaction handling to the caller.
+    ///
+    /// Only honoured when no transaction is active on the connection. Should a chunk fail, the chunks
+    /// since the last intermediate commit are rolled back.
+    std::size_t commitEveryChunks { 0 };
+};
+
 /// @brief Main API for mapping records to and from the database using high level C++ syntax.
 ///
 /// A DataMapper instances operates on a single SQL connection and provides methods to
@@ -122,7 +153,8 @@ class DataMapper
     /// Move constructor.
     DataMapper(DataMapper&& other) noexcept:
         _connection(std::move(other._connection)),
-        _stmt(_connection)
+        _stmt(_connection),
+        _identityMap(std::move(other._identityMap))
     {
         other._stmt = SqlStatement(std::nullopt);
     }
@@ -136,6 +168,7 @@ class DataMapper
         _connection = std::move(other._connection);
         _stmt = SqlStatement(_connection);
         other._stmt = SqlStatement(std::nullopt);
+        _identityMap = std::move(other._identityMap);
 
         return *this;
     }
@@ -154,6 +187,66 @@ class DataMapper
         return _connection;
     }
 
+    /// @brief A unit of work during which the DataMapper keeps an identity map, see BeginIdentityMap().
+    class IdentityMapScope
+    {
+      public:
+        IdentityMapScope(IdentityMapScope const&) = delete;
+        IdentityMapScope& operator=(IdentityMapScope const&) = delete;
+        IdentityMapScope& operator=(IdentityMapScope&&) = delete;
+
+        /// Move constructor.
+        IdentityMapScope(IdentityMapScope&& other) noexcept:
+            _dm { std::exchange(other._dm, nullptr) }
+        {
+        }
+
+        /// Ends the unit of work and drops the identity map, unless an outer scope is still active.
+        ~IdentityMapScope()
+        {
+            if (_dm)
+                _dm->_identityMap.reset();
+        }
+
+      private:
+        friend class DataMapper;
+
+        explicit IdentityMapScope(DataMapper* dm) noexcept:
+            _dm { dm }
+        {
+        }
+
+        DataMapper* _dm;
+    };
+
+    /// @brief Starts a unit of work in which records loaded by primary key are remembered.
+    ///
+    /// Until the returned scope is destroyed, QuerySingle() by primary key (and thereby the loading of
+    /// @c BelongsTo relations) returns a copy of the record it already loaded during the unit of work
+    /// instead of querying the database again. Update(), UpdateAll(), Delete(), DeleteAll() and
+    /// DeleteByIds() drop the affected records. Nested calls share the outermost unit of work.
+    ///
+    /// @code
+    /// {
+    ///     auto const unitOfWork = dm.BeginIdentityMap();
+    ///     for (auto const& order: orders)
+    ///         Print(dm.QuerySingle<Customer>(order.customer.Value())); // each customer is read once
+    /// }
+    /// @endcode
+    [[nodiscard]] IdentityMapScope BeginIdentityMap()
+    {
+        if (_identityMap)
+            return IdentityMapScope { nullptr };
+        _identityMap = std::make_unique<RecordIdentityMap>();
+        return IdentityMapScope { this };
+    }
+
+    /// @return the lookup counters of the current unit of work, all zero if none is active.
+    [[nodiscard]] RecordCacheStatistics IdentityMapStatistics() const noexcept
+    {
+        return _identityMap ? _identityMap->Statistics() : RecordCacheStatistics {};
+    }
+
 #if defined(BUILD_TESTS)
 
     [[nodiscard]] SqlStatement& Statement(this auto&& self) noexcept
@@ -209,13 +302,15 @@ class DataMapper
     /// The INSERT is prepared once and the whole batch is submitted via
     /// SqlStatement::ExecuteBatch(rows, accessors...), which uses native zero-copy row-wise array
     /// binding when every inserted column is row-bindable (primitives, date/time/datetime, numeric, or
-    /// std::optional of a fixed non-numeric type) and the driver supports parameter arrays, otherwise a
-    /// prepare-once + per-row execute. This is dramatically faster than calling CreateExplicit() in a
-    /// loop (which re-prepares per row).
+    /// std::optional of a fixed non-numeric type) and the driver supports parameter arrays. Records with
+    /// variable-length columns (strings, GUIDs, nullable columns) are staged column by column and still
+    /// submitted in a single execute, unless a string exceeds SqlOptimalMaxColumnSize, in which case a
+    /// prepare-once + per-row execute is used. This is dramatically faster than calling CreateExplicit()
+    /// in a loop (which re-prepares per row).
     ///
     /// @note Like CreateExplicit(), this does not write back primary keys, relations, or modified-state
     /// onto the records; callers should treat the inserted records as write-only inputs. Auto-increment
-    /// primary keys are not retrieved.
+    /// primary keys are not retrieved; use CreateAllReturningIds() when they are needed.
     ///
     /// Accepts any contiguous, sized range of records (e.g. std::vector, std::array, std::span, or a C
     /// array), so `dm.CreateAll(records)` works without an explicit std::span wrapper. Non-contiguous
@@ -226,6 +321,45 @@ class DataMapper
     template <std::ranges::range Records>
     void CreateAll(Records const& records);
 
+    /// @brief Batch-inserts a span of records and writes their primary keys back, like Create() per record.
+    ///
+    /// Auto-assigned keys (GUIDs, or MAX+1 for integers — queried once for the whole batch and skipping the
+    /// keys set explicitly in the batch) are generated up front. Server-side auto-increment keys are read back in the same statement via
+    /// `INSERT ... RETURNING` (PostgreSQL, SQLite >= 3.35) or `OUTPUT INSERTED` (SQL Server): on SQL Server
+    /// the whole batch is one parameter-array execute, elsewhere the INSERT is prepared once and executed
+    /// per record (see SqlStatement::ExecuteBatchReturning). Only when the backend cannot return generated
+    /// values does this fall back to an INSERT plus a LastInsertId() query per record.
+    ///
+    /// Every record's primary key is set, its modified state is reset, and (per @p QueryOptions) its
+    /// relations are configured for auto-loading, exactly as Create() does.
+    ///
+    /// @note On SQL Server, `OUTPUT INSERTED` without `INTO` is rejected for tables with enabled triggers.
+    ///
+    /// @tparam QueryOptions A specialization of DataMapperOptions that controls query behavior.
+    /// @tparam Records A contiguous, sized range of mutable records with a primary key.
+    /// @param records The records to insert. An empty range is a no-op.
+    /// @return The primary keys of the inserted records, in the order of @p records.
+    template <DataMapperOptions QueryOptions = {}, std::ranges::range Records>
+    std::vector<RecordPrimaryKeyType<std::remove_cvref_t<std::ranges::range_value_t<Records>>>> CreateAllReturningIds(
+        Records&& records);
+
+    /// @brief Inserts a parent/child object graph parent-first: all @p parents, then all @p children,
+    /// each child's `BelongsTo<>` referencing the parent record type set to its parent's new key.
+    ///
+    /// @code
+    /// auto users = std::vector<User> { ... };
+    /// auto emails = std::vector<Email> { ... };
+    /// // emailOwner[i] is the index into `users` of the owner of emails[i].
+    /// dm.CreateAllReturningIds(users, emails, [&](Email const&, std::size_t i) { return emailOwner[i]; });
+    /// @endcode
+    ///
+    /// @param parents The parent records; keys are written back as by CreateAllReturningIds(records).
+    /// @param children The child records; keys are written back likewise.
+    /// @param parentIndexOf Maps (child, child index) to the index of its parent within @p parents.
+    template <DataMapperOptions QueryOptions = {}, std::ranges::range Parents, std::ranges::range Children, typename ParentIndexOf>
+        requires std::invocable<ParentIndexOf const&, std::ranges::range_value_t<Children> const&, std::size_t>
+    void CreateAllReturningIds(Parents&& parents, Children&& children, ParentIndexOf const& parentIndexOf);
+
     /// @brief Creates a copy of an existing record in the database.
     ///
     /// This method is useful for duplicating a database record while assigning a new primary key.
@@ -263,6 +397,23 @@ class DataMapper
     template <typename Record, DataMapperOptions QueryOptions = {}, typename... PrimaryKeyTypes>
     std::optional<Record> QuerySingle(PrimaryKeyTypes&&... primaryKeys);
 
+    /// @brief Reads the given fields of @p record from its row, identified by its primary key.
+    ///
+    /// Meant for fields a partial-column query left unloaded (see SqlCoreDataMapperQueryBuilder::Only),
+    /// typically large text or binary columns that are only needed for some of the records.
+    /// The fields read are marked as loaded and not modified; other fields are left untouched.
+    ///
+    /// @return false if the row no longer exists, in which case @p record is left unchanged.
+    ///
+    /// @code
+    /// for (auto& user: dm.Query<User>().Only<&User::id, &User::name>().All())
+    ///     if (user.name.Value() == "Alice" && dm.LoadFields<&User::bio, &User::avatar>(user))
+    ///         Show(user.bio.Value(), user.avatar.Value());
+    /// @endcode
+    template <auto... ReferencedFields, typename Record>
+        requires(sizeof...(ReferencedFields) >= 1)
+    bool LoadFields(Record& record);
+
     /// Queries multiple records from the database, based on the given query.
     ///
     /// @tparam Record          The record type to query and materialize.
@@ -428,6 +579,36 @@ class DataMapper
             *this, BuildFullyQualifiedFieldList<Record>());
     }
 
+    /// Compiles a query on @p Record that takes call arguments of types @p Params.
+    ///
+    /// The SQL is rendered once per database type instead of on every call, and the arguments are
+    /// bound by their own types, see SqlCompiledQuery. The statement for this DataMapper's database
+    /// type is rendered right away, so a build function that cannot render fails here.
+    ///
+    /// @code
+    /// static auto const byAge = dm.Compile<Person, int>([](auto& query, auto age) {
+    ///     return query.Where(FieldNameOf<&Person::age>, "=", age).OrderBy(FieldNameOf<&Person::name>);
+    /// });
+    /// for (auto const age: ages)
+    ///     Print(byAge.All(dm, age));
+    /// @endcode
+    template <typename Record, typename... Params>
+    [[nodiscard]] SqlCompiledQuery<Record, DataMapperOptions {}, Params...> Compile(
+        typename SqlCompiledQuery<Record, DataMapperOptions {}, Params...>::BuildFunction build)
+    {
+        return Compile<Record, DataMapperOptions {}, Params...>(std::move(build));
+    }
+
+    /// Compiles a query on @p Record with the given @p QueryOptions. @see Compile
+    template <typename Record, DataMapperOptions QueryOptions, typename... Params>
+    [[nodiscard]] SqlCompiledQuery<Record, QueryOptions, Params...> Compile(
+        typename SqlCompiledQuery<Record, QueryOptions, Params...>::BuildFunction build)
+    {
+        auto compiled = SqlCompiledQuery<Record, QueryOptions, Params...> { std::move(build) };
+        std::ignore = compiled.AllPlan(*this);
+        return compiled;
+    }
+
     /// Returns a SqlQueryBuilder using the default query formatter.
     ///
     /// This can be used to build custom queries separately from the DataMapper
@@ -462,7 +643,8 @@ class DataMapper
     /// One UPDATE is prepared that writes **all** storable non-primary-key columns of the record,
     /// matched on the primary key(s) (`UPDATE … SET <all non-PK columns> WHERE <pk> = ?`), and the whole
     /// batch is submitted via SqlStatement::ExecuteBatch(rows, accessors...) — natively row-wise when
-    /// possible, otherwise prepare-once + per-row execute.
+    /// possible, as column-wise staged parameter arrays for string/GUID/nullable columns, otherwise
+    /// prepare-once + per-row execute (see CreateAll).
     ///
     /// @note Unlike Update(), which writes only the modified fields of a single record, this writes a
     /// uniform set of columns for every row, because a single prepared statement must bind the same
@@ -486,6 +668,33 @@ class DataMapper
     template <typename Record>
     std::size_t Delete(Record const& record);
 
+    /// @brief Deletes @p records, identified by their primary key(s), with one DELETE per chunk of keys.
+    ///
+    /// Each statement removes up to DataMapperDeleteOptions::chunkSize records. A single integer or
+    /// string primary key is bound as one array parameter (see SqlQueryFormatter::InArrayParameter);
+    /// any other key, including a composite one, expands to `"pk" IN (?, ...)` respectively
+    /// `("k1" = ? AND "k2" = ?) OR ...`, with the chunk padded to a power of two so that only a few
+    /// distinct statements get prepared.
+    ///
+    /// @param records The records to delete. An empty range is a no-op.
+    /// @param options Chunk size and intermediate commits.
+    /// @return The number of rows deleted.
+    template <std::ranges::input_range Records>
+    std::size_t DeleteAll(Records const& records, DataMapperDeleteOptions const& options = {});
+
+    /// @brief Deletes the records of type @p Record whose primary key is one of @p ids.
+    ///
+    /// The elements of @p ids are primary key values or, for a composite key, tuples of them in
+    /// member declaration order (see RecordPrimaryKeyTuple). Chunking is as for DeleteAll().
+    ///
+    /// @code
+    /// auto const deleted = dm.DeleteByIds<Person>(expiredIds, { .commitEveryChunks = 10 });
+    /// @endcode
+    ///
+    /// @return The number of rows deleted.
+    template <typename Record, std::ranges::input_range Ids>
+    std::size_t DeleteByIds(Ids const& ids, DataMapperDeleteOptions const& options = {});
+
     /// Constructs an SQL query builder for the given table name.
     SqlQueryBuilder FromTable(std::string_view tableName)
     {
@@ -542,6 +751,32 @@ class DataMapper
     template <typename T>
     [[nodiscard]] std::optional<T> Execute(std::string_view sqlQueryString);
 
+    /// Runs several independent SELECTs in as few round-trips as the connection allows.
+    ///
+    /// If the connection supports multi-result batches (@c SqlConnection::SupportsMultiResultBatch),
+    /// all queries are sent as one batch and its result sets are distributed, in order, into the
+    /// returned vectors. Otherwise the queries run one after another on this connection.
+    ///
+    /// @code
+    /// auto [people, emails] = dm.QueryMany(dm.Query<Person>().Where(FieldNameOf<&Person::age>, ">", 30),
+    ///                                      dm.Query<Email>().Where(FieldNameOf<&Email::verified>, "=", true));
+    /// @endcode
+    ///
+    /// @param builders Query builders (e.g. from @c Query<Record>()) whose @c All() result is wanted.
+    /// @return One vector of records per builder, in argument order.
+    template <typename... Builders>
+        requires(sizeof...(Builders) >= 1 && (SqlSelectRenderer<Builders> && ...))
+    [[nodiscard]] auto QueryMany(Builders const&... builders)
+    {
+        return QueryMany(builders.RenderAll()...);
+    }
+
+    /// Runs several already rendered SELECTs in as few round-trips as the connection allows.
+    /// @see QueryMany(Builders const&...)
+    template <typename... Records, DataMapperOptions... QueryOptions>
+    [[nodiscard]] std::tuple<std::vector<Records>...> QueryMany(
+        SqlRenderedSelect<Records, QueryOptions> const&... queries);
+
     // --------------------------------------------------------------------------------------------
     // Asynchronous (C++23 coroutine) API.
     //
@@ -582,7 +817,44 @@ class DataMapper
     template <typename Record>
     [[nodiscard]] Async::Task<void> LoadRelationsAsync(Record& record);
 
+    /// Asynchronously runs several independent SELECTs as one offloaded step. @see QueryMany.
+    ///
+    /// On a connection that supports multi-result batches this is a single round-trip; otherwise the
+    /// queries run back to back in that one step. To spread them across connections instead, use
+    /// @c Pool::QueryManyAsync. The queries are rendered when this is called, so the builders may be
+    /// temporaries.
+    ///
+    /// @code
+    /// auto [people, emails] = co_await dm.QueryManyAsync(dm.QueryAsync<Person>(), dm.QueryAsync<Email>());
+    /// @endcode
+    template <typename... Builders>
+        requires(sizeof...(Builders) >= 1 && (SqlSelectRenderer<Builders> && ...))
+    [[nodiscard]] auto QueryManyAsync(Builders const&... builders)
+    {
+        return QueryManyAsync(builders.RenderAll()...);
+    }
+
+    /// Asynchronously runs several already rendered SELECTs as one offloaded step. @see QueryMany.
+    template <typename... Records, DataMapperOptions... QueryOptions>
+    [[nodiscard]] Async::Task<std::tuple<std::vector<Records>...>> QueryManyAsync(
+        SqlRenderedSelect<Records, QueryOptions>... queries);
+
   private:
+    template <typename Record, typename Derived, DataMapperOptions QueryOptions>
+    friend class SqlCoreDataMapperQueryBuilder;
+
+    template <typename Record, DataMapperOptions QueryOptions, typename... Params>
+    friend class SqlCompiledQuery;
+
+    /// Binds @p params and the plan's own values, and executes the statement of @p plan.
+    template <typename... Params>
+    SqlResultCursor ExecuteCompiledQuery(SqlCompiledQueryPlan const& plan, Params const&... params);
+
+    /// Deletes the rows of @p Record matching @p keys, chunked as described at DeleteAll().
+    template <typename Record>
+    std::size_t DeleteByPrimaryKeys(std::span<RecordPrimaryKeyTuple<Record> const> keys,
+                                    DataMapperDeleteOptions const& options);
+
     /// Builds the comma-separated, fully-qualified (`"Table"."Column"`) field list for @p Record.
     ///
     /// Shared by @c Query and @c QueryAsync so the SELECT projection is produced in exactly one place.
@@ -717,6 +989,27 @@ class DataMapper
     template <typename Record>
     std::optional<RecordPrimaryKeyType<Record>> GenerateAutoAssignPrimaryKey(Record const& record);
 
+    /// Reads the record identified by @p primaryKeys from the database, bypassing all caches.
+    template <typename Record, typename... PrimaryKeyTypes>
+    std::optional<Record> QuerySingleUncached(PrimaryKeyTypes&&... primaryKeys);
+
+    /// Looks @p key up in the identity map, then in the RecordCache if @p Record is enabled there.
+    template <typename Record>
+    std::shared_ptr<void const> FindCachedRecord(std::string const& key);
+
+    /// Remembers the freshly read @p record in the identity map and the RecordCache, where active.
+    /// The RecordCache skips it if @p key was invalidated since its @p generation was taken.
+    template <typename Record>
+    void StoreCachedRecord(std::string const& key, Record const& record, std::uint64_t generation);
+
+    /// Drops the record identified by @p keys from the identity map and the RecordCache.
+    template <typename Record>
+    void InvalidateCachedRecord(RecordPrimaryKeyTuple<Record> const& keys);
+
+    /// Drops all records of @p Record from the identity map and the RecordCache.
+    template <typename Record>
+    void InvalidateCachedTable();
+
     template <PrimaryKeySource UsePkOverride, typename Record>
     RecordPrimaryKeyType<Record> CreateInternal(
         Record const& record,
@@ -725,6 +1018,7 @@ class DataMapper
 
     SqlConnection _connection;
     SqlStatement _stmt;
+    std::unique_ptr<RecordIdentityMap> _identityMap;
 };
 
 // ------------------------------------------------------------------------------------------------
@@ -1077,6 +1371,85 @@ namespace detail
             reader, record, indexFromQuery);
     }
 
+    /// The members a partial-column query (see SqlCoreDataMapperQueryBuilder::Only) reads, in member
+    /// order: @p ReferencedFields plus the primary key, so the records read can still be updated or deleted.
+    template <typename Record, auto... ReferencedFields>
+    struct ProjectedMembers
+    {
+        template <size_t I>
+        static constexpr bool IsSelected =
+            IsPrimaryKey<RecordMemberTypeOf<I, Record>> || ((I == MemberIndexOf<ReferencedFields>) || ...);
+
+        static constexpr auto Indices = []<size_t... I>(std::index_sequence<I...>) consteval {
+            auto indices = std::array<size_t, (0UZ + ... + size_t { IsSelected<I> })> {};
+            auto count = 0UZ;
+            ((IsSelected<I> ? void(indices[count++] = I) : void()), ...);
+            return indices;
+        }(std::make_index_sequence<RecordMemberCount<Record>> {});
+
+        template <size_t... J>
+        static auto MakeMask(std::index_sequence<J...>) -> std::integer_sequence<size_t, Indices[J]...>;
+
+        /// The element mask of the members read, for GetAllColumns.
+        using Mask = decltype(MakeMask(std::make_index_sequence<Indices.size()> {}));
+
+        // Each column is written as "Table"."Field", separated by ", ".
+        static constexpr auto StorageSize = []<size_t... J>(std::index_sequence<J...>) consteval {
+            return (2 * (sizeof...(J) - 1))
+                   + (0UZ + ... + (RecordTableName<Record>.size() + FieldNameAt<Indices[J], Record>.size() + 5));
+        }(std::make_index_sequence<Indices.size()> {});
+
+        static constexpr auto Storage = []<size_t... J>(std::index_sequence<J...>) consteval {
+            using namespace std::string_view_literals;
+            constexpr auto TableName = RecordTableName<Record>;
+            auto storage = std::array<char, StorageSize> {};
+            auto out = storage.begin();
+            (
+                [&] {
+                    if (out != storage.begin())
+                        out = std::ranges::copy(", "sv, out).out;
+                    out = std::ranges::copy("\""sv, out).out;
+                    out = std::ranges::copy(TableName, out).out;
+                    out = std::ranges::copy("\".\""sv, out).out;
+                    out = std::ranges::copy(FieldNameAt<Indices[J], Record>, out).out;
+                    out = std::ranges::copy("\""sv, out).out;
+                }(),
+                ...);
+            return storage;
+        }(std::make_index_sequence<Indices.size()> {});
+
+        /// The fully qualified, comma-joined column list of the members read.
+        static constexpr auto Fields = std::string_view { Storage.data(), Storage.size() };
+    };
+
+    /// Marks the fields of @p record as loaded if a partial-column query on @p ReferencedFields reads
+    /// them, and as not loaded otherwise; either way as not modified.
+    template <typename Record, auto... ReferencedFields>
+    void MarkLoadedFields(Record& record) noexcept
+    {
+        EnumerateRecordMembers(record, []<size_t I, typename FieldType>(FieldType& field) {
+            if constexpr (requires { field.SetLoaded(false); })
+                field.SetLoaded(ProjectedMembers<Record, ReferencedFields...>::template IsSelected<I>);
+            if constexpr (requires { field.SetModified(false); })
+                field.SetModified(false);
+        });
+    }
+
+    /// Reads the next row of a partial-column query (see SqlCoreDataMapperQueryBuilder::Only) into
+    /// @p record, whose other fields are marked as not loaded.
+    ///
+    /// @return false at the end of the result set.
+    template <typename Record, auto... ReferencedFields>
+    bool ReadProjectedRecord(SqlResultCursor& reader, Record& record)
+    {
+        if (!reader.FetchRow())
+            return false;
+
+        GetAllColumns<typename ProjectedMembers<Record, ReferencedFields...>::Mask>(reader, record);
+        MarkLoadedFields<Record, ReferencedFields...>(record);
+        return true;
+    }
+
     template <typename FirstRecord, typename SecondRecord>
     // TODO we need to remove this at some points and provide generic bindings for tuples
     void GetAllColumns(SqlResultCursor& reader, std::tuple<FirstRecord, SecondRecord>& record)
@@ -1106,8 +1479,152 @@ namespace detail
 
         return true;
     }
+
+    /// Generator body behind @c SqlCoreDataMapperQueryBuilder::Stream.
+    ///
+    /// Executes the already rendered @p query and then fetches up to @p blockRows records per offloaded
+    /// step. The statement and its cursor live in the coroutine frame between blocks but are only ever
+    /// touched on the connection's strand. Takes the DataMapper and backend by pointer so the frame
+    /// holds no reference parameters.
+    template <typename Record, DataMapperOptions QueryOptions>
+    Async::Generator<std::vector<Record>> StreamRecords(DataMapper* dm,
+                                                        Async::IAsyncBackend* asyncBackend,
+                                                        std::string query,
+                                                        std::vector<SqlVariant> inputs,
+                                                        size_t blockRows,
+                                                        std::stop_token token)
+    {
+        auto& backend = *asyncBackend;
+        blockRows = std::max<size_t>(blockRows, 1);
+
+        auto stmt = std::optional<SqlStatement> {};
+        auto reader = std::optional<SqlResultCursor> {};
+        co_await Async::RunAsync(
+            backend,
+            [&] {
+                stmt.emplace(dm->Connection());
+                stmt->Prepare(query);
+                reader.emplace(stmt->ExecuteWithVariants(inputs));
+            },
+            token);
+
+        auto exhausted = false;
+        while (!exhausted)
+        {
+            if (token.stop_requested())
+            {
+                co_await Async::RunAsync(backend, [&] {
+                    reader.reset();
+                    stmt.reset();
+                });
+                throw Async::OperationCancelledError {};
+            }
+
+            auto block = co_await Async::RunAsync(backend, [&] {
+                auto const serverType = stmt->Connection().ServerType();
+                auto records = std::vector<Record> {};
+                records.reserve(blockRows);
+                while (records.size() < blockRows)
+                {
+                    Record& record = records.emplace_back();
+                    if (!ReadSingleResult(serverType, *reader, record))
+                    {
+                        records.pop_back();
+                        break;
+                    }
+                }
+                // Relations are configured once the block is complete, as they may capture record addresses.
+                if constexpr (QueryOptions.loadRelations)
+                {
+                    for (auto& record: records)
+                        dm->ConfigureRelationAutoLoading(record);
+                }
+                return records;
+            });
+
+            exhausted = block.size() < blockRows;
+            if (!block.empty())
+                co_yield std::move(block);
+        }
+
+        co_await Async::RunAsync(backend, [&] {
+            reader.reset();
+            stmt.reset();
+        });
+    }
+
+    /// Reads the current result set of @p reader to its end.
+    template <typename Record, DataMapperOptions QueryOptions>
+    std::vector<Record> ReadResultSet(DataMapper& dm, SqlServerType serverType, SqlResultCursor& reader)
+    {
+        auto records = std::vector<Record> {};
+        while (true)
+        {
+            Record& record = records.emplace_back();
+            if (!ReadSingleResult(serverType, reader, record))
+            {
+                records.pop_back();
+                break;
+            }
+        }
+        if constexpr (QueryOptions.loadRelations)
+        {
+            for (auto& record: records)
+                dm.ConfigureRelationAutoLoading(record);
+        }
+        return records;
+    }
+
+    /// Advances @p reader to its next result set (unless @p isFirst) and reads it.
+    template <typename Record, DataMapperOptions QueryOptions>
+    std::vector<Record> ReadNextResultSet(DataMapper& dm, SqlServerType serverType, SqlResultCursor& reader, bool& isFirst)
+    {
+        if (!std::exchange(isFirst, false) && !reader.NextResultSet())
+            throw std::runtime_error { "QueryMany: the batch returned fewer result sets than it has queries." };
+        return ReadResultSet<Record, QueryOptions>(dm, serverType, reader);
+    }
+
+    /// Runs one rendered SELECT on its own statement.
+    template <typename Record, DataMapperOptions QueryOptions>
+    std::vector<Record> RunRenderedSelect(DataMapper& dm, SqlRenderedSelect<Record, QueryOptions> const& query)
+    {
+        auto stmt = SqlStatement { dm.Connection() };
+        stmt.Prepare(query.query);
+        auto reader = stmt.ExecuteWithVariants(query.inputs);
+        return ReadResultSet<Record, QueryOptions>(dm, stmt.Connection().ServerType(), reader);
+    }
 } // namespace detail
 
+template <typename... Records, DataMapperOptions... QueryOptions>
+std::tuple<std::vector<Records>...> DataMapper::QueryMany(SqlRenderedSelect<Records, QueryOptions> const&... queries)
+{
+    if constexpr (sizeof...(Records) > 1)
+    {
+        if (_connection.SupportsMultiResultBatch())
+        {
+            // One round-trip: send every SELECT as one batch and walk its result sets in order.
+            auto batch = std::string {};
+            auto inputs = std::vector<SqlVariant> {};
+            ((batch += queries.query, batch += ";\n", inputs.insert(inputs.end(), queries.inputs.begin(), queries.inputs.end())),
+             ...);
+
+            auto stmt = SqlStatement { _connection };
+            stmt.Prepare(batch);
+            auto reader = stmt.ExecuteWithVariants(inputs);
+            stmt.KeepPendingResultSets();
+
+            // Braced initialization evaluates left to right, so result sets are consumed in query order.
+            auto const serverType = _connection.ServerType();
+            auto isFirst = true;
+            return std::tuple<std::vector<Records>...> {
+                detail::ReadNextResultSet<Records, QueryOptions>(*this, serverType, reader, isFirst)...
+            };
+        }
+    }
+
+    return std::tuple<std::vector<Records>...> { detail::RunRenderedSelect<Records, QueryOptions>(*this, queries)... };
+}
+
 template <typename Record, typename Derived, DataMapperOptions QueryOptions>
 template <typename Finisher>
 auto SqlCoreDataMapperQueryBuilder<Record, Derived, QueryOptions>::RunFinisher(Finisher finisher)
@@ -1177,6 +1694,61 @@ void SqlCoreDataMapperQueryBuilder<Record, Derived, QueryOptions>::DeleteImpl()
 
     stmt.Prepare(query);
     [[maybe_unused]] auto cursor = stmt.ExecuteWithVariants(_boundInputs);
+
+    // Which rows matched is unknown here, so every cached record of the table goes.
+    if constexpr (DataMapperRecord<Record>)
+        _dm.template InvalidateCachedTable<Record>();
+}
+
+template <typename Record, typename Derived, DataMapperOptions QueryOptions>
+Async::Generator<std::vector<Record>> SqlCoreDataMapperQueryBuilder<Record, Derived, QueryOptions>::StreamImpl(
+    size_t blockRows, std::stop_token token)
+{
+    // Render the query and resolve the backend eagerly: the builder is usually a temporary that dies
+    // before the first block, and a missing EnableAsync() should fail at the call site like the other
+    // async finishers.
+    auto rendered = RenderAll();
+    return detail::StreamRecords<Record, QueryOptions>(&_dm,
+                                                       &_dm.Connection().AsyncBackend(),
+                                                       std::move(rendered.query),
+                                                       std::move(rendered.inputs),
+                                                       blockRows,
+                                                       std::move(token));
+}
+
+template <typename Record, typename Derived, DataMapperOptions QueryOptions>
+void SqlCoreDataMapperQueryBuilder<Record, Derived, QueryOptions>::ReadRecords(SqlResultCursor reader,
+                                                                               std::vector<Record>* records) const
+{
+    if (!_projectedReader)
+    {
+        Derived::ReadResults(_dm.Connection().ServerType(), std::move(reader), records);
+        return;
+    }
+
+    while (true)
+    {
+        auto& record = records->emplace_back();
+        if (!_projectedReader(reader, record))
+        {
+            records->pop_back();
+            break;
+        }
+    }
+}
+
+template <typename Record, typename Derived, DataMapperOptions QueryOptions>
+void SqlCoreDataMapperQueryBuilder<Record, Derived, QueryOptions>::ReadRecord(SqlResultCursor reader,
+                                                                              std::optional<Record>* record) const
+{
+    if (!_projectedReader)
+    {
+        Derived::ReadResult(_dm.Connection().ServerType(), std::move(reader), record);
+        return;
+    }
+
+    if (!_projectedReader(reader, record->emplace()))
+        record->reset();
 }
 
 template <typename Record, typename Derived, DataMapperOptions QueryOptions>
@@ -1186,14 +1758,14 @@ std::vector<Record> SqlCoreDataMapperQueryBuilder<Record, Derived, QueryOptions>
     auto records = std::vector<Record> {};
     auto stmt = SqlStatement { _dm.Connection() };
     stmt.Prepare(_formatter.SelectAll(this->_query.distinct,
-                                      _fields,
+                                      SelectedFields(),
                                       RecordTableName<Record>,
                                       this->_query.searchCondition.tableAlias,
                                       this->_query.searchCondition.tableJoins,
                                       this->_query.searchCondition.condition,
                                       this->_query.orderBy,
                                       this->_query.groupBy));
-    Derived::ReadResults(stmt.Connection().ServerType(), stmt.ExecuteWithVariants(_boundInputs), &records);
+    ReadRecords(stmt.ExecuteWithVariants(_boundInputs), &records);
     if constexpr (DataMapperRecord<Record>)
     {
         // This can be called when record type is not plain aggregate type
@@ -1301,7 +1873,7 @@ std::optional<Record> SqlCoreDataMapperQueryBuilder<Record, Derived, QueryOption
     std::optional<Record> record {};
     auto stmt = SqlStatement { _dm.Connection() };
     stmt.Prepare(_formatter.SelectFirst(this->_query.distinct,
-                                        _fields,
+                                        SelectedFields(),
                                         RecordTableName<Record>,
                                         this->_query.searchCondition.tableAlias,
                                         this->_query.searchCondition.tableJoins,
@@ -1309,7 +1881,7 @@ std::optional<Record> SqlCoreDataMapperQueryBuilder<Record, Derived, QueryOption
                                         this->_query.orderBy,
                                         this->_query.groupBy,
                                         1));
-    Derived::ReadResult(stmt.Connection().ServerType(), stmt.ExecuteWithVariants(_boundInputs), &record);
+    ReadRecord(stmt.ExecuteWithVariants(_boundInputs), &record);
     if constexpr (QueryOptions.loadRelations)
     {
         if (record)
@@ -1402,7 +1974,7 @@ std::vector<Record> SqlCoreDataMapperQueryBuilder<Record, Derived, QueryOptions>
     auto stmt = SqlStatement { _dm.Connection() };
     records.reserve(n);
     stmt.Prepare(_formatter.SelectFirst(this->_query.distinct,
-                                        _fields,
+                                        SelectedFields(),
                                         RecordTableName<Record>,
                                         this->_query.searchCondition.tableAlias,
                                         this->_query.searchCondition.tableJoins,
@@ -1410,7 +1982,7 @@ std::vector<Record> SqlCoreDataMapperQueryBuilder<Record, Derived, QueryOptions>
                                         this->_query.orderBy,
                                         this->_query.groupBy,
                                         n));
-    Derived::ReadResults(stmt.Connection().ServerType(), stmt.ExecuteWithVariants(_boundInputs), &records);
+    ReadRecords(stmt.ExecuteWithVariants(_boundInputs), &records);
 
     if constexpr (QueryOptions.loadRelations)
     {
@@ -1428,7 +2000,7 @@ std::vector<Record> SqlCoreDataMapperQueryBuilder<Record, Derived, QueryOptions>
     records.reserve(limit);
     stmt.Prepare(
         _formatter.SelectRange(this->_query.distinct,
-                               _fields,
+                               SelectedFields(),
                                RecordTableName<Record>,
                                this->_query.searchCondition.tableAlias,
                                this->_query.searchCondition.tableJoins,
@@ -1439,7 +2011,7 @@ std::vector<Record> SqlCoreDataMapperQueryBuilder<Record, Derived, QueryOptions>
                                this->_query.groupBy,
                                offset,
                                limit));
-    Derived::ReadResults(stmt.Connection().ServerType(), stmt.ExecuteWithVariants(_boundInputs), &records);
+    ReadRecords(stmt.ExecuteWithVariants(_boundInputs), &records);
     if constexpr (QueryOptions.loadRelations)
     {
         for (auto& record: records)
@@ -1746,7 +2318,10 @@ std::optional<RecordPrimaryKeyType<Record>> DataMapper::GenerateAutoAssignPrimar
                 {
                     if (!primaryKeyField.Value())
                         [&](auto& res) {
-                            res.emplace(SqlGuid::Create());
+                            if constexpr (PrimaryKeyType::IsSequentialPrimaryKey)
+                                res.emplace(SqlGuid::CreateSequentialFor(_connection.ServerType()));
+                            else
+                                res.emplace(SqlGuid::Create());
                         }(result);
                 }
                 else if constexpr (requires { ValueType {} + 1; })
@@ -1939,6 +2514,151 @@ void DataMapper::CreateAll(Records const& records)
     }(std::make_index_sequence<RecordMemberCount<Record>> {});
 }
 
+template <DataMapperOptions QueryOptions, std::ranges::range Records>
+std::vector<RecordPrimaryKeyType<std::remove_cvref_t<std::ranges::range_value_t<Records>>>> DataMapper::CreateAllReturningIds(
+    Records&& records)
+{
+    static_assert(std::ranges::contiguous_range<Records> && std::ranges::sized_range<Records>,
+                  "CreateAllReturningIds requires a contiguous, sized range of records (e.g. std::vector, std::array, "
+                  "std::span, or a C array).");
+    static_assert(!std::is_const_v<std::remove_reference_t<std::ranges::range_reference_t<Records>>>,
+                  "CreateAllReturningIds writes the primary keys back, so the records must be mutable");
+    using Record = std::remove_cvref_t<std::ranges::range_value_t<Records>>;
+    using PrimaryKeyType = RecordPrimaryKeyType<Record>;
+    static_assert(DataMapperRecord<Record>, "Record must satisfy DataMapperRecord");
+    static_assert(HasPrimaryKey<Record>, "CreateAllReturningIds requires a record type with a primary key");
+
+    ZoneScopedN("DataMapper::CreateAllReturningIds");
+    ZoneTextObject(RecordTableName<Record>);
+
+    auto keys = std::vector<PrimaryKeyType> {};
+    if (std::ranges::empty(records))
+        return keys;
+    keys.reserve(std::ranges::size(records));
+
+    if constexpr (HasAutoIncrementPrimaryKey<Record>)
+    {
+        if (_connection.SupportsInsertReturning())
+        {
+            // Same column set and order as CreateAll(), plus the server-generated key as result column.
+            auto query = _connection.Query(RecordTableName<Record>).Insert(nullptr);
+            EnumerateRecordMembers<Record>([&query]<auto I, typename FieldType>() {
+                if constexpr (detail::IsBatchInsertColumn<FieldType>)
+                    query.Set(FieldNameAt<I, Record>, SqlWildcard);
+            });
+            query.Returning(FieldNameAt<RecordPrimaryKeyIndex<Record>, Record>);
+            _stmt.Prepare(query);
+
+            [&]<std::size_t... Is>(std::index_sequence<Is...>) {
+                std::apply(
+                    [&](auto const&... accessors) {
+                        keys = _stmt.ExecuteBatchReturning<PrimaryKeyType>(std::as_const(records), accessors...);
+                    },
+                    std::tuple_cat(detail::MakeCreateColumnAccessor<Is, Record>()...));
+            }(std::make_index_sequence<RecordMemberCount<Record>> {});
+        }
+        else
+        {
+            for (auto const& record: records)
+                keys.push_back(CreateInternal<PrimaryKeySource::Record>(record));
+        }
+
+        for (auto&& [record, key]: std::views::zip(records, keys))
+            SetId(record, key);
+    }
+    else
+    {
+        if constexpr (requires(PrimaryKeyType key) { key + 1; })
+        {
+            // Auto-assigned integer keys are MAX(pk) + 1: query that once and count up from there, rather
+            // than issuing a SELECT MAX per record (which would also hand every record of the batch the same
+            // key). Keys set explicitly in the batch are reserved first, so the count skips them.
+            auto reserved = std::vector<PrimaryKeyType> {};
+            for (auto const& record: records)
+                if (auto const& key = RecordPrimaryKeyOf(record).Value(); key != PrimaryKeyType {})
+                    reserved.push_back(key);
+            std::ranges::sort(reserved);
+
+            auto nextKey = std::optional<PrimaryKeyType> {};
+            for (auto& record: records)
+            {
+                if (RecordPrimaryKeyOf(record).Value() != PrimaryKeyType {})
+                    continue;
+                if (!nextKey)
+                    nextKey = GenerateAutoAssignPrimaryKey(record);
+                if (!nextKey)
+                    break; // The key is not auto-assigned
+                while (std::ranges::binary_search(reserved, *nextKey))
+                    nextKey = *nextKey + 1;
+                SetId(record, *nextKey);
+                nextKey = *nextKey + 1;
+            }
+        }
+        else
+        {
+            for (auto& record: records)
+                if (auto generatedKey = GenerateAutoAssignPrimaryKey(record); generatedKey)
+                    SetId(record, *generatedKey);
+        }
+
+        CreateAll(records);
+
+        for (auto const& record: records)
+            keys.push_back(RecordPrimaryKeyOf(record).Value());
+    }
+
+    for (auto& record: records)
+    {
+        SetModifiedState<ModifiedState::NotModified>(record);
+        if constexpr (QueryOptions.loadRelations)
+            ConfigureRelationAutoLoading(record);
+    }
+
+    return keys;
+}
+
+template <DataMapperOptions QueryOptions,
+          std::ranges::range Parents,
+          std::ranges::range Children,
+          typename ParentIndexOf>
+    requires std::invocable<ParentIndexOf const&, std::ranges::range_value_t<Children> const&, std::size_t>
+void DataMapper::CreateAllReturningIds(Parents&& parents, Children&& children, ParentIndexOf const& parentIndexOf)
+{
+    using Parent = std::remove_cvref_t<std::ranges::range_value_t<Parents>>;
+    using Child = std::remove_cvref_t<std::ranges::range_value_t<Children>>;
+
+    ZoneScopedN("DataMapper::CreateAllReturningIds(graph)");
+
+    auto const parentKeys = CreateAllReturningIds<QueryOptions>(parents);
+
+    // Point every child's BelongsTo<> on the parent type at its parent's freshly generated key.
+    constexpr bool childReferencesParent =
+        FoldRecordMembers<Child>(false, []<std::size_t I, typename FieldType>(bool found) constexpr {
+            if constexpr (IsBelongsTo<FieldType>)
+                return found || std::same_as<typename FieldType::ReferencedRecord, Parent>;
+            else
+                return found;
+        });
+    static_assert(childReferencesParent, "The child record type must have a BelongsTo<> referencing the parent record type");
+
+    for (auto&& [index, child]: children | std::views::enumerate)
+    {
+        auto const parentIndex = static_cast<std::size_t>(parentIndexOf(std::as_const(child), static_cast<std::size_t>(index)));
+        if (parentIndex >= parentKeys.size())
+            throw std::out_of_range(std::format("Parent index {} of child {} is out of range ({} parents)",
+                                                parentIndex,
+                                                index,
+                                                parentKeys.size()));
+        EnumerateRecordMembers(child, [&]<auto I, typename FieldType>(FieldType& field) {
+            if constexpr (IsBelongsTo<FieldType>)
+                if constexpr (std::same_as<typename FieldType::ReferencedRecord, Parent>)
+                    field = parentKeys[parentIndex];
+        });
+    }
+
+    std::ignore = CreateAllReturningIds<QueryOptions>(children);
+}
+
 template <DataMapperOptions QueryOptions, typename Record>
 RecordPrimaryKeyType<Record> DataMapper::CreateCopyOf(Record const& originalRecord)
 {
@@ -2114,6 +2834,9 @@ void DataMapper::Update(Record& record)
 
     [[maybe_unused]] auto cursor = _stmt.Execute();
 
+    if constexpr (detail::CacheableRecord<Record>)
+        InvalidateCachedRecord<Record>(GetPrimaryKeyFields(record));
+
     SetModifiedState<ModifiedState::NotModified>(record);
 }
 
@@ -2151,6 +2874,9 @@ void DataMapper::UpdateAll(Records const& records)
                    std::tuple_cat(detail::MakeUpdateSetAccessor<Is, Record>()...,
                                   detail::MakeUpdateWhereAccessor<Is, Record>()...));
     }(std::make_index_sequence<RecordMemberCount<Record>> {});
+    if constexpr (detail::CacheableRecord<Record>)
+        for (auto const& record: records)
+            InvalidateCachedRecord<Record>(GetPrimaryKeyFields(record));
 }
 
 template <typename Record>
@@ -2206,9 +2932,386 @@ std::size_t DataMapper::Delete(Record const& record)
 
     auto cursor = _stmt.Execute();
 
+    if constexpr (detail::CacheableRecord<Record>)
+        InvalidateCachedRecord<Record>(GetPrimaryKeyFields(record));
+
     return cursor.NumRowsAffected();
 }
 
+template <std::ranges::input_range Records>
+std::size_t DataMapper::DeleteAll(Records const& records, DataMapperDeleteOptions const& options)
+{
+    using Record = std::remove_cvref_t<std::ranges::range_value_t<Records>>;
+    static_assert(DataMapperRecord<Record>, "Record must satisfy DataMapperRecord");
+    static_assert(HasPrimaryKey<Record>, "DeleteAll requires a record type with a primary key");
+
+    ZoneScopedN("DataMapper::DeleteAll");
+    ZoneTextObject(RecordTableName<Record>);
+
+    auto keys = std::vector<RecordPrimaryKeyTuple<Record>> {};
+    if constexpr (std::ranges::sized_range<Records>)
+        keys.reserve(std::ranges::size(records));
+    for (auto const& record: records)
+        keys.emplace_back(GetPrimaryKeyFields(record));
+
+    return DeleteByPrimaryKeys<Record>(keys, options);
+}
+
+template <typename Record, std::ranges::input_range Ids>
+std::size_t DataMapper::DeleteByIds(Ids const& ids, DataMapperDeleteOptions const& options)
+{
+    static_assert(DataMapperRecord<Record>, "Record must satisfy DataMapperRecord");
+    static_assert(HasPrimaryKey<Record>, "DeleteByIds requires a record type with a primary key");
+
+    ZoneScopedN("DataMapper::DeleteByIds");
+    ZoneTextObject(RecordTableName<Record>);
+
+    using KeyTuple = RecordPrimaryKeyTuple<Record>;
+    using Id = std::remove_cvref_t<std::ranges::range_value_t<Ids>>;
+
+    auto keys = std::vector<KeyTuple> {};
+    if constexpr (std::ranges::sized_range<Ids>)
+        keys.reserve(std::ranges::size(ids));
+    for (auto const& id: ids)
+    {
+        if constexpr (std::same_as<Id, KeyTuple>)
+            keys.emplace_back(id);
+        else
+        {
+            static_assert(!HasCompositePrimaryKey<Record>,
+                          "DeleteByIds on a composite primary key takes tuples of the key values (RecordPrimaryKeyTuple)");
+            keys.emplace_back(KeyTuple { id });
+        }
+    }
+
+    return DeleteByPrimaryKeys<Record>(keys, options);
+}
+
+template <typename Record>
+std::size_t DataMapper::DeleteByPrimaryKeys(std::span<RecordPrimaryKeyTuple<Record> const> keys,
+                                            DataMapperDeleteOptions const& options)
+{
+    using namespace std::string_view_literals;
+    using KeyTuple = RecordPrimaryKeyTuple<Record>;
+    constexpr auto KeyCount = RecordPrimaryKeyCount<Record>;
+
+    if (keys.empty())
+        return 0;
+
+    // Dropped up front: a cached record must not outlive its row even if a later chunk fails.
+    for (auto const& key: keys)
+        InvalidateCachedRecord<Record>(key);
+
+    auto keyColumns = std::array<std::string, KeyCount> {};
+    EnumerateRecordMembers<Record>([&keyColumns, n = std::size_t { 0 }]<size_t I, typename FieldType>() mutable {
+        if constexpr (IsField<FieldType>)
+            if constexpr (FieldType::IsPrimaryKey)
+                keyColumns[n++] = detail::MakeSqlColumnName(FieldNameAt<I, Record>);
+    });
+
+    // A single integer or string key travels as one array parameter, so the statement text is the
+    // same for every chunk and the chunk size is not bound by the backend's parameter limit.
+    using FirstKey = std::tuple_element_t<0, KeyTuple>;
+    constexpr bool bindsAsArray =
+        KeyCount == 1 && (detail::SqlIntegerArrayElement<FirstKey> || detail::SqlTextArrayElement<FirstKey>);
+    constexpr auto arrayElementType =
+        detail::SqlIntegerArrayElement<FirstKey> ? SqlArrayElementType::Integer : SqlArrayElementType::Text;
+
+    // Otherwise every key value is a marker of its own. 999 is the lowest parameter limit among the
+    // supported backends (SQLite before 3.32); rounding down to a power of two keeps full chunks on a
+    // padding bucket.
+    auto const chunkSize = [&]() -> std::size_t {
+        auto const requested = std::max<std::size_t>(options.chunkSize, 1);
+        if constexpr (bindsAsArray)
+            return requested;
+        else
+            return std::bit_floor(std::min<std::size_t>(requested, 999 / KeyCount));
+    }();
+
+    auto const buildWhereCondition = [&](std::size_t markerRows) {
+        auto condition = std::string { "\n WHERE "sv };
+        if constexpr (bindsAsArray)
+            condition += _connection.QueryFormatter().InArrayParameter(keyColumns[0], arrayElementType);
+        else if constexpr (KeyCount == 1)
+        {
+            condition += keyColumns[0];
+            condition += " IN ("sv;
+            for (auto const i: std::views::iota(std::size_t { 0 }, markerRows))
+                condition += i == 0 ? "?"sv : ", ?"sv;
+            condition += ')';
+        }
+        else
+        {
+            for (auto const i: std::views::iota(std::size_t { 0 }, markerRows))
+            {
+                condition += i == 0 ? "("sv : " OR ("sv;
+                for (auto const column: std::views::iota(std::size_t { 0 }, KeyCount))
+                {
+                    if (column > 0)
+                        condition += " AND "sv;
+                    condition += keyColumns[column];
+                    condition += " = ?"sv;
+                }
+                condition += ')';
+            }
+        }
+        return _connection.QueryFormatter().Delete(RecordTableName<Record>, ""sv, ""sv, condition);
+    };
+
+    // Intermediate commits are only ours to make when the caller has not opened a transaction.
+    auto const commitEvery = _connection.TransactionActive() ? std::size_t { 0 } : options.commitEveryChunks;
+    auto transaction = std::optional<SqlTransaction> {};
+    if (commitEvery != 0)
+        transaction.emplace(_connection, SqlTransactionMode::ROLLBACK);
+
+    auto preparedQuery = std::string {};
+    auto affectedRows = std::size_t { 0 };
+    auto chunkNumber = std::size_t { 0 };
+    for (auto const chunk: keys | std::views::chunk(chunkSize))
+    {
+        auto const chunkRows = chunk.size();
+        auto const markerRows = bindsAsArray ? chunkRows : std::bit_ceil(chunkRows);
+        if (auto query = buildWhereCondition(markerRows); query != preparedQuery)
+        {
+            _stmt.Prepare(query);
+            preparedQuery = std::move(query);
+        }
+
+        // Bound values must stay alive until the statement has executed.
+        auto arrayValue = std::string {};
+        if constexpr (bindsAsArray)
+        {
+            auto elements = std::vector<std::string> {};
+            elements.reserve(chunkRows);
+            for (auto const& key: chunk)
+            {
+                if constexpr (detail::SqlIntegerArrayElement<FirstKey>)
+                    elements.emplace_back(std::to_string(std::get<0>(key)));
+                else
+                    elements.emplace_back(std::string_view { std::get<0>(key) });
+            }
+            arrayValue = _connection.QueryFormatter().ArrayParameterValue(elements, arrayElementType);
+            _stmt.BindInputParameter(1, arrayValue);
+        }
+        else
+        {
+            // Padding rows repeat the last key, which does not change the set of deleted rows.
+            auto parameter = SQLSMALLINT { 1 };
+            for (auto const row: std::views::iota(std::size_t { 0 }, markerRows))
+            {
+                auto const& key = chunk[std::min(row, chunkRows - 1)];
+                std::apply([&](auto const&... values) { (_stmt.BindInputParameter(parameter++, values), ...); }, key);
+            }
+        }
+
+        auto cursor = _stmt.Execute();
+        affectedRows += cursor.NumRowsAffected();
+
+        if (commitEvery != 0 && ++chunkNumber % commitEvery == 0)
+        {
+            transaction->Commit();
+            transaction.reset();
+            transaction.emplace(_connection, SqlTransactionMode::ROLLBACK);
+            // Not every driver keeps a prepared statement across a commit.
+            preparedQuery.clear();
+        }
+    }
+
+    if (transaction)
+        transaction->Commit();
+
+    return affectedRows;
+}
+
+template <typename Record, DataMapperOptions QueryOptions, typename... Params>
+SqlCompiledQueryPlan const& SqlCompiledQuery<Record, QueryOptions, Params...>::PlanFor(DataMapper& dm, Shape shape) const
+{
+    auto& plan = _state->plans[(static_cast<std::size_t>(dm.Connection().ServerType()) * ShapeCount)
+                               + static_cast<std::size_t>(shape)];
+    if (auto const* rendered = plan.load(std::memory_order_acquire); rendered)
+        return *rendered;
+
+    std::scoped_lock const lock(_state->mutex);
+    if (auto const* rendered = plan.load(std::memory_order_relaxed); rendered)
+        return *rendered;
+
+    auto builder = dm.Query<Record, QueryOptions>();
+    [&]<std::size_t... I>(std::index_sequence<I...>) {
+        _state->build(builder, detail::MakeCompiledQueryArgumentMarker(I)...);
+    }(std::index_sequence_for<Params...> {});
+
+    auto renderedSelect = shape == Shape::All ? builder.RenderAll() : builder.RenderFirst();
+    auto const& owned = _state->ownedPlans.emplace_back(std::make_unique<SqlCompiledQueryPlan const>(
+        detail::ResolveCompiledQueryPlan(renderedSelect.query, std::move(renderedSelect.inputs), sizeof...(Params))));
+    plan.store(owned.get(), std::memory_order_release);
+    return *owned;
+}
+
+template <typename Record, DataMapperOptions QueryOptions, typename... Params>
+std::vector<Record> SqlCompiledQuery<Record, QueryOptions, Params...>::All(DataMapper& dm, Params const&... params) const
+{
+    ZoneScopedN("SqlCompiledQuery::All");
+    ZoneTextObject(RecordTableName<Record>);
+
+    auto records = std::vector<Record> {};
+    Builder::ReadResults(
+        dm.Connection().ServerType(), dm.ExecuteCompiledQuery(PlanFor(dm, Shape::All), params...), &records);
+    if constexpr (QueryOptions.loadRelations)
+        for (auto& record: records)
+            dm.ConfigureRelationAutoLoading(record);
+    return records;
+}
+
+template <typename Record, DataMapperOptions QueryOptions, typename... Params>
+std::optional<Record> SqlCompiledQuery<Record, QueryOptions, Params...>::First(DataMapper& dm,
+                                                                               Params const&... params) const
+{
+    ZoneScopedN("SqlCompiledQuery::First");
+    ZoneTextObject(RecordTableName<Record>);
+
+    auto record = std::optional<Record> {};
+    Builder::ReadResult(
+        dm.Connection().ServerType(), dm.ExecuteCompiledQuery(PlanFor(dm, Shape::First), params...), &record);
+    if constexpr (QueryOptions.loadRelations)
+        if (record)
+            dm.ConfigureRelationAutoLoading(record.value());
+    return record;
+}
+
+template <typename... Params>
+SqlResultCursor DataMapper::ExecuteCompiledQuery(SqlCompiledQueryPlan const& plan, Params const&... params)
+{
+    _stmt.PrepareIfChanged(plan.query);
+
+    for (auto const& [position, value]: plan.constants)
+        _stmt.BindInputParameter(position, value);
+
+    // An argument binds to every marker it was used at, and to none if the build function ignored it.
+    [[maybe_unused]] auto argument = std::size_t { 0 };
+    (
+        [&] {
+            for (auto const position: plan.argumentMarkers[argument])
+                _stmt.BindInputParameter(position, params);
+            ++argument;
+        }(),
+        ...);
+
+    return _stmt.Execute();
+}
+
+template <typename Record>
+std::shared_ptr<void const> DataMapper::FindCachedRecord(std::string const& key)
+{
+    if (_identityMap)
+        if (auto record = _identityMap->Find(key); record)
+            return record;
+
+    if (!RecordCache::IsEnabled<Record>())
+        return nullptr;
+
+    auto record = RecordCache::Instance().Find(key);
+    if (record && _identityMap)
+        _identityMap->Insert(key, record);
+    return record;
+}
+
+template <typename Record>
+void DataMapper::StoreCachedRecord(std::string const& key, Record const& record, std::uint64_t generation)
+{
+    auto const cached = std::make_shared<Record const>(record);
+    if (_identityMap)
+        _identityMap->Insert(key, cached);
+    // A row read inside a transaction may be rolled back, so only the unit of work may keep it.
+    if (RecordCache::IsEnabled<Record>() && !_connection.TransactionActive())
+        RecordCache::Instance().Insert(key, cached, generation);
+}
+
+template <typename Record>
+void DataMapper::InvalidateCachedRecord(RecordPrimaryKeyTuple<Record> const& keys)
+{
+    if constexpr (detail::CacheableRecord<Record>)
+    {
+        auto const enabled = RecordCache::IsEnabled<Record>();
+        if (!_identityMap && !enabled)
+            return;
+
+        auto const key = detail::MakeRecordCacheKey<Record>(keys);
+        if (_identityMap)
+            _identityMap->Invalidate(key);
+        if (enabled)
+            RecordCache::Instance().Invalidate(key);
+    }
+}
+
+template <typename Record>
+void DataMapper::InvalidateCachedTable()
+{
+    if constexpr (detail::CacheableRecord<Record>)
+    {
+        if (_identityMap)
+            _identityMap->InvalidateTable(RecordTableName<Record>);
+        if (RecordCache::IsEnabled<Record>())
+            RecordCache::Instance().InvalidateTable(RecordTableName<Record>);
+    }
+}
+
+template <auto... ReferencedFields, typename Record>
+    requires(sizeof...(ReferencedFields) >= 1)
+bool DataMapper::LoadFields(Record& record)
+{
+    static_assert(DataMapperRecord<Record>, "Record must satisfy DataMapperRecord");
+    static_assert(HasPrimaryKey<Record>, "LoadFields requires a record type with a primary key");
+
+    using namespace std::string_view_literals;
+
+    ZoneScopedN("DataMapper::LoadFields");
+    ZoneTextObject(RecordTableName<Record>);
+
+    auto condition = std::string { "\n WHERE "sv };
+    EnumerateRecordMembers<Record>([&condition, first = true]<size_t I, typename FieldType>() mutable {
+        if constexpr (IsField<FieldType>)
+        {
+            if constexpr (FieldType::IsPrimaryKey)
+            {
+                if (!first)
+                    condition += " AND "sv;
+                first = false;
+                condition += detail::MakeSqlColumnName(FieldNameAt<I, Record>);
+                condition += " = ?"sv;
+            }
+        }
+    });
+
+    _stmt.Prepare(_connection.QueryFormatter().SelectFirst(false,
+                                                           detail::FullyQualifiedNamesOf<ReferencedFields...>,
+                                                           RecordTableName<Record>,
+                                                           {},
+                                                           {},
+                                                           condition,
+                                                           {},
+                                                           {},
+                                                           1));
+    auto reader = std::apply([this](auto const&... keys) { return _stmt.Execute(keys...); }, GetPrimaryKeyFields(record));
+    if (!reader.FetchRow())
+        return false;
+
+    detail::GetAllColumns<std::integer_sequence<size_t, MemberIndexOf<ReferencedFields>...>>(reader, record);
+    (
+        [&record] {
+#if defined(LIGHTWEIGHT_CXX26_REFLECTION)
+            auto& field = record.[:ReferencedFields:];
+#else
+            auto& field = record.*ReferencedFields;
+#endif
+            if constexpr (requires { field.SetLoaded(true); })
+                field.SetLoaded(true);
+            if constexpr (requires { field.SetModified(false); })
+                field.SetModified(false);
+        }(),
+        ...);
+    return true;
+}
+
 template <typename Record, DataMapperOptions QueryOptions, typename... PrimaryKeyTypes>
 std::optional<Record> DataMapper::QuerySingle(PrimaryKeyTypes&&... primaryKeys)
 {
@@ -2217,6 +3320,54 @@ std::optional<Record> DataMapper::QuerySingle(PrimaryKeyTypes&&... primaryKeys)
     ZoneScopedN("DataMapper::QuerySingle(PK)");
     ZoneTextObject(RecordTableName<Record>);
 
+    // Served from the identity map or the RecordCache, where active. Only lookups by exactly the
+    // primary key tuple can be keyed; anything else always goes to the database.
+    constexpr bool cacheable = detail::CacheableRecord<Record>
+                               && std::constructible_from<RecordPrimaryKeyTuple<Record>, PrimaryKeyTypes const&...>;
+    auto cacheKey = std::string {};
+    auto cachedRecord = std::shared_ptr<void const> {};
+    auto cacheGeneration = std::uint64_t {};
+    if constexpr (cacheable)
+    {
+        if (_identityMap || RecordCache::IsEnabled<Record>())
+        {
+            cacheKey = detail::MakeRecordCacheKey<Record>(RecordPrimaryKeyTuple<Record> { primaryKeys... });
+            cachedRecord = FindCachedRecord<Record>(cacheKey);
+            // Taken before the database read, so an Update or Delete racing with it on another
+            // DataMapper keeps the row it replaced out of the RecordCache.
+            if (!cachedRecord && RecordCache::IsEnabled<Record>())
+                cacheGeneration = RecordCache::Instance().Generation(cacheKey);
+        }
+    }
+
+    // A single return statement at the end is deliberate, not stylistic: a composite foreign key
+    // configured below (ConfigureRelationAutoLoading) captures a pointer to *resultRecord. An earlier
+    // `return std::nullopt;` here defeats NRVO in both GCC and Clang (verified: it forces a move-construct
+    // into the caller's storage at a new address), which would leave that captured pointer dangling.
+    auto resultRecord = std::optional<Record> {};
+    if (cachedRecord)
+        resultRecord.emplace(*static_cast<Record const*>(cachedRecord.get()));
+    else
+        resultRecord = QuerySingleUncached<Record>(std::forward<PrimaryKeyTypes>(primaryKeys)...);
+
+    if (resultRecord)
+    {
+        if constexpr (cacheable)
+            if (!cachedRecord && !cacheKey.empty())
+                StoreCachedRecord(cacheKey, *resultRecord, cacheGeneration);
+
+        SetModifiedState<ModifiedState::NotModified>(resultRecord.value());
+
+        if constexpr (QueryOptions.loadRelations)
+            ConfigureRelationAutoLoading(*resultRecord);
+    }
+
+    return resultRecord;
+}
+
+template <typename Record, typename... PrimaryKeyTypes>
+std::optional<Record> DataMapper::QuerySingleUncached(PrimaryKeyTypes&&... primaryKeys)
+{
     // Starter doesn't expose finalizers / Where until at least one column is
     // projected. The reflection enumeration below is constexpr-conditional, so
     // which iteration adds the first column isn't known up front — promote on the
@@ -2244,23 +3395,9 @@ std::optional<Record> DataMapper::QuerySingle(PrimaryKeyTypes&&... primaryKeys)
     _stmt.Prepare(queryBuilder->First());
     auto reader = _stmt.Execute(std::forward<PrimaryKeyTypes>(primaryKeys)...);
 
-    // A single return statement at the end is deliberate, not stylistic: a composite foreign key
-    // configured below (ConfigureRelationAutoLoading) captures a pointer to *resultRecord. An earlier
-    // `return std::nullopt;` here defeats NRVO in both GCC and Clang (verified: it forces a move-construct
-    // into the caller's storage at a new address), which would leave that captured pointer dangling.
     auto resultRecord = std::optional<Record> { Record {} };
-    if (detail::ReadSingleResult(_stmt.Connection().ServerType(), reader, *resultRecord))
-    {
-        SetModifiedState<ModifiedState::NotModified>(resultRecord.value());
-
-        if constexpr (QueryOptions.loadRelations)
-            ConfigureRelationAutoLoading(*resultRecord);
-    }
-    else
-    {
+    if (!detail::ReadSingleResult(_stmt.Connection().ServerType(), reader, *resultRecord))
         resultRecord.reset();
-    }
-
     return resultRecord;
 }
 
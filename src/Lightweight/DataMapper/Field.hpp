@@ -37,6 +37,11 @@ enum class PrimaryKey : uint8_t
 
     /// The field is an integer primary key, and it is auto-incremented by the database.
     ServerSideAutoIncrement,
+
+    /// Like @c AutoAssign, but a GUID key is generated with SqlGuid::CreateSequential() in the sort order
+    /// of the connected database, so that inserts append to the clustered index instead of splitting
+    /// pages all over it.
+    AutoAssignSequential,
 };
 
 namespace detail
@@ -124,7 +129,11 @@ struct Field
     static constexpr auto IsPrimaryKey = IsPrimaryKeyValue != PrimaryKey::No;
 
     /// Indicates if this is a primary key, it also is auto-assigned by the client.
-    static constexpr auto IsAutoAssignPrimaryKey = IsPrimaryKeyValue == PrimaryKey::AutoAssign;
+    static constexpr auto IsAutoAssignPrimaryKey =
+        IsPrimaryKeyValue == PrimaryKey::AutoAssign || IsPrimaryKeyValue == PrimaryKey::AutoAssignSequential;
+
+    /// Indicates if this is an auto-assigned primary key whose GUID values are generated sequentially.
+    static constexpr auto IsSequentialPrimaryKey = IsPrimaryKeyValue == PrimaryKey::AutoAssignSequential;
 
     /// Indicates if this is a primary key, it also is auto-incremented by the database.
     static constexpr auto IsAutoIncrementPrimaryKey = IsPrimaryKeyValue == PrimaryKey::ServerSideAutoIncrement;
@@ -165,6 +174,14 @@ struct Field
     /// Checks if the field has been modified.
     [[nodiscard]] constexpr bool IsModified() const noexcept;
 
+    /// Marks whether the field holds the value read from the database.
+    constexpr void SetLoaded(bool value) noexcept;
+
+    /// Checks if the field holds a value, i.e. it was not left out of a partial-column query.
+    ///
+    /// @see SqlCoreDataMapperQueryBuilder::Only, DataMapper::LoadFields
+    [[nodiscard]] constexpr bool IsLoaded() const noexcept;
+
     /// Returns the value of the field.
     [[nodiscard]] constexpr T const& Value() const noexcept;
 
@@ -183,6 +200,7 @@ struct Field
   private:
     ValueType _value {};
     bool _modified { true };
+    bool _loaded { true };
 };
 
 // clang-format off
@@ -198,6 +216,12 @@ struct IsAutoAssignPrimaryKeyField<Field<T, PrimaryKey::AutoAssign, P>>: std::tr
 template <typename T, auto P>
 struct IsAutoAssignPrimaryKeyField<Field<T, P, PrimaryKey::AutoAssign>>: std::true_type {};
 
+template <typename T, auto P>
+struct IsAutoAssignPrimaryKeyField<Field<T, PrimaryKey::AutoAssignSequential, P>>: std::true_type {};
+
+template <typename T, auto P>
+struct IsAutoAssignPrimaryKeyField<Field<T, P, PrimaryKey::AutoAssignSequential>>: std::true_type {};
+
 template <typename T>
 struct IsAutoIncrementPrimaryKeyField: std::false_type {};
 
@@ -245,6 +269,7 @@ constexpr LIGHTWEIGHT_FORCE_INLINE Field<T, P1, P2>& Field<T, P1, P2>::operator=
 {
     _value = std::forward<S>(value);
     SetModified(true);
+    SetLoaded(true);
     return *this;
 }
 
@@ -326,6 +351,18 @@ constexpr LIGHTWEIGHT_FORCE_INLINE bool Field<T, P1, P2>::IsModified() const noe
     return _modified;
 }
 
+template <detail::FieldElementType T, auto P1, auto P2>
+constexpr LIGHTWEIGHT_FORCE_INLINE void Field<T, P1, P2>::SetLoaded(bool value) noexcept
+{
+    _loaded = value;
+}
+
+template <detail::FieldElementType T, auto P1, auto P2>
+constexpr LIGHTWEIGHT_FORCE_INLINE bool Field<T, P1, P2>::IsLoaded() const noexcept
+{
+    return _loaded;
+}
+
 template <detail::FieldElementType T, auto P1, auto P2>
 constexpr LIGHTWEIGHT_FORCE_INLINE T const& Field<T, P1, P2>::Value() const noexcept
 {
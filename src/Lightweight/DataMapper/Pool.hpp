@@ -3,10 +3,14 @@
 
 #include "../Async/Executor.hpp"
 #include "../Async/Task.hpp"
+#include "../Async/WhenAll.hpp"
 #include "../SqlLogger.hpp"
 #include "DataMapper.hpp"
 
+#include <algorithm>
+#include <array>
 #include <cassert>
+#include <chrono>
 #include <condition_variable>
 #include <coroutine>
 #include <cstdint>
@@ -14,6 +18,8 @@
 #include <memory>
 #include <mutex>
 #include <stdexcept>
+#include <tuple>
+#include <utility>
 #include <vector>
 
 /// @defgroup ConnectionPool Connection Pooling
@@ -60,6 +66,36 @@ struct PoolConfig
     /// Strategy to determine how the pool should grow when there are no idle data mappers available, default is BoundedWait
     /// which blocks until a data mapper is returned to the pool
     GrowthStrategy growthStrategy { GrowthStrategy::BoundedWait };
+    /// While both priority classes have parked acquirers, the number of returned mappers handed to
+    /// AcquirePriority::Interactive waiters for every one handed to an AcquirePriority::Batch waiter
+    /// (must be >= 1). Batch waiters therefore keep making progress under interactive load.
+    size_t interactiveWeight { 4 };
+};
+
+/// @ingroup ConnectionPool
+/// Priority class of a pool acquisition. Only matters when a BoundedWait pool is exhausted and
+/// acquirers have to wait: returned mappers are then shared between the classes by
+/// @c PoolConfig::interactiveWeight, and in arrival order within a class.
+enum class AcquirePriority : uint8_t
+{
+    /// Latency-sensitive work, such as serving an API request. The default.
+    Interactive,
+    /// Background or bulk work that may wait longer.
+    Batch,
+};
+
+/// @ingroup ConnectionPool
+/// Wait-time statistics of one @ref AcquirePriority class, see @c Pool::WaitStatistics.
+struct PoolWaitStatistics
+{
+    /// Completed acquisitions (an @c AcquireManyAsync call counts once).
+    std::uint64_t acquisitions {};
+    /// Acquisitions that had to wait for a mapper to be returned.
+    std::uint64_t waited {};
+    /// Sum of the wait times of all acquisitions.
+    std::chrono::nanoseconds totalWait {};
+    /// Longest single wait.
+    std::chrono::nanoseconds maxWait {};
 };
 
 /// @ingroup ConnectionPool
@@ -69,6 +105,8 @@ struct PoolConfig
 template <PoolConfig Config>
 class Pool
 {
+    static_assert(Config.interactiveWeight >= 1, "PoolConfig::interactiveWeight must be at least 1");
+
   public:
     /// @ingroup ConnectionPool
     /// A wrapper around a DataMapper that returns it to the pool when destroyed
@@ -155,8 +193,8 @@ class Pool
         _idleDataMappers.push_back(std::move(dm));
     }
 
-    /// for bounded wait strategy, return the data mapper to the pool: hand it to the next FIFO waiter
-    /// (sync or async) or idle it.
+    /// for bounded wait strategy, return the data mapper to the pool: hand it to the next waiter
+    /// (sync or async, see ReturnLocked) or idle it.
     void Return(std::unique_ptr<DataMapper> dm) noexcept
         requires(Config.growthStrategy == GrowthStrategy::BoundedWait)
     {
@@ -171,39 +209,98 @@ class Pool
             toResume->resume->Resume(toResume->handle);
     }
 
-    /// Hands @p dm to the next FIFO waiter (transferring the checked-out count) or idles it. Serving
-    /// @c _waiters in arrival order keeps sync @ref Acquire and async @ref AcquireAsync waiters fair.
+    /// Hands @p dm to the next waiter (transferring the checked-out count) or idles it.
+    ///
+    /// The next waiter is the @ref AcquireManyAsync reservation currently collecting mappers, if any;
+    /// otherwise the head of the priority class picked by @ref NextWaiterLocked. Within a class, sync
+    /// @ref Acquire and async @ref AcquireAsync waiters are served in arrival order.
     ///
     /// @pre @c _mutex is held by the caller.
     /// @param dm The mapper to return; its async backend must already be disabled.
-    /// @return The async waiter node handed the mapper, to be resumed by the caller after releasing
-    ///         @c _mutex; @c nullptr if a sync waiter was woken in place or the mapper was idled.
+    /// @return The async waiter node handed its last missing mapper, to be resumed by the caller after
+    ///         releasing @c _mutex; @c nullptr if a sync waiter was woken in place, a reservation is
+    ///         still collecting, or the mapper was idled.
     std::shared_ptr<WaiterNode> ReturnLocked(std::unique_ptr<DataMapper> dm) noexcept
         requires(Config.growthStrategy == GrowthStrategy::BoundedWait)
     {
-        while (!_waiters.empty())
+        auto node = NextWaiterLocked();
+        if (!node)
         {
-            auto node = _waiters.front();
-            _waiters.pop_front();
-            // _waiters only ever holds parked nodes (an async awaitable de-registers itself on
-            // abandonment; a synchronous waiter is never abandoned), but guard defensively.
-            if (node->state != WaiterNode::State::Parked)
-                continue;
-            // Handed directly to a waiter, never idled: a reuse, not an idle transition.
-            SqlLogger::GetLogger().OnConnectionReuse(dm->Connection());
-            node->state = WaiterNode::State::Fulfilled;
-            node->mapper = std::move(dm); // hand off ownership; _checkedOut stays (transferred)
-            if (node->kind == WaiterNode::Kind::Async)
-                return node;       // resumed by the caller outside the lock
-            node->cv.notify_one(); // wake the blocked Acquire(); it consumes node->mapper
+            SqlLogger::GetLogger().OnConnectionIdle(dm->Connection());
+            _idleDataMappers.push_back(std::move(dm));
+            --_checkedOut;
             return nullptr;
         }
-        SqlLogger::GetLogger().OnConnectionIdle(dm->Connection());
-        _idleDataMappers.push_back(std::move(dm));
-        --_checkedOut;
+
+        // Handed directly to a waiter, never idled: a reuse, not an idle transition. The node reserved
+        // capacity for every mapper it needs when it parked, so this push_back does not allocate.
+        SqlLogger::GetLogger().OnConnectionReuse(dm->Connection());
+        node->mappers.push_back(std::move(dm)); // _checkedOut stays (transferred)
+        if (node->mappers.size() < node->needed)
+        {
+            // Only one reservation collects at a time, so partial reservations can never hold every
+            // mapper between them and wait on each other.
+            _collecting = node;
+            return nullptr;
+        }
+        if (_collecting == node)
+            _collecting.reset();
+
+        auto& queue = _waiters[ClassIndex(node->priority)];
+        assert(!queue.empty() && queue.front() == node);
+        queue.pop_front();
+        node->state = WaiterNode::State::Fulfilled;
+        RecordWaitLocked(node->priority, std::chrono::steady_clock::now() - node->parkedAt);
+        if (node->kind == WaiterNode::Kind::Async)
+            return node;       // resumed by the caller outside the lock
+        node->cv.notify_one(); // wake the blocked Acquire(); it consumes node->mappers
         return nullptr;
     }
 
+    /// Picks the waiter the next returned mapper goes to: the collecting reservation if there is one,
+    /// else the head of a priority class. While both classes wait, @c PoolConfig::interactiveWeight
+    /// interactive waiters are served for every batch waiter.
+    ///
+    /// @pre @c _mutex is held by the caller.
+    /// @return The chosen waiter (still queued), or @c nullptr if nobody is waiting.
+    std::shared_ptr<WaiterNode> NextWaiterLocked() noexcept
+        requires(Config.growthStrategy == GrowthStrategy::BoundedWait)
+    {
+        if (_collecting)
+            return _collecting;
+
+        auto& interactive = _waiters[ClassIndex(AcquirePriority::Interactive)];
+        auto& batch = _waiters[ClassIndex(AcquirePriority::Batch)];
+        if (interactive.empty() && batch.empty())
+            return nullptr;
+        if (interactive.empty() || (!batch.empty() && _interactiveStreak >= Config.interactiveWeight))
+        {
+            _interactiveStreak = 0;
+            return batch.front();
+        }
+        if (!batch.empty())
+            ++_interactiveStreak;
+        return interactive.front();
+    }
+
+    /// Returns every mapper in @p mappers to the pool, collecting the async waiters that must be
+    /// resumed (after releasing @c _mutex) into @p toResume.
+    ///
+    /// @pre @c _mutex is held by the caller.
+    void ReclaimLocked(std::vector<std::unique_ptr<DataMapper>>& mappers,
+                       std::vector<std::shared_ptr<WaiterNode>>& toResume) noexcept
+        requires(Config.growthStrategy == GrowthStrategy::BoundedWait)
+    {
+        for (auto& dm: mappers)
+        {
+            if (!dm)
+                continue;
+            if (auto node = ReturnLocked(std::move(dm)))
+                toResume.push_back(std::move(node));
+        }
+        mappers.clear();
+    }
+
     /// for bounded overflow strategy, only return to pool if we have capacity, otherwise just destroy the data mapper
     void Return(std::unique_ptr<DataMapper> dm) noexcept
         requires(Config.growthStrategy == GrowthStrategy::BoundedOverflow)
@@ -217,6 +314,89 @@ class Pool
         }
     }
 
+    /// @return the index of @p priority into the per-class arrays.
+    static constexpr size_t ClassIndex(AcquirePriority priority) noexcept
+    {
+        return static_cast<size_t>(priority);
+    }
+
+    /// Takes one mapper without waiting: an idle one, else a fresh one (within @c maxSize for
+    /// BoundedWait, whose checked-out count it increments).
+    ///
+    /// @pre @c _mutex is held by the caller.
+    /// @return The mapper, or @c nullptr if a BoundedWait pool is at capacity.
+    std::unique_ptr<DataMapper> TryTakeOneLocked()
+    {
+        if (!_idleDataMappers.empty())
+        {
+            auto dm = std::move(_idleDataMappers.back());
+            _idleDataMappers.pop_back();
+            if constexpr (Config.growthStrategy == GrowthStrategy::BoundedWait)
+                ++_checkedOut;
+            SqlLogger::GetLogger().OnConnectionReuse(dm->Connection());
+            return dm;
+        }
+        if constexpr (Config.growthStrategy == GrowthStrategy::BoundedWait)
+        {
+            if (_checkedOut >= Config.maxSize)
+                return nullptr;
+        }
+        auto dm = std::make_unique<DataMapper>();
+        if constexpr (Config.growthStrategy == GrowthStrategy::BoundedWait)
+            ++_checkedOut;
+        return dm;
+    }
+
+    /// Moves available mappers into @p out until it holds @p count or none are left.
+    ///
+    /// @pre @c _mutex is held by the caller and @p out has capacity for @p count mappers.
+    void TakeAvailableLocked(std::vector<std::unique_ptr<DataMapper>>& out, size_t count)
+    {
+        while (out.size() < count)
+        {
+            auto dm = TryTakeOneLocked();
+            if (!dm)
+                return;
+            out.push_back(std::move(dm));
+        }
+    }
+
+    /// Takes @p count mappers without waiting, all or nothing.
+    ///
+    /// @pre @c _mutex is held by the caller.
+    /// @return false (taking nothing) if a BoundedWait pool cannot provide @p count mappers right now.
+    bool TryReserveLocked(size_t count, std::vector<std::unique_ptr<DataMapper>>& out)
+    {
+        if constexpr (Config.growthStrategy == GrowthStrategy::BoundedWait)
+        {
+            // Idle mappers are part of maxSize, so whatever is not checked out can be handed out.
+            if (Config.maxSize - _checkedOut < count)
+                return false;
+        }
+        out.reserve(count);
+        TakeAvailableLocked(out, count);
+        return true;
+    }
+
+    /// Counts an acquisition of class @p priority that did not wait.
+    /// @pre @c _mutex is held by the caller.
+    void RecordAcquisitionLocked(AcquirePriority priority) noexcept
+    {
+        ++_waitStatistics[ClassIndex(priority)].acquisitions;
+    }
+
+    /// Counts an acquisition of class @p priority that waited @p wait for returned mappers.
+    /// @pre @c _mutex is held by the caller.
+    void RecordWaitLocked(AcquirePriority priority, std::chrono::steady_clock::duration wait) noexcept
+    {
+        auto& statistics = _waitStatistics[ClassIndex(priority)];
+        auto const waitNs = std::chrono::duration_cast<std::chrono::nanoseconds>(wait);
+        ++statistics.acquisitions;
+        ++statistics.waited;
+        statistics.totalWait += waitNs;
+        statistics.maxWait = std::max(statistics.maxWait, waitNs);
+    }
+
   public:
     /// Default constructor that pre-creates the initial number of data mappers and stores them in the pool
     /// No other constructors are provided, as the pool is configured at compile time via the template parameter
@@ -236,13 +416,14 @@ class Pool
         // pool, so destroying the pool out from under it is undefined: drive every AcquireAsync task to
         // completion and let every blocked Acquire() return first. The assert catches this in debug; the
         // warning surfaces it in release (where the later access would be a use-after-free).
-        if (!_waiters.empty())
+        auto const waiting = std::ranges::any_of(_waiters, [](auto const& queue) { return !queue.empty(); });
+        if (waiting)
             SqlLogger::GetLogger().OnWarning(
                 "Pool destroyed while acquirers are still waiting on it (coroutines parked in AcquireAsync "
                 "and/or threads blocked in Acquire); the pool must outlive every acquirer (drive each "
                 "AcquireAsync task to completion or destroy it first, and never destroy the pool while a "
                 "thread is blocked in Acquire). This is undefined behavior.");
-        assert(_waiters.empty() && "Pool destroyed while acquirers are still waiting on it");
+        assert(!waiting && "Pool destroyed while acquirers are still waiting on it");
     }
 
     Pool(Pool const&) = delete;
@@ -253,52 +434,38 @@ class Pool
     /// Function to acquire a data mapper from the pool, the behavior of this function depends on the growth strategy
     /// this is a specific implementation for the BoundedWait strategy, which blocks until a data mapper is available if the
     /// pool is at maximum capacity
-    PooledDataMapper Acquire()
+    ///
+    /// @param priority The class this acquisition waits in when the pool is exhausted.
+    PooledDataMapper Acquire(AcquirePriority priority = AcquirePriority::Interactive)
         requires(Config.growthStrategy == GrowthStrategy::BoundedWait)
     {
         std::unique_lock lock(_mutex);
-        if (!_idleDataMappers.empty())
+        if (auto dm = TryTakeOneLocked())
         {
-            // get a data mapper from the pool
-            auto dm = std::move(_idleDataMappers.back());
-            _idleDataMappers.pop_back();
-            ++_checkedOut;
-            SqlLogger::GetLogger().OnConnectionReuse(dm->Connection());
+            RecordAcquisitionLocked(priority);
             return PooledDataMapper(*this, std::move(dm));
         }
-        if (_checkedOut < Config.maxSize)
-        {
-            // below capacity: create a fresh data mapper
-            ++_checkedOut;
-            return PooledDataMapper(*this, std::make_unique<DataMapper>());
-        }
 
-        // Pool exhausted: park as a FIFO waiter (fair with AcquireAsync waiters) and block until a
-        // mapper is handed to this node. The hand-off transfers a checked-out slot, so no ++_checkedOut.
-        auto node = std::make_shared<WaiterNode>(WaiterNode::Kind::Sync);
-        _waiters.push_back(node);
+        // Pool exhausted: park in the priority class (in arrival order, fair with AcquireAsync waiters)
+        // and block until a mapper is handed to this node. The hand-off transfers a checked-out slot,
+        // so no ++_checkedOut.
+        auto node = std::make_shared<WaiterNode>(WaiterNode::Kind::Sync, priority, 1);
+        _waiters[ClassIndex(priority)].push_back(node);
         node->cv.wait(lock, [&node] { return node->state == WaiterNode::State::Fulfilled; });
-        return PooledDataMapper(*this, std::move(node->mapper));
+        return PooledDataMapper(*this, std::move(node->mappers.front()));
     }
 
     /// Function to acquire a data mapper from the pool, the behavior of this function depends on the growth strategy
     /// this is a specific implementation for the strategies that do not block, which always creates a new data mapper if
     /// the pool is empty, regardless of the maximum capacity
-    PooledDataMapper Acquire()
+    ///
+    /// @param priority Only recorded in @ref WaitStatistics; these strategies never wait.
+    PooledDataMapper Acquire(AcquirePriority priority = AcquirePriority::Interactive)
         requires(Config.growthStrategy != GrowthStrategy::BoundedWait)
     {
         std::scoped_lock lock(_mutex);
-        if (_idleDataMappers.empty())
-        {
-            // create a new data mapper and return it
-            return PooledDataMapper(*this, std::make_unique<DataMapper>());
-        }
-
-        // get a data mapper from the pool
-        auto dm = std::move(_idleDataMappers.back());
-        _idleDataMappers.pop_back();
-        SqlLogger::GetLogger().OnConnectionReuse(dm->Connection());
-        return PooledDataMapper(*this, std::move(dm));
+        RecordAcquisitionLocked(priority);
+        return PooledDataMapper(*this, TryTakeOneLocked());
     }
 
     /// Asynchronously acquires a DataMapper from the pool without blocking the calling thread.
@@ -310,11 +477,14 @@ class Pool
     ///
     /// @param dbWorkers The worker pool used to run the acquired mapper's blocking ODBC calls.
     /// @param resume The scheduler used to resume coroutines (typically the app run loop).
+    /// @param priority The class this acquisition waits in when the pool is exhausted.
     /// @return A Task yielding a pooled DataMapper.
-    [[nodiscard]] Async::Task<PooledDataMapper> AcquireAsync(Async::IExecutor& dbWorkers, Async::IResumeScheduler& resume)
+    [[nodiscard]] Async::Task<PooledDataMapper> AcquireAsync(Async::IExecutor& dbWorkers,
+                                                             Async::IResumeScheduler& resume,
+                                                             AcquirePriority priority = AcquirePriority::Interactive)
     {
         // Forward to a coroutine taking pointers (coroutines must not take reference parameters).
-        return AcquireAsyncImpl(&dbWorkers, &resume);
+        return AcquireAsyncImpl(&dbWorkers, &resume, priority);
     }
 
     /// Configures the executors that the no-argument @ref AcquireAsync() overload wires acquired
@@ -343,16 +513,106 @@ class Pool
     /// Equivalent to the explicit-argument @ref AcquireAsync overload with the pool's stored
     /// executors; pass the executors to that overload to override them for a single call.
     ///
+    /// @param priority The class this acquisition waits in when the pool is exhausted.
     /// @return A Task yielding a pooled DataMapper.
     /// @throws std::logic_error if @ref SetAsyncExecutors has not been called on this pool.
-    [[nodiscard]] Async::Task<PooledDataMapper> AcquireAsync()
+    [[nodiscard]] Async::Task<PooledDataMapper> AcquireAsync(AcquirePriority priority = AcquirePriority::Interactive)
     {
         if (!_asyncDbWorkers || !_asyncResume)
             throw std::logic_error {
                 "Pool::AcquireAsync(): no async executors configured; call Pool::SetAsyncExecutors(...) first "
                 "or use the explicit AcquireAsync(dbWorkers, resume) overload."
             };
-        return AcquireAsyncImpl(_asyncDbWorkers, _asyncResume);
+        return AcquireAsyncImpl(_asyncDbWorkers, _asyncResume, priority);
+    }
+
+    /// Asynchronously acquires @p count DataMappers at once, for fan-out jobs.
+    ///
+    /// The mappers are reserved atomically: the coroutine resumes once it holds all @p count of them,
+    /// and it never holds a partial set. While it waits, the pool collects returned mappers for it,
+    /// and only one reservation collects at a time. So two fan-out jobs can never each hold part of
+    /// the pool while waiting for the other's share, which is the deadlock of acquiring one mapper at
+    /// a time. Every mapper is wired for async like @ref AcquireAsync.
+    ///
+    /// @param dbWorkers The worker pool used to run the acquired mappers' blocking ODBC calls.
+    /// @param resume The scheduler used to resume coroutines (typically the app run loop).
+    /// @param count Number of mappers to reserve.
+    /// @param priority The class this acquisition waits in when the pool is exhausted.
+    /// @return A Task yielding @p count pooled DataMappers.
+    /// @throws std::invalid_argument if a BoundedWait pool's @c maxSize is below @p count.
+    [[nodiscard]] Async::Task<std::vector<PooledDataMapper>> AcquireManyAsync(
+        Async::IExecutor& dbWorkers,
+        Async::IResumeScheduler& resume,
+        size_t count,
+        AcquirePriority priority = AcquirePriority::Interactive)
+    {
+        if constexpr (Config.growthStrategy == GrowthStrategy::BoundedWait)
+        {
+            if (count > Config.maxSize)
+                throw std::invalid_argument {
+                    "Pool::AcquireManyAsync(): count exceeds the pool's maxSize, so the reservation could never "
+                    "be satisfied."
+                };
+        }
+        return AcquireManyAsyncImpl(&dbWorkers, &resume, count, priority);
+    }
+
+    /// Asynchronously acquires @p count DataMappers at once using the executors set via
+    /// @ref SetAsyncExecutors. @see AcquireManyAsync(Async::IExecutor&, Async::IResumeScheduler&, size_t, AcquirePriority)
+    ///
+    /// @throws std::logic_error if @ref SetAsyncExecutors has not been called on this pool.
+    /// @throws std::invalid_argument if a BoundedWait pool's @c maxSize is below @p count.
+    [[nodiscard]] Async::Task<std::vector<PooledDataMapper>> AcquireManyAsync(
+        size_t count, AcquirePriority priority = AcquirePriority::Interactive)
+    {
+        if (!_asyncDbWorkers || !_asyncResume)
+            throw std::logic_error {
+                "Pool::AcquireManyAsync(): no async executors configured; call Pool::SetAsyncExecutors(...) first "
+                "or use the explicit AcquireManyAsync(dbWorkers, resume, count) overload."
+            };
+        return AcquireManyAsync(*_asyncDbWorkers, *_asyncResume, count, priority);
+    }
+
+    /// @return the wait-time statistics of the acquisitions of class @p priority since the pool was
+    ///         created. Acquisitions that found a mapper right away count with no wait.
+    [[nodiscard]] PoolWaitStatistics WaitStatistics(AcquirePriority priority)
+    {
+        std::scoped_lock lock(_mutex);
+        return _waitStatistics[ClassIndex(priority)];
+    }
+
+    /// Asynchronously runs several independent SELECTs, using the pool to overlap them.
+    ///
+    /// If the pooled connections support multi-result batches, all queries go to one acquired mapper
+    /// as a single round-trip (see @ref DataMapper::QueryMany). Otherwise one mapper per query is
+    /// reserved at once (see @ref AcquireManyAsync) and the queries run concurrently via
+    /// @ref Async::WhenAll, so the total latency is that of the slowest query rather than the sum.
+    /// A BoundedWait pool smaller than the number of queries runs them back to back on one mapper.
+    /// Requires @ref SetAsyncExecutors.
+    ///
+    /// @param builders Query builders from any mapper of this pool; they are rendered immediately.
+    /// @return A Task producing one vector of records per builder, in argument order.
+    template <typename... Builders>
+        requires(sizeof...(Builders) >= 1 && (SqlSelectRenderer<Builders> && ...))
+    [[nodiscard]] auto QueryManyAsync(Builders const&... builders)
+    {
+        return QueryManyAsync(builders.RenderAll()...);
+    }
+
+    /// Asynchronously runs several already rendered SELECTs. @see QueryManyAsync(Builders const&...)
+    template <typename... Records, DataMapperOptions... QueryOptions>
+    [[nodiscard]] Async::Task<std::tuple<std::vector<Records>...>> QueryManyAsync(
+        SqlRenderedSelect<Records, QueryOptions>... queries)
+    {
+        constexpr auto QueryCount = sizeof...(Records);
+        constexpr bool FanOutFits = Config.growthStrategy != GrowthStrategy::BoundedWait || QueryCount <= Config.maxSize;
+        {
+            auto dm = co_await AcquireAsync();
+            if (QueryCount == 1 || !FanOutFits || dm->Connection().SupportsMultiResultBatch())
+                co_return co_await dm->QueryManyAsync(std::move(queries)...);
+        } // Return the probing mapper before fanning out, so it counts towards the reservation.
+        auto mappers = co_await AcquireManyAsync(QueryCount);
+        co_return co_await FanOutQueries(std::move(mappers), std::index_sequence_for<Records...> {}, std::move(queries)...);
     }
 
 #if defined(BUILD_TESTS)
@@ -367,14 +627,14 @@ class Pool
     [[nodiscard]] size_t WaiterCount() noexcept
     {
         std::scoped_lock lock(_mutex);
-        return _waiters.size();
+        return _waiters[0].size() + _waiters[1].size();
     }
 #endif
 
   private:
-    /// A parked acquirer awaiting a DataMapper — a suspended @ref AcquireAsync coroutine (@c Kind::Async)
-    /// or a blocked synchronous @ref Acquire thread (@c Kind::Sync). Both share one FIFO queue
-    /// (@c _waiters), served in arrival order so neither kind starves the other.
+    /// A parked acquirer awaiting DataMappers — a suspended @ref AcquireAsync / @ref AcquireManyAsync
+    /// coroutine (@c Kind::Async) or a blocked synchronous @ref Acquire thread (@c Kind::Sync). Both share
+    /// the FIFO queue of their priority class (@c _waiters), so neither kind starves the other.
     ///
     /// Heap-allocated and shared with the pool. Holding the handed-off mapper and @c state in this node
     /// (not via a pointer into a coroutine frame) lets @ref Return and the awaitable's destructor
@@ -397,8 +657,12 @@ class Pool
         };
 
         Kind kind;
+        AcquirePriority priority;
+        size_t needed; ///< Mappers this waiter reserves; more than one for AcquireManyAsync.
         State state = State::Parked;
-        std::unique_ptr<DataMapper> mapper {}; ///< Filled by Return on hand-off; lives outside any frame.
+        /// Filled by Return on hand-off (capacity for @c needed reserved up front); lives outside any frame.
+        std::vector<std::unique_ptr<DataMapper>> mappers {};
+        std::chrono::steady_clock::time_point parkedAt = std::chrono::steady_clock::now();
 
         // Async waiter only:
         std::coroutine_handle<> handle {};
@@ -408,27 +672,37 @@ class Pool
         // CV, so Return's notify_one wakes exactly the served thread.
         std::condition_variable cv {};
 
-        explicit WaiterNode(Kind nodeKind) noexcept:
-            kind { nodeKind }
+        WaiterNode(Kind nodeKind, AcquirePriority nodePriority, size_t nodeNeeded):
+            kind { nodeKind },
+            priority { nodePriority },
+            needed { nodeNeeded }
         {
+            mappers.reserve(needed);
         }
     };
 
-    /// Awaitable that acquires a DataMapper, suspending only when the pool is at capacity.
+    /// Awaitable that acquires @c needed DataMappers, suspending only when the pool is at capacity.
     ///
     /// Non-copyable/non-movable: constructed in place in the co_await expression. On suspension it
-    /// registers a shared @ref WaiterNode (@c Kind::Async) in pool._waiters; the node carries the
-    /// handed-off mapper and liveness state so Return() and this destructor coordinate safely.
+    /// registers a shared @ref WaiterNode (@c Kind::Async) in its class of pool._waiters; the node
+    /// carries the handed-off mappers and liveness state so Return() and this destructor coordinate safely.
     struct AsyncAcquireAwaitable
     {
         Pool& pool;
         Async::IResumeScheduler& resume;
-        std::unique_ptr<DataMapper> acquired {}; ///< Mapper obtained without suspending (idle/fresh).
-        std::shared_ptr<WaiterNode> node {};     ///< Set only while parked; shared with the pool.
-
-        AsyncAcquireAwaitable(Pool& poolRef, Async::IResumeScheduler& resumeRef) noexcept:
+        AcquirePriority priority;
+        size_t needed;
+        std::vector<std::unique_ptr<DataMapper>> acquired {}; ///< Mappers obtained without suspending.
+        std::shared_ptr<WaiterNode> node {};                  ///< Set only while parked; shared with the pool.
+
+        AsyncAcquireAwaitable(Pool& poolRef,
+                              Async::IResumeScheduler& resumeRef,
+                              AcquirePriority acquirePriority,
+                              size_t count) noexcept:
             pool { poolRef },
-            resume { resumeRef }
+            resume { resumeRef },
+            priority { acquirePriority },
+            needed { count }
         {
         }
 
@@ -437,48 +711,56 @@ class Pool
         AsyncAcquireAwaitable(AsyncAcquireAwaitable&&) = delete;
         AsyncAcquireAwaitable& operator=(AsyncAcquireAwaitable&&) = delete;
 
-        /// Cleans up if the awaiting coroutine is destroyed before it consumes its mapper.
+        /// Cleans up if the awaiting coroutine is destroyed before it consumes its mappers.
         ///
         /// Under pool._mutex: if still parked, de-registers the node so a later Return() never hands
-        /// off to a dead frame. If Return() already handed off a mapper (Fulfilled) that await_resume
-        /// never consumed, reclaims it into the pool so the BoundedWait checked-out count is not
-        /// leaked (possibly handing it straight to the next waiter, resumed after the lock is released).
+        /// off to a dead frame, and passes on any mappers a collecting reservation already holds. If
+        /// Return() already handed off mappers (Fulfilled) that await_resume never consumed, reclaims
+        /// them into the pool so the BoundedWait checked-out count is not leaked (possibly handing them
+        /// straight to the next waiters, resumed after the lock is released).
         ///
-        /// @warning A task that has already been handed a mapper must still be driven to completion:
+        /// @warning A task that has already been handed its mappers must still be driven to completion:
         /// the resumption Return() scheduled cannot be cancelled, so a coroutine frame with a pending
         /// resumption must not be freed (do not destroy such a task concurrently with, or right after,
         /// the hand-off). Likewise the pool must outlive every task acquired from it.
         ~AsyncAcquireAwaitable()
         {
             if (!node)
+            {
+                // Only non-empty if acquiring threw midway; give back what was taken.
+                for (auto& dm: acquired)
+                    pool.Return(std::move(dm));
                 return;
-            std::shared_ptr<WaiterNode> toResume;
+            }
+            if constexpr (Config.growthStrategy == GrowthStrategy::BoundedWait)
             {
-                std::scoped_lock const lock(pool._mutex);
-                switch (node->state)
+                std::vector<std::shared_ptr<WaiterNode>> toResume;
                 {
-                    case WaiterNode::State::Parked:
-                        // Never fulfilled: remove ourselves so Return() won't hand off to a dead frame.
-                        // Parking never incremented _checkedOut, so there is nothing to release.
-                        node->state = WaiterNode::State::Abandoned;
-                        std::erase(pool._waiters, node);
-                        break;
-                    case WaiterNode::State::Fulfilled:
-                        // Handed a mapper but the task is dropped before consuming it: reclaim it,
-                        // releasing this acquisition's checked-out count so the pool does not leak.
-                        node->state = WaiterNode::State::Abandoned;
-                        if constexpr (Config.growthStrategy == GrowthStrategy::BoundedWait)
-                        {
-                            if (node->mapper)
-                                toResume = pool.ReturnLocked(std::move(node->mapper));
-                        }
-                        break;
-                    case WaiterNode::State::Abandoned:
-                        break;
+                    std::scoped_lock const lock(pool._mutex);
+                    switch (node->state)
+                    {
+                        case WaiterNode::State::Parked:
+                            // Never fulfilled: remove ourselves so Return() won't hand off to a dead frame.
+                            // Mappers a collecting reservation holds are still checked out: pass them on.
+                            node->state = WaiterNode::State::Abandoned;
+                            std::erase(pool._waiters[ClassIndex(node->priority)], node);
+                            if (pool._collecting == node)
+                                pool._collecting.reset();
+                            pool.ReclaimLocked(node->mappers, toResume);
+                            break;
+                        case WaiterNode::State::Fulfilled:
+                            // Handed mappers but the task is dropped before consuming them: reclaim them,
+                            // releasing this acquisition's checked-out count so the pool does not leak.
+                            node->state = WaiterNode::State::Abandoned;
+                            pool.ReclaimLocked(node->mappers, toResume);
+                            break;
+                        case WaiterNode::State::Abandoned:
+                            break;
+                    }
                 }
+                for (auto const& waiter: toResume)
+                    waiter->resume->Resume(waiter->handle);
             }
-            if (toResume)
-                toResume->resume->Resume(toResume->handle);
         }
 
         [[nodiscard]] bool await_ready() const noexcept
@@ -489,56 +771,90 @@ class Pool
         bool await_suspend(std::coroutine_handle<> handle)
         {
             std::scoped_lock const lock(pool._mutex);
-            if (!pool._idleDataMappers.empty())
+            // Only BoundedWait bounds the pool and parks coroutines on exhaustion. The non-blocking
+            // strategies (BoundedOverflow — the default — and UnboundedGrow) always succeed here, creating
+            // fresh mappers as needed, matching the synchronous Acquire() overloads, which never suspend.
+            if (pool.TryReserveLocked(needed, acquired))
             {
-                acquired = std::move(pool._idleDataMappers.back());
-                pool._idleDataMappers.pop_back();
-                if constexpr (Config.growthStrategy == GrowthStrategy::BoundedWait)
-                    ++pool._checkedOut;
-                SqlLogger::GetLogger().OnConnectionReuse(acquired->Connection());
+                pool.RecordAcquisitionLocked(priority);
                 return false; // do not suspend — resume immediately
             }
-            // Only BoundedWait bounds the pool and parks coroutines on exhaustion. The non-blocking
-            // strategies (BoundedOverflow — the default — and UnboundedGrow) always create a fresh
-            // mapper here, matching the synchronous Acquire() overloads, which also never suspend.
             if constexpr (Config.growthStrategy == GrowthStrategy::BoundedWait)
             {
-                if (pool._checkedOut >= Config.maxSize)
+                node = std::make_shared<WaiterNode>(WaiterNode::Kind::Async, priority, needed);
+                node->handle = handle;
+                node->resume = &resume;
+                // A reservation that finds part of what it needs claims it now and collects the rest as
+                // mappers are returned — unless another reservation is already collecting.
+                if (!pool._collecting)
                 {
-                    node = std::make_shared<WaiterNode>(WaiterNode::Kind::Async);
-                    node->handle = handle;
-                    node->resume = &resume;
-                    pool._waiters.push_back(node);
-                    return true; // suspend until a mapper is returned
+                    pool.TakeAvailableLocked(node->mappers, needed);
+                    if (!node->mappers.empty())
+                        pool._collecting = node;
                 }
-                ++pool._checkedOut;
+                pool._waiters[ClassIndex(priority)].push_back(node);
             }
-            acquired = std::make_unique<DataMapper>();
-            return false;
+            return true; // suspend until the mappers are handed over
         }
 
-        std::unique_ptr<DataMapper> await_resume() noexcept
+        std::vector<std::unique_ptr<DataMapper>> await_resume() noexcept
         {
-            // If we suspended, Return() placed the mapper in the shared node; take it here (on the
+            // If we suspended, Return() placed the mappers in the shared node; take them here (on the
             // resuming thread, with no concurrent access per the destruction contract). That leaves
-            // node->mapper empty, so the destructor treats the node as already consumed.
+            // node->mappers empty, so the destructor treats the node as already consumed.
             if (node)
-                return std::move(node->mapper);
+                return std::move(node->mappers);
             return std::move(acquired);
         }
     };
 
-    Async::Task<PooledDataMapper> AcquireAsyncImpl(Async::IExecutor* dbWorkers, Async::IResumeScheduler* resume)
+    Async::Task<PooledDataMapper> AcquireAsyncImpl(Async::IExecutor* dbWorkers,
+                                                   Async::IResumeScheduler* resume,
+                                                   AcquirePriority priority)
     {
-        auto dm = co_await AsyncAcquireAwaitable { *this, *resume };
+        auto mappers = co_await AsyncAcquireAwaitable { *this, *resume, priority, 1 };
         // Wrap in the RAII PooledDataMapper BEFORE the throwing EnableAsync call: if EnableAsync
         // throws (e.g. bad_alloc), ~PooledDataMapper returns the mapper to the pool, decrementing
         // _checkedOut and avoiding a permanent BoundedWait capacity leak.
-        auto pooled = PooledDataMapper(*this, std::move(dm));
+        auto pooled = PooledDataMapper(*this, std::move(mappers.front()));
         pooled->Connection().EnableAsync(*dbWorkers, *resume);
         co_return std::move(pooled);
     }
 
+    Async::Task<std::vector<PooledDataMapper>> AcquireManyAsyncImpl(Async::IExecutor* dbWorkers,
+                                                                    Async::IResumeScheduler* resume,
+                                                                    size_t count,
+                                                                    AcquirePriority priority)
+    {
+        // Reserve before acquiring, so wrapping the acquired mappers below cannot throw and leak them.
+        auto pooled = std::vector<PooledDataMapper> {};
+        pooled.reserve(count);
+        auto mappers = co_await AsyncAcquireAwaitable { *this, *resume, priority, count };
+        for (auto& dm: mappers)
+            pooled.push_back(PooledDataMapper(*this, std::move(dm)));
+        for (auto& dm: pooled)
+            dm->Connection().EnableAsync(*dbWorkers, *resume);
+        co_return pooled;
+    }
+
+    /// Runs the queries of a @ref QueryManyAsync fan-out concurrently, query @c I on @p mappers[I].
+    template <typename... Records, DataMapperOptions... QueryOptions, size_t... Indexes>
+    static Async::Task<std::tuple<std::vector<Records>...>> FanOutQueries(
+        std::vector<PooledDataMapper> mappers,
+        std::index_sequence<Indexes...> /*indexes*/,
+        SqlRenderedSelect<Records, QueryOptions>... queries)
+    {
+        co_return co_await Async::WhenAll(QueryOn(mappers[Indexes], std::move(queries))...);
+    }
+
+    /// Runs one query of a @ref QueryManyAsync fan-out on @p dm, which outlives the returned task.
+    template <typename Record, DataMapperOptions QueryOptions>
+    static Async::Task<std::vector<Record>> QueryOn(PooledDataMapper& dm, SqlRenderedSelect<Record, QueryOptions> query)
+    {
+        auto [records] = co_await dm->QueryManyAsync(std::move(query));
+        co_return std::move(records);
+    }
+
     std::mutex _mutex;
     std::vector<std::unique_ptr<DataMapper>> _idleDataMappers;
     size_t _checkedOut {};
@@ -546,9 +862,16 @@ class Pool
     /// Null until configured. Only references are held; they must outlive the pool's async use.
     Async::IExecutor* _asyncDbWorkers = nullptr;
     Async::IResumeScheduler* _asyncResume = nullptr;
-    /// FIFO of parked acquirers (sync @ref Acquire threads and async @ref AcquireAsync coroutines) in
-    /// arrival order. Each sync waiter owns its CV inside its @ref WaiterNode, so no shared CV is needed.
-    std::deque<std::shared_ptr<WaiterNode>> _waiters;
+    /// Parked acquirers (sync @ref Acquire threads and async @ref AcquireAsync coroutines), one FIFO per
+    /// @ref AcquirePriority class in arrival order. Each sync waiter owns its CV inside its
+    /// @ref WaiterNode, so no shared CV is needed.
+    std::array<std::deque<std::shared_ptr<WaiterNode>>, 2> _waiters;
+    /// The parked @ref AcquireManyAsync reservation that returned mappers are collected for, if any.
+    std::shared_ptr<WaiterNode> _collecting;
+    /// Interactive hand-offs since the last batch hand-off while batch waiters were parked.
+    size_t _interactiveStreak {};
+    /// Wait-time statistics per @ref AcquirePriority class, see @ref WaitStatistics.
+    std::array<PoolWaitStatistics, 2> _waitStatistics {};
 };
 
 // Default pool configuration, configurable via CMake options:
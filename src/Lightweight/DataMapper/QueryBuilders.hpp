@@ -11,12 +11,22 @@
 #include "Record.hpp"
 
 #include <cstdint>
+#include <stop_token>
 
 namespace Lightweight
 {
 
 class DataMapper;
 
+namespace detail
+{
+    template <typename Record, auto... ReferencedFields>
+    struct ProjectedMembers;
+
+    template <typename Record, auto... ReferencedFields>
+    bool ReadProjectedRecord(SqlResultCursor& reader, Record& record);
+} // namespace detail
+
 /// Structural type for options for DataMapper queries.
 /// This allows to configure behavior of the queries at compile time
 /// when using query builder directly from the DataMapper
@@ -39,6 +49,26 @@ enum class SqlQueryExecutionMode : std::uint8_t
     Asynchronous,
 };
 
+/// A SELECT rendered from a DataMapper query builder, detached from the builder that produced it.
+///
+/// Carries everything needed to run the query later, possibly on another connection of the same
+/// database type: the SQL text and its bound input values. The record type and query options are
+/// kept in the type, so the result can be read back into the right records.
+///
+/// @ingroup DataMapper
+template <typename Record, DataMapperOptions QueryOptions = {}>
+struct SqlRenderedSelect
+{
+    /// The rendered SELECT statement.
+    std::string query;
+    /// The values bound to the statement's parameter markers, in order.
+    std::vector<SqlVariant> inputs;
+};
+
+/// A query builder that can render its SELECT without executing it, see @c SqlRenderedSelect.
+template <typename T>
+concept SqlSelectRenderer = requires(T const& builder) { builder.RenderAll(); };
+
 /// Main API for mapping records to C++ from the database using high level C++ syntax.
 ///
 /// @ingroup DataMapper
@@ -52,6 +82,10 @@ class [[nodiscard]] SqlCoreDataMapperQueryBuilder: public SqlBasicSelectQueryBui
     std::string _fields;
     std::vector<SqlVariant> _boundInputs;
 
+    // Set by Only(): the projected column list and the matching row reader.
+    std::string_view _projectedFields;
+    bool (*_projectedReader)(SqlResultCursor& reader, Record& record) = nullptr;
+
     friend class SqlWhereClauseBuilder<Derived>;
 
     LIGHTWEIGHT_FORCE_INLINE SqlSearchCondition& SearchCondition() noexcept
@@ -94,6 +128,27 @@ class [[nodiscard]] SqlCoreDataMapperQueryBuilder: public SqlBasicSelectQueryBui
         return RunFinisher([this] { return CountImpl(); });
     }
 
+    /// @brief Restricts the records read by All(), First() and Range() to the given fields.
+    ///
+    /// The primary key is always read as well, so the records can be updated, deleted or passed to
+    /// DataMapper::LoadFields. The other fields keep their default values and report @c IsLoaded()
+    /// as false, which spares list queries the transfer of large text or binary columns. No field is
+    /// marked as modified, so an Update() of such a record only writes what is changed afterwards.
+    /// DataMapper::LoadFields reads skipped fields on demand.
+    ///
+    /// @code
+    /// auto users = dm.Query<User>().Only<&User::id, &User::name>().All(); // without bio and avatar
+    /// dm.LoadFields<&User::bio>(users.front());
+    /// @endcode
+    template <auto... ReferencedFields>
+        requires(sizeof...(ReferencedFields) >= 1)
+    [[nodiscard]] Derived& Only()
+    {
+        _projectedFields = detail::ProjectedMembers<Record, ReferencedFields...>::Fields;
+        _projectedReader = &detail::ReadProjectedRecord<Record, ReferencedFields...>;
+        return static_cast<Derived&>(*this);
+    }
+
     /// Executes a SELECT query and returns all records found.
     [[nodiscard]] auto All()
     {
@@ -106,6 +161,58 @@ class [[nodiscard]] SqlCoreDataMapperQueryBuilder: public SqlBasicSelectQueryBui
         return RunFinisher([this] { return DeleteImpl(); });
     }
 
+    /// Renders the SELECT query that @c All() would execute, without executing it.
+    ///
+    /// Used to combine several independent queries into one round-trip, see @c DataMapper::QueryMany.
+    [[nodiscard]] SqlRenderedSelect<Record, QueryOptions> RenderAll() const
+    {
+        return { .query = _formatter.SelectAll(this->_query.distinct,
+                                               _fields,
+                                               RecordTableName<Record>,
+                                               this->_query.searchCondition.tableAlias,
+                                               this->_query.searchCondition.tableJoins,
+                                               this->_query.searchCondition.condition,
+                                               this->_query.orderBy,
+                                               this->_query.groupBy),
+                 .inputs = _boundInputs };
+    }
+
+    /// Renders the SELECT query that @c First() would execute, without executing it.
+    [[nodiscard]] SqlRenderedSelect<Record, QueryOptions> RenderFirst() const
+    {
+        return { .query = _formatter.SelectFirst(this->_query.distinct,
+                                                 _fields,
+                                                 RecordTableName<Record>,
+                                                 this->_query.searchCondition.tableAlias,
+                                                 this->_query.searchCondition.tableJoins,
+                                                 this->_query.searchCondition.condition,
+                                                 this->_query.orderBy,
+                                                 this->_query.groupBy,
+                                                 1),
+                 .inputs = _boundInputs };
+    }
+
+    /// Executes a SELECT query and streams the records found in blocks of up to @p blockRows records.
+    ///
+    /// Only available on @c DataMapper::QueryAsync builders. Unlike @c All(), which materializes the
+    /// whole result in one offloaded step, each block is fetched by its own step on the connection's
+    /// strand, and only when the consumer awaits @c Generator::Next, so memory stays bounded by one block.
+    /// The query is rendered when @c Stream() is called, so the builder itself need not outlive the
+    /// generator; the DataMapper must, and its connection must not be used for anything else while the
+    /// stream is open. If @p token is stopped between blocks, the cursor is closed and the pending
+    /// @c Next completes with @c Async::OperationCancelledError.
+    ///
+    /// @code
+    /// auto stream = dm.QueryAsync<Person>().OrderBy(FieldNameOf<&Person::id>, SqlResultOrdering::ASCENDING).Stream(500);
+    /// while (auto block = co_await stream.Next())
+    ///     co_await Send(*block);
+    /// @endcode
+    [[nodiscard]] Async::Generator<std::vector<Record>> Stream(size_t blockRows = 1000, std::stop_token token = {})
+        requires(Derived::QueryExecution == SqlQueryExecutionMode::Asynchronous && DataMapperRecord<Record>)
+    {
+        return StreamImpl(blockRows, std::move(token));
+    }
+
     /// @brief Executes a SELECT query and returns all records found for the specified field.
     ///
     /// @tparam Field The field to select from the record, in the form of &Record::FieldName.
@@ -231,6 +338,7 @@ class [[nodiscard]] SqlCoreDataMapperQueryBuilder: public SqlBasicSelectQueryBui
     [[nodiscard]] size_t CountImpl();
     [[nodiscard]] std::vector<Record> AllImpl();
     void DeleteImpl();
+    [[nodiscard]] Async::Generator<std::vector<Record>> StreamImpl(size_t blockRows, std::stop_token token);
 
     template <auto Field>
 #if defined(LIGHTWEIGHT_CXX26_REFLECTION)
@@ -267,6 +375,18 @@ class [[nodiscard]] SqlCoreDataMapperQueryBuilder: public SqlBasicSelectQueryBui
 
     template <auto... ReferencedFields>
     [[nodiscard]] std::vector<Record> RangeImpl(size_t offset, size_t limit);
+
+    /// The column list of the record-returning finishers: all fields, or those chosen by Only().
+    [[nodiscard]] std::string_view SelectedFields() const noexcept
+    {
+        return _projectedReader ? _projectedFields : std::string_view { _fields };
+    }
+
+    /// Reads the result of a record-returning finisher, honoring Only().
+    void ReadRecords(SqlResultCursor reader, std::vector<Record>* records) const;
+
+    /// Reads the single-record result of a record-returning finisher, honoring Only().
+    void ReadRecord(SqlResultCursor reader, std::optional<Record>* record) const;
 };
 
 /// @brief Represents a query builder that retrieves all fields of a record.
@@ -287,6 +407,8 @@ class [[nodiscard]] SqlAllFieldsQueryBuilder final:
     friend class SqlCoreDataMapperQueryBuilder<Record,
                                                SqlAllFieldsQueryBuilder<Record, QueryOptions, Execution>,
                                                QueryOptions>;
+    template <typename CompiledRecord, DataMapperOptions CompiledQueryOptions, typename... Params>
+    friend class SqlCompiledQuery;
 
     /// The execution mode (synchronous/asynchronous) read by the CRTP base to dispatch finishers.
     static constexpr SqlQueryExecutionMode QueryExecution = Execution;
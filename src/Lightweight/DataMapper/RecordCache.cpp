@@ -0,0 +1,176 @@
+// SPDX-License-Identifier: Apache-2.0
+
+#include "RecordCache.hpp"
+
+#include <algorithm>
+#include <functional>
+
+namespace Lightweight
+{
+
+RecordCache& RecordCache::Instance()
+{
+    static RecordCache instance;
+    return instance;
+}
+
+RecordCache::Shard& RecordCache::ShardOf(std::string const& key) noexcept
+{
+    return _shards[std::hash<std::string> {}(key) % ShardCount];
+}
+
+std::uint64_t& RecordCache::GenerationOf(Shard& shard, std::string const& key) noexcept
+{
+    return shard.generations[std::hash<std::string> {}(key) / ShardCount % GenerationSlots];
+}
+
+void RecordCache::EvictLocked(Shard& shard, std::size_t shardCapacity)
+{
+    while (shard.entries.size() > shardCapacity)
+    {
+        shard.index.erase(shard.entries.back().first);
+        shard.entries.pop_back();
+        ++shard.statistics.evictions;
+    }
+}
+
+void RecordCache::SetCapacity(std::size_t capacity)
+{
+    _capacity.store(capacity, std::memory_order_relaxed);
+    auto const shardCapacity = std::max<std::size_t>(capacity / ShardCount, 1);
+    for (auto& shard: _shards)
+    {
+        std::scoped_lock const lock(shard.mutex);
+        EvictLocked(shard, shardCapacity);
+    }
+}
+
+std::size_t RecordCache::Capacity() const noexcept
+{
+    return _capacity.load(std::memory_order_relaxed);
+}
+
+std::shared_ptr<void const> RecordCache::Find(std::string const& key)
+{
+    auto& shard = ShardOf(key);
+    std::scoped_lock const lock(shard.mutex);
+    auto const it = shard.index.find(key);
+    if (it == shard.index.end())
+    {
+        ++shard.statistics.misses;
+        return nullptr;
+    }
+    ++shard.statistics.hits;
+    shard.entries.splice(shard.entries.begin(), shard.entries, it->second);
+    return it->second->second;
+}
+
+void RecordCache::Insert(std::string const& key, std::shared_ptr<void const> record)
+{
+    auto& shard = ShardOf(key);
+    std::scoped_lock const lock(shard.mutex);
+    InsertLocked(shard, key, std::move(record));
+}
+
+std::uint64_t RecordCache::Generation(std::string const& key)
+{
+    auto& shard = ShardOf(key);
+    std::scoped_lock const lock(shard.mutex);
+    return GenerationOf(shard, key);
+}
+
+bool RecordCache::Insert(std::string const& key, std::shared_ptr<void const> record, std::uint64_t generation)
+{
+    auto& shard = ShardOf(key);
+    std::scoped_lock const lock(shard.mutex);
+    if (GenerationOf(shard, key) != generation)
+        return false;
+    InsertLocked(shard, key, std::move(record));
+    return true;
+}
+
+void RecordCache::InsertLocked(Shard& shard, std::string const& key, std::shared_ptr<void const> record)
+{
+    auto const shardCapacity = std::max<std::size_t>(Capacity() / ShardCount, 1);
+    if (auto const it = shard.index.find(key); it != shard.index.end())
+    {
+        it->second->second = std::move(record);
+        shard.entries.splice(shard.entries.begin(), shard.entries, it->second);
+    }
+    else
+    {
+        shard.entries.emplace_front(key, std::move(record));
+        shard.index.emplace(key, shard.entries.begin());
+    }
+    ++shard.statistics.insertions;
+    EvictLocked(shard, shardCapacity);
+}
+
+void RecordCache::Invalidate(std::string const& key)
+{
+    auto& shard = ShardOf(key);
+    std::scoped_lock const lock(shard.mutex);
+    ++GenerationOf(shard, key);
+    if (auto const it = shard.index.find(key); it != shard.index.end())
+    {
+        shard.entries.erase(it->second);
+        shard.index.erase(it);
+        ++shard.statistics.invalidations;
+    }
+}
+
+void RecordCache::InvalidateTable(std::string_view tableName)
+{
+    auto const prefix = detail::MakeRecordCacheTablePrefix(tableName);
+    for (auto& shard: _shards)
+    {
+        std::scoped_lock const lock(shard.mutex);
+        for (auto& generation: shard.generations)
+            ++generation;
+        shard.entries.remove_if([&](auto const& entry) {
+            if (!entry.first.starts_with(prefix))
+                return false;
+            shard.index.erase(entry.first);
+            ++shard.statistics.invalidations;
+            return true;
+        });
+    }
+}
+
+void RecordCache::Clear()
+{
+    for (auto& shard: _shards)
+    {
+        std::scoped_lock const lock(shard.mutex);
+        for (auto& generation: shard.generations)
+            ++generation;
+        shard.index.clear();
+        shard.entries.clear();
+    }
+}
+
+RecordCacheStatistics RecordCache::Statistics() const
+{
+    auto result = RecordCacheStatistics {};
+    for (auto const& shard: _shards)
+    {
+        std::scoped_lock const lock(shard.mutex);
+        result.hits += shard.statistics.hits;
+        result.misses += shard.statistics.misses;
+        result.insertions += shard.statistics.insertions;
+        result.evictions += shard.statistics.evictions;
+        result.invalidations += shard.statistics.invalidations;
+    }
+    return result;
+}
+
+void RecordCache::ResetStatistics()
+{
+    for (auto& shard: _shards)
+    {
+        std::scoped_lock const lock(shard.mutex);
+        shard.statistics = {};
+    }
+}
+
+} // namespace Lightweight
@@ -0,0 +1,282 @@
+// SPDX-License-Identifier: Apache-2.0
+#pragma once
+
+#include "../Api.hpp"
+#include "Record.hpp"
+
+#include <array>
+#include <atomic>
+#include <concepts>
+#include <cstddef>
+#include <cstdint>
+#include <format>
+#include <iterator>
+#include <list>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <string_view>
+#include <tuple>
+#include <unordered_map>
+#include <utility>
+
+namespace Lightweight
+{
+
+/// @ingroup DataMapper
+/// Lookup counters of a record cache, see @ref RecordCache::Statistics and
+/// @c DataMapper::IdentityMapStatistics.
+struct RecordCacheStatistics
+{
+    /// Lookups answered from the cache.
+    std::uint64_t hits {};
+    /// Lookups that had to go to the database.
+    std::uint64_t misses {};
+    /// Records stored after a miss.
+    std::uint64_t insertions {};
+    /// Records dropped to stay within the capacity.
+    std::uint64_t evictions {};
+    /// Records dropped because they were updated or deleted.
+    std::uint64_t invalidations {};
+
+    /// @return the share of lookups answered from the cache, or 0 if there were none.
+    [[nodiscard]] double HitRatio() const noexcept
+    {
+        auto const lookups = hits + misses;
+        return lookups == 0 ? 0.0 : static_cast<double>(hits) / static_cast<double>(lookups);
+    }
+};
+
+namespace detail
+{
+    /// Whether a primary key value can be rendered into a cache key.
+    template <typename T>
+    concept RecordCacheKeyPart = requires(T const& value) { std::format("{}", value); };
+
+    template <typename KeyTuple>
+    struct RecordCacheKeyTupleHelper: std::false_type
+    {
+    };
+
+    template <typename... Keys>
+    struct RecordCacheKeyTupleHelper<std::tuple<Keys...>>: std::bool_constant<(RecordCacheKeyPart<Keys> && ...)>
+    {
+    };
+
+    /// Whether @p Record can be cached: it is copied in and out of the cache, and its primary key
+    /// values must render into the textual cache key.
+    template <typename Record>
+    concept CacheableRecord = HasPrimaryKey<Record> && std::copy_constructible<Record>
+                              && RecordCacheKeyTupleHelper<RecordPrimaryKeyTuple<Record>>::value;
+
+    /// Renders the cache key of the @p Record identified by @p keys: the table name followed by the
+    /// primary key values, each terminated by a unit separator.
+    template <typename Record>
+    std::string MakeRecordCacheKey(RecordPrimaryKeyTuple<Record> const& keys)
+    {
+        auto result = std::string { RecordTableName<Record> };
+        result += '\x1f';
+        std::apply(
+            [&result](auto const&... values) {
+                ((std::format_to(std::back_inserter(result), "{}", values), result += '\x1f'), ...);
+            },
+            keys);
+        return result;
+    }
+
+    /// The prefix shared by the cache keys of all records of @p tableName.
+    inline std::string MakeRecordCacheTablePrefix(std::string_view tableName)
+    {
+        auto result = std::string { tableName };
+        result += '\x1f';
+        return result;
+    }
+
+    template <typename Record>
+    inline std::atomic<bool> RecordCacheEnabled { false };
+} // namespace detail
+
+/// @ingroup DataMapper
+/// @brief Process-wide, size-bounded, read-through cache of records loaded by primary key.
+///
+/// Caching is opt-in per record type via Enable(). For enabled types, @c DataMapper::QuerySingle
+/// (and thereby the loading of @c BelongsTo relations) serves records from this cache, and stores
+/// what it had to read from the database. @c DataMapper::Update, @c UpdateAll, @c Delete,
+/// @c DeleteAll and @c DeleteByIds invalidate the affected entries, so the cache is coherent with
+/// changes made through DataMappers of this process, but not with changes made by other processes:
+/// enable it for reference data that changes rarely, such as currencies or categories.
+///
+/// Entries are keyed by RecordTableName and primary key and spread over @ref ShardCount
+/// independently locked shards, each evicting its least recently used entries beyond its share of
+/// the capacity. The key does not name the database: DataMappers connected to different databases
+/// share the entries of their equally named tables, so only enable the cache for record types that
+/// all of the process's connections read from the same database.
+///
+/// A read-through store cannot bring back a record that was invalidated while it was being read:
+/// the reader takes the key's Generation() before querying the database and passes it to Insert(),
+/// which drops the record if the key was invalidated in between.
+///
+/// @code
+/// RecordCache::Instance().Enable<Currency>();
+/// auto const euro = dm.QuerySingle<Currency>("EUR"); // read from the database, then cached
+/// auto const again = dm.QuerySingle<Currency>("EUR"); // served from the cache
+/// std::println("hit ratio: {}", RecordCache::Instance().Statistics().HitRatio());
+/// @endcode
+class RecordCache
+{
+  public:
+    /// Number of independently locked shards.
+    static constexpr std::size_t ShardCount = 16;
+
+    /// Number of invalidation generations per shard; keys of a shard sharing one only cost each
+    /// other a skipped store.
+    static constexpr std::size_t GenerationSlots = 64;
+
+    /// Default total number of cached records.
+    static constexpr std::size_t DefaultCapacity = 10'000;
+
+    /// @return the process-wide cache.
+    LIGHTWEIGHT_API static RecordCache& Instance();
+
+    RecordCache() = default;
+    RecordCache(RecordCache const&) = delete;
+    RecordCache(RecordCache&&) = delete;
+    RecordCache& operator=(RecordCache const&) = delete;
+    RecordCache& operator=(RecordCache&&) = delete;
+    ~RecordCache() = default;
+
+    /// Starts caching records of type @p Record.
+    template <typename Record>
+        requires detail::CacheableRecord<Record>
+    void Enable() noexcept
+    {
+        detail::RecordCacheEnabled<Record>.store(true, std::memory_order_release);
+    }
+
+    /// Stops caching records of type @p Record and drops the cached ones.
+    template <typename Record>
+    void Disable()
+    {
+        detail::RecordCacheEnabled<Record>.store(false, std::memory_order_release);
+        InvalidateTable(RecordTableName<Record>);
+    }
+
+    /// @return whether records of type @p Record are cached.
+    template <typename Record>
+    [[nodiscard]] static bool IsEnabled() noexcept
+    {
+        return detail::RecordCacheEnabled<Record>.load(std::memory_order_acquire);
+    }
+
+    /// Sets the total number of cached records, evicting the least recently used ones beyond it.
+    LIGHTWEIGHT_API void SetCapacity(std::size_t capacity);
+
+    /// @return the total number of cached records.
+    [[nodiscard]] LIGHTWEIGHT_API std::size_t Capacity() const noexcept;
+
+    /// @return the cached record of @p key, or nullptr; counted as a hit or a miss.
+    [[nodiscard]] LIGHTWEIGHT_API std::shared_ptr<void const> Find(std::string const& key);
+
+    /// Stores @p record under @p key, replacing a previous entry.
+    LIGHTWEIGHT_API void Insert(std::string const& key, std::shared_ptr<void const> record);
+
+    /// @return the invalidation generation of @p key, to be taken before reading its record from the
+    /// database and passed to the Insert() of what was read.
+    [[nodiscard]] LIGHTWEIGHT_API std::uint64_t Generation(std::string const& key);
+
+    /// Stores @p record under @p key, unless @p key was invalidated since @p generation was taken.
+    ///
+    /// @return whether @p record was stored.
+    LIGHTWEIGHT_API bool Insert(std::string const& key, std::shared_ptr<void const> record, std::uint64_t generation);
+
+    /// Drops the entry of @p key, if any.
+    LIGHTWEIGHT_API void Invalidate(std::string const& key);
+
+    /// Drops all entries of @p tableName.
+    LIGHTWEIGHT_API void InvalidateTable(std::string_view tableName);
+
+    /// Drops all entries.
+    LIGHTWEIGHT_API void Clear();
+
+    /// @return the counters summed over all shards since the start or the last ResetStatistics().
+    [[nodiscard]] LIGHTWEIGHT_API RecordCacheStatistics Statistics() const;
+
+    /// Resets the counters of Statistics().
+    LIGHTWEIGHT_API void ResetStatistics();
+
+  private:
+    struct Shard
+    {
+        using Entry = std::pair<std::string, std::shared_ptr<void const>>;
+
+        mutable std::mutex mutex;
+        /// Most recently used first.
+        std::list<Entry> entries;
+        std::unordered_map<std::string, std::list<Entry>::iterator> index;
+        /// Bumped by every invalidation of a key hashing to the slot, whether it was cached or not.
+        std::array<std::uint64_t, GenerationSlots> generations {};
+        RecordCacheStatistics statistics;
+    };
+
+    Shard& ShardOf(std::string const& key) noexcept;
+    static std::uint64_t& GenerationOf(Shard& shard, std::string const& key) noexcept;
+    void InsertLocked(Shard& shard, std::string const& key, std::shared_ptr<void const> record);
+    void EvictLocked(Shard& shard, std::size_t shardCapacity);
+
+    std::array<Shard, ShardCount> _shards;
+    std::atomic<std::size_t> _capacity { DefaultCapacity };
+};
+
+/// @ingroup DataMapper
+/// @brief Records loaded by primary key during one unit of work of a single DataMapper.
+///
+/// Active while a @c DataMapper::IdentityMapScope exists. Unlike the RecordCache it is neither
+/// bounded nor shared, and holds records of every type; it lives only as long as the unit of work.
+class RecordIdentityMap
+{
+  public:
+    /// @return the record of @p key, or nullptr; counted as a hit or a miss.
+    [[nodiscard]] std::shared_ptr<void const> Find(std::string const& key)
+    {
+        if (auto const it = _records.find(key); it != _records.end())
+        {
+            ++_statistics.hits;
+            return it->second;
+        }
+        ++_statistics.misses;
+        return nullptr;
+    }
+
+    /// Stores @p record under @p key.
+    void Insert(std::string const& key, std::shared_ptr<void const> record)
+    {
+        _records.insert_or_assign(key, std::move(record));
+        ++_statistics.insertions;
+    }
+
+    /// Drops the record of @p key, if any.
+    void Invalidate(std::string const& key)
+    {
+        _statistics.invalidations += _records.erase(key);
+    }
+
+    /// Drops all records of @p tableName.
+    void InvalidateTable(std::string_view tableName)
+    {
+        auto const prefix = detail::MakeRecordCacheTablePrefix(tableName);
+        _statistics.invalidations +=
+            std::erase_if(_records, [&prefix](auto const& entry) { return entry.first.starts_with(prefix); });
+    }
+
+    /// @return the lookup counters of this unit of work.
+    [[nodiscard]] RecordCacheStatistics const& Statistics() const noexcept
+    {
+        return _statistics;
+    }
+
+  private:
+    std::unordered_map<std::string, std::shared_ptr<void const>> _records;
+    RecordCacheStatistics _statistics;
+};
+
+} // namespace Lightweight
@@ -6,12 +6,14 @@ module;
 #include "Async/Backend.hpp"
 #include "Async/CancellationToken.hpp"
 #include "Async/Executor.hpp"
+#include "Async/Generator.hpp"
 #include "Async/ManualExecutor.hpp"
 #include "Async/StrandExecutor.hpp"
 #include "Async/SyncWait.hpp"
 #include "Async/Task.hpp"
 #include "Async/ThreadOffloadBackend.hpp"
 #include "Async/ThreadPoolExecutor.hpp"
+#include "Async/WhenAll.hpp"
 #include "DataBinder/SqlRawColumn.hpp"
 #include "DataMapper/QueryBuilders.hpp"
 #include "Lightweight.hpp"
@@ -23,10 +25,12 @@ module;
 #include "SqlBackup/Sha256.hpp"
 #include "SqlBackup/SqlBackup.hpp"
 #include "SqlBackup/TableFilter.hpp"
+#include "SqlBackup/Xxh3.hpp"
 #include "SqlErrorDetection.hpp"
 #include "SqlScopedLock.hpp"
 #include "ThreadSafeQueue.hpp"
 #include "Tools/CxxModelPrinter.hpp"
+#include "Zip/MappedZipArchive.hpp"
 #include "Zip/ZipArchive.hpp"
 #include "Zip/ZipError.hpp"
 
@@ -46,6 +50,7 @@ using Lightweight::Connection;
 using Lightweight::ConnectionType;
 using Lightweight::ConvertWindows1252ToUtf8;
 using Lightweight::DataMapper;
+using Lightweight::DataMapperDeleteOptions;
 using Lightweight::DataMapperOptions;
 using Lightweight::DataMapperRecord;
 using Lightweight::DataMapperRecords;
@@ -104,8 +109,11 @@ using Lightweight::ParseEncryptionMode;
 using Lightweight::PostgreSqlFormatter;
 using Lightweight::PrimaryKey;
 using Lightweight::QualifiedColumnName;
+using Lightweight::RecordCache;
+using Lightweight::RecordCacheStatistics;
 using Lightweight::RecordColumnCount;
 using Lightweight::RecordColumnMember;
+using Lightweight::RecordIdentityMap;
 using Lightweight::RecordPrimaryKeyIndex;
 using Lightweight::RecordPrimaryKeyOf;
 using Lightweight::RecordPrimaryKeyType;
@@ -125,13 +133,18 @@ using Lightweight::SqlAlterTableCommand;
 using Lightweight::SqlAlterTablePlan;
 using Lightweight::SqlAlterTableQueryBuilder;
 using Lightweight::SqlAnsiString;
+using Lightweight::SqlArrayElementType;
+using Lightweight::SqlFingerprintColumn;
 using Lightweight::SqlBasicSelectQueryBuilder;
 using Lightweight::SqlBasicStringBinderConcept;
 using Lightweight::SqlBasicStringOperations;
 using Lightweight::SqlBinary;
 using Lightweight::SqlColumnDeclaration;
+using Lightweight::SqlColumnSummary;
 using Lightweight::SqlColumnTypeDefinition;
 using Lightweight::SqlColumnTypeDefinitionOf;
+using Lightweight::SqlCompiledQuery;
+using Lightweight::SqlCompiledQueryPlan;
 using Lightweight::SqlCompositeForeignKeyConstraint;
 using Lightweight::SqlConnectInfo;
 using Lightweight::SqlConnection;
@@ -171,6 +184,7 @@ using Lightweight::SqlFixedStringMode;
 using Lightweight::SqlForeignKeyReferenceDefinition;
 using Lightweight::SqlGetColumnNativeType;
 using Lightweight::SqlGuid;
+using Lightweight::SqlGuidSequence;
 using Lightweight::SqlInputParameterBatchBinder;
 using Lightweight::SqlInputParameterBinder;
 using Lightweight::SqlInsertDataPlan;
@@ -179,6 +193,9 @@ using Lightweight::SqlIsolationMode;
 using Lightweight::SQLiteQueryFormatter;
 using Lightweight::SqlJoinConditionBuilder;
 using Lightweight::SqlLastInsertIdQuery;
+using Lightweight::SqlLobChunkConsumer;
+using Lightweight::SqlLobChunkSource;
+using Lightweight::SqlLobType;
 using Lightweight::SqlLockError;
 using Lightweight::SqlLockFailureReason;
 using Lightweight::SqlLogger;
@@ -208,6 +225,7 @@ using Lightweight::SqlRawColumn;
 using Lightweight::SqlRawColumnMetadata;
 using Lightweight::SqlRawSqlPlan;
 using Lightweight::SqlRealName;
+using Lightweight::SqlRenderedSelect;
 using Lightweight::SqlRequireLoadedError;
 using Lightweight::SqlResultCursor;
 using Lightweight::SqlResultOrdering;
@@ -217,6 +235,7 @@ using Lightweight::SqlScopedTimeLogger;
 using Lightweight::SqlScopedTraceLogger;
 using Lightweight::SqlSearchCondition;
 using Lightweight::SqlSelectQueryBuilder;
+using Lightweight::SqlSelectRenderer;
 using Lightweight::SqlSentinelIterator;
 using Lightweight::SqlServerQueryFormatter;
 using Lightweight::SqlServerType;
@@ -224,6 +243,7 @@ using Lightweight::SqlSimpleDataBinder;
 using Lightweight::SqlStatement;
 using Lightweight::SqlString;
 using Lightweight::SqlText;
+using Lightweight::SqlTextColumnView;
 using Lightweight::SqlTime;
 using Lightweight::SqlTransaction;
 using Lightweight::SqlTransactionException;
@@ -262,6 +282,7 @@ namespace Async
     // C++23 coroutine async API (first-class, always built). Mirrors <Lightweight/Async/*.hpp>.
     using Lightweight::Async::Async;
     using Lightweight::Async::AsyncSqlTransaction;
+    using Lightweight::Async::Generator;
     using Lightweight::Async::IAsyncBackend;
     using Lightweight::Async::IExecutor;
     using Lightweight::Async::InlineExecutor;
@@ -275,6 +296,8 @@ namespace Async
     using Lightweight::Async::Task;
     using Lightweight::Async::ThreadOffloadBackend;
     using Lightweight::Async::ThreadPoolExecutor;
+    using Lightweight::Async::ThreadPoolScheduling;
+    using Lightweight::Async::WhenAll;
 } // namespace Async
 
 namespace Aggregate
@@ -309,11 +332,14 @@ namespace SqlBackup
     using Lightweight::SqlBackup::BackupSettings;
     using Lightweight::SqlBackup::BackupValue;
     using Lightweight::SqlBackup::CalculateRestoreSettings;
+    using Lightweight::SqlBackup::ChecksumAlgorithm;
+    using Lightweight::SqlBackup::ChecksumAlgorithmName;
     using Lightweight::SqlBackup::ChunkReader;
     using Lightweight::SqlBackup::ChunkWriter;
     using Lightweight::SqlBackup::ColumnBatch;
     using Lightweight::SqlBackup::CompressionMethod;
     using Lightweight::SqlBackup::CompressionMethodName;
+    using Lightweight::SqlBackup::ComputeChecksum;
     using Lightweight::SqlBackup::CreateMetadata;
     using Lightweight::SqlBackup::CreateMsgPackChunkReader;
     using Lightweight::SqlBackup::CreateMsgPackChunkReaderFromBuffer;
@@ -323,15 +349,24 @@ namespace SqlBackup
     using Lightweight::SqlBackup::GetSupportedCompressionMethods;
     using Lightweight::SqlBackup::IsCompressionMethodSupported;
     using Lightweight::SqlBackup::NullProgressManager;
+    using Lightweight::SqlBackup::ParseChecksumAlgorithm;
     using Lightweight::SqlBackup::ParseSchema;
     using Lightweight::SqlBackup::Progress;
     using Lightweight::SqlBackup::ProgressManager;
+    using Lightweight::SqlBackup::ReadStreamArchiveMetadata;
     using Lightweight::SqlBackup::Restore;
+    using Lightweight::SqlBackup::RestoreLoadStatistics;
     using Lightweight::SqlBackup::RestoreSettings;
+    using Lightweight::SqlBackup::RestoreWorkerIdleTime;
     using Lightweight::SqlBackup::RetrySettings;
     using Lightweight::SqlBackup::Sha256;
+    using Lightweight::SqlBackup::TableCompression;
+    using Lightweight::SqlBackup::TableCompressions;
     using Lightweight::SqlBackup::TableFilter;
     using Lightweight::SqlBackup::TableInfo;
+    using Lightweight::SqlBackup::WindowFingerprint;
+    using Lightweight::SqlBackup::WindowFingerprints;
+    using Lightweight::SqlBackup::Xxh3;
 } // namespace SqlBackup
 
 namespace SqlColumnTypeDefinitions
@@ -401,6 +436,9 @@ namespace Zip
     using Lightweight::Zip::CompressionMethod;
     using Lightweight::Zip::EntryInfo;
     using Lightweight::Zip::IsCompressionSupported;
+    using Lightweight::Zip::MappedEntryInfo;
+    using Lightweight::Zip::MappedZipArchive;
+    using Lightweight::Zip::MappedZipReader;
     using Lightweight::Zip::OpenMode;
     using Lightweight::Zip::ZipArchive;
     using Lightweight::Zip::ZipEntry;
@@ -45,6 +45,42 @@ class PostgreSqlFormatter final: public SQLiteQueryFormatter
         return result;
     }
 
+    [[nodiscard]] std::string InArrayParameter(std::string_view columnName,
+                                               SqlArrayElementType elementType) const override
+    {
+        // The parameter arrives as text, so it is cast to a typed array for the planner.
+        char const* const arrayType = elementType == SqlArrayElementType::Integer ? "BIGINT[]" : "TEXT[]";
+        return std::format("{} = ANY(CAST(? AS {}))", columnName, arrayType);
+    }
+
+    [[nodiscard]] std::string ArrayParameterValue(std::span<std::string const> elements,
+                                                  SqlArrayElementType elementType) const override
+    {
+        // Array input syntax: `{1,2,3}`, with text elements double-quoted and `"`/`\` backslash-escaped.
+        std::string result;
+        result += '{';
+        for (auto const& element: elements)
+        {
+            if (result.size() > 1)
+                result += ',';
+            if (elementType == SqlArrayElementType::Integer)
+            {
+                result += element;
+                continue;
+            }
+            result += '"';
+            for (char const ch: element)
+            {
+                if (ch == '"' || ch == '\\')
+                    result += '\\';
+                result += ch;
+            }
+            result += '"';
+        }
+        result += '}';
+        return result;
+    }
+
     [[nodiscard]] std::string QueryLastInsertId(std::string_view /*tableName*/) const override
     {
         // NB: Find a better way to do this on the given table.
@@ -324,11 +360,41 @@ class PostgreSqlFormatter final: public SQLiteQueryFormatter
         return { sqlQueryString.str() };
     }
 
+    [[nodiscard]] std::size_t MultiRowInsertParameterLimit() const noexcept override
+    {
+        // psqlODBC runs a parameter array as one Bind/Execute per row, and has no API to feed
+        // COPY FROM STDIN. The protocol would take 65535 parameters; ODBC stops at 32767.
+        return 32767;
+    }
+
     [[nodiscard]] std::string QueryServerVersion() const override
     {
         return "SELECT version()";
     }
 
+    [[nodiscard]] StringList SingleWriterImportSettings(std::size_t /*cacheSizeKB*/) const override
+    {
+        return {}; // The SQLite PRAGMAs of the base formatter do not apply
+    }
+
+    [[nodiscard]] std::string WindowFingerprint(std::string_view schema,
+                                                std::string_view table,
+                                                std::string_view pkColumn,
+                                                int64_t lo,
+                                                int64_t hi,
+                                                std::span<SqlFingerprintColumn const> /*columns*/) const override
+    {
+        // The row-to-text cast covers every column type; ordering by the key makes the hash
+        // independent of the physical row order. Hashing each row first keeps the aggregated
+        // text at 32 bytes per row, however wide the rows are (text values stay below 1 GB).
+        return std::format(R"(SELECT COUNT(*) || ':' || COALESCE(md5(string_agg(md5(w::text), '' ORDER BY w."{0}")), '') )"
+                           R"(FROM {1} AS w WHERE w."{0}" BETWEEN {2} AND {3})",
+                           pkColumn,
+                           FormatTableName(schema, table),
+                           lo,
+                           hi);
+    }
+
     /// PostgreSQL uses `pg_advisory_lock` / `pg_advisory_unlock`. Inline delegation
     /// keeps the vtable weak — see `SQLiteQueryFormatter::AdvisoryLockOps()` for
     /// the rationale.
@@ -66,6 +66,28 @@ class SQLiteQueryFormatter: public SqlQueryFormatter
         return std::format(R"(INSERT INTO "{}" ({}) VALUES ({}))", intoTable, fields, values);
     }
 
+    [[nodiscard]] std::string InsertReturning(std::string_view intoTable,
+                                              std::string_view fields,
+                                              std::string_view values,
+                                              std::string_view returningColumn) const override
+    {
+        // RETURNING is understood by PostgreSQL and by SQLite since 3.35.
+        return std::format(R"(INSERT INTO "{}" ({}) VALUES ({}) RETURNING "{}")", intoTable, fields, values, returningColumn);
+    }
+
+    [[nodiscard]] std::string InArrayParameter(std::string_view columnName,
+                                               SqlArrayElementType /*elementType*/) const override
+    {
+        // json_each() yields JSON numbers as INTEGER and JSON strings as TEXT, so no cast is needed.
+        return std::format("{} IN (SELECT value FROM json_each(?))", columnName);
+    }
+
+    [[nodiscard]] std::string ArrayParameterValue(std::span<std::string const> elements,
+                                                  SqlArrayElementType elementType) const override
+    {
+        return JsonArrayLiteral(elements, elementType);
+    }
+
     [[nodiscard]] std::string QueryLastInsertId(std::string_view /*tableName*/) const override
     {
         // This is SQLite syntax. We might want to provide aspecialized SQLite class instead.
@@ -664,6 +686,19 @@ ALTER TABLE {2} DROP COLUMN "{1}";)",
         return "SELECT sqlite_version()";
     }
 
+    [[nodiscard]] StringList SingleWriterImportSettings(std::size_t cacheSizeKB) const override
+    {
+        // locking_mode first: leaving WAL for journal_mode OFF needs the exclusive lock.
+        StringList statements { "PRAGMA locking_mode = EXCLUSIVE",
+                                "PRAGMA journal_mode = OFF",
+                                "PRAGMA synchronous = OFF",
+                                "PRAGMA foreign_keys = OFF",
+                                "PRAGMA temp_store = MEMORY" };
+        if (cacheSizeKB > 0)
+            statements.push_back(std::format("PRAGMA cache_size = -{}", cacheSizeKB));
+        return statements;
+    }
+
     /// SQLite has no native advisory-lock primitive, so the handler maintains
     /// a `_lightweight_locks` table guarded by a unique constraint. The
     /// override is intentionally inline-delegating: putting the body in
@@ -6,7 +6,9 @@
 
 #include <reflection-cpp/reflection.hpp>
 
+#include <algorithm>
 #include <cassert>
+#include <cctype>
 #include <format>
 
 namespace Lightweight
@@ -125,6 +127,14 @@ EXEC sp_executesql @sql;)",
     }
 
   private:
+    /// @brief Whether `BINARY_CHECKSUM` skips columns of the server type `nativeType`.
+    static bool IsNonComparableType(std::string_view nativeType) noexcept
+    {
+        auto const lower = [](char c) { return static_cast<char>(std::tolower(static_cast<unsigned char>(c))); };
+        auto const is = [&](std::string_view name) { return std::ranges::equal(nativeType, name, {}, lower); };
+        return is("xml") || is("text") || is("ntext") || is("image");
+    }
+
     /// @brief Decodes the byte length of the UTF-8 sequence starting at `s[i]`.
     /// Returns `1` (and treats the byte as ASCII) for malformed lead bytes so the
     /// encoder always makes forward progress.
@@ -247,6 +257,24 @@ EXEC sp_executesql @sql;)",
         return std::format("[{}].[{}]", schema, table);
     }
 
+    [[nodiscard]] std::string InsertReturning(std::string_view intoTable,
+                                              std::string_view fields,
+                                              std::string_view values,
+                                              std::string_view returningColumn) const override
+    {
+        return std::format(
+            R"(INSERT INTO "{}" ({}) OUTPUT INSERTED."{}" VALUES ({}))", intoTable, fields, returningColumn, values);
+    }
+
+    [[nodiscard]] std::string InArrayParameter(std::string_view columnName,
+                                               SqlArrayElementType elementType) const override
+    {
+        // OPENJSON (SQL Server 2016+) with an explicit schema, so that the values arrive typed rather
+        // than as NVARCHAR(MAX) and an integer key column can still be probed by an index seek.
+        char const* const valueType = elementType == SqlArrayElementType::Integer ? "BIGINT" : "NVARCHAR(4000)";
+        return std::format("{} IN (SELECT value FROM OPENJSON(?) WITH (value {} '$'))", columnName, valueType);
+    }
+
     [[nodiscard]] std::string QueryLastInsertId(std::string_view /*tableName*/) const override
     {
         // TODO: Figure out how to get the last insert id in SQL Server for a given table.
@@ -712,6 +740,41 @@ DROP INDEX "{0}_{1}_{2}_index" ON "{0}"."{1}";)",
         return "SELECT @@VERSION";
     }
 
+    [[nodiscard]] StringList SingleWriterImportSettings(std::size_t /*cacheSizeKB*/) const override
+    {
+        return {}; // The SQLite PRAGMAs of the base formatter do not apply
+    }
+
+    [[nodiscard]] std::string WindowFingerprint(std::string_view schema,
+                                                std::string_view table,
+                                                std::string_view pkColumn,
+                                                int64_t lo,
+                                                int64_t hi,
+                                                std::span<SqlFingerprintColumn const> columns) const override
+    {
+        // CHECKSUM_AGG is an order-independent XOR, so the row count is prepended to catch rows that
+        // cancel out. BINARY_CHECKSUM skips the non-comparable types, whose changes would go unseen:
+        // those columns are hashed and checksummed on their own.
+        auto uncheckedHashes = std::string {};
+        for (auto const& column: columns)
+        {
+            if (!IsNonComparableType(column.nativeType))
+                continue;
+            uncheckedHashes += uncheckedHashes.empty() ? "" : ", ";
+            uncheckedHashes += std::format(R"(HASHBYTES('SHA2_256', CAST("{}" AS varbinary(max))))", column.name);
+        }
+        if (!uncheckedHashes.empty())
+            uncheckedHashes = std::format(", ':', CHECKSUM_AGG(BINARY_CHECKSUM({}))", uncheckedHashes);
+
+        return std::format(R"(SELECT CONCAT(COUNT_BIG(*), ':', CHECKSUM_AGG(BINARY_CHECKSUM(*)){}) )"
+                           R"(FROM {} WHERE "{}" BETWEEN {} AND {})",
+                           uncheckedHashes,
+                           FormatTableName(schema, table),
+                           pkColumn,
+                           lo,
+                           hi);
+    }
+
     /// Microsoft SQL Server uses `sp_getapplock` / `sp_releaseapplock`. Inline
     /// delegation keeps the vtable weak — see `SQLiteQueryFormatter::AdvisoryLockOps()`
     /// for the rationale.
@@ -0,0 +1,140 @@
+// SPDX-License-Identifier: Apache-2.0
+#include "../TracyProfiler.hpp"
+#include "AdaptiveCompression.hpp"
+#include "StreamArchive.hpp"
+
+#include <algorithm>
+#include <ranges>
+
+namespace Lightweight::SqlBackup::detail
+{
+
+namespace
+{
+    /// Size and number of the slices a large chunk is sampled with.
+    constexpr std::size_t SampleSliceBytes = 64 * 1024;
+    constexpr std::size_t SampleSlices = 4;
+
+    /// Entry name of the trial archives (only its length matters).
+    constexpr std::string_view TrialEntryName = "sample";
+
+    /// Saving the fast level must reach at any tradeoff, and the part added at tradeoff 0.
+    constexpr double MinSaving = 0.02;
+    constexpr double MinSavingAtLeastCpu = 0.10;
+
+    /// Relative saving the strong level must add per multiple of the fast level's time, at tradeoff 0.
+    constexpr double StrongSavingPerSlowdown = 0.03;
+} // namespace
+
+AdaptiveCompressionLevels AdaptiveLevelsOf(CompressionMethod method) noexcept
+{
+    switch (method)
+    {
+        case CompressionMethod::Store:
+            return { .fast = 0, .strong = 0 };
+        case CompressionMethod::Zstd:
+            return { .fast = 1, .strong = 19 };
+        case CompressionMethod::Deflate:
+        case CompressionMethod::Bzip2:
+        case CompressionMethod::Lzma:
+        case CompressionMethod::Xz:
+            break;
+    }
+    return { .fast = 1, .strong = 9 };
+}
+
+TableCompression DecideTableCompression(CompressionMethod method,
+                                        double tradeoff,
+                                        CompressionTrial const& fast,
+                                        std::optional<CompressionTrial> const& strong)
+{
+    tradeoff = std::clamp(tradeoff, 0.0, 1.0);
+    auto const levels = AdaptiveLevelsOf(method);
+
+    if (method == CompressionMethod::Store || 1.0 - fast.ratio < MinSaving + (MinSavingAtLeastCpu * (1.0 - tradeoff)))
+        return { .method = CompressionMethod::Store, .level = 0, .sampleRatio = 1.0 };
+
+    if (!strong || tradeoff <= 0.0 || strong->ratio >= fast.ratio)
+        return { .method = method, .level = levels.fast, .sampleRatio = fast.ratio };
+
+    auto const extraSaving = (fast.ratio - strong->ratio) / fast.ratio;
+    auto const fastSeconds = std::max(std::chrono::duration<double>(fast.elapsed).count(), 1e-9);
+    auto const slowdown = std::chrono::duration<double>(strong->elapsed).count() / fastSeconds;
+    if (extraSaving >= (1.0 - tradeoff) * StrongSavingPerSlowdown * slowdown)
+        return { .method = method, .level = levels.strong, .sampleRatio = strong->ratio };
+    return { .method = method, .level = levels.fast, .sampleRatio = fast.ratio };
+}
+
+AdaptiveCompression::AdaptiveCompression(CompressionMethod method, double tradeoff):
+    m_method { method },
+    m_tradeoff { std::clamp(tradeoff, 0.0, 1.0) }
+{
+    // The trials measure whole single-entry archives; the headers around the data would make small
+    // samples look incompressible.
+    if (m_method != CompressionMethod::Store)
+        m_entryOverhead = CompressStreamEntry(TrialEntryName, {}, CompressionMethod::Store, 0).size();
+}
+
+TableCompression AdaptiveCompression::ForTable(std::string const& tableName, std::string_view chunk)
+{
+    {
+        auto const lock = std::scoped_lock(m_mutex);
+        if (auto const choice = m_choices.find(tableName); choice != m_choices.end())
+            return choice->second;
+    }
+
+    // The trials run outside the lock, so workers of other tables are not held up by them.
+    auto decision = TableCompression {};
+    if (m_method != CompressionMethod::Store && !chunk.empty())
+    {
+        ZoneScopedN("Backup::CompressionTrial");
+        auto const sample = Sample(chunk);
+        auto const levels = AdaptiveLevelsOf(m_method);
+        auto const fast = Trial(sample, levels.fast);
+
+        // The strong level is only worth a trial if the table is compressed at all.
+        auto strong = std::optional<CompressionTrial> {};
+        if (m_tradeoff > 0.0 && levels.strong != levels.fast
+            && DecideTableCompression(m_method, m_tradeoff, fast, std::nullopt).method != CompressionMethod::Store)
+            strong = Trial(sample, levels.strong);
+
+        decision = DecideTableCompression(m_method, m_tradeoff, fast, strong);
+    }
+
+    auto const lock = std::scoped_lock(m_mutex);
+    return m_choices.try_emplace(tableName, decision).first->second;
+}
+
+TableCompressions AdaptiveCompression::Choices() const
+{
+    auto const lock = std::scoped_lock(m_mutex);
+    return m_choices;
+}
+
+std::string AdaptiveCompression::Sample(std::string_view chunk)
+{
+    if (chunk.size() <= SampleSlices * SampleSliceBytes)
+        return std::string { chunk };
+
+    // Slices from the start to the end of the chunk, so a table whose rows change character along
+    // the key (e.g. old rows compressed by the application, new ones not) is judged by both.
+    auto sample = std::string {};
+    sample.reserve(SampleSlices * SampleSliceBytes);
+    auto const stride = (chunk.size() - SampleSliceBytes) / (SampleSlices - 1);
+    for (auto const slice: std::views::iota(0UZ, SampleSlices))
+        sample.append(chunk.substr(slice * stride, SampleSliceBytes));
+    return sample;
+}
+
+CompressionTrial AdaptiveCompression::Trial(std::string_view sample, std::uint32_t level) const
+{
+    auto const start = std::chrono::steady_clock::now();
+    auto const archiveSize = CompressStreamEntry(TrialEntryName, sample, m_method, level).size();
+    auto const elapsed = std::chrono::steady_clock::now() - start;
+
+    auto const payloadSize = archiveSize > m_entryOverhead ? archiveSize - m_entryOverhead : 0;
+    return { .ratio = static_cast<double>(payloadSize) / static_cast<double>(sample.size()),
+             .elapsed = std::chrono::duration_cast<std::chrono::nanoseconds>(elapsed) };
+}
+
+} // namespace Lightweight::SqlBackup::detail
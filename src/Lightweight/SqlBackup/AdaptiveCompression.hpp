@@ -0,0 +1,95 @@
+// SPDX-License-Identifier: Apache-2.0
+#pragma once
+
+#include "../Api.hpp"
+#include "SqlBackup.hpp"
+
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <mutex>
+#include <optional>
+#include <string>
+#include <string_view>
+
+namespace Lightweight::SqlBackup::detail
+{
+
+/// The fast and the strong level adaptive compression chooses between for one method.
+struct AdaptiveCompressionLevels
+{
+    std::uint32_t fast = 1;
+    std::uint32_t strong = 9;
+};
+
+/// Returns the levels adaptive compression tries for @p method (zstd goes up to 19, the others to 9).
+[[nodiscard]] LIGHTWEIGHT_API AdaptiveCompressionLevels AdaptiveLevelsOf(CompressionMethod method) noexcept;
+
+/// Outcome of trial-compressing a sample at one level.
+struct CompressionTrial
+{
+    /// Compressed size relative to the uncompressed sample size.
+    double ratio = 1.0;
+
+    /// Time the compression took.
+    std::chrono::nanoseconds elapsed {};
+};
+
+/// Decides a table's compression from the trials of its sample.
+///
+/// Compression is skipped (Store) unless the fast level saves at least 2% of the bytes, plus up to
+/// 10% more the lower @p tradeoff is. The strong level is chosen over the fast one if the bytes it
+/// saves in addition make up for its extra time: the relative saving must reach
+/// (1 - tradeoff) x 3% per multiple of the fast level's time. A @p tradeoff of 1 takes the strong level
+/// whenever it is smaller; a @p tradeoff of 0 never takes it.
+///
+/// @param method The configured compression method.
+/// @param tradeoff CPU/size tradeoff from 0 (least CPU) to 1 (smallest archive); clamped to [0, 1].
+/// @param fast The trial at the fast level.
+/// @param strong The trial at the strong level, or std::nullopt if it was not run.
+/// @return The chosen method, level and sample ratio.
+[[nodiscard]] LIGHTWEIGHT_API TableCompression DecideTableCompression(CompressionMethod method,
+                                                                      double tradeoff,
+                                                                      CompressionTrial const& fast,
+                                                                      std::optional<CompressionTrial> const& strong);
+
+/// Chooses the compression of each table's chunks from a trial compression of its first chunk.
+///
+/// Shared by all backup workers: the first chunk a worker flushes for a table decides the table's
+/// compression; chunks of the same table flushed meanwhile by other workers run their own trial,
+/// but only the first decision is kept and applied to every chunk of the table.
+class LIGHTWEIGHT_API AdaptiveCompression
+{
+  public:
+    /// Constructs the chooser.
+    ///
+    /// @param method The configured compression method; Store disables the trials.
+    /// @param tradeoff CPU/size tradeoff from 0 (least CPU) to 1 (smallest archive).
+    AdaptiveCompression(CompressionMethod method, double tradeoff);
+
+    /// Returns the compression of @p tableName's chunks, trial-compressing @p chunk if the table
+    /// has no decision yet.
+    ///
+    /// @param tableName The table the chunk belongs to.
+    /// @param chunk The uncompressed chunk bytes.
+    /// @return The table's compression.
+    [[nodiscard]] TableCompression ForTable(std::string const& tableName, std::string_view chunk);
+
+    /// Returns the decisions made so far, keyed by table name.
+    [[nodiscard]] TableCompressions Choices() const;
+
+    /// Returns the part of @p chunk that is trial-compressed: @p chunk itself if it is small,
+    /// otherwise four evenly spaced 64 KiB slices of it.
+    [[nodiscard]] static std::string Sample(std::string_view chunk);
+
+  private:
+    [[nodiscard]] CompressionTrial Trial(std::string_view sample, std::uint32_t level) const;
+
+    CompressionMethod m_method;
+    double m_tradeoff;
+    std::size_t m_entryOverhead = 0; // archive bytes of an empty trial entry, subtracted from every trial
+    mutable std::mutex m_mutex;
+    TableCompressions m_choices;
+};
+
+} // namespace Lightweight::SqlBackup::detail
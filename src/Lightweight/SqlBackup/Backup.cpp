@@ -13,7 +13,6 @@
 #include "Backup.hpp"
 #include "Common.hpp"
 #include "MsgPackChunkFormats.hpp"
-#include "Sha256.hpp"
 #include "SqlBackupFormats.hpp"
 
 #include <algorithm>
@@ -24,6 +23,7 @@
 #include <limits>
 #include <print>
 #include <ranges>
+#include <span>
 #include <stdexcept>
 #include <variant>
 #include <vector>
@@ -293,6 +293,81 @@ void DeleteStaleSubChunks(WorkerChunkArchive& archive,
     }
 }
 
+// Fingerprints a PK-range window on the server. A dialect without a fingerprint query, or a query
+// the server rejects, yields an empty fingerprint: the window is then simply read (and not recorded).
+static std::string QueryWindowFingerprint(BackupContext& ctx,
+                                          SqlStatement& stmt,
+                                          SqlQueryFormatter const& formatter,
+                                          detail::Chunk const& chunk)
+{
+    auto const& table = *chunk.table;
+    auto columns = std::vector<SqlFingerprintColumn> {};
+    columns.reserve(table.columns.size());
+    for (auto const& column: table.columns)
+        columns.push_back({ .name = column.name, .nativeType = column.dialectDependantTypeString });
+    auto const query =
+        formatter.WindowFingerprint(table.schema, table.name, chunk.pkColumn, chunk.lo, chunk.hi, columns);
+    if (query.empty())
+        return {};
+
+    ZoneScopedN("Backup::WindowFingerprint");
+    try
+    {
+        return stmt.ExecuteDirectScalar<std::string>(query).value_or(std::string {});
+    }
+    catch (SqlException const& e)
+    {
+        ctx.progress.Update({ .state = Progress::State::Warning,
+                              .tableName = table.name,
+                              .currentRows = chunk.state->processedRows.load(),
+                              .totalRows = chunk.state->totalRows.load(),
+                              .message = std::format("Cannot fingerprint window {}, reading it: {}",
+                                                     chunk.windowIndex,
+                                                     e.what()) });
+        return {};
+    }
+}
+
+// Reuses the base archive's entries for a window whose fingerprint is unchanged: their checksums
+// are carried over and their names queued for the finalize merge, which raw-copies them from the
+// base archive. Returns false (the window is read) if the base has no matching window or lacks a
+// checksum for one of its entries.
+static bool ReuseBaseWindow(BackupContext& ctx, detail::Chunk const& chunk, std::string const& fingerprint)
+{
+    auto const& table = *chunk.table;
+    auto const* baseWindow =
+        ctx.incrementalBase->FindReusableWindow(table, chunk.windowIndex, chunk.lo, chunk.hi, fingerprint);
+    if (!baseWindow)
+        return false;
+
+    auto entries = std::vector<std::pair<std::string, std::string>> {};
+    for (auto const subId: std::views::iota(size_t { 0 }, baseWindow->subChunks))
+    {
+        auto entryName = BackupChunkEntryName(table.name, chunk.windowIndex, subId);
+        auto const checksum = ctx.incrementalBase->checksums.find(entryName);
+        if (checksum == ctx.incrementalBase->checksums.end())
+            return false;
+        entries.emplace_back(std::move(entryName), checksum->second);
+    }
+
+    if (ctx.checksums && ctx.checksumMutex)
+    {
+        auto const checksumLock = std::scoped_lock(*ctx.checksumMutex);
+        for (auto const& [entryName, checksum]: entries)
+            (*ctx.checksums)[entryName] = checksum;
+    }
+    {
+        auto const logLock = std::scoped_lock(ctx.incrementalLog->mutex);
+        ctx.incrementalLog->windows[table.name].push_back(*baseWindow);
+        for (auto const& entry: entries)
+            ctx.incrementalLog->reusedEntries.push_back(entry.first);
+    }
+
+    chunk.state->processedRows.fetch_add(baseWindow->rows, std::memory_order_relaxed);
+    ctx.progress.OnItemsProcessed(baseWindow->rows);
+    return true;
+}
+
 std::optional<std::pair<int64_t, int64_t>> QueryPkBounds(SqlStatement& stmt,
                                                          SqlSchema::Table const& table,
                                                          std::string const& pkColumn)
@@ -322,6 +397,21 @@ std::optional<std::pair<int64_t, int64_t>> QueryPkBounds(SqlStatement& stmt,
     return std::string { reinterpret_cast<char const*>(utf8.data()), utf8.size() };
 }
 
+// Appends the LOB value of column @p columnIndex to @p value via the chunked column reader, so the
+// only scratch memory is one chunk. @p buffer is the worker's chunk buffer, sized on first use and
+// reused for every LOB cell after. Returns false if the value is NULL.
+template <typename Container>
+bool ReadLobColumn(
+    SqlResultCursor& cursor, SQLUSMALLINT columnIndex, SqlLobType type, std::vector<std::byte>& buffer, Container& value)
+{
+    if (buffer.empty())
+        buffer.resize(SqlStatement::DefaultLobChunkSize);
+    return cursor.ReadColumnChunks(columnIndex, type, buffer, [&value](std::span<std::byte const> chunk) {
+        auto const* const data = reinterpret_cast<typename Container::value_type const*>(chunk.data());
+        value.insert(value.end(), data, data + chunk.size());
+    });
+}
+
 // Decodes one column cell of the current row from the single-row (SqlResultCursor) path into the
 // BackupValue variant. Extracted from ProcessChunkBackup's per-row lambda so that decode ladder is
 // not inlined into the lambda (keeping the lambda's cognitive complexity bounded). The branch order
@@ -330,7 +420,8 @@ std::optional<std::pair<int64_t, int64_t>> QueryPkBounds(SqlStatement& stmt,
 BackupValue DecodeSingleRowColumn(SqlResultCursor& cursor,
                                   SqlSchema::Column const& colDef,
                                   SQLUSMALLINT columnIndex,
-                                  SqlServerType serverType)
+                                  SqlServerType serverType,
+                                  std::vector<std::byte>& lobBuffer)
 {
     using namespace SqlColumnTypeDefinitions;
     auto const i = columnIndex;
@@ -343,9 +434,19 @@ BackupValue DecodeSingleRowColumn(SqlResultCursor& cursor,
 
     if (std::holds_alternative<Binary>(colDef.type) || std::holds_alternative<VarBinary>(colDef.type))
     {
-        auto valOpt = cursor.GetNullableColumn<SqlDynamicBinary<MaxBinaryLobBufferSize>>(i);
-        return orNull(valOpt,
-                      [](auto const& v) -> BackupValue { return std::vector<uint8_t>(v.data(), v.data() + v.size()); });
+        // Stream the value straight into the backup value, one chunk at a time: no intermediate
+        // binary buffer, and no truncation at its capacity.
+        auto value = std::vector<uint8_t> {};
+        if (!ReadLobColumn(cursor, i, SqlLobType::Binary, lobBuffer, value))
+            return std::monostate {};
+        return value;
+    }
+    if (std::holds_alternative<Text>(colDef.type))
+    {
+        auto value = std::string {};
+        if (!ReadLobColumn(cursor, i, SqlLobType::Text, lobBuffer, value))
+            return std::monostate {};
+        return value;
     }
     if (std::holds_alternative<Bool>(colDef.type))
         return orNull(cursor.GetNullableColumn<bool>(i), [](bool v) -> BackupValue { return v; });
@@ -378,8 +479,7 @@ BackupValue DecodeSingleRowColumn(SqlResultCursor& cursor,
         // Native SqlDateTime read avoids MSSQL SQL_TYPE_TIMESTAMP -> SQL_C_CHAR conversion error 22003.
         return orNull(cursor.GetNullableColumn<SqlDateTime>(i),
                       [](auto const& v) -> BackupValue { return std::format("{}", v); });
-    if (std::holds_alternative<Varchar>(colDef.type) || std::holds_alternative<Char>(colDef.type)
-        || std::holds_alternative<Text>(colDef.type))
+    if (std::holds_alternative<Varchar>(colDef.type) || std::holds_alternative<Char>(colDef.type))
     {
         // psqlODBC narrows SQL_C_CHAR to the client codepage (losing non-ASCII); read PG text through
         // the wide (UTF-16 -> UTF-8) path, the same as the NVarchar branch. Other DBs read narrow.
@@ -443,6 +543,103 @@ BackupValue DecodeBatchedColumn(RowArrayCursor& cursor,
                                        colDef.name));
 }
 
+// Buffers a BackupColumnBlock of one column points into, reused across the blocks of a chunk so
+// numeric and narrow-text columns allocate nothing in the steady state.
+struct BatchedColumnStorage
+{
+    std::vector<uint8_t> nulls;
+    std::vector<std::string> texts;
+    std::vector<std::string_view> views;
+};
+
+// Column-wise counterpart of DecodeBatchedColumn: describes column @p columnIndex of the whole block
+// last fetched by @p cursor for ChunkWriter::WriteColumns. Integer, Real and narrow-text columns view
+// the cursor's bound buffers; the other types are rendered into @p storage exactly as
+// DecodeBatchedColumn renders them, so the written chunk is byte-identical to the per-row path. The
+// returned block is valid until the next FetchArray() or the next call with the same @p storage.
+static BackupColumnBlock DecodeBatchedColumnBlock(RowArrayCursor& cursor,
+                                                  SqlSchema::Column const& colDef,
+                                                  SQLUSMALLINT columnIndex,
+                                                  BatchedColumnStorage& storage)
+{
+    using namespace SqlColumnTypeDefinitions;
+    auto const i = columnIndex;
+
+    auto const indicators = cursor.ColumnIndicators(i);
+    auto const rows = indicators.size();
+    storage.nulls.resize(rows);
+    std::ranges::transform(indicators, storage.nulls.begin(), [](SQLLEN indicator) -> uint8_t {
+        return indicator == SQL_NULL_DATA ? 1 : 0;
+    });
+
+    auto block = BackupColumnBlock { .nulls = storage.nulls };
+
+    // Renders every non-NULL cell through @p render into owned strings and points the block at them.
+    auto const renderedText = [&](auto&& render) {
+        storage.texts.resize(rows);
+        storage.views.resize(rows);
+        for (auto const r: std::views::iota(0UZ, rows))
+        {
+            if (storage.nulls[r])
+                storage.texts[r].clear();
+            else
+                storage.texts[r] = render(r);
+            storage.views[r] = storage.texts[r];
+        }
+        block.type = BackupColumnBlock::Type::Text;
+        block.textValues = storage.views;
+        return block;
+    };
+
+    if (std::holds_alternative<Bool>(colDef.type))
+    {
+        // Bound as int64 (0/1); the Bool block type stores it as bool, like DecodeBatchedColumn.
+        block.type = BackupColumnBlock::Type::Bool;
+        block.int64Values = cursor.I64Column(i);
+        return block;
+    }
+    if (std::holds_alternative<Integer>(colDef.type) || std::holds_alternative<Bigint>(colDef.type)
+        || std::holds_alternative<Smallint>(colDef.type) || std::holds_alternative<Tinyint>(colDef.type))
+    {
+        block.type = BackupColumnBlock::Type::Int64;
+        block.int64Values = cursor.I64Column(i);
+        return block;
+    }
+    if (std::holds_alternative<Real>(colDef.type))
+    {
+        block.type = BackupColumnBlock::Type::Double;
+        block.doubleValues = cursor.F64Column(i);
+        return block;
+    }
+    if (std::holds_alternative<Varchar>(colDef.type) || std::holds_alternative<Char>(colDef.type)
+        || std::holds_alternative<Decimal>(colDef.type) || std::holds_alternative<NVarchar>(colDef.type)
+        || std::holds_alternative<NChar>(colDef.type) || std::holds_alternative<Time>(colDef.type))
+    {
+        if (cursor.ColumnBoundType(i) != RowArrayCursor::BoundType::Char)
+            // Wide-bound text needs the UTF-16 -> UTF-8 conversion GetString performs.
+            return renderedText([&](std::size_t r) { return *cursor.GetString(r, i); });
+
+        // Narrow-bound text is already the bytes GetString would copy out: view it in place.
+        auto const text = cursor.NarrowTextColumn(i);
+        storage.views.resize(rows);
+        for (auto const r: std::views::iota(0UZ, rows))
+            storage.views[r] = storage.nulls[r] ? std::string_view {} : text[r];
+        block.type = BackupColumnBlock::Type::Text;
+        block.textValues = storage.views;
+        return block;
+    }
+    if (std::holds_alternative<Date>(colDef.type))
+        return renderedText([&](std::size_t r) { return std::format("{}", *cursor.GetDate(r, i)); });
+    if (std::holds_alternative<DateTime>(colDef.type) || std::holds_alternative<Timestamp>(colDef.type))
+        return renderedText([&](std::size_t r) { return std::format("{}", *cursor.GetTimestamp(r, i)); });
+    if (std::holds_alternative<Guid>(colDef.type))
+        return renderedText([&](std::size_t r) { return to_string(*cursor.GetGuid(r, i)); });
+
+    throw std::logic_error(std::format("DecodeBatchedColumnBlock: column '{}' has a type not in the "
+                                       "array-fetch safe set; TableIsArrayFetchable / decode ladder drift",
+                                       colDef.name));
+}
+
 // Decodes a whole fetched row from the single-row cursor into @p row (cleared first), wrapping each
 // column decode with the debug-trace + rethrow the inline loop had. Extracted from processQuery so
 // that lambda's cognitive complexity stays under the clang-tidy threshold.
@@ -450,6 +647,7 @@ void DecodeRowSingle(SqlResultCursor& cursor,
                      SqlSchema::Table const& table,
                      SqlServerType serverType,
                      std::string_view tableName,
+                     std::vector<std::byte>& lobBuffer,
                      std::vector<BackupValue>& row)
 {
     ZoneScopedN("Backup::DecodeRow");
@@ -462,7 +660,7 @@ void DecodeRowSingle(SqlResultCursor& cursor,
         {
             if constexpr (DebugBackupWorker)
                 std::println(stderr, "DEBUG: Processing col {} ({}) type index: {}", i, colDef.name, colDef.type.index());
-            row.emplace_back(DecodeSingleRowColumn(cursor, colDef, i, serverType));
+            row.emplace_back(DecodeSingleRowColumn(cursor, colDef, i, serverType, lobBuffer));
         }
         catch ([[maybe_unused]] std::exception const& e)
         {
@@ -524,12 +722,23 @@ void ProcessChunkBackup(BackupContext& ctx, SqlConnection& conn, detail::Chunk c
                               .totalRows = totalRows,
                               .message = "Started backup"s });
 
+    // Fingerprint the window BEFORE reading it: a change racing the read then merely makes the next
+    // incremental backup re-read the window, never skip it. Unchanged windows of an incremental
+    // backup are taken from the base archive without touching the rows.
+    std::string fingerprint;
+    if (usePkRange && ctx.incrementalLog)
+    {
+        fingerprint = QueryWindowFingerprint(ctx, stmt, formatter, chunk);
+        if (!fingerprint.empty() && ctx.incrementalBase && ReuseBaseWindow(ctx, chunk, fingerprint))
+            return;
+    }
+
     if constexpr (DebugBackupWorker)
     {
         std::println(stderr, "DEBUG: ProcessChunkBackup: Starting backup for {} ({} rows)", tableName, totalRows);
         std::println(stderr, "DEBUG: Creating writer...");
     }
-    auto writer = CreateMsgPackChunkWriter(ctx.backupSettings.chunkSizeBytes);
+    auto writer = CreateMsgPackChunkWriter(ctx.backupSettings.chunkSizeBytes, ctx.backupSettings.compactEncodings);
     if constexpr (DebugBackupWorker)
         std::println(stderr, "DEBUG: Writer created.");
 
@@ -546,6 +755,10 @@ void ProcessChunkBackup(BackupContext& ctx, SqlConnection& conn, detail::Chunk c
     // Highest sub-chunk count any attempt of this PK-range window flushed; used to delete stale
     // sub-chunk files if a retry produces fewer (live data drift).
     size_t maxSubChunksFlushed = 0;
+    // Stream archive output: frames of a PK-range window are held back until the window is read
+    // completely, since a retried window must not leave its earlier attempt's frames in the stream.
+    // This holds the window's whole compressed output in memory, bounded by rowsPerChunk.
+    std::vector<StreamFrame> pendingFrames;
 
     auto flushChunk = [&]() {
         ZoneScopedN("Backup::FlushChunk");
@@ -558,12 +771,12 @@ void ProcessChunkBackup(BackupContext& ctx, SqlConnection& conn, detail::Chunk c
 
         std::string const entryName = BackupChunkEntryName(table.name, chunk.windowIndex, subChunkId);
 
-        // Checksum semantics unchanged: SHA-256 of the UNCOMPRESSED chunk bytes (restore verifies
-        // after libzip's transparent decompression).
+        // Checksum of the UNCOMPRESSED chunk bytes (restore verifies after libzip's transparent
+        // decompression), with the algorithm checksums.json records.
         std::string checksum;
         {
-            ZoneScopedN("Backup::Sha256");
-            checksum = Sha256::Hash(data);
+            ZoneScopedN("Backup::Checksum");
+            checksum = ComputeChecksum(ctx.backupSettings.checksumAlgorithm, data);
         }
         if (ctx.checksums && ctx.checksumMutex)
         {
@@ -571,11 +784,36 @@ void ProcessChunkBackup(BackupContext& ctx, SqlConnection& conn, detail::Chunk c
             (*ctx.checksums)[entryName] = checksum;
         }
 
-        // Hand the chunk to the worker's private archive: compression happens in THIS worker
-        // thread when the archive's rotation fills (overlapped with the network-bound fetch), and
-        // the finalize phase raw-merges the precompressed entries into the final zip. No shared
-        // zip lock on the data path anymore.
-        archive.Add(entryName, data);
+        // Adaptive compression decides on the table's first chunk; every entry carries its table's choice.
+        auto const compression =
+            ctx.compression ? ctx.compression->ForTable(table.name, data)
+                            : TableCompression { .method = ctx.backupSettings.method,
+                                                 .level = ctx.backupSettings.level,
+                                                 .sampleRatio = 1.0 };
+
+        if (ctx.stream)
+        {
+            // Stream archive: compress in THIS worker thread, then hand the finished frame to the
+            // single writer thread.
+            auto frame = StreamFrame {
+                .type = StreamFrameType::Chunk,
+                .name = entryName,
+                .checksum = std::move(checksum),
+                .payload = CompressStreamEntry(entryName, data, compression.method, compression.level),
+            };
+            if (usePkRange)
+                pendingFrames.push_back(std::move(frame));
+            else
+                ctx.stream->Write(std::move(frame));
+        }
+        else
+        {
+            // Hand the chunk to the worker's private archive: compression happens in THIS worker
+            // thread when the archive's rotation fills (overlapped with the network-bound fetch), and
+            // the finalize phase raw-merges the precompressed entries into the final zip. No shared
+            // zip lock on the data path anymore.
+            archive.Add(entryName, data, compression.method, compression.level);
+        }
 
         TracyPlot("Backup.RowsPerChunk", static_cast<int64_t>(processedRows - rowsAtLastFlush));
         rowsAtLastFlush = processedRows;
@@ -587,6 +825,7 @@ void ProcessChunkBackup(BackupContext& ctx, SqlConnection& conn, detail::Chunk c
         std::println(stderr, "DEBUG: Reserving row...");
     std::vector<BackupValue> row;
     row.reserve(table.columns.size());
+    auto lobBuffer = std::vector<std::byte> {}; // chunk buffer of the LOB columns, shared by all their cells
     if constexpr (DebugBackupWorker)
         std::println(stderr, "DEBUG: Row reserved. Entering FetchRow loop...");
 
@@ -614,7 +853,7 @@ void ProcessChunkBackup(BackupContext& ctx, SqlConnection& conn, detail::Chunk c
 
             if constexpr (DebugBackupWorker)
                 std::println(stderr, "DEBUG: FetchRow returned true for {}", tableName);
-            DecodeRowSingle(cursor, table, conn.ServerType(), tableName, row);
+            DecodeRowSingle(cursor, table, conn.ServerType(), tableName, lobBuffer, row);
 
             try
             {
@@ -655,9 +894,11 @@ void ProcessChunkBackup(BackupContext& ctx, SqlConnection& conn, detail::Chunk c
     // blocks of rows per round-trip — this delivers the bulk of the SQLGetData reduction for the
     // simple-column tables. The per-column decode mirrors processQuery's switch but is restricted to
     // the safe type set TableIsArrayFetchable allows (integer family + Bool -> int64; Real -> double;
-    // Varchar/Char/Decimal -> narrow text). The BackupValue alternative produced for each type
-    // is identical to the single-row path: int64_t for the integer family, double for Real, bool for
-    // Bool, std::string for the text/decimal types, and std::monostate for SQL NULL.
+    // Varchar/Char/Decimal -> narrow text). Each block goes to the writer column by column
+    // (DecodeBatchedColumnBlock + ChunkWriter::WriteColumns), so numeric columns are copied straight
+    // out of the bound buffers and narrow text is appended from them without a per-cell BackupValue.
+    // The chunk bytes are identical to the single-row path: int64 for the integer family, double for
+    // Real, bool for Bool, string for the text/decimal types, and nil for SQL NULL.
     //
     // Unlike processQuery, this path has NO transient-error retry: a transient error propagates and
     // fails the table. Re-running the backup is idempotent (every chunk entry is added with
@@ -675,6 +916,9 @@ void ProcessChunkBackup(BackupContext& ctx, SqlConnection& conn, detail::Chunk c
             return stmt.ExecuteBatchFetch(selectQuery, ArrayDepth);
         }();
 
+        auto storage = std::vector<BatchedColumnStorage>(cols);
+        auto blocks = std::vector<BackupColumnBlock>(cols);
+
         while (true)
         {
             std::size_t n = 0;
@@ -685,38 +929,37 @@ void ProcessChunkBackup(BackupContext& ctx, SqlConnection& conn, detail::Chunk c
             if (n == 0)
                 break;
 
-            for (std::size_t r = 0; r < n; ++r)
             {
-                row.clear();
-                {
-                    ZoneScopedN("Backup::DecodeRow");
-                    for (SQLUSMALLINT i = 1; i <= cols; ++i)
-                        row.emplace_back(DecodeBatchedColumn(cursor, table.columns[i - 1], r, i));
-                } // End DecodeRow zone
+                ZoneScopedN("Backup::DecodeBlock");
+                for (auto const column: std::views::iota(0UZ, table.columns.size()))
+                    blocks[column] = DecodeBatchedColumnBlock(
+                        cursor, table.columns[column], static_cast<SQLUSMALLINT>(column + 1), storage[column]);
+            } // End DecodeBlock zone
 
-                {
-                    ZoneScopedN("Backup::WriteRow");
-                    writer->WriteRow(row);
-                }
-                processedRows++;
-                if (processedRows > reportedRows)
-                {
-                    // Beyond the high-water mark: report for rate calculation and the shared
-                    // per-table cumulative counter (a retried window never double-counts).
-                    reportedRows = processedRows;
-                    state.processedRows.fetch_add(1, std::memory_order_relaxed);
-                    ctx.progress.OnItemsProcessed(1);
-                }
+            {
+                ZoneScopedN("Backup::WriteColumns");
+                writer->WriteColumns(blocks, n);
+            }
+            processedRows += n;
+            if (processedRows > reportedRows)
+            {
+                // Beyond the high-water mark: report for rate calculation and the shared
+                // per-table cumulative counter (a retried window never double-counts).
+                auto const newRows = processedRows - reportedRows;
+                reportedRows = processedRows;
+                state.processedRows.fetch_add(newRows, std::memory_order_relaxed);
+                ctx.progress.OnItemsProcessed(newRows);
+            }
 
-                if (writer->IsChunkFull())
-                {
-                    flushChunk();
-                    ctx.progress.Update({ .state = Progress::State::InProgress,
-                                          .tableName = tableName,
-                                          .currentRows = state.processedRows.load(std::memory_order_relaxed),
-                                          .totalRows = totalRows,
-                                          .message = "Writing chunk..."s });
-                }
+            // Checked per block: a chunk overshoots its size target by at most one block.
+            if (writer->IsChunkFull())
+            {
+                flushChunk();
+                ctx.progress.Update({ .state = Progress::State::InProgress,
+                                      .tableName = tableName,
+                                      .currentRows = state.processedRows.load(std::memory_order_relaxed),
+                                      .totalRows = totalRows,
+                                      .message = "Writing chunk..."s });
             }
         }
     };
@@ -779,6 +1022,7 @@ void ProcessChunkBackup(BackupContext& ctx, SqlConnection& conn, detail::Chunk c
                 ++retryCount;
                 maxSubChunksFlushed = std::max(maxSubChunksFlushed, subChunkId);
                 writer->Clear();
+                pendingFrames.clear();
                 subChunkId = 0;
                 processedRows = 0;
                 rowsAtLastFlush = 0;
@@ -906,6 +1150,19 @@ void ProcessChunkBackup(BackupContext& ctx, SqlConnection& conn, detail::Chunk c
         // flushed; remove the leftovers so restore never reads stale rows.
         if (usePkRange && maxSubChunksFlushed > subChunkId)
             DeleteStaleSubChunks(archive, ctx, tableName, chunk.windowIndex, subChunkId, maxSubChunksFlushed);
+        for (auto& frame: pendingFrames)
+            ctx.stream->Write(std::move(frame));
+
+        if (!fingerprint.empty())
+        {
+            auto const logLock = std::scoped_lock(ctx.incrementalLog->mutex);
+            ctx.incrementalLog->windows[tableName].push_back({ .window = chunk.windowIndex,
+                                                               .lo = chunk.lo,
+                                                               .hi = chunk.hi,
+                                                               .fingerprint = std::move(fingerprint),
+                                                               .subChunks = subChunkId,
+                                                               .rows = processedRows });
+        }
     }
     catch (std::exception const& e)
     {
@@ -6,8 +6,12 @@
 #include "../SqlSchema.hpp"
 #include "../SqlStatement.hpp"
 #include "../ThreadSafeQueue.hpp"
+#include "AdaptiveCompression.hpp"
 #include "ChunkPlanner.hpp"
+#include "Incremental.hpp"
 #include "SqlBackup.hpp"
+#include "SqlBackupFormats.hpp"
+#include "StreamArchive.hpp"
 #include "WorkerChunkArchive.hpp"
 
 #include <cstdint>
@@ -16,7 +20,9 @@
 #include <mutex>
 #include <optional>
 #include <string>
+#include <string_view>
 #include <utility>
+#include <vector>
 
 #if defined(__clang__)
     #pragma clang diagnostic push
@@ -38,10 +44,14 @@ struct BackupContext
     ProgressManager& progress;
     SqlConnectionString const& connectionString;
     std::string const& schema;
-    std::map<std::string, std::string>* checksums; // entryName -> SHA-256 hash
+    std::map<std::string, std::string>* checksums; // entryName -> chunk checksum
     std::mutex* checksumMutex;
     RetrySettings const& retrySettings;
     BackupSettings const& backupSettings;
+    IncrementalBase const* incrementalBase = nullptr; // base archive whose unchanged windows are reused
+    IncrementalLog* incrementalLog = nullptr;         // non-null when window fingerprints are recorded
+    StreamArchiveWriter* stream = nullptr;            // stream archive output; chunks bypass the worker archives
+    AdaptiveCompression* compression = nullptr;       // per-table compression choices (adaptive compression only)
 };
 
 /// Builds a SELECT query with ORDER BY for deterministic results.
@@ -69,6 +79,49 @@ std::string BuildSelectQueryWithOffset(SqlQueryFormatter const& formatter,
                                        std::vector<std::string> const& primaryKeys,
                                        size_t offset);
 
+/// Builds a SELECT query restricted to the closed primary-key window [lo, hi], ordered by the key.
+///
+/// @param serverType The server type (selects the MSSQL DECIMAL workaround).
+/// @param schema The schema name (may be empty).
+/// @param tableName The table name.
+/// @param columns The column definitions.
+/// @param pkColumn The single numeric primary-key column name.
+/// @param lo Inclusive lower bound of the window.
+/// @param hi Inclusive upper bound of the window.
+/// @return The SQL query string.
+std::string BuildSelectQueryWithPkRange(SqlServerType serverType,
+                                        std::string_view schema,
+                                        std::string const& tableName,
+                                        std::vector<SqlSchema::Column> const& columns,
+                                        std::string const& pkColumn,
+                                        int64_t lo,
+                                        int64_t hi);
+
+/// Decodes the current row of a single-row cursor into @p row (cleared first), one BackupValue per column.
+///
+/// @param cursor The cursor positioned on a fetched row.
+/// @param table The table the row belongs to.
+/// @param serverType The DBMS the row was read from (selects per-DBMS read strategies).
+/// @param tableName The table name (diagnostics only).
+/// @param row Receives the decoded row.
+void DecodeRowSingle(SqlResultCursor& cursor,
+                     SqlSchema::Table const& table,
+                     SqlServerType serverType,
+                     std::string_view tableName,
+                     std::vector<BackupValue>& row);
+
+/// Decodes one cell of an array-fetched block into a BackupValue identical to the single-row path.
+///
+/// @param cursor The array cursor holding the current block.
+/// @param colDef The column definition (must be in the TableIsArrayFetchable safe set).
+/// @param rowInBatch The row index within the current block.
+/// @param columnIndex The 1-based column index.
+/// @return The decoded cell value.
+BackupValue DecodeBatchedColumn(RowArrayCursor& cursor,
+                                SqlSchema::Column const& colDef,
+                                std::size_t rowInBatch,
+                                SQLUSMALLINT columnIndex);
+
 /// Queries the inclusive [MIN(pk), MAX(pk)] bounds of @p table's @p pkColumn.
 /// @param stmt The statement to execute the scalar queries on.
 /// @param table The table to inspect.
@@ -97,7 +150,7 @@ LIGHTWEIGHT_API void DeleteStaleSubChunks(WorkerChunkArchive& archive,
                                           size_t end);
 
 /// Processes a single chunk (a bounded row-range of a table) into compressed msgpack chunk
-/// entries in the worker's chunk archive.
+/// entries in the worker's chunk archive, or into frames for BackupContext::stream.
 /// @param ctx The backup context.
 /// @param conn The database connection for this worker (borrowed from the pool).
 /// @param chunk The chunk (table + row window) to process.
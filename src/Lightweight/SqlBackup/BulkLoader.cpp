@@ -0,0 +1,560 @@
+// SPDX-License-Identifier: Apache-2.0
+
+#include "../SqlError.hpp"
+#include "../SqlOdbcWide.hpp"
+#include "../SqlQueryFormatter.hpp"
+#include "../SqlStatement.hpp"
+#include "../TracyProfiler.hpp"
+#include "BulkLoader.hpp"
+
+#include <algorithm>
+#include <cstring>
+#include <format>
+#include <map>
+#include <mutex>
+#include <optional>
+#include <ranges>
+
+#if defined(_WIN32)
+    #ifndef NOMINMAX
+        #define NOMINMAX
+    #endif
+    #ifndef WIN32_LEAN_AND_MEAN
+        #define WIN32_LEAN_AND_MEAN
+    #endif
+    #include <Windows.h>
+#else
+    #include <dlfcn.h>
+#endif
+
+namespace Lightweight::SqlBackup::detail
+{
+
+namespace
+{
+    /// Returns the `?, ?, ...` parameter list of an INSERT over @p count columns.
+    std::string InsertPlaceholders(size_t count)
+    {
+        return std::ranges::fold_left(std::views::iota(0UZ, count), std::string {}, [](std::string const& acc, size_t) {
+            return acc.empty() ? std::string("?") : acc + ", ?";
+        });
+    }
+
+    /// Returns row @p row of the column-wise @p column as a single-row column.
+    SqlRawColumn RowOf(SqlRawColumn const& column, size_t row)
+    {
+        // ToRaw() lays every column out with a fixed stride of bufferLength bytes.
+        auto const stride = static_cast<size_t>(column.metadata.bufferLength);
+        return SqlRawColumn { .metadata = column.metadata,
+                              .data = column.data.subspan(row * stride, stride),
+                              .indicators = column.indicators.subspan(row, 1) };
+    }
+
+    class ParameterArrayLoader final: public BulkLoader
+    {
+      public:
+        ParameterArrayLoader(SqlConnection& conn,
+                             std::string const& schema,
+                             std::string const& tableName,
+                             TableInfo const& tableInfo):
+            m_stmt { conn }
+        {
+            ZoneScopedN("Restore::Prepare");
+            m_stmt.Prepare(conn.QueryFormatter().Insert(
+                schema, tableName, tableInfo.fields, InsertPlaceholders(tableInfo.columns.size())));
+        }
+
+        void Load(std::vector<SqlRawColumn> const& columns, std::size_t rows) override
+        {
+            (void) m_stmt.ExecuteBatch(columns, rows);
+        }
+
+        [[nodiscard]] BulkLoadMethod Method() const noexcept override
+        {
+            return BulkLoadMethod::ParameterArrays;
+        }
+
+      private:
+        SqlStatement m_stmt;
+    };
+
+    class MultiRowInsertLoader final: public BulkLoader
+    {
+      public:
+        MultiRowInsertLoader(SqlConnection& conn,
+                             std::string const& schema,
+                             std::string const& tableName,
+                             TableInfo const& tableInfo,
+                             std::size_t parameterLimit):
+            m_conn { conn },
+            m_schema { schema },
+            m_tableName { tableName },
+            m_fields { tableInfo.fields },
+            m_rowPlaceholders { InsertPlaceholders(tableInfo.columns.size()) },
+            m_rowsPerStatement { std::max(1UZ, parameterLimit / std::max(1UZ, tableInfo.columns.size())) }
+        {
+        }
+
+        void Load(std::vector<SqlRawColumn> const& columns, std::size_t rows) override
+        {
+            for (auto const statementRows: std::views::iota(0UZ, rows) | std::views::chunk(m_rowsPerStatement))
+            {
+                m_parameters.clear();
+                for (auto const row: statementRows)
+                    for (auto const& column: columns)
+                        m_parameters.push_back(RowOf(column, row));
+                (void) StatementFor(statementRows.size()).ExecuteBatch(m_parameters, 1);
+            }
+        }
+
+        [[nodiscard]] BulkLoadMethod Method() const noexcept override
+        {
+            return BulkLoadMethod::MultiRowValues;
+        }
+
+      private:
+        /// Returns the statement inserting @p rows rows: the full-size one, or the one for the
+        /// last partial statement of a batch (prepared again when its size changes).
+        SqlStatement& StatementFor(std::size_t rows)
+        {
+            auto& [stmt, preparedRows] = rows == m_rowsPerStatement ? m_full : m_partial;
+            if (!stmt || preparedRows != rows)
+            {
+                ZoneScopedN("Restore::Prepare");
+                // Insert() wraps the values in one pair of parentheses, so the rows are joined by "), (".
+                std::string values = m_rowPlaceholders;
+                for ([[maybe_unused]] auto const _: std::views::iota(1UZ, rows))
+                    values += "), (" + m_rowPlaceholders;
+                stmt.emplace(m_conn);
+                stmt->Prepare(m_conn.QueryFormatter().Insert(m_schema, m_tableName, m_fields, values));
+                preparedRows = rows;
+            }
+            return *stmt;
+        }
+
+        SqlConnection& m_conn;
+        std::string m_schema;
+        std::string m_tableName;
+        std::string m_fields;
+        std::string m_rowPlaceholders;
+        std::size_t m_rowsPerStatement;
+        std::pair<std::optional<SqlStatement>, std::size_t> m_full;
+        std::pair<std::optional<SqlStatement>, std::size_t> m_partial;
+        std::vector<SqlRawColumn> m_parameters;
+    };
+
+    // The bulk-copy entry points and constants are declared in the Microsoft-specific `msodbcsql.h`,
+    // which Lightweight must not depend on (see SqlConnection.cpp). Mirror them; they are part of the
+    // driver's stable ABI. The functions are exported by the driver library, not the driver manager.
+    // https://learn.microsoft.com/en-us/sql/relational-databases/native-client-odbc-extensions-bulk-copy-functions/bcp-bind
+    constexpr int BcpSucceed = 1;                 // SUCCEED
+    constexpr int BcpDirectionIn = 1;             // DB_IN
+    constexpr int BcpKeepIdentity = 8;            // BCPKEEPIDENTITY
+    constexpr SQLINTEGER BcpVariableLength = -10; // SQL_VARLEN_DATA
+
+    // Host data type tokens of bcp_bind().
+    constexpr int BcpInt1 = 0x30;      // SQLINT1
+    constexpr int BcpBit = 0x32;       // SQLBIT
+    constexpr int BcpInt2 = 0x34;      // SQLINT2
+    constexpr int BcpInt4 = 0x38;      // SQLINT4
+    constexpr int BcpInt8 = 0x7F;      // SQLINT8
+    constexpr int BcpFloat4 = 0x3B;    // SQLFLT4
+    constexpr int BcpFloat8 = 0x3E;    // SQLFLT8
+    constexpr int BcpUniqueId = 0x24;  // SQLUNIQUEID
+    constexpr int BcpVarChar = 0xA7;   // SQLBIGVARCHAR
+    constexpr int BcpNVarChar = 0xE7;  // SQLNVARCHAR
+    constexpr int BcpVarBinary = 0xA5; // SQLBIGVARBINARY
+
+    using BcpInitFn = int(SQL_API*)(SQLHDBC, SQLWCHAR const*, SQLWCHAR const*, SQLWCHAR const*, int);
+    using BcpBindFn = int(SQL_API*)(SQLHDBC, std::uint8_t const*, int, SQLINTEGER, std::uint8_t const*, int, int, int);
+    using BcpColPtrFn = int(SQL_API*)(SQLHDBC, std::uint8_t const*, int);
+    using BcpColLenFn = int(SQL_API*)(SQLHDBC, SQLINTEGER, int);
+    using BcpSendRowFn = int(SQL_API*)(SQLHDBC);
+    using BcpDoneFn = SQLINTEGER(SQL_API*)(SQLHDBC);
+    using BcpControlFn = int(SQL_API*)(SQLHDBC, int, void*);
+
+    struct BcpApi
+    {
+        BcpInitFn init;
+        BcpBindFn bind;
+        BcpColPtrFn colPtr;
+        BcpColLenFn colLen;
+        BcpSendRowFn sendRow;
+        BcpDoneFn done;
+        BcpControlFn control;
+    };
+
+    /// Looks up @p symbol in the already loaded driver library @p driverName.
+    void* FindDriverSymbol(std::string const& driverName, char const* symbol)
+    {
+#if defined(_WIN32)
+        HMODULE const module = GetModuleHandleA(driverName.c_str());
+        return module ? reinterpret_cast<void*>(GetProcAddress(module, symbol)) : nullptr;
+#else
+        // RTLD_NOLOAD: only find the driver the driver manager loaded, never load another copy.
+        if (void* const handle = dlopen(driverName.c_str(), RTLD_NOW | RTLD_NOLOAD))
+        {
+            void* const address = dlsym(handle, symbol);
+            dlclose(handle);
+            if (address)
+                return address;
+        }
+        return dlsym(RTLD_DEFAULT, symbol);
+#endif
+    }
+
+    std::optional<BcpApi> ResolveBcpApi(std::string const& driverName)
+    {
+        auto const find = [&]<typename Fn>(Fn& fn, char const* symbol) {
+            fn = reinterpret_cast<Fn>(FindDriverSymbol(driverName, symbol));
+            return fn != nullptr;
+        };
+        BcpApi api {};
+        if (find(api.init, "bcp_initW") && find(api.bind, "bcp_bind") && find(api.colPtr, "bcp_colptr")
+            && find(api.colLen, "bcp_collen") && find(api.sendRow, "bcp_sendrow") && find(api.done, "bcp_done")
+            && find(api.control, "bcp_control"))
+            return api;
+        return std::nullopt;
+    }
+
+    /// Returns the bulk-copy functions of @p driverName, or nullptr if the driver does not export them.
+    BcpApi const* BcpApiFor(std::string const& driverName)
+    {
+        static std::mutex mutex;
+        static std::map<std::string, std::optional<BcpApi>> resolved;
+        std::scoped_lock const lock(mutex);
+        auto [it, inserted] = resolved.try_emplace(driverName);
+        if (inserted)
+            it->second = ResolveBcpApi(driverName);
+        return it->second ? &*it->second : nullptr;
+    }
+
+    /// Characters reserved per value of a date/time column sent to bcp as text.
+    constexpr size_t BcpTextStride = 32;
+
+    /// The session-local table each bulk copy goes into before its rows are moved to the target.
+    constexpr std::string_view BcpStagingTable = "#lightweight_bulk_load";
+
+    /// How a column is handed to bcp_bind().
+    struct BcpColumn
+    {
+        int type = 0;
+        bool asText = false;                ///< date/time structures, sent as ISO 8601 text
+        int fractionDigits = 7;             ///< asText: digits of the seconds fraction of a timestamp
+        SQLUINTEGER fractionUnit = 100;     ///< asText: nanoseconds per unit of the last fraction digit
+        std::vector<char> text;             ///< asText: the values of the current batch
+        std::vector<SQLINTEGER> textSizes;  ///< asText: their lengths
+    };
+
+    /// Returns how a column bound as @p cType is sent, or std::nullopt if the bulk-copy binding
+    /// does not cover it. @p type is the column's type in the restored table.
+    std::optional<BcpColumn> BcpColumnFor(SQLSMALLINT cType, SqlColumnTypeDefinition const& type)
+    {
+        switch (cType)
+        {
+            case SQL_C_TINYINT:
+            case SQL_C_UTINYINT:
+                return BcpColumn { .type = BcpInt1 };
+            case SQL_C_BIT:
+                return BcpColumn { .type = BcpBit };
+            case SQL_C_SHORT:
+                return BcpColumn { .type = BcpInt2 };
+            case SQL_C_LONG:
+                return BcpColumn { .type = BcpInt4 };
+            case SQL_C_SBIGINT:
+                return BcpColumn { .type = BcpInt8 };
+            case SQL_C_FLOAT:
+                return BcpColumn { .type = BcpFloat4 };
+            case SQL_C_DOUBLE:
+                return BcpColumn { .type = BcpFloat8 };
+            case SQL_C_GUID:
+                return BcpColumn { .type = BcpUniqueId };
+            case SQL_C_CHAR:
+                return BcpColumn { .type = BcpVarChar };
+            case SQL_C_WCHAR:
+                return BcpColumn { .type = BcpNVarChar };
+            case SQL_C_BINARY:
+                return BcpColumn { .type = BcpVarBinary };
+            case SQL_C_TYPE_DATE:
+            case SQL_C_TYPE_TIME:
+            case SQL_C_TYPE_TIMESTAMP:
+                // The server converts the text; bcp's own date/time host types differ per driver version.
+                // DATETIME refuses text with more than three fraction digits, datetime2 keeps seven.
+                if (std::holds_alternative<SqlColumnTypeDefinitions::DateTime>(type))
+                    return BcpColumn { .type = BcpVarChar, .asText = true, .fractionDigits = 3, .fractionUnit = 1'000'000 };
+                return BcpColumn { .type = BcpVarChar, .asText = true };
+            default:
+                return std::nullopt;
+        }
+    }
+
+    /// Renders the date/time value at @p value (of C type @p cType) into @p out, returning its length.
+    /// Timestamps get the seconds fraction @p column keeps.
+    SQLINTEGER FormatDateTime(SQLSMALLINT cType, BcpColumn const& column, std::byte const* value, char* out)
+    {
+        switch (cType)
+        {
+            case SQL_C_TYPE_DATE: {
+                SQL_DATE_STRUCT date {};
+                std::memcpy(&date, value, sizeof(date));
+                return static_cast<SQLINTEGER>(
+                    std::format_to_n(out, BcpTextStride, "{:04}-{:02}-{:02}", date.year, date.month, date.day).size);
+            }
+            case SQL_C_TYPE_TIME: {
+                SQL_TIME_STRUCT time {};
+                std::memcpy(&time, value, sizeof(time));
+                return static_cast<SQLINTEGER>(
+                    std::format_to_n(out, BcpTextStride, "{:02}:{:02}:{:02}", time.hour, time.minute, time.second)
+                        .size);
+            }
+            default: {
+                SQL_TIMESTAMP_STRUCT ts {};
+                std::memcpy(&ts, value, sizeof(ts));
+                // fraction is in nanoseconds.
+                return static_cast<SQLINTEGER>(std::format_to_n(out,
+                                                                BcpTextStride,
+                                                                "{:04}-{:02}-{:02} {:02}:{:02}:{:02}.{:0{}}",
+                                                                ts.year,
+                                                                ts.month,
+                                                                ts.day,
+                                                                ts.hour,
+                                                                ts.minute,
+                                                                ts.second,
+                                                                ts.fraction / column.fractionUnit,
+                                                                column.fractionDigits)
+                                                   .size);
+            }
+        }
+    }
+
+    /// Bulk copies into a session-local staging table and moves the rows into the target table in
+    /// Finish(), inside the connection's transaction. bcp_done() commits what was sent, so a chunk that
+    /// fails midway leaves its rows in the staging table only, which the next loader drops.
+    class BulkCopyLoader final: public BulkLoader
+    {
+      public:
+        BulkCopyLoader(SqlConnection& conn,
+                       BcpApi const& api,
+                       std::string const& schema,
+                       std::string const& tableName,
+                       TableInfo const& tableInfo):
+            m_conn { conn },
+            m_api { api },
+            m_schema { schema },
+            m_tableName { tableName },
+            m_tableInfo { tableInfo },
+            m_qualifiedName { conn.QueryFormatter().QualifiedTableName(schema, tableName) }
+        {
+        }
+
+        BulkCopyLoader(BulkCopyLoader const&) = delete;
+        BulkCopyLoader(BulkCopyLoader&&) = delete;
+        BulkCopyLoader& operator=(BulkCopyLoader const&) = delete;
+        BulkCopyLoader& operator=(BulkCopyLoader&&) = delete;
+
+        ~BulkCopyLoader() override
+        {
+            // Leave bulk-copy mode after a failed load; the rows sent so far only reach the staging table.
+            if (m_started)
+                (void) m_api.done(m_conn.NativeHandle());
+        }
+
+        void Load(std::vector<SqlRawColumn> const& columns, std::size_t rows) override
+        {
+            if (!m_fallback && !m_started && !Start(columns))
+                m_fallback = std::make_unique<ParameterArrayLoader>(m_conn, m_schema, m_tableName, m_tableInfo);
+            if (m_fallback)
+            {
+                m_fallback->Load(columns, rows);
+                return;
+            }
+
+            auto* const hDbc = m_conn.NativeHandle();
+            for (auto&& [column, bcp]: std::views::zip(columns, m_columns))
+            {
+                if (!bcp.asText)
+                    continue;
+                bcp.text.resize(rows * BcpTextStride);
+                bcp.textSizes.resize(rows);
+                for (auto const row: std::views::iota(0UZ, rows))
+                    if (column.indicators[row] != SQL_NULL_DATA)
+                        bcp.textSizes[row] = FormatDateTime(column.metadata.cType,
+                                                            bcp,
+                                                            column.data.data() + (row * column.metadata.bufferLength),
+                                                            bcp.text.data() + (row * BcpTextStride));
+            }
+
+            for (auto const row: std::views::iota(0UZ, rows))
+            {
+                for (auto const& [i, column]: columns | std::views::enumerate)
+                {
+                    auto const& bcp = m_columns[static_cast<size_t>(i)];
+                    auto const index = static_cast<int>(i + 1); // bcp column ordinals are 1-based
+                    auto const indicator = column.indicators[row];
+                    if (indicator == SQL_NULL_DATA)
+                    {
+                        Require(m_api.colLen(hDbc, SQL_NULL_DATA, index));
+                        continue;
+                    }
+                    if (bcp.asText)
+                    {
+                        Require(m_api.colPtr(
+                            hDbc, reinterpret_cast<std::uint8_t const*>(bcp.text.data() + (row * BcpTextStride)), index));
+                        Require(m_api.colLen(hDbc, bcp.textSizes[row], index));
+                    }
+                    else
+                    {
+                        Require(m_api.colPtr(
+                            hDbc,
+                            reinterpret_cast<std::uint8_t const*>(column.data.data() + (row * column.metadata.bufferLength)),
+                            index));
+                        Require(m_api.colLen(hDbc, static_cast<SQLINTEGER>(indicator), index));
+                    }
+                }
+                Require(m_api.sendRow(hDbc));
+            }
+        }
+
+        void Finish() override
+        {
+            if (!m_started)
+                return;
+            m_started = false;
+            if (m_api.done(m_conn.NativeHandle()) < 0)
+                throw SqlException(SqlErrorInfo::FromConnectionHandle(m_conn.NativeHandle()));
+
+            auto stmt = SqlStatement { m_conn };
+            (void) stmt.ExecuteDirect(std::format("INSERT INTO {} ({}) SELECT {} FROM {}",
+                                                  m_qualifiedName,
+                                                  m_tableInfo.fields,
+                                                  m_tableInfo.fields,
+                                                  BcpStagingTable));
+            (void) stmt.ExecuteDirect(std::format("TRUNCATE TABLE {}", BcpStagingTable));
+        }
+
+        [[nodiscard]] BulkLoadMethod Method() const noexcept override
+        {
+            return m_fallback ? m_fallback->Method() : BulkLoadMethod::BulkCopy;
+        }
+
+      private:
+        /// Starts a bulk copy into the staging table, or returns false if a column type is not covered.
+        bool Start(std::vector<SqlRawColumn> const& columns)
+        {
+            if (m_columns.empty())
+            {
+                for (auto const& [column, declaration]: std::views::zip(columns, m_tableInfo.columns))
+                {
+                    auto bcp = BcpColumnFor(column.metadata.cType, declaration.type);
+                    if (!bcp)
+                        return false;
+                    m_columns.push_back(std::move(*bcp));
+                }
+
+                // An empty copy of the target's columns, replacing what a failed chunk left behind.
+                auto stmt = SqlStatement { m_conn };
+                (void) stmt.ExecuteDirect(std::format("DROP TABLE IF EXISTS {}", BcpStagingTable));
+                (void) stmt.ExecuteDirect(
+                    std::format("SELECT TOP 0 * INTO {} FROM {}", BcpStagingTable, m_qualifiedName));
+            }
+
+            auto* const hDbc = m_conn.NativeHandle();
+            auto wTableName = Lightweight::detail::OdbcWideArg { BcpStagingTable };
+            Require(m_api.init(hDbc, wTableName.data(), nullptr, nullptr, BcpDirectionIn));
+            m_started = true;
+            // Restored rows carry their identity values (like SET IDENTITY_INSERT ON).
+            Require(m_api.control(hDbc, BcpKeepIdentity, reinterpret_cast<void*>(1)));
+
+            // bcp_colptr()/bcp_collen() point every column at its value before each row is sent;
+            // a null pData would mean "sent with bcp_moretext" instead.
+            static std::uint8_t const placeholder {};
+            for (auto const& [i, column]: m_columns | std::views::enumerate)
+                Require(m_api.bind(
+                    hDbc, &placeholder, 0, BcpVariableLength, nullptr, 0, column.type, static_cast<int>(i + 1)));
+            return true;
+        }
+
+        void Require(int result) const
+        {
+            if (result != BcpSucceed)
+                throw SqlException(SqlErrorInfo::FromConnectionHandle(m_conn.NativeHandle()));
+        }
+
+        SqlConnection& m_conn;
+        BcpApi const& m_api;
+        std::string m_schema;
+        std::string m_tableName;
+        TableInfo const& m_tableInfo;
+        std::string m_qualifiedName;
+        std::vector<BcpColumn> m_columns;
+        std::unique_ptr<BulkLoader> m_fallback; // column types bcp_bind() is not given
+        bool m_started = false;
+    };
+} // namespace
+
+std::string_view BulkLoadMethodName(BulkLoadMethod method) noexcept
+{
+    switch (method)
+    {
+        case BulkLoadMethod::ParameterArrays:
+            return "parameter arrays";
+        case BulkLoadMethod::MultiRowValues:
+            return "multi-row insert";
+        case BulkLoadMethod::BulkCopy:
+            return "bulk copy";
+    }
+    return "unknown";
+}
+
+std::unique_ptr<BulkLoader> CreateBulkLoader(SqlConnection& conn,
+                                             std::string const& schema,
+                                             std::string const& tableName,
+                                             TableInfo const& tableInfo,
+                                             bool preferNative)
+{
+    if (preferNative && conn.SupportsBulkCopy() && conn.BulkCopyEnabled())
+        if (auto const* api = BcpApiFor(conn.DriverName()))
+            return std::make_unique<BulkCopyLoader>(conn, *api, schema, tableName, tableInfo);
+
+    if (auto const limit = conn.QueryFormatter().MultiRowInsertParameterLimit(); preferNative && limit > 0)
+        return CreateMultiRowInsertLoader(conn, schema, tableName, tableInfo, limit);
+
+    return std::make_unique<ParameterArrayLoader>(conn, schema, tableName, tableInfo);
+}
+
+std::unique_ptr<BulkLoader> CreateMultiRowInsertLoader(SqlConnection& conn,
+                                                       std::string const& schema,
+                                                       std::string const& tableName,
+                                                       TableInfo const& tableInfo,
+                                                       std::size_t parameterLimit)
+{
+    return std::make_unique<MultiRowInsertLoader>(conn, schema, tableName, tableInfo, parameterLimit);
+}
+
+void BulkLoadCounters::Add(BulkLoadMethod method, std::size_t rows, std::chrono::steady_clock::duration elapsed)
+{
+    auto const index = static_cast<size_t>(method);
+    m_rows[index].fetch_add(rows, std::memory_order_relaxed);
+    m_nanoseconds[index].fetch_add(std::chrono::duration_cast<std::chrono::nanoseconds>(elapsed).count(),
+                                   std::memory_order_relaxed);
+}
+
+std::vector<RestoreLoadStatistics> BulkLoadCounters::Statistics() const
+{
+    std::vector<RestoreLoadStatistics> statistics;
+    for (auto const index: std::views::iota(0UZ, MethodCount))
+    {
+        auto const rows = m_rows[index].load(std::memory_order_relaxed);
+        if (rows == 0)
+            continue;
+        auto const elapsed = std::chrono::nanoseconds { m_nanoseconds[index].load(std::memory_order_relaxed) };
+        statistics.push_back(RestoreLoadStatistics {
+            .method = std::string { BulkLoadMethodName(static_cast<BulkLoadMethod>(index)) },
+            .rows = static_cast<std::size_t>(rows),
+            .insertTime = std::chrono::duration_cast<std::chrono::milliseconds>(elapsed),
+        });
+    }
+    return statistics;
+}
+
+} // namespace Lightweight::SqlBackup::detail
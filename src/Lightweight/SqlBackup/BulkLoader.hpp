@@ -0,0 +1,98 @@
+// SPDX-License-Identifier: Apache-2.0
+
+#pragma once
+
+#include "../Api.hpp"
+#include "../DataBinder/SqlRawColumn.hpp"
+#include "../SqlConnection.hpp"
+#include "SqlBackup.hpp"
+
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace Lightweight::SqlBackup::detail
+{
+
+/// The insert path a BulkLoader feeds rows through.
+enum class BulkLoadMethod : std::uint8_t
+{
+    ParameterArrays, ///< One prepared single-row INSERT, executed over a parameter array.
+    MultiRowValues,  ///< Prepared `INSERT ... VALUES (...), (...)` statements packing many rows each.
+    BulkCopy,        ///< SQL Server's bulk-copy protocol (the driver's `bcp_*` extensions).
+};
+
+/// Returns the display name of a load method, as reported by ProgressManager::OnRestoreLoadStatistics().
+[[nodiscard]] LIGHTWEIGHT_API std::string_view BulkLoadMethodName(BulkLoadMethod method) noexcept;
+
+/// Inserts the column-wise batches a BatchManager flushes into one table.
+///
+/// Load() is the BatchManager executor. Rows become visible with the connection's transaction;
+/// call Finish() before committing it, as the bulk-copy method only completes its rows there.
+class LIGHTWEIGHT_API BulkLoader
+{
+  public:
+    BulkLoader() = default;
+    BulkLoader(BulkLoader const&) = delete;
+    BulkLoader(BulkLoader&&) = delete;
+    BulkLoader& operator=(BulkLoader const&) = delete;
+    BulkLoader& operator=(BulkLoader&&) = delete;
+    virtual ~BulkLoader() = default;
+
+    /// Inserts @p rows rows of column-wise data, one SqlRawColumn per table column.
+    virtual void Load(std::vector<SqlRawColumn> const& columns, std::size_t rows) = 0;
+
+    /// Completes the rows loaded so far. Load() may be called again afterwards.
+    virtual void Finish() {}
+
+    /// The insert path the rows loaded so far went through.
+    [[nodiscard]] virtual BulkLoadMethod Method() const noexcept = 0;
+};
+
+/// Creates the loader for inserting into @p tableName over @p conn.
+///
+/// With @p preferNative the loader uses the server's native bulk path where the connection offers
+/// one: SQL Server's bulk copy on connections with SqlConnection::BulkCopyEnabled() whose driver
+/// exports the `bcp_*` functions, and multi-row VALUES statements on dialects with a
+/// SqlQueryFormatter::MultiRowInsertParameterLimit(). Everything else, and bulk copies of column
+/// types the protocol binding does not cover, inserts through parameter arrays.
+///
+/// Bulk copy addresses the columns by position, so the table's columns must be in the order of
+/// @p tableInfo, as RecreateDatabaseSchema() creates them.
+[[nodiscard]] LIGHTWEIGHT_API std::unique_ptr<BulkLoader> CreateBulkLoader(SqlConnection& conn,
+                                                                            std::string const& schema,
+                                                                            std::string const& tableName,
+                                                                            TableInfo const& tableInfo,
+                                                                            bool preferNative);
+
+/// Creates a loader that inserts with multi-row VALUES statements of at most @p parameterLimit parameters.
+[[nodiscard]] LIGHTWEIGHT_API std::unique_ptr<BulkLoader> CreateMultiRowInsertLoader(SqlConnection& conn,
+                                                                                      std::string const& schema,
+                                                                                      std::string const& tableName,
+                                                                                      TableInfo const& tableInfo,
+                                                                                      std::size_t parameterLimit);
+
+/// Rows and insert time per load method, shared by the workers of one restore.
+class BulkLoadCounters
+{
+  public:
+    /// Adds @p rows rows inserted through @p method in @p elapsed.
+    LIGHTWEIGHT_API void Add(BulkLoadMethod method, std::size_t rows, std::chrono::steady_clock::duration elapsed);
+
+    /// Returns one entry per method that inserted rows.
+    [[nodiscard]] LIGHTWEIGHT_API std::vector<RestoreLoadStatistics> Statistics() const;
+
+  private:
+    static constexpr std::size_t MethodCount = 3;
+
+    std::array<std::atomic<std::uint64_t>, MethodCount> m_rows {};
+    std::array<std::atomic<std::int64_t>, MethodCount> m_nanoseconds {};
+};
+
+} // namespace Lightweight::SqlBackup::detail
@@ -24,6 +24,22 @@ namespace
     /// is no std::is_any_of<T, U...> in the standard library).
     template <typename T, typename... Candidates>
     constexpr bool IsAnyOf = (std::is_same_v<T, Candidates> || ...);
+
+    /// Returns the index of the window of @p grid holding @p pkMin, or std::nullopt if [pkMin, pkMax]
+    /// starts below the grid or spans more than MaxBaseGridWindowsPerTable of its windows.
+    std::optional<uint64_t> FirstGridWindow(WindowGrid const& grid, int64_t pkMin, int64_t pkMax)
+    {
+        if (grid.width < 1 || pkMin < grid.pkMin)
+            return std::nullopt;
+        // Offsets from the grid origin, wrap-safe in uint64 like CappedWindowWidth.
+        auto const width = static_cast<uint64_t>(grid.width);
+        auto const first = (static_cast<uint64_t>(pkMin) - static_cast<uint64_t>(grid.pkMin)) / width;
+        auto const last = (static_cast<uint64_t>(pkMax) - static_cast<uint64_t>(grid.pkMin)) / width;
+        if (last - first >= static_cast<uint64_t>(MaxBaseGridWindowsPerTable)
+            || last > std::numeric_limits<uint32_t>::max())
+            return std::nullopt;
+        return first;
+    }
 } // namespace
 
 bool TableHasLobColumn(SqlSchema::Table const& table)
@@ -172,7 +188,8 @@ int64_t CappedWindowWidth(int64_t pkMin, int64_t pkMax, int64_t rowsPerChunk, in
 ChunkPlan PlanChunks(std::vector<SqlSchema::Table> const& tables,
                      size_t rowsPerChunk,
                      PkBoundsFunction const& pkBounds,
-                     SqlServerType serverType)
+                     SqlServerType serverType,
+                     WindowGrids const& baseGrids)
 {
     auto plan = ChunkPlan {};
     if (rowsPerChunk == 0)
@@ -196,8 +213,23 @@ ChunkPlan PlanChunks(std::vector<SqlSchema::Table> const& tables,
                 continue;
             }
             auto const [pkMin, pkMax] = *bounds;
-            auto const width = CappedWindowWidth(pkMin, pkMax, static_cast<int64_t>(rowsPerChunk), MaxWindowsPerTable);
-            auto const windows = PlanPrimaryKeyWindows(pkMin, pkMax, width);
+            auto grid = WindowGrid {
+                .pkMin = pkMin,
+                .width = CappedWindowWidth(pkMin, pkMax, static_cast<int64_t>(rowsPerChunk), MaxWindowsPerTable),
+            };
+            uint64_t firstWindow = 0;
+            if (auto const baseGrid = baseGrids.find(table.name); baseGrid != baseGrids.end())
+            {
+                if (auto const first = FirstGridWindow(baseGrid->second, pkMin, pkMax))
+                {
+                    grid = baseGrid->second;
+                    firstWindow = *first;
+                }
+            }
+            plan.windowGrids[table.name] = grid;
+            auto const firstLo = static_cast<int64_t>(static_cast<uint64_t>(grid.pkMin)
+                                                      + (firstWindow * static_cast<uint64_t>(grid.width)));
+            auto const windows = PlanPrimaryKeyWindows(firstLo, pkMax, grid.width);
             auto& state = plan.tableStates.emplace_back();
             state.remainingChunks.store(windows.size());
             // Wrap-safe span estimate (pkMax - pkMin in signed int64 is UB for the full range),
@@ -219,7 +251,7 @@ ChunkPlan PlanChunks(std::vector<SqlSchema::Table> const& tables,
                 plan.chunks.emplace_back(Chunk {
                     .table = &table,
                     .strategy = ChunkStrategy::PrimaryKeyRange,
-                    .windowIndex = static_cast<uint32_t>(windowIndex),
+                    .windowIndex = static_cast<uint32_t>(firstWindow + static_cast<uint64_t>(windowIndex)),
                     .offset = 0,
                     .lo = lo,
                     .hi = hi,
@@ -4,6 +4,7 @@
 #include "../Api.hpp"
 #include "../SqlSchema.hpp"
 #include "../SqlServerType.hpp"
+#include "SqlBackup.hpp"
 
 #include <atomic>
 #include <cstddef>
@@ -95,6 +96,8 @@ struct ChunkPlan
     std::deque<TableBackupState> tableStates;
     /// Single-numeric-PK tables with no rows: no chunks; caller reports them Finished(0).
     std::vector<SqlSchema::Table const*> emptyTables;
+    /// The grid each PrimaryKeyRange table's windows were cut from, keyed by table name.
+    WindowGrids windowGrids;
 };
 
 /// Plans the chunk work-list for a set of tables. Tables with a single numeric primary key are
@@ -103,16 +106,24 @@ struct ChunkPlan
 /// a single OFFSET seed chunk. The returned plan owns the per-table states the chunks point into
 /// and must outlive the workers.
 ///
+/// A table listed in @p baseGrids is cut on that grid instead, so an incremental backup gets the
+/// base archive's window indexes and bounds no matter how far MAX(pk) moved: windows start at the
+/// one holding MIN(pk), and keys above the base's range get new windows of the same width. A table
+/// whose MIN(pk) fell below the grid, or that would need more than MaxBaseGridWindowsPerTable
+/// windows, is planned afresh.
+///
 /// @param tables The tables to back up (must outlive the returned plan — chunks hold pointers).
 /// @param rowsPerChunk Target rows per chunk window.
 /// @param pkBounds Plan-time MIN/MAX query for a table's primary-key column.
 /// @param serverType The DBMS being backed up (gates per-DBMS array-fetch admissions, see
 ///                   TableIsArrayFetchable).
+/// @param baseGrids The window grids of an incremental backup's base archive, keyed by table name.
 /// @return The chunk plan (work-list + per-table states + empty-table list).
 [[nodiscard]] LIGHTWEIGHT_API ChunkPlan PlanChunks(std::vector<SqlSchema::Table> const& tables,
                                                    size_t rowsPerChunk,
                                                    PkBoundsFunction const& pkBounds,
-                                                   SqlServerType serverType);
+                                                   SqlServerType serverType,
+                                                   WindowGrids const& baseGrids = {});
 
 /// Returns true if @p table has a column whose type cannot be fixed-stride array-bound
 /// (varchar(max)/text/nvarchar(max)/binary/varbinary/image LOBs). Such tables use the
@@ -174,6 +185,10 @@ struct ChunkPlan
 /// explode; sparse tables get proportionally wider windows instead.
 constexpr int64_t MaxWindowsPerTable = 1024;
 
+/// Upper bound on the windows of a table planned on an incremental base's grid, which grows with
+/// the table instead of widening. Beyond it the table is planned afresh with CappedWindowWidth.
+constexpr int64_t MaxBaseGridWindowsPerTable = 4 * MaxWindowsPerTable;
+
 /// Computes the per-window key width for splitting [pkMin, pkMax] into at most
 /// @p maxWindowsPerTable windows of at least @p rowsPerChunk keys each:
 /// windowCount = clamp(ceil(span / rowsPerChunk), 1, maxWindowsPerTable); width = ceil(span / windowCount).
@@ -26,11 +26,6 @@
 namespace Lightweight::SqlBackup::detail
 {
 
-/// Maximum declared buffer size for binary LOB columns during backup.
-/// The actual data can grow beyond this via automatic ODBC buffer resizing.
-/// Set to 16MB to handle typical BLOB/VARBINARY(MAX) columns.
-constexpr size_t MaxBinaryLobBufferSize = 16 * 1024 * 1024;
-
 /// Metadata for a ZIP entry used during restore operations.
 struct ZipEntryInfo
 {
@@ -38,6 +33,7 @@ struct ZipEntryInfo
     std::string name;
     zip_uint64_t size {};
     bool valid = false;
+    zip_uint64_t compressedSize {}; ///< Size of the entry in the archive; drives the restore cost estimate.
 };
 
 /// Determines if the given SQL error is a transient error that can be retried.
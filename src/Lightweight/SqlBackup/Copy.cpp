@@ -0,0 +1,606 @@
+// SPDX-License-Identifier: Apache-2.0
+
+#include "../SqlQueryFormatter.hpp"
+#include "../SqlSchema.hpp"
+#include "../SqlStatement.hpp"
+#include "../SqlTransaction.hpp"
+#include "../TracyProfiler.hpp"
+#include "../Utils.hpp"
+#include "Backup.hpp"
+#include "BatchManager.hpp"
+#include "ChunkPlanner.hpp"
+#include "Common.hpp"
+#include "ConnectionPool.hpp"
+#include "Copy.hpp"
+#include "Restore.hpp"
+#include "SqlBackup.hpp"
+#include "TableFilter.hpp"
+
+#include <algorithm>
+#include <atomic>
+#include <format>
+#include <functional>
+#include <map>
+#include <memory>
+#include <ranges>
+#include <set>
+#include <string>
+#include <thread>
+#include <vector>
+
+using namespace std::string_literals;
+
+namespace Lightweight::SqlBackup::detail
+{
+
+namespace
+{
+
+    /// A prepared INSERT for one target table plus the batch manager feeding it.
+    /// Heap-allocated so the executor lambda's reference to @c stmt stays valid.
+    struct CopyInsert
+    {
+        SqlStatement stmt;
+        std::unique_ptr<::Lightweight::detail::BatchManager> batchManager;
+    };
+
+    using CopyInsertCache = std::map<std::string, std::unique_ptr<CopyInsert>>;
+
+    /// Applies the per-session settings the restore workers use for fast bulk loading.
+    void ApplyCopyTargetSessionSettings(SqlConnection& conn)
+    {
+        if (conn.ServerType() != SqlServerType::SQLITE)
+            return;
+        (void) SqlStatement { conn }.ExecuteDirect("PRAGMA synchronous = OFF");
+        (void) SqlStatement { conn }.ExecuteDirect("PRAGMA journal_mode = WAL");
+        (void) SqlStatement { conn }.ExecuteDirect("PRAGMA foreign_keys = OFF");
+    }
+
+    /// Returns the cached INSERT for @p tableName, preparing it on first use.
+    CopyInsert& GetOrPrepareInsert(CopyContext& ctx,
+                                   SqlConnection& conn,
+                                   CopyInsertCache& inserts,
+                                   std::string const& tableName,
+                                   TableInfo const& tableInfo)
+    {
+        if (auto const it = inserts.find(tableName); it != inserts.end())
+            return *it->second;
+
+        ZoneScopedN("Copy::Prepare");
+        auto insert = std::make_unique<CopyInsert>(CopyInsert { .stmt = SqlStatement { conn }, .batchManager = nullptr });
+        auto const placeholders = std::ranges::fold_left(
+            std::views::iota(0UZ, tableInfo.columns.size()), std::string {}, [](std::string const& acc, size_t) {
+                return acc.empty() ? std::string("?") : acc + ", ?";
+            });
+        insert->stmt.Prepare(conn.QueryFormatter().Insert(ctx.targetSchema, tableName, tableInfo.fields, placeholders));
+
+        auto& stmt = insert->stmt;
+        insert->batchManager = std::make_unique<::Lightweight::detail::BatchManager>(
+            [&stmt](std::vector<SqlRawColumn> const& cols, size_t rows) {
+                ZoneScopedN("Copy::ExecuteBatch");
+                ZoneValue(rows);
+                (void) stmt.ExecuteBatch(cols, rows);
+            },
+            tableInfo.columns,
+            std::max<size_t>(1, ctx.copySettings.rowsPerBatch),
+            conn.ServerType());
+
+        return *inserts.emplace(tableName, std::move(insert)).first->second;
+    }
+
+    /// Writes one batch inside its own transaction, retrying after transient errors.
+    /// @return true if the batch was committed.
+    // NOLINTNEXTLINE(readability-function-cognitive-complexity)
+    bool WriteCopyBatch(CopyContext& ctx, SqlConnection& conn, CopyBatch const& item, CopyInsertCache& inserts)
+    {
+        ZoneScopedN("Copy::WriteBatch");
+        ZoneTextObject(item.tableName);
+        auto const& tableInfo = ctx.tableMap.at(item.tableName);
+
+        bool const needsIdentityInsert =
+            conn.ServerType() == SqlServerType::MICROSOFT_SQL
+            && std::ranges::any_of(tableInfo.columns,
+                                   [](auto const& col) { return col.primaryKey == SqlPrimaryKeyType::AUTO_INCREMENT; });
+        auto const identityTable = needsIdentityInsert ? FormatTableName(ctx.targetSchema, item.tableName) : std::string {};
+
+        // IDENTITY_INSERT is session-wide and only one table may have it ON at a time, so it is
+        // scoped to the batch; writers interleave batches of different tables.
+        auto const disableIdentityInsert = [&] {
+            if (!needsIdentityInsert)
+                return;
+            try
+            {
+                (void) SqlStatement { conn }.ExecuteDirect(std::format("SET IDENTITY_INSERT {} OFF", identityTable));
+            }
+            catch (...) // NOLINT(bugprone-empty-catch)
+            {
+                // Best-effort cleanup - a reconnect resets the session anyway
+            }
+        };
+
+        unsigned retryCount = 0;
+        while (true)
+        {
+            try
+            {
+                if (needsIdentityInsert)
+                    (void) SqlStatement { conn }.ExecuteDirect(std::format("SET IDENTITY_INSERT {} ON", identityTable));
+
+                auto& insert = GetOrPrepareInsert(ctx, conn, inserts, item.tableName, tableInfo);
+                SqlTransaction transaction(conn, SqlTransactionMode::ROLLBACK);
+                {
+                    ZoneScopedN("Copy::PushBatch");
+                    insert.batchManager->PushBatch(item.batch);
+                }
+                {
+                    ZoneScopedN("Copy::Commit");
+                    insert.batchManager->Flush();
+                    transaction.Commit();
+                }
+                disableIdentityInsert();
+                return true;
+            }
+            catch (SqlException const& e)
+            {
+                // A failed statement may leave rows buffered in the batch manager; never reuse it.
+                inserts.erase(item.tableName);
+                if (!IsTransientError(e.info()) || retryCount >= ctx.retrySettings.maxRetries)
+                {
+                    disableIdentityInsert();
+                    ctx.progress.Update({ .state = Progress::State::Error,
+                                          .tableName = item.tableName,
+                                          .currentRows = 0,
+                                          .totalRows = 0,
+                                          .message = "Insert failed: "s + e.what() });
+                    return false;
+                }
+
+                ++retryCount;
+                ctx.progress.Update({ .state = Progress::State::Warning,
+                                      .tableName = item.tableName,
+                                      .currentRows = 0,
+                                      .totalRows = tableInfo.rowCount,
+                                      .message = std::format(
+                                          "Transient error, retry {}/{}: {}", retryCount, ctx.retrySettings.maxRetries, e.what()) });
+
+                // Prepared statements die with the connection.
+                inserts.clear();
+                conn.Close();
+                std::this_thread::sleep_for(CalculateRetryDelay(retryCount - 1, ctx.retrySettings));
+                if (!ConnectWithRetry(conn, ctx.targetConnectionString, ctx.retrySettings, ctx.progress, item.tableName))
+                {
+                    ctx.progress.Update({ .state = Progress::State::Error,
+                                          .tableName = item.tableName,
+                                          .currentRows = 0,
+                                          .totalRows = 0,
+                                          .message = "Failed to reconnect after transient error" });
+                    return false;
+                }
+                ApplyCopyTargetSessionSettings(conn);
+            }
+            catch (std::exception const& e)
+            {
+                inserts.erase(item.tableName);
+                disableIdentityInsert();
+                ctx.progress.Update({ .state = Progress::State::Error,
+                                      .tableName = item.tableName,
+                                      .currentRows = 0,
+                                      .totalRows = 0,
+                                      .message = "Insert failed: "s + e.what() });
+                return false;
+            }
+        }
+    }
+
+} // namespace
+
+void TryReportTableCopied(CopyContext& ctx, std::string const& tableName)
+{
+    auto& state = ctx.tableStates.at(tableName);
+    if (!state.readDone.load() || state.pendingBatches.load() != 0)
+        return;
+    if (state.reported.exchange(true))
+        return;
+
+    auto const rows = state.writtenRows.load();
+    bool const failed = state.failed.load();
+    ctx.progress.Update({ .state = failed ? Progress::State::Error : Progress::State::Finished,
+                          .tableName = tableName,
+                          .currentRows = rows,
+                          .totalRows = rows,
+                          .message = failed ? "Copy incomplete: errors occurred" : "Copy complete" });
+}
+
+// NOLINTNEXTLINE(readability-function-cognitive-complexity)
+void ReadChunkForCopy(CopyContext& ctx, SqlConnection& conn, Chunk const& chunk)
+{
+    auto const& table = *chunk.table;
+    ZoneScopedN("Copy::ReadChunk");
+    ZoneTextObject(table.name);
+    auto& copyState = ctx.tableStates.at(table.name);
+    auto const totalRows = ctx.tableMap.at(table.name).rowCount;
+
+    if (!chunk.state->started.exchange(true))
+        ctx.progress.Update({ .state = Progress::State::Started,
+                              .tableName = table.name,
+                              .currentRows = 0,
+                              .totalRows = totalRows,
+                              .message = "Started copy"s });
+
+    SqlStatement stmt { conn };
+    std::string selectQuery;
+    {
+        ZoneScopedN("Copy::BuildQuery");
+        if (chunk.strategy == ChunkStrategy::PrimaryKeyRange && !chunk.pkColumn.empty())
+            selectQuery = BuildSelectQueryWithPkRange(
+                conn.ServerType(), table.schema, table.name, table.columns, chunk.pkColumn, chunk.lo, chunk.hi);
+        else
+            selectQuery = BuildSelectQueryWithOffset(conn.QueryFormatter(),
+                                                     conn.ServerType(),
+                                                     table.schema,
+                                                     table.name,
+                                                     table.columns,
+                                                     table.primaryKeys,
+                                                     chunk.offset);
+    }
+
+    auto const rowsPerBatch = std::max<size_t>(1, ctx.copySettings.rowsPerBatch);
+    ColumnBatch batch;
+    std::vector<BackupValue> row;
+    row.reserve(table.columns.size());
+
+    // Hands the accumulated rows to the writers. Blocks while the queue is full (backpressure);
+    // fails once the queue was shut down because every writer gave up.
+    auto const emitBatch = [&] {
+        if (batch.rowCount == 0)
+            return;
+        copyState.pendingBatches.fetch_add(1);
+        if (!ctx.batchQueue.Push(CopyBatch { .tableName = table.name, .batch = std::move(batch) }))
+        {
+            copyState.pendingBatches.fetch_sub(1);
+            throw std::runtime_error("No copy writer left to accept data");
+        }
+        batch = ColumnBatch {};
+    };
+
+    auto const appendRow = [&] {
+        batch.AppendRow(row);
+        chunk.state->processedRows.fetch_add(1, std::memory_order_relaxed);
+        if (batch.rowCount >= rowsPerBatch)
+            emitBatch();
+    };
+
+    // Same dispatch as the backup worker: bulk array fetch for array-fetchable tables, falling back
+    // to the single-row path when the driver describes a column the array cursor cannot bind (the
+    // cursor throws before any row is fetched, so nothing has been queued yet).
+    if (chunk.arrayFetchable)
+    {
+        try
+        {
+            constexpr std::size_t ArrayDepth = 512;
+            auto const cols = static_cast<SQLUSMALLINT>(table.columns.size());
+            auto cursor = stmt.ExecuteBatchFetch(selectQuery, ArrayDepth);
+            while (auto const n = cursor.FetchArray())
+            {
+                for (auto const r: std::views::iota(0UZ, n))
+                {
+                    row.clear();
+                    for (auto const i: std::views::iota(SQLUSMALLINT { 1 }, static_cast<SQLUSMALLINT>(cols + 1)))
+                        row.emplace_back(DecodeBatchedColumn(cursor, table.columns[i - 1], r, i));
+                    appendRow();
+                }
+            }
+            emitBatch();
+            return;
+        }
+        catch (RowArrayCursorUnsupported const& e)
+        {
+            ctx.progress.Update({ .state = Progress::State::Warning,
+                                  .tableName = table.name,
+                                  .currentRows = chunk.state->processedRows.load(),
+                                  .totalRows = totalRows,
+                                  .message = std::format("Table not bulk-fetchable ({}); using single-row path", e.what()) });
+        }
+    }
+
+    auto cursor = stmt.ExecuteDirect(selectQuery);
+    while (cursor.FetchRow())
+    {
+        DecodeRowSingle(cursor, table, conn.ServerType(), table.name, row);
+        appendRow();
+    }
+    emitBatch();
+}
+
+void CopyReader(ThreadSafeQueue<Chunk>& chunkQueue, CopyContext ctx, SqlConnection& conn)
+{
+    static std::atomic<int> readerCounter { 0 };
+    auto const readerName = std::format("CopyReader-{}", readerCounter.fetch_add(1));
+    TracySetThreadName(readerName.c_str());
+
+    Chunk chunk;
+    while (chunkQueue.WaitAndPop(chunk))
+    {
+        auto const& tableName = chunk.table->name;
+        try
+        {
+            // Chunks are not retried: rows of a partially read window may already be committed on
+            // the target, and re-reading the window would duplicate them.
+            ReadChunkForCopy(ctx, conn, chunk);
+        }
+        catch (std::exception const& e)
+        {
+            ctx.tableStates.at(tableName).failed.store(true);
+            ctx.progress.Update({ .state = Progress::State::Error,
+                                  .tableName = tableName,
+                                  .currentRows = 0,
+                                  .totalRows = 0,
+                                  .message = "Read failed: "s + e.what() });
+        }
+
+        // The reader that completes the table's last chunk marks it read; the table is reported
+        // once the writers have drained its queued batches as well.
+        if (chunk.state->remainingChunks.fetch_sub(1) == 1)
+        {
+            ctx.tableStates.at(tableName).readDone.store(true);
+            TryReportTableCopied(ctx, tableName);
+        }
+    }
+}
+
+void CopyWriter(CopyContext ctx, SqlConnection& conn)
+{
+    static std::atomic<int> writerCounter { 0 };
+    auto const writerName = std::format("CopyWriter-{}", writerCounter.fetch_add(1));
+    TracySetThreadName(writerName.c_str());
+
+    try
+    {
+        ApplyCopyTargetSessionSettings(conn);
+
+        CopyInsertCache inserts;
+        CopyBatch item;
+        while (ctx.batchQueue.WaitAndPop(item))
+        {
+            auto& state = ctx.tableStates.at(item.tableName);
+            if (WriteCopyBatch(ctx, conn, item, inserts))
+            {
+                auto const written = state.writtenRows.fetch_add(item.batch.rowCount) + item.batch.rowCount;
+                ctx.progress.Update({ .state = Progress::State::InProgress,
+                                      .tableName = item.tableName,
+                                      .currentRows = written,
+                                      .totalRows = ctx.tableMap.at(item.tableName).rowCount,
+                                      .message = "Copying rows"s });
+                ctx.progress.OnItemsProcessed(item.batch.rowCount);
+            }
+            else
+                state.failed.store(true);
+
+            state.pendingBatches.fetch_sub(1);
+            TryReportTableCopied(ctx, item.tableName);
+        }
+    }
+    catch (std::exception const& e)
+    {
+        ctx.progress.Update({ .state = Progress::State::Error,
+                              .tableName = "",
+                              .currentRows = 0,
+                              .totalRows = std::nullopt,
+                              .message = "Writer failed: "s + e.what() });
+    }
+}
+
+} // namespace Lightweight::SqlBackup::detail
+
+namespace Lightweight::SqlBackup
+{
+
+// NOLINTNEXTLINE(readability-function-cognitive-complexity)
+void Copy(SqlConnectionString const& sourceConnectionString,
+          SqlConnectionString const& targetConnectionString,
+          ProgressManager& progress,
+          std::string const& sourceSchema,
+          std::string const& targetSchema,
+          std::string const& tableFilter,
+          RetrySettings const& retrySettings,
+          CopySettings const& copySettings)
+{
+    ZoneScopedN("SqlBackup::Copy");
+
+    auto const readerJobs = std::max(1U, copySettings.readerJobs);
+    auto const writerJobs = std::max(1U, copySettings.writerJobs);
+
+    try
+    {
+        SqlConnection sourceConn { std::nullopt };
+        if (!sourceConn.Connect(sourceConnectionString))
+            throw std::runtime_error(
+                std::format("Failed to connect to source database: {}", sourceConn.LastError().message));
+
+        auto const filter = TableFilter::Parse(tableFilter);
+        SqlSchema::TableFilterPredicate tableFilterPredicate;
+        if (!filter.MatchesAll())
+        {
+            tableFilterPredicate = [&filter, &sourceSchema](std::string_view /*schemaName*/, std::string_view tableName) {
+                return filter.Matches(sourceSchema, tableName);
+            };
+        }
+
+        SqlSchema::TableList tables;
+        {
+            ZoneScopedN("Copy::Phase::SchemaScan");
+            auto stmt = SqlStatement { sourceConn };
+            tables = SqlSchema::ReadAllTables(
+                stmt,
+                sourceConn.DatabaseName(),
+                sourceSchema,
+                [&progress](std::string_view tableName, size_t const current, size_t const total) {
+                    progress.Update({ .state = Progress::State::InProgress,
+                                      .tableName = "Scanning schema",
+                                      .currentRows = current,
+                                      .totalRows = total,
+                                      .message = std::format("Scanning table {}", tableName) });
+                },
+                {},
+                tableFilterPredicate);
+        }
+        progress.Update({ .state = Progress::State::Finished,
+                          .tableName = "Scanning schema",
+                          .currentRows = tables.size(),
+                          .totalRows = tables.size(),
+                          .message = "" });
+
+        // Route the source schema through the backup metadata so the target DDL (and the column
+        // bindings of the insert path) are exactly what a backup/restore round trip would produce.
+        auto tableMap = ParseSchema(CreateMetadata(sourceConnectionString, tables, sourceSchema), &progress);
+
+        auto const createdTables =
+            detail::RecreateDatabaseSchema(targetConnectionString, targetSchema, tableMap, progress);
+        if (createdTables.size() < tableMap.size())
+        {
+            progress.Update({ .state = Progress::State::Warning,
+                              .tableName = "",
+                              .currentRows = 0,
+                              .totalRows = std::nullopt,
+                              .message = std::format("Schema creation: {} of {} tables created, {} failed",
+                                                     createdTables.size(),
+                                                     tableMap.size(),
+                                                     tableMap.size() - createdTables.size()) });
+        }
+        std::erase_if(tableMap, [&](auto const& pair) { return !createdTables.contains(pair.first); });
+        std::erase_if(tables, [&](auto const& table) { return !createdTables.contains(table.name); });
+
+        if (!copySettings.schemaOnly)
+        {
+            ZoneScopedN("Copy::Phase::Data");
+
+            progress.SetMaxTableNameLength(std::ranges::fold_left(
+                tables | std::views::transform([](auto const& t) { return t.name.size(); }),
+                size_t { 0 },
+                [](size_t a, size_t b) { return std::max(a, b); }));
+            progress.SetTotalTables(tables.size());
+            progress.SetTotalItems(std::ranges::fold_left(
+                tableMap | std::views::values | std::views::transform(&TableInfo::rowCount), size_t { 0 }, std::plus {}));
+
+            std::map<std::string, detail::TableCopyState> tableStates;
+            for (auto const& name: tableMap | std::views::keys)
+                tableStates.try_emplace(name);
+
+            auto planStmt = SqlStatement { sourceConn };
+            auto const plan = detail::PlanChunks(
+                tables,
+                copySettings.rowsPerChunk,
+                [&planStmt](SqlSchema::Table const& table, std::string const& pkColumn) {
+                    return detail::QueryPkBounds(planStmt, table, pkColumn);
+                },
+                sourceConn.ServerType());
+
+            for (auto const* emptyTable: plan.emptyTables)
+            {
+                tableStates.at(emptyTable->name).reported.store(true);
+                progress.Update({ .state = Progress::State::Finished,
+                                  .tableName = emptyTable->name,
+                                  .currentRows = 0,
+                                  .totalRows = size_t { 0 },
+                                  .message = "Copy complete" });
+            }
+
+            ThreadSafeQueue<detail::Chunk> chunkQueue;
+            for (auto const& chunk: plan.chunks)
+                chunkQueue.Push(chunk);
+            chunkQueue.MarkFinished();
+
+            ThreadSafeQueue<detail::CopyBatch> batchQueue { std::max<size_t>(1, copySettings.queueCapacity) };
+            std::atomic<unsigned> activeWriters { writerJobs };
+
+            detail::CopyContext ctx {
+                .sourceConnectionString = sourceConnectionString,
+                .targetConnectionString = targetConnectionString,
+                .targetSchema = targetSchema,
+                .tableMap = tableMap,
+                .tableStates = tableStates,
+                .batchQueue = batchQueue,
+                .activeWriters = activeWriters,
+                .progress = progress,
+                .retrySettings = retrySettings,
+                .copySettings = copySettings,
+            };
+
+            // Both pools connect sequentially up front, avoiding concurrent-connect driver races.
+            detail::ConnectionPool readerPool { sourceConnectionString, readerJobs, retrySettings, progress };
+            detail::ConnectionPool writerPool { targetConnectionString, writerJobs, retrySettings, progress };
+
+            std::vector<std::thread> writers;
+            writers.reserve(writerJobs);
+            for ([[maybe_unused]] auto const _: std::views::iota(0U, writerJobs))
+                writers.emplace_back([ctx, &writerPool] {
+                    // The last writer to leave shuts the queue so readers blocked on a full queue do
+                    // not wait for a consumer that will never come, also if it never got a connection.
+                    auto const leave = detail::Finally([&ctx] {
+                        if (ctx.activeWriters.fetch_sub(1) == 1)
+                            ctx.batchQueue.MarkFinished();
+                    });
+                    try
+                    {
+                        auto lease = writerPool.Acquire();
+                        detail::CopyWriter(ctx, lease.Get());
+                    }
+                    catch (std::exception const& e)
+                    {
+                        ctx.progress.Update({ .state = Progress::State::Error,
+                                              .tableName = "",
+                                              .currentRows = 0,
+                                              .totalRows = std::nullopt,
+                                              .message = "Writer failed: "s + e.what() });
+                    }
+                });
+
+            std::vector<std::thread> readers;
+            readers.reserve(readerJobs);
+            for ([[maybe_unused]] auto const _: std::views::iota(0U, readerJobs))
+                readers.emplace_back([&chunkQueue, ctx, &readerPool] {
+                    try
+                    {
+                        auto lease = readerPool.Acquire();
+                        detail::CopyReader(chunkQueue, ctx, lease.Get());
+                    }
+                    catch (std::exception const& e)
+                    {
+                        ctx.progress.Update({ .state = Progress::State::Error,
+                                              .tableName = "",
+                                              .currentRows = 0,
+                                              .totalRows = std::nullopt,
+                                              .message = "Reader failed: "s + e.what() });
+                    }
+                });
+
+            for (auto& t: readers)
+                t.join();
+            batchQueue.MarkFinished(); // writers drain what is left, then exit
+            for (auto& t: writers)
+                t.join();
+        }
+
+        // Constraints and indexes go on after the load so the inserts neither pay for index
+        // maintenance nor depend on parent-before-child ordering.
+        detail::ApplyDatabaseConstraints(targetConnectionString, targetSchema, tableMap, progress);
+        detail::RestoreIndexes(targetConnectionString, targetSchema, tableMap, progress);
+
+        progress.Update({ .state = Progress::State::Finished,
+                          .tableName = "",
+                          .currentRows = 0,
+                          .totalRows = std::nullopt,
+                          .message = copySettings.schemaOnly ? "Schema-only copy complete" : "Copy complete" });
+        progress.AllDone();
+    }
+    catch (std::exception const& e)
+    {
+        progress.Update({ .state = Progress::State::Error,
+                          .tableName = "Unknown",
+                          .currentRows = 0,
+                          .totalRows = 0,
+                          .message = "Copy failed: "s + e.what() });
+    }
+}
+
+} // namespace Lightweight::SqlBackup
@@ -0,0 +1,91 @@
+// SPDX-License-Identifier: Apache-2.0
+
+#pragma once
+
+#include "../SqlConnection.hpp"
+#include "../ThreadSafeQueue.hpp"
+#include "ChunkPlanner.hpp"
+#include "SqlBackup.hpp"
+#include "SqlBackupFormats.hpp"
+
+#include <atomic>
+#include <cstddef>
+#include <map>
+#include <string>
+
+namespace Lightweight::SqlBackup::detail
+{
+
+/// A decoded batch of rows of one table, handed from a copy reader to a copy writer.
+struct CopyBatch
+{
+    /// The table the rows were read from (and are written into).
+    std::string tableName;
+    /// The decoded rows in column-oriented form, ready for BatchManager::PushBatch.
+    ColumnBatch batch;
+};
+
+/// Per-table copy state shared between the readers and the writers.
+///
+/// A table is complete once every chunk of it has been read (@c readDone) and every batch a reader
+/// queued for it has been written (@c pendingBatches == 0). Whichever side observes that last
+/// reports the table as finished; @c reported makes sure only one of them does.
+struct TableCopyState
+{
+    /// Batches queued by readers but not yet written.
+    std::atomic<size_t> pendingBatches { 0 };
+    /// Rows committed to the target database.
+    std::atomic<size_t> writtenRows { 0 };
+    /// Set once the last chunk of the table has been read.
+    std::atomic<bool> readDone { false };
+    /// Set when reading or writing any part of the table failed.
+    std::atomic<bool> failed { false };
+    /// Set by whoever reports the table's final state.
+    std::atomic<bool> reported { false };
+};
+
+/// Context for copy operations, shared between copy readers and writers.
+struct CopyContext
+{
+    SqlConnectionString const& sourceConnectionString;
+    SqlConnectionString const& targetConnectionString;
+    std::string const& targetSchema;
+    std::map<std::string, TableInfo> const& tableMap;
+    std::map<std::string, TableCopyState>& tableStates;
+    ThreadSafeQueue<CopyBatch>& batchQueue;
+    std::atomic<unsigned>& activeWriters; // writer threads still running; the last one finishes batchQueue
+    ProgressManager& progress;
+    RetrySettings const& retrySettings;
+    CopySettings const& copySettings;
+};
+
+/// Reports @p tableName as finished (or failed) once it has been read completely and all of its
+/// queued batches have been written. Safe to call from readers and writers concurrently.
+///
+/// @param ctx The copy context.
+/// @param tableName The table to check.
+void TryReportTableCopied(CopyContext& ctx, std::string const& tableName);
+
+/// Reads one chunk (a bounded row-range of a table) from the source database and queues its rows
+/// as batches of CopySettings::rowsPerBatch rows. Blocks while the batch queue is full.
+///
+/// @param ctx The copy context.
+/// @param conn The source connection of this reader.
+/// @param chunk The chunk to read.
+void ReadChunkForCopy(CopyContext& ctx, SqlConnection& conn, Chunk const& chunk);
+
+/// Copy reader: pops chunks from the queue and reads them on its borrowed source connection.
+///
+/// @param chunkQueue The queue of planned source chunks.
+/// @param ctx The copy context.
+/// @param conn The source connection of this reader.
+void CopyReader(ThreadSafeQueue<Chunk>& chunkQueue, CopyContext ctx, SqlConnection& conn);
+
+/// Copy writer: pops batches from the batch queue and inserts them into the target database,
+/// one transaction per batch, retrying a batch after transient errors.
+///
+/// @param ctx The copy context.
+/// @param conn The target connection of this writer.
+void CopyWriter(CopyContext ctx, SqlConnection& conn);
+
+} // namespace Lightweight::SqlBackup::detail
@@ -0,0 +1,109 @@
+// SPDX-License-Identifier: Apache-2.0
+#include "Common.hpp"
+#include "Incremental.hpp"
+
+#include <algorithm>
+#include <format>
+#include <ranges>
+#include <stdexcept>
+
+#if defined(__clang__)
+    #pragma clang diagnostic push
+    #pragma clang diagnostic ignored "-Wnullability-extension"
+#endif
+#include <zip.h>
+#if defined(__clang__)
+    #pragma clang diagnostic pop
+#endif
+
+#include <nlohmann/json.hpp>
+
+namespace Lightweight::SqlBackup::detail
+{
+
+WindowFingerprint const* IncrementalBase::FindReusableWindow(SqlSchema::Table const& table,
+                                                             std::uint32_t window,
+                                                             std::int64_t lo,
+                                                             std::int64_t hi,
+                                                             std::string_view fingerprint) const
+{
+    // A changed column list changes the chunk layout even when the data is untouched.
+    auto const baseColumns = columns.find(table.name);
+    if (baseColumns == columns.end()
+        || !std::ranges::equal(baseColumns->second, table.columns, {}, {}, &SqlSchema::Column::name))
+        return nullptr;
+
+    auto const baseWindows = windows.find(table.name);
+    if (baseWindows == windows.end())
+        return nullptr;
+
+    auto const match = std::ranges::find_if(baseWindows->second, [&](WindowFingerprint const& candidate) {
+        return candidate.window == window && candidate.lo == lo && candidate.hi == hi
+               && candidate.fingerprint == fingerprint;
+    });
+    return match != baseWindows->second.end() ? &*match : nullptr;
+}
+
+IncrementalBase ParseIncrementalBase(std::string_view metadataJson, std::string_view checksumsJson)
+{
+    auto base = IncrementalBase {};
+    nlohmann::json const metadata = nlohmann::json::parse(metadataJson);
+    base.formatVersion = metadata.value("format_version", "");
+
+    for (auto const& table: metadata.value("schema", nlohmann::json::array()))
+    {
+        auto const name = table.value("name", "");
+        auto& columnNames = base.columns[name];
+        for (auto const& column: table.value("columns", nlohmann::json::array()))
+            columnNames.push_back(column.value("name", ""));
+
+        if (!table.contains("windows"))
+            continue;
+        if (table.contains("window_grid"))
+            base.grids[name] = { .pkMin = table["window_grid"].at("pk_min").get<std::int64_t>(),
+                                 .width = table["window_grid"].at("width").get<std::int64_t>() };
+        auto& windows = base.windows[name];
+        for (auto const& window: table["windows"])
+            windows.push_back({ .window = window.at("window").get<std::uint32_t>(),
+                                .lo = window.at("lo").get<std::int64_t>(),
+                                .hi = window.at("hi").get<std::int64_t>(),
+                                .fingerprint = window.at("fingerprint").get<std::string>(),
+                                .subChunks = window.at("sub_chunks").get<std::size_t>(),
+                                .rows = window.value("rows", std::size_t { 0 }) });
+    }
+
+    if (!checksumsJson.empty())
+    {
+        nlohmann::json const checksums = nlohmann::json::parse(checksumsJson);
+        base.checksumAlgorithm = checksums.value("algorithm", base.checksumAlgorithm);
+        for (auto const& [name, hash]: checksums.value("files", nlohmann::json::object()).items())
+            base.checksums[name] = hash.get<std::string>();
+    }
+
+    return base;
+}
+
+IncrementalBase LoadIncrementalBase(std::filesystem::path const& path)
+{
+    int err = 0;
+    zip_t* zip = zip_open(path.string().c_str(), ZIP_RDONLY, &err);
+    if (!zip)
+        throw std::runtime_error(std::format("Failed to open incremental base archive: {}", path.string()));
+
+    auto const readEntry = [zip](char const* name) -> std::string {
+        zip_int64_t const index = zip_name_locate(zip, name, 0);
+        zip_stat_t stat;
+        if (index < 0 || zip_stat_index(zip, static_cast<zip_uint64_t>(index), 0, &stat) < 0)
+            return {};
+        return ReadZipEntry<std::string>(zip, index, stat.size);
+    };
+    auto const metadataJson = readEntry("metadata.json");
+    auto const checksumsJson = readEntry("checksums.json");
+    zip_close(zip);
+
+    if (metadataJson.empty())
+        throw std::runtime_error(std::format("Incremental base archive has no metadata.json: {}", path.string()));
+    return ParseIncrementalBase(metadataJson, checksumsJson);
+}
+
+} // namespace Lightweight::SqlBackup::detail
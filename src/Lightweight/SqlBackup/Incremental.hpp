@@ -0,0 +1,92 @@
+// SPDX-License-Identifier: Apache-2.0
+#pragma once
+
+#include "../Api.hpp"
+#include "../SqlSchema.hpp"
+#include "SqlBackup.hpp"
+
+#include <cstdint>
+#include <filesystem>
+#include <map>
+#include <mutex>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace Lightweight::SqlBackup::detail
+{
+
+/// The parts of an incremental backup's base archive that decide which windows can be reused:
+/// the window fingerprints and column lists from its metadata.json and the entry checksums from
+/// its checksums.json. The chunk entries themselves stay in the archive until the finalize merge
+/// raw-copies the reused ones.
+struct IncrementalBase
+{
+    /// The base archive's format_version.
+    std::string formatVersion;
+
+    /// Recorded window fingerprints per table.
+    WindowFingerprints windows;
+
+    /// The grids the recorded windows were cut from, for planning this backup's windows on them.
+    WindowGrids grids;
+
+    /// Column names per table, in metadata order.
+    std::map<std::string, std::vector<std::string>> columns;
+
+    /// The algorithm of #checksums, as named in the base archive's checksums.json.
+    std::string checksumAlgorithm = "sha256";
+
+    /// Checksum of every chunk entry (uncompressed bytes), keyed by entry name.
+    std::map<std::string, std::string> checksums;
+
+    /// Finds the base window that can stand in for window @p window of @p table.
+    ///
+    /// A window is reusable only if the table still has the same columns in the same order, the
+    /// window has the same index and bounds, and the server-side fingerprint is unchanged.
+    ///
+    /// @param table The table as scanned by the current backup.
+    /// @param window The plan-time window index.
+    /// @param lo Inclusive lower primary-key bound of the window.
+    /// @param hi Inclusive upper primary-key bound of the window.
+    /// @param fingerprint The fingerprint just computed for the window.
+    /// @return The base window, or nullptr if the window must be re-read.
+    [[nodiscard]] LIGHTWEIGHT_API WindowFingerprint const* FindReusableWindow(SqlSchema::Table const& table,
+                                                                              std::uint32_t window,
+                                                                              std::int64_t lo,
+                                                                              std::int64_t hi,
+                                                                              std::string_view fingerprint) const;
+};
+
+/// Parses the metadata.json and checksums.json contents of an incremental backup's base archive.
+///
+/// @param metadataJson Content of the base archive's metadata.json.
+/// @param checksumsJson Content of the base archive's checksums.json (may be empty).
+/// @return The parsed base; tables without recorded windows have no entry in IncrementalBase::windows.
+[[nodiscard]] LIGHTWEIGHT_API IncrementalBase ParseIncrementalBase(std::string_view metadataJson,
+                                                                   std::string_view checksumsJson);
+
+/// Reads the base archive of an incremental backup.
+///
+/// @param path The base archive.
+/// @return The parsed base.
+/// @throws std::runtime_error if the archive cannot be opened or has no metadata.json.
+[[nodiscard]] LIGHTWEIGHT_API IncrementalBase LoadIncrementalBase(std::filesystem::path const& path);
+
+/// Window fingerprints and reused base entries collected by the backup workers.
+struct IncrementalLog
+{
+    /// Guards the members below.
+    std::mutex mutex;
+
+    /// Fingerprints of every window of this backup (fetched or reused), recorded in metadata.json.
+    WindowFingerprints windows;
+
+    /// The grids this backup's windows were cut from, recorded with them.
+    WindowGrids grids;
+
+    /// Entry names the finalize merge copies from the base archive.
+    std::vector<std::string> reusedEntries;
+};
+
+} // namespace Lightweight::SqlBackup::detail
@@ -1,14 +1,19 @@
 // SPDX-License-Identifier: Apache-2.0
 #include "MsgPackChunkFormats.hpp"
 
+#include <algorithm>
 #include <bit>
 #include <cstdio>
 #include <cstring>
 #include <format>
 #include <iostream>
+#include <iterator>
 #include <optional>
+#include <ranges>
 #include <span>
 #include <sstream>
+#include <stdexcept>
+#include <unordered_map>
 
 #if defined(__GNUC__) || defined(__clang__)
     #pragma GCC diagnostic push
@@ -135,6 +140,382 @@ namespace
             val);
     }
 
+    // The value of row @p row of @p block, as AppendRow() would have received it.
+    BackupValue BlockValueAt(BackupColumnBlock const& block, size_t row)
+    {
+        if (block.nulls[row] != 0)
+            return std::monostate {};
+        switch (block.type)
+        {
+            case BackupColumnBlock::Type::Int64:
+                return block.int64Values[row];
+            case BackupColumnBlock::Type::Bool:
+                return block.int64Values[row] != 0;
+            case BackupColumnBlock::Type::Double:
+                return block.doubleValues[row];
+            case BackupColumnBlock::Type::Text:
+                return std::string { block.textValues[row] };
+        }
+        return std::monostate {}; // LCOV_EXCL_LINE - all enumerators handled above
+    }
+
+    // Appends a block of @p values to a column of element type T, the way AppendToColumn would
+    // append them one by one: an untyped column stays untyped while only NULLs arrive, and NULL
+    // rows hold a default-constructed element. Returns false if the column holds another type.
+    template <typename T, typename Values, typename Convert>
+    bool AppendTypedBlock(ColumnBatch::ColumnData& colData,
+                          std::vector<bool>& nulls,
+                          BackupColumnBlock const& block,
+                          Values values,
+                          size_t rowCount,
+                          [[maybe_unused]] Convert const& convert)
+    {
+        using VecT = std::vector<T>;
+        auto const blockNulls = block.nulls.first(rowCount);
+
+        if (std::holds_alternative<std::monostate>(colData))
+        {
+            if (std::ranges::all_of(blockNulls, [](uint8_t isNull) { return isNull != 0; }))
+            {
+                nulls.insert(nulls.end(), rowCount, true);
+                return true;
+            }
+            colData = VecT(nulls.size()); // the NULL rows appended so far
+        }
+
+        auto* vec = std::get_if<VecT>(&colData);
+        if (!vec)
+            return false;
+
+        auto const offset = vec->size();
+        vec->reserve(offset + rowCount);
+        if constexpr (std::is_same_v<T, int64_t> || std::is_same_v<T, double>)
+            vec->insert(vec->end(), values.begin(), values.begin() + static_cast<std::ptrdiff_t>(rowCount));
+        else
+            for (auto const row: std::views::iota(0UZ, rowCount))
+                vec->push_back(blockNulls[row] != 0 ? T {} : convert(values[row]));
+
+        for (auto const row: std::views::iota(0UZ, rowCount))
+        {
+            auto const isNull = blockNulls[row] != 0;
+            nulls.push_back(isNull);
+            if constexpr (std::is_same_v<T, int64_t> || std::is_same_v<T, double>)
+                if (isNull)
+                    (*vec)[offset + row] = T {};
+        }
+        return true;
+    }
+
+    // Appends one column block, see ColumnBatch::AppendColumns.
+    void AppendBlockToColumn(ColumnBatch::ColumnData& colData,
+                             std::vector<bool>& nulls,
+                             BackupColumnBlock const& block,
+                             size_t rowCount)
+    {
+        auto const identity = [](auto const& value) { return value; };
+        bool appended = false;
+        switch (block.type)
+        {
+            case BackupColumnBlock::Type::Int64:
+                appended = AppendTypedBlock<int64_t>(colData, nulls, block, block.int64Values, rowCount, identity);
+                break;
+            case BackupColumnBlock::Type::Bool:
+                appended = AppendTypedBlock<bool>(
+                    colData, nulls, block, block.int64Values, rowCount, [](int64_t value) { return value != 0; });
+                break;
+            case BackupColumnBlock::Type::Double:
+                appended = AppendTypedBlock<double>(colData, nulls, block, block.doubleValues, rowCount, identity);
+                break;
+            case BackupColumnBlock::Type::Text:
+                appended = AppendTypedBlock<std::string>(
+                    colData, nulls, block, block.textValues, rowCount, [](std::string_view value) {
+                        return std::string { value };
+                    });
+                break;
+        }
+
+        // The column holds another type: promote it exactly as per-row appends would.
+        if (!appended)
+            for (auto const row: std::views::iota(0UZ, rowCount))
+                AppendToColumn(colData, nulls, BlockValueAt(block, row));
+    }
+
+    // The bytes a value adds to a chunk, as estimated for IsChunkFull().
+    size_t EstimatedValueBytes(BackupValue const& value)
+    {
+        return std::visit(
+            [](auto const& arg) -> size_t {
+                using T = std::decay_t<decltype(arg)>;
+                if constexpr (std::is_same_v<T, std::string> || std::is_same_v<T, std::vector<uint8_t>>)
+                    return arg.size() + 5;
+                else if constexpr (std::is_same_v<T, std::monostate>)
+                    return 1;
+                else
+                    return 9; // 8 bytes + type
+            },
+            value);
+    }
+
+    // The bytes a column block adds to a chunk, matching the per-row estimate of its values.
+    size_t EstimatedBlockBytes(BackupColumnBlock const& block, size_t rowCount)
+    {
+        size_t bytes = 0;
+        for (auto const row: std::views::iota(0UZ, rowCount))
+        {
+            if (block.nulls[row] != 0)
+                bytes += 1;
+            else if (block.type == BackupColumnBlock::Type::Text)
+                bytes += block.textValues[row].size() + 5;
+            else
+                bytes += 9;
+        }
+        return bytes;
+    }
+
+    // --- Compact column encodings (format 1.1) ---
+
+    // A str column is dictionary-encoded only below this many distinct values (and at most one
+    // distinct value per two rows).
+    constexpr size_t DictionaryMaxEntries = 65536;
+
+    // Upper bound on the rows an encoded column may expand to; guards run-length decoding against
+    // corrupt input. Writers emit at most 100'000 rows per chunk.
+    constexpr uint64_t MaxEncodedColumnRows = uint64_t { 1 } << 28;
+
+    // Maps signed to unsigned so that small magnitudes of either sign get short varints.
+    constexpr uint64_t ZigZagEncode(int64_t value) noexcept
+    {
+        return (static_cast<uint64_t>(value) << 1) ^ static_cast<uint64_t>(value >> 63);
+    }
+
+    constexpr int64_t ZigZagDecode(uint64_t value) noexcept
+    {
+        return static_cast<int64_t>(value >> 1) ^ -static_cast<int64_t>(value & 1);
+    }
+
+    // The difference of two values with two's complement wrap-around, so every delta is representable.
+    constexpr int64_t WrappingDelta(int64_t value, int64_t previous) noexcept
+    {
+        return static_cast<int64_t>(static_cast<uint64_t>(value) - static_cast<uint64_t>(previous));
+    }
+
+    constexpr size_t VarintSize(uint64_t value) noexcept
+    {
+        // One byte per started group of 7 bits; 0 still takes a byte.
+        return (std::max<size_t>(std::bit_width(value), 1) + 6) / 7;
+    }
+
+    // Appends @p value as an unsigned LEB128 varint.
+    void AppendVarint(std::vector<uint8_t>& out, uint64_t value)
+    {
+        while (value >= 0x80)
+        {
+            out.push_back(static_cast<uint8_t>(value | 0x80));
+            value >>= 7;
+        }
+        out.push_back(static_cast<uint8_t>(value));
+    }
+
+    // Reads the LEB128 varints of an encoded column payload; iterating it yields the varints up to the
+    // end of the payload.
+    class VarintReader
+    {
+      public:
+        class Iterator
+        {
+          public:
+            using value_type = uint64_t;
+            using difference_type = std::ptrdiff_t;
+
+            explicit Iterator(VarintReader& reader):
+                reader_(&reader)
+            {
+                Advance();
+            }
+
+            uint64_t operator*() const noexcept
+            {
+                return value_;
+            }
+
+            Iterator& operator++()
+            {
+                Advance();
+                return *this;
+            }
+
+            void operator++(int)
+            {
+                Advance();
+            }
+
+            bool operator==(std::default_sentinel_t /*end*/) const noexcept
+            {
+                return done_;
+            }
+
+          private:
+            void Advance()
+            {
+                done_ = reader_->AtEnd();
+                if (!done_)
+                    value_ = reader_->Next();
+            }
+
+            VarintReader* reader_;
+            uint64_t value_ = 0;
+            bool done_ = false;
+        };
+
+        explicit VarintReader(std::span<uint8_t const> bytes):
+            bytes_(bytes)
+        {
+        }
+
+        [[nodiscard]] Iterator begin()
+        {
+            return Iterator { *this };
+        }
+
+        [[nodiscard]] static std::default_sentinel_t end() noexcept
+        {
+            return std::default_sentinel;
+        }
+
+        [[nodiscard]] bool AtEnd() const noexcept
+        {
+            return pos_ >= bytes_.size();
+        }
+
+        uint64_t Next()
+        {
+            uint64_t value = 0;
+            // A 64-bit value spans at most 10 groups of 7 bits.
+            for (auto const group: std::views::iota(0U, 10U))
+            {
+                if (pos_ >= bytes_.size())
+                    throw std::out_of_range("MsgPackReader: Truncated varint in encoded column");
+                auto const byte = bytes_[pos_++];
+                value |= static_cast<uint64_t>(byte & 0x7F) << (7 * group);
+                if ((byte & 0x80) == 0)
+                    return value;
+            }
+            throw std::runtime_error("MsgPackReader: Malformed varint in encoded column");
+        }
+
+      private:
+        std::span<uint8_t const> bytes_;
+        size_t pos_ = 0;
+    };
+
+    // Calls @p visit with the value stored for each slot of an i64 column. NULL slots repeat the
+    // previous value so they neither add a delta nor break a run; readers ignore them anyway.
+    template <typename Visit>
+    void ForEachSlotValue(std::vector<int64_t> const& values, std::vector<bool> const& nulls, Visit&& visit)
+    {
+        int64_t previous = 0;
+        for (auto const i: std::views::iota(0UZ, values.size()))
+        {
+            if (!nulls[i])
+                previous = values[i];
+            visit(previous);
+        }
+    }
+
+    // Calls @p visit with the zigzag-encoded delta of each slot of an i64 column to the slot before.
+    template <typename Visit>
+    void ForEachDelta(std::vector<int64_t> const& values, std::vector<bool> const& nulls, Visit&& visit)
+    {
+        int64_t previous = 0;
+        ForEachSlotValue(values, nulls, [&](int64_t value) {
+            visit(ZigZagEncode(WrappingDelta(value, previous)));
+            previous = value;
+        });
+    }
+
+    // Calls @p visit with the value and length of each run of equal slots of an i64 column.
+    template <typename Visit>
+    void ForEachRun(std::vector<int64_t> const& values, std::vector<bool> const& nulls, Visit&& visit)
+    {
+        int64_t runValue = 0;
+        uint64_t runLength = 0;
+        ForEachSlotValue(values, nulls, [&](int64_t value) {
+            if (runLength > 0 && value == runValue)
+            {
+                ++runLength;
+                return;
+            }
+            if (runLength > 0)
+                visit(runValue, runLength);
+            runValue = value;
+            runLength = 1;
+        });
+        if (runLength > 0)
+            visit(runValue, runLength);
+    }
+
+    // Calls @p visit with the length of each run of a bool column; runs alternate between false and
+    // true, starting with false (so the first run is empty if the column starts with true).
+    template <typename Visit>
+    void ForEachBoolRun(std::vector<bool> const& values, Visit&& visit)
+    {
+        bool current = false;
+        uint64_t runLength = 0;
+        for (bool const value: values)
+        {
+            if (value == current)
+            {
+                ++runLength;
+                continue;
+            }
+            visit(runLength);
+            current = value;
+            runLength = 1;
+        }
+        if (runLength > 0)
+            visit(runLength);
+    }
+
+    // The distinct values of a str column in first-seen order, and the entry index of each slot.
+    struct StringDictionary
+    {
+        std::vector<std::string_view> entries;
+        std::vector<uint32_t> indices;
+    };
+
+    // Builds the dictionary of @p values, or returns an empty one if they have too many distinct values.
+    StringDictionary BuildStringDictionary(std::vector<std::string> const& values)
+    {
+        auto const maxEntries = std::min(DictionaryMaxEntries, values.size() / 2);
+        auto index = std::unordered_map<std::string_view, uint32_t> {};
+        auto dictionary = StringDictionary {};
+        dictionary.indices.reserve(values.size());
+        for (auto const& value: values)
+        {
+            auto const [it, inserted] = index.try_emplace(value, static_cast<uint32_t>(dictionary.entries.size()));
+            if (inserted)
+            {
+                if (dictionary.entries.size() == maxEntries)
+                    return {};
+                dictionary.entries.emplace_back(value);
+            }
+            dictionary.indices.push_back(it->second);
+        }
+        return dictionary;
+    }
+
+    // The bytes a MsgPack string of @p length takes, header included.
+    constexpr size_t MsgPackStringSize(size_t length) noexcept
+    {
+        if (length <= 31)
+            return 1 + length;
+        if (length <= 0xFF)
+            return 2 + length;
+        if (length <= 0xFFFF)
+            return 3 + length;
+        return 5 + length;
+    }
+
     // --- MsgPack Implementation ---
 
     // Constants (Mirrored from msgpack spec/header for self-sufficiency in reader)
@@ -175,39 +556,26 @@ namespace
     class MsgPackChunkWriter: public ChunkWriter
     {
       public:
-        explicit MsgPackChunkWriter(size_t limitBytes):
-            limitBytes_(limitBytes)
+        MsgPackChunkWriter(size_t limitBytes, bool compactEncodings):
+            limitBytes_(limitBytes),
+            compactEncodings_(compactEncodings)
         {
         }
 
         void WriteRow(std::span<BackupValue const> row) override
         {
-            if (batch_.columns.empty())
-            {
-                batch_.columns.resize(row.size());
-                batch_.nullIndicators.resize(row.size());
-            }
+            batch_.AppendRow(row);
 
-            for (size_t i = 0; i < row.size(); ++i)
-            {
-                AppendToColumn(batch_.columns[i], batch_.nullIndicators[i], row[i]);
+            for (auto const& value: row)
+                estimatedBytes_ += EstimatedValueBytes(value);
+        }
 
-                // Track estimated size
-                std::visit(
-                    [&](auto&& arg) {
-                        using T = std::decay_t<decltype(arg)>;
-                        if constexpr (std::is_same_v<T, std::string>)
-                            estimatedBytes_ += arg.size() + 5;
-                        else if constexpr (std::is_same_v<T, std::vector<uint8_t>>)
-                            estimatedBytes_ += arg.size() + 5;
-                        else if constexpr (std::is_same_v<T, std::monostate>)
-                            estimatedBytes_ += 1;
-                        else
-                            estimatedBytes_ += 9; // 8 bytes + type
-                    },
-                    row[i]);
-            }
-            batch_.rowCount++;
+        void WriteColumns(std::span<BackupColumnBlock const> blocks, size_t rowCount) override
+        {
+            batch_.AppendColumns(blocks, rowCount);
+
+            for (auto const& block: blocks)
+                estimatedBytes_ += EstimatedBlockBytes(block, rowCount);
         }
 
         // NOLINTNEXTLINE(readability-function-cognitive-complexity)
@@ -222,14 +590,15 @@ namespace
             for (size_t i = 0; i < numCols; ++i)
             {
                 // Write Column Map
-                // { "t": type, "d": data, "n": nulls }
+                // { "t": type, ["e": encoding,] "d": data, "n": nulls }
                 // For simplicity, we just use a simplified format for now:
                 // Map(3) or Map(2)
 
                 auto& col = batch_.columns[i];
                 auto& nulls = batch_.nullIndicators[i];
 
-                WriteMapHeader(3);
+                auto const encoding = ChooseEncoding(col, nulls);
+                WriteMapHeader(encoding.kind == EncodingKind::Plain ? 3 : 4);
 
                 // 1. Type
                 WriteString("t");
@@ -251,66 +620,19 @@ namespace
                     },
                     col);
 
+                // 1b. Encoding (format 1.1), ahead of the data it describes
+                if (encoding.kind != EncodingKind::Plain)
+                {
+                    WriteString("e");
+                    WriteString(EncodingName(encoding.kind));
+                }
+
                 // 2. Data
                 WriteString("d");
-                std::visit(
-                    [&](auto&& arg) {
-                        using T = std::decay_t<decltype(arg)>;
-                        if constexpr (std::is_same_v<T, std::monostate>)
-                        {
-                            WriteNil();
-                        }
-                        else if constexpr (std::is_same_v<T, std::vector<int64_t>>)
-                        {
-                            // Packed Binary of 64-bit integers
-                            WritePackedData(arg);
-                        }
-                        else if constexpr (std::is_same_v<T, std::vector<double>>)
-                        {
-                            WritePackedData(arg);
-                        }
-                        else if constexpr (std::is_same_v<T, std::vector<bool>>)
-                        {
-                            WriteBitPackedArray(arg);
-                        }
-                        else if constexpr (std::is_same_v<T, std::vector<std::string>>)
-                        {
-                            WriteArrayHeader(arg.size());
-                            for (auto const& s: arg)
-                                WriteString(s);
-                        }
-                        else if constexpr (std::is_same_v<T, std::vector<std::vector<uint8_t>>>)
-                        {
-                            WriteArrayHeader(arg.size());
-                            for (auto const& bin: arg)
-                            {
-                                size_t const len = bin.size();
-                                if (len <= 0xFF)
-                                {
-                                    WriteU8(Mp::Bin8);
-                                    WriteU8(static_cast<uint8_t>(len));
-                                }
-                                else if (len <= 0xFFFF)
-                                {
-                                    WriteU8(Mp::Bin16);
-                                    WriteBe(static_cast<uint16_t>(len));
-                                }
-                                else
-                                {
-                                    WriteU8(Mp::Bin32);
-                                    WriteBe(static_cast<uint32_t>(len));
-                                }
-                                buffer_.insert(buffer_.end(), bin.begin(), bin.end());
-                            }
-                        }
-                        else
-                        {
-                            // generic array
-                            WriteArrayHeader(arg.size());
-                            // ... implement if needed
-                        }
-                    },
-                    col);
+                if (encoding.kind != EncodingKind::Plain)
+                    WriteEncodedData(col, nulls, encoding);
+                else
+                    WritePlainData(col);
 
                 // 3. Nulls (Packed Bits)
                 WriteString("n");
@@ -336,10 +658,216 @@ namespace
 
       private:
         size_t limitBytes_;
+        bool compactEncodings_;
         std::vector<uint8_t> buffer_;
         ColumnBatch batch_;
         size_t estimatedBytes_ = 0;
 
+        // The compact encodings of format 1.1; Plain writes the data as format 1.0 does.
+        enum class EncodingKind : uint8_t
+        {
+            Plain,
+            Delta,      ///< i64: zigzag varints of each value's difference to the previous one
+            RunLength,  ///< i64: (zigzag varint value, varint count) pairs; bool: alternating run lengths
+            Dictionary, ///< str: the distinct strings, and a varint entry index per row
+        };
+
+        struct ColumnEncoding
+        {
+            EncodingKind kind = EncodingKind::Plain;
+            StringDictionary dictionary; ///< for Dictionary only
+        };
+
+        static std::string_view EncodingName(EncodingKind kind)
+        {
+            switch (kind)
+            {
+                case EncodingKind::Delta:
+                    return "delta";
+                case EncodingKind::RunLength:
+                    return "rle";
+                case EncodingKind::Dictionary:
+                    return "dict";
+                case EncodingKind::Plain:
+                    break;
+            }
+            return {}; // LCOV_EXCL_LINE - Plain columns carry no "e" key
+        }
+
+        // Picks the smallest encoding of a column, falling back to Plain if none beats it.
+        [[nodiscard]] ColumnEncoding ChooseEncoding(ColumnBatch::ColumnData const& col, std::vector<bool> const& nulls) const
+        {
+            if (!compactEncodings_)
+                return {};
+
+            if (auto const* ints = std::get_if<std::vector<int64_t>>(&col))
+            {
+                size_t deltaBytes = 0;
+                ForEachDelta(*ints, nulls, [&](uint64_t delta) { deltaBytes += VarintSize(delta); });
+                size_t runBytes = 0;
+                ForEachRun(*ints, nulls, [&](int64_t value, uint64_t length) {
+                    runBytes += VarintSize(ZigZagEncode(value)) + VarintSize(length);
+                });
+                auto const plainBytes = ints->size() * sizeof(int64_t);
+                if (runBytes <= deltaBytes && runBytes < plainBytes)
+                    return { .kind = EncodingKind::RunLength, .dictionary = {} };
+                if (deltaBytes < plainBytes)
+                    return { .kind = EncodingKind::Delta, .dictionary = {} };
+                return {};
+            }
+
+            if (auto const* bools = std::get_if<std::vector<bool>>(&col))
+            {
+                size_t runBytes = 0;
+                ForEachBoolRun(*bools, [&](uint64_t length) { runBytes += VarintSize(length); });
+                // The packed form also spends a few bytes on its element count.
+                if (runBytes < (bools->size() + 7) / 8)
+                    return { .kind = EncodingKind::RunLength, .dictionary = {} };
+                return {};
+            }
+
+            if (auto const* strings = std::get_if<std::vector<std::string>>(&col))
+            {
+                auto dictionary = BuildStringDictionary(*strings);
+                if (dictionary.entries.empty())
+                    return {};
+                size_t plainBytes = 0;
+                for (auto const& value: *strings)
+                    plainBytes += MsgPackStringSize(value.size());
+                size_t dictionaryBytes = 0;
+                for (auto const entry: dictionary.entries)
+                    dictionaryBytes += MsgPackStringSize(entry.size());
+                for (auto const index: dictionary.indices)
+                    dictionaryBytes += VarintSize(index);
+                if (dictionaryBytes < plainBytes)
+                    return { .kind = EncodingKind::Dictionary, .dictionary = std::move(dictionary) };
+                return {};
+            }
+
+            return {};
+        }
+
+        void WriteEncodedData(ColumnBatch::ColumnData const& col,
+                              std::vector<bool> const& nulls,
+                              ColumnEncoding const& encoding)
+        {
+            std::vector<uint8_t> payload;
+            switch (encoding.kind)
+            {
+                case EncodingKind::Delta:
+                    ForEachDelta(std::get<std::vector<int64_t>>(col), nulls, [&](uint64_t delta) {
+                        AppendVarint(payload, delta);
+                    });
+                    WriteBinary(payload);
+                    break;
+                case EncodingKind::RunLength:
+                    if (auto const* bools = std::get_if<std::vector<bool>>(&col))
+                        ForEachBoolRun(*bools, [&](uint64_t length) { AppendVarint(payload, length); });
+                    else
+                        ForEachRun(std::get<std::vector<int64_t>>(col), nulls, [&](int64_t value, uint64_t length) {
+                            AppendVarint(payload, ZigZagEncode(value));
+                            AppendVarint(payload, length);
+                        });
+                    WriteBinary(payload);
+                    break;
+                case EncodingKind::Dictionary:
+                    // [ [entry, ...], Bin(varint index per row) ]
+                    WriteArrayHeader(2);
+                    WriteArrayHeader(encoding.dictionary.entries.size());
+                    for (auto const entry: encoding.dictionary.entries)
+                        WriteString(entry);
+                    for (auto const index: encoding.dictionary.indices)
+                        AppendVarint(payload, index);
+                    WriteBinary(payload);
+                    break;
+                case EncodingKind::Plain:
+                    WritePlainData(col); // LCOV_EXCL_LINE - Flush() writes Plain columns directly
+                    break;
+            }
+        }
+
+        void WriteBinary(std::span<uint8_t const> bytes)
+        {
+            if (bytes.size() <= 0xFF)
+            {
+                WriteU8(Mp::Bin8);
+                WriteU8(static_cast<uint8_t>(bytes.size()));
+            }
+            else if (bytes.size() <= 0xFFFF)
+            {
+                WriteU8(Mp::Bin16);
+                WriteBe(static_cast<uint16_t>(bytes.size()));
+            }
+            else
+            {
+                WriteU8(Mp::Bin32);
+                WriteBe(static_cast<uint32_t>(bytes.size()));
+            }
+            buffer_.insert(buffer_.end(), bytes.begin(), bytes.end());
+        }
+
+        void WritePlainData(ColumnBatch::ColumnData const& col)
+        {
+            std::visit(
+                [&](auto const& arg) {
+                    using T = std::decay_t<decltype(arg)>;
+                    if constexpr (std::is_same_v<T, std::monostate>)
+                    {
+                        WriteNil();
+                    }
+                    else if constexpr (std::is_same_v<T, std::vector<int64_t>>)
+                    {
+                        // Packed Binary of 64-bit integers
+                        WritePackedData(arg);
+                    }
+                    else if constexpr (std::is_same_v<T, std::vector<double>>)
+                    {
+                        WritePackedData(arg);
+                    }
+                    else if constexpr (std::is_same_v<T, std::vector<bool>>)
+                    {
+                        WriteBitPackedArray(arg);
+                    }
+                    else if constexpr (std::is_same_v<T, std::vector<std::string>>)
+                    {
+                        WriteArrayHeader(arg.size());
+                        for (auto const& s: arg)
+                            WriteString(s);
+                    }
+                    else if constexpr (std::is_same_v<T, std::vector<std::vector<uint8_t>>>)
+                    {
+                        WriteArrayHeader(arg.size());
+                        for (auto const& bin: arg)
+                        {
+                            size_t const len = bin.size();
+                            if (len <= 0xFF)
+                            {
+                                WriteU8(Mp::Bin8);
+                                WriteU8(static_cast<uint8_t>(len));
+                            }
+                            else if (len <= 0xFFFF)
+                            {
+                                WriteU8(Mp::Bin16);
+                                WriteBe(static_cast<uint16_t>(len));
+                            }
+                            else
+                            {
+                                WriteU8(Mp::Bin32);
+                                WriteBe(static_cast<uint32_t>(len));
+                            }
+                            buffer_.insert(buffer_.end(), bin.begin(), bin.end());
+                        }
+                    }
+                    else
+                    {
+                        // generic array
+                        WriteArrayHeader(arg.size());
+                        // ... implement if needed
+                    }
+                },
+                col);
+        }
+
         // ... helper write functions ...
         void WriteNil()
         {
@@ -551,15 +1079,20 @@ namespace
                 ReadMapHeader(mapLen);
 
                 std::string typeStr;
+                std::string encoding; // format 1.1; written ahead of "d"
 
                 for (size_t k = 0; k < mapLen; ++k)
                 {
                     std::string key = ReadString();
                     if (key == "t")
                         typeStr = ReadString();
+                    else if (key == "e")
+                        encoding = ReadString();
                     else if (key == "d")
                     {
-                        if (typeStr == "i64")
+                        if (!encoding.empty())
+                            ReadEncodedData(typeStr, encoding, batch.columns[i]);
+                        else if (typeStr == "i64")
                             ReadPackedInt64(batch.columns[i]);
                         else if (typeStr == "f64")
                             ReadPackedDouble(batch.columns[i]);
@@ -808,6 +1341,13 @@ namespace
         }
 
         std::vector<uint8_t> ReadBinary()
+        {
+            auto const bytes = ReadBinaryView();
+            return { bytes.begin(), bytes.end() };
+        }
+
+        // Reads a binary value without copying it out of the input.
+        std::span<uint8_t const> ReadBinaryView()
         {
             if (cursor_ >= end_)
                 throw std::out_of_range("MsgPackReader: Unexpected EOF in ReadBinary");
@@ -835,11 +1375,94 @@ namespace
             if (cursor_ + len > end_)
                 throw std::out_of_range("EOF reading binary data");
 
-            std::vector<uint8_t> data(cursor_, cursor_ + len);
+            auto const data = std::span<uint8_t const>(cursor_, len);
             cursor_ += len;
             return data;
         }
 
+        void ReadEncodedData(std::string const& typeStr, std::string const& encoding, ColumnBatch::ColumnData& col)
+        {
+            if (typeStr == "i64" && encoding == "delta")
+                ReadDeltaInt64(col);
+            else if (typeStr == "i64" && encoding == "rle")
+                ReadRunLengthInt64(col);
+            else if (typeStr == "bool" && encoding == "rle")
+                ReadRunLengthBool(col);
+            else if (typeStr == "str" && encoding == "dict")
+                ReadDictionaryStrings(col);
+            else
+                throw std::runtime_error(
+                    std::format("MsgPackReader: Unsupported encoding '{}' for column type '{}'", encoding, typeStr));
+        }
+
+        void ReadDeltaInt64(ColumnBatch::ColumnData& col)
+        {
+            auto varints = VarintReader(ReadBinaryView());
+            std::vector<int64_t> vec;
+            int64_t previous = 0;
+            for (auto const delta: varints)
+            {
+                previous = static_cast<int64_t>(static_cast<uint64_t>(previous)
+                                                + static_cast<uint64_t>(ZigZagDecode(delta)));
+                vec.push_back(previous);
+            }
+            col = std::move(vec);
+        }
+
+        void ReadRunLengthInt64(ColumnBatch::ColumnData& col)
+        {
+            auto varints = VarintReader(ReadBinaryView());
+            std::vector<int64_t> vec;
+            for (auto const encodedValue: varints)
+            {
+                auto const value = ZigZagDecode(encodedValue);
+                auto const length = varints.Next(); // each value is followed by its run length
+                if (length > MaxEncodedColumnRows - vec.size())
+                    throw std::runtime_error("MsgPackReader: Run-length encoded column is too long");
+                vec.insert(vec.end(), length, value);
+            }
+            col = std::move(vec);
+        }
+
+        void ReadRunLengthBool(ColumnBatch::ColumnData& col)
+        {
+            auto varints = VarintReader(ReadBinaryView());
+            std::vector<bool> vec;
+            bool value = false;
+            for (auto const length: varints)
+            {
+                if (length > MaxEncodedColumnRows - vec.size())
+                    throw std::runtime_error("MsgPackReader: Run-length encoded column is too long");
+                vec.insert(vec.end(), length, value);
+                value = !value;
+            }
+            col = std::move(vec);
+        }
+
+        void ReadDictionaryStrings(ColumnBatch::ColumnData& col)
+        {
+            uint32_t len = 0;
+            if (!ReadArrayHeader(len) || len != 2)
+                throw std::runtime_error("MsgPackReader: Expected [entries, indices] for a dictionary column");
+
+            uint32_t entryCount = 0;
+            if (!ReadArrayHeader(entryCount))
+                throw std::runtime_error("MsgPackReader: Expected the entries of a dictionary column");
+            std::vector<std::string> entries;
+            entries.reserve(entryCount);
+            std::ranges::generate_n(std::back_inserter(entries), entryCount, [this] { return ReadString(); });
+
+            auto varints = VarintReader(ReadBinaryView());
+            std::vector<std::string> vec;
+            for (auto const index: varints)
+            {
+                if (index >= entries.size())
+                    throw std::runtime_error("MsgPackReader: Dictionary index out of range");
+                vec.push_back(entries[index]);
+            }
+            col = std::move(vec);
+        }
+
         void ReadBinaryArray(ColumnBatch::ColumnData& col)
         {
             uint32_t len = 0;
@@ -1099,9 +1722,35 @@ namespace
 
 } // namespace
 
-std::unique_ptr<ChunkWriter> CreateMsgPackChunkWriter(size_t limitBytes)
+void ColumnBatch::AppendRow(std::span<BackupValue const> row)
+{
+    if (columns.empty())
+    {
+        columns.resize(row.size());
+        nullIndicators.resize(row.size());
+    }
+
+    for (auto const i: std::views::iota(0UZ, row.size()))
+        AppendToColumn(columns[i], nullIndicators[i], row[i]);
+    rowCount++;
+}
+
+void ColumnBatch::AppendColumns(std::span<BackupColumnBlock const> blocks, size_t blockRows)
+{
+    if (columns.empty())
+    {
+        columns.resize(blocks.size());
+        nullIndicators.resize(blocks.size());
+    }
+
+    for (auto const i: std::views::iota(0UZ, blocks.size()))
+        AppendBlockToColumn(columns[i], nullIndicators[i], blocks[i], blockRows);
+    rowCount += blockRows;
+}
+
+std::unique_ptr<ChunkWriter> CreateMsgPackChunkWriter(size_t limitBytes, bool compactEncodings)
 {
-    return std::make_unique<MsgPackChunkWriter>(limitBytes);
+    return std::make_unique<MsgPackChunkWriter>(limitBytes, compactEncodings);
 }
 
 std::unique_ptr<ChunkReader> CreateMsgPackChunkReader(std::istream& input)
@@ -11,7 +11,12 @@ namespace Lightweight::SqlBackup
 {
 
 /// Factory for creating chunk writers.
-LIGHTWEIGHT_API std::unique_ptr<ChunkWriter> CreateMsgPackChunkWriter(size_t limitBytes = 10 * 1024 * 1024);
+///
+/// @param limitBytes The estimated chunk size at which IsChunkFull() reports true.
+/// @param compactEncodings Whether to delta-, run-length- or dictionary-encode columns where that is
+///                         smaller (backup format 1.1). Such chunks need a reader of format 1.1.
+LIGHTWEIGHT_API std::unique_ptr<ChunkWriter> CreateMsgPackChunkWriter(size_t limitBytes = 10 * 1024 * 1024,
+                                                                      bool compactEncodings = false);
 
 /// Factory for creating chunk readers.
 LIGHTWEIGHT_API std::unique_ptr<ChunkReader> CreateMsgPackChunkReader(std::istream& input);
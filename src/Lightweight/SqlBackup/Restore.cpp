@@ -4,17 +4,23 @@
 #include "../SqlStatement.hpp"
 #include "../SqlTransaction.hpp"
 #include "../TracyProfiler.hpp"
+#include "../Utils.hpp"
 #include "BatchManager.hpp"
 #include "Common.hpp"
 #include "MsgPackChunkFormats.hpp"
 #include "Restore.hpp"
-#include "Sha256.hpp"
 
 #include <algorithm>
 #include <atomic>
+#include <chrono>
+#include <deque>
 #include <format>
+#include <map>
+#include <memory>
 #include <ranges>
 #include <set>
+#include <span>
+#include <string_view>
 #include <thread>
 
 using namespace std::string_literals;
@@ -22,11 +28,42 @@ using namespace std::string_literals;
 namespace Lightweight::SqlBackup::detail
 {
 
+namespace
+{
+    /// A chunk decoded by a RestoreWithSingleWriter() decoder, waiting for the writer.
+    struct DecodedChunk
+    {
+        RestoreChunkInfo info; ///< content already released
+        std::vector<ColumnBatch> batches;
+    };
+
+    /// Rows the single writer inserts per transaction. Transactions only end at chunk
+    /// boundaries, and with the journal turned off their size costs no memory.
+    constexpr size_t SingleWriterRowsPerCommit = 1'000'000;
+} // namespace
+
 void IncrementChunkCounter(RestoreContext& ctx, std::string const& tableName, bool success)
 {
     auto& chunkCounter = *ctx.chunksProcessed.at(tableName);
+    auto const totalChunks = ctx.totalChunks.find(tableName);
+    if (totalChunks == ctx.totalChunks.end())
+    {
+        // Stream archive: the chunk counts arrive with the trailing index, so Restore() reports the
+        // finished tables once the stream is drained. A failed chunk is reported now and not
+        // counted, which keeps its table from being reported finished.
+        if (success)
+            chunkCounter.fetch_add(1);
+        else
+            ctx.progress.Update({ .state = Progress::State::Error,
+                                  .tableName = tableName,
+                                  .currentRows = ctx.tableProgress.at(tableName)->load(),
+                                  .totalRows = std::nullopt,
+                                  .message = "Restore incomplete: errors occurred" });
+        return;
+    }
+
     size_t const processedChunks = chunkCounter.fetch_add(1) + 1;
-    size_t const totalChunksForTable = ctx.totalChunks.at(tableName);
+    size_t const totalChunksForTable = totalChunks->second;
 
     if (processedChunks >= totalChunksForTable)
     {
@@ -43,33 +80,74 @@ void IncrementChunkCounter(RestoreContext& ctx, std::string const& tableName, bo
 std::expected<RestoreChunkInfo, FetchChunkError> FetchNextRestoreChunk(RestoreContext& ctx)
 {
     ZoneScopedN("Restore::FetchChunk");
-    ZipEntryInfo entryInfo;
+    std::string path;
+    std::string frameChecksum;
+    std::vector<uint8_t> content;
+    std::span<uint8_t const> mappedContent;
+    if (ctx.streamQueue)
     {
-        auto const lock = std::scoped_lock(ctx.queueMutex);
-        if (ctx.dataQueue.empty())
+        // Stream archive: the reader thread only enqueues frames; decompressing them here spreads
+        // the decode over the workers.
+        StreamFrame frame;
+        if (!ctx.streamQueue->WaitAndPop(frame))
             return RestoreChunkInfo { .tableName = {},
                                       .chunkPath = {},
                                       .content = {},
+                                      .mappedContent = {},
                                       .tableInfo = nullptr,
                                       .displayTotal = std::nullopt,
-                                      .isEndOfStream = true }; // Signal worker to exit - queue empty
-        entryInfo = ctx.dataQueue.front();
-        ctx.dataQueue.pop_front();
+                                      .isEndOfStream = true }; // Stream drained (or stopped)
+        path = std::move(frame.name);
+        frameChecksum = std::move(frame.checksum);
+        try
+        {
+            content = DecompressStreamEntry(frame.payload);
+        }
+        catch (std::exception const& e)
+        {
+            return std::unexpected(FetchChunkError { .tableName = "", .message = std::format("{}: {}", path, e.what()) });
+        }
     }
-
-    std::vector<uint8_t> content;
+    else
     {
-        ZoneScopedN("Restore::UnzipChunk");
-        auto const lock = std::scoped_lock(ctx.fileMutex);
+        auto scheduled = ctx.scheduler->Acquire(ctx.workerIndex);
+        if (!scheduled)
+            return RestoreChunkInfo { .tableName = {},
+                                      .chunkPath = {},
+                                      .content = {},
+                                      .mappedContent = {},
+                                      .tableInfo = nullptr,
+                                      .displayTotal = std::nullopt,
+                                      .isEndOfStream = true }; // Signal worker to exit - no chunks left
+        auto& entryInfo = scheduled->entry;
         if (!entryInfo.valid)
             return std::unexpected(
                 FetchChunkError { .tableName = "", .message = std::format("Invalid zip entry: {}", entryInfo.name) });
-        content = ReadZipEntry<std::vector<uint8_t>>(ctx.zip, entryInfo.index, entryInfo.size);
+
+        if (ctx.mappedZip)
+        {
+            ZoneScopedN("Restore::ReadMappedChunk");
+            if (!ctx.mappedReader)
+                ctx.mappedReader = std::make_shared<Zip::MappedZipReader>(*ctx.mappedZip);
+            auto const bytes = ctx.mappedReader->Read(entryInfo.index);
+            if (!bytes)
+                return std::unexpected(FetchChunkError {
+                    .tableName = "",
+                    .message = std::format("Failed to read {}: {}", entryInfo.name, bytes.error().message),
+                });
+            mappedContent = *bytes;
+        }
+        else
+        {
+            ZoneScopedN("Restore::UnzipChunk");
+            auto const lock = std::scoped_lock(ctx.fileMutex);
+            content = ReadZipEntry<std::vector<uint8_t>>(ctx.zip, entryInfo.index, entryInfo.size);
+        }
+        path = std::move(entryInfo.name);
     }
 
     // Parse path FIRST to get tableName for chunk-based completion tracking.
     // Path format: data/TABLE_NAME/chunk_ID.msgpack
-    std::string const path = entryInfo.name;
     auto const firstSlash = path.find('/');
     if (firstSlash == std::string::npos)
         return std::unexpected(
@@ -85,21 +163,25 @@ std::expected<RestoreChunkInfo, FetchChunkError> FetchNextRestoreChunk(RestoreCo
         return std::unexpected(
             FetchChunkError { .tableName = tableName, .message = std::format("Unknown table in backup: {}", tableName) });
 
-    // Verify checksum if available
+    // Verify checksum if available: stream frames carry their own, ZIP entries have theirs in checksums.json.
+    std::string_view expectedHash = frameChecksum;
     if (ctx.checksums)
     {
-        auto const it = ctx.checksums->find(entryInfo.name);
+        auto const it = ctx.checksums->find(path);
         if (it != ctx.checksums->end())
+            expectedHash = it->second;
+    }
+    if (!expectedHash.empty())
+    {
+        ZoneScopedN("Restore::ChecksumVerify");
+        auto const bytes = ctx.mappedZip ? mappedContent : std::span<uint8_t const> { content };
+        std::string const actualHash = ComputeChecksum(
+            ctx.checksumAlgorithm, std::string_view { reinterpret_cast<char const*>(bytes.data()), bytes.size() });
+        if (actualHash != expectedHash)
         {
-            ZoneScopedN("Restore::Sha256Verify");
-            std::string const actualHash = Sha256::Hash(content.data(), content.size());
-            if (actualHash != it->second)
-            {
-                return std::unexpected(FetchChunkError {
-                    .tableName = tableName,
-                    .message = std::format(
-                        "Checksum mismatch for {}: expected {}, got {}", entryInfo.name, it->second, actualHash) });
-            }
+            return std::unexpected(FetchChunkError {
+                .tableName = tableName,
+                .message = std::format("Checksum mismatch for {}: expected {}, got {}", path, expectedHash, actualHash) });
         }
     }
 
@@ -110,6 +192,7 @@ std::expected<RestoreChunkInfo, FetchChunkError> FetchNextRestoreChunk(RestoreCo
         .tableName = tableName,
         .chunkPath = path,
         .content = std::move(content),
+        .mappedContent = mappedContent,
         .tableInfo = &tableInfo,
         .displayTotal = displayTotal,
     };
@@ -124,7 +207,6 @@ bool RestoreChunkData(RestoreContext& ctx, SqlConnection& workerConn, RestoreChu
     auto const& tableInfo = *chunk.tableInfo;
     std::string const& tableName = chunk.tableName;
     std::string const& path = chunk.chunkPath;
-    std::string const& fields = tableInfo.fields;
 
     size_t const currentTotal1 = ctx.tableProgress.at(tableName)->load();
     ctx.progress.Update({ .state = Progress::State::InProgress,
@@ -140,7 +222,7 @@ bool RestoreChunkData(RestoreContext& ctx, SqlConnection& workerConn, RestoreChu
         try
         {
             // Use zero-copy reader directly from buffer (eliminates 2 memory copies)
-            auto reader = CreateMsgPackChunkReaderFromBuffer(chunk.content);
+            auto reader = CreateMsgPackChunkReaderFromBuffer(chunk.Content());
 
             bool const isMsSql = workerConn.ServerType() == SqlServerType::MICROSOFT_SQL;
             bool const isSQLite = workerConn.ServerType() == SqlServerType::SQLITE;
@@ -167,22 +249,22 @@ bool RestoreChunkData(RestoreContext& ctx, SqlConnection& workerConn, RestoreChu
             }
 
             {
-                auto const& formatter = workerConn.QueryFormatter();
-                SqlStatement stmt { workerConn };
-                auto const placeholders = std::ranges::fold_left(
-                    std::views::iota(0UZ, tableInfo.columns.size()), std::string {}, [](std::string const& acc, size_t) {
-                        return acc.empty() ? std::string("?") : acc + ", ?";
-                    });
-                {
-                    ZoneScopedN("Restore::Prepare");
-                    stmt.Prepare(formatter.Insert(ctx.schema, tableName, fields, placeholders));
-                }
+                auto const loader =
+                    CreateBulkLoader(workerConn, ctx.schema, tableName, tableInfo, ctx.restoreSettings.bulkLoad);
+                std::chrono::steady_clock::duration loadTime {};
+                size_t loadedRows = 0;
+                auto const timed = [&loadTime](auto&& load) {
+                    auto const start = std::chrono::steady_clock::now();
+                    load();
+                    loadTime += std::chrono::steady_clock::now() - start;
+                };
 
                 ::Lightweight::detail::BatchManager batchManager(
                     [&](std::vector<SqlRawColumn> const& cols, size_t rows) {
                         ZoneScopedN("Restore::ExecuteBatch");
                         ZoneValue(rows);
-                        (void) stmt.ExecuteBatch(cols, rows);
+                        timed([&] { loader->Load(cols, rows); });
+                        loadedRows += rows;
                     },
                     tableInfo.columns,
                     batchCapacity,
@@ -227,6 +309,7 @@ bool RestoreChunkData(RestoreContext& ctx, SqlConnection& workerConn, RestoreChu
                     if (isSQLite && maxRowsPerCommit > 0 && rowsSinceCommit >= maxRowsPerCommit)
                     {
                         batchManager.Flush();
+                        timed([&] { loader->Finish(); });
                         transaction.Commit();
                         transaction = SqlTransaction(workerConn, SqlTransactionMode::ROLLBACK);
                         rowsSinceCommit = 0;
@@ -249,8 +332,11 @@ bool RestoreChunkData(RestoreContext& ctx, SqlConnection& workerConn, RestoreChu
                 {
                     ZoneScopedN("Restore::Commit");
                     batchManager.Flush();
+                    timed([&] { loader->Finish(); });
                     transaction.Commit();
                 }
+                if (ctx.loadCounters)
+                    ctx.loadCounters->Add(loader->Method(), loadedRows, loadTime);
                 // Cursor cleanup is handled by RAII
             }
 
@@ -341,6 +427,12 @@ void RestoreWorker(RestoreContext ctx, SqlConnection& workerConn)
 
     size_t const batchCapacity = ctx.restoreSettings.batchSize > 0 ? ctx.restoreSettings.batchSize : 4000;
 
+    // Also on errors, so workers waiting on this worker's table are not left blocked.
+    auto const finishScheduling = Lightweight::detail::Finally([&ctx] {
+        if (ctx.scheduler)
+            ctx.scheduler->Finish(ctx.workerIndex);
+    });
+
     try
     {
         // SQLite optimization: Turn off synchronization for faster restore
@@ -405,6 +497,247 @@ void RestoreWorker(RestoreContext ctx, SqlConnection& workerConn)
     }
 }
 
+// NOLINTNEXTLINE(readability-function-cognitive-complexity)
+void RestoreWithSingleWriter(RestoreContext ctx, SqlConnection& writerConn, unsigned decoders)
+{
+    ZoneScopedN("SqlBackup::RestoreWithSingleWriter");
+    decoders = std::max(1U, decoders);
+
+    // Two decoded chunks per decoder keep the writer fed without holding many chunks in memory.
+    ThreadSafeQueue<DecodedChunk> decoded { std::size_t { decoders } * 2 };
+    std::atomic<unsigned> activeDecoders { decoders };
+
+    auto const reportError = [&ctx](std::string const& tableName, std::string const& message) {
+        ctx.progress.Update({ .state = Progress::State::Error,
+                              .tableName = tableName,
+                              .currentRows = 0,
+                              .totalRows = std::nullopt,
+                              .message = message });
+    };
+
+    auto const decode = [&](size_t index) {
+        auto decoderCtx = ctx;
+        decoderCtx.workerIndex = index;
+        auto const threadName = std::format("RestoreDecoder-{}", index);
+        TracySetThreadName(threadName.c_str());
+        auto const finish = Lightweight::detail::Finally([&] {
+            if (decoderCtx.scheduler)
+                decoderCtx.scheduler->Finish(index);
+            if (activeDecoders.fetch_sub(1) == 1)
+                decoded.MarkFinished();
+        });
+
+        while (true)
+        {
+            auto fetchResult = FetchNextRestoreChunk(decoderCtx);
+            if (!fetchResult.has_value())
+            {
+                reportError(fetchResult.error().tableName, fetchResult.error().message);
+                if (!fetchResult.error().tableName.empty())
+                    IncrementChunkCounter(decoderCtx, fetchResult.error().tableName, false);
+                return; // Like a restore worker, a decoder stops at its first failed chunk
+            }
+            if (fetchResult->isEndOfStream)
+                return;
+
+            DecodedChunk chunk { .info = std::move(*fetchResult), .batches = {} };
+            try
+            {
+                ZoneScopedN("Restore::DecodeChunk");
+                auto reader = CreateMsgPackChunkReaderFromBuffer(chunk.info.Content());
+                ColumnBatch batch;
+                while (reader->ReadBatch(batch))
+                {
+                    if (batch.rowCount == 0)
+                        continue;
+                    if (batch.columns.size() != chunk.info.tableInfo->columns.size())
+                        throw std::runtime_error(
+                            std::format("Column count mismatch in backup data: expected {} columns, got {}",
+                                        chunk.info.tableInfo->columns.size(),
+                                        batch.columns.size()));
+                    chunk.batches.push_back(std::move(batch));
+                    batch = ColumnBatch {};
+                }
+            }
+            catch (std::exception const& e)
+            {
+                reportError(chunk.info.tableName, std::format("Decoding {} failed: {}", chunk.info.chunkPath, e.what()));
+                IncrementChunkCounter(decoderCtx, chunk.info.tableName, false);
+                return;
+            }
+            chunk.info.content = {};
+            chunk.info.mappedContent = {}; // the decoder's next read reuses the buffer it may point into
+
+            if (!decoded.Push(std::move(chunk)))
+                return; // The writer failed
+        }
+    };
+
+    std::vector<std::thread> decoderThreads;
+    decoderThreads.reserve(decoders);
+    for (auto const i: std::views::iota(0U, decoders))
+        decoderThreads.emplace_back(decode, size_t { i });
+
+    size_t const batchCapacity = ctx.restoreSettings.batchSize > 0 ? ctx.restoreSettings.batchSize : 4000;
+
+    // The insert state of the table the writer is on, rebuilt (and its statement re-prepared)
+    // whenever the writer moves on to another table.
+    std::string currentTable;
+    std::unique_ptr<BulkLoader> loader;
+    std::optional<::Lightweight::detail::BatchManager> batchManager;
+    std::optional<SqlTransaction> transaction;
+    std::vector<std::string> uncommittedChunks; // table of every chunk inserted since the last commit
+    size_t rowsSinceCommit = 0;
+    size_t loadedRows = 0; // by the current loader
+    std::chrono::steady_clock::duration loadTime {};
+
+    auto const timed = [&loadTime](auto&& load) {
+        auto const start = std::chrono::steady_clock::now();
+        load();
+        loadTime += std::chrono::steady_clock::now() - start;
+    };
+    auto const finishLoad = [&] {
+        if (!batchManager)
+            return;
+        batchManager->Flush();
+        timed([&] { loader->Finish(); });
+    };
+    auto const recordLoad = [&] {
+        if (loader && ctx.loadCounters)
+            ctx.loadCounters->Add(loader->Method(), loadedRows, loadTime);
+        loadedRows = 0;
+        loadTime = {};
+    };
+
+    auto const commit = [&] {
+        ZoneScopedN("Restore::Commit");
+        finishLoad();
+        transaction->Commit();
+        transaction.reset();
+        for (auto const& tableName: uncommittedChunks)
+            IncrementChunkCounter(ctx, tableName, true);
+        uncommittedChunks.clear();
+        rowsSinceCommit = 0;
+    };
+
+    // The decoders interleave tables, so the writer holds back decoded chunks of other tables and
+    // stays on its current table while the queue brings more of it. This bounds the table switches
+    // by the number of tables rather than chunks, at the memory of up to two more chunks per decoder.
+    std::map<std::string, std::deque<DecodedChunk>> heldChunks;
+    size_t heldCount = 0;
+    size_t const maxHeld = std::size_t { decoders } * 2;
+
+    auto const takeHeld = [&](auto held, DecodedChunk& next) {
+        next = std::move(held->second.front());
+        held->second.pop_front();
+        if (held->second.empty())
+            heldChunks.erase(held);
+        --heldCount;
+    };
+    auto const nextChunk = [&](DecodedChunk& next) {
+        if (auto const held = heldChunks.find(currentTable); held != heldChunks.end())
+        {
+            takeHeld(held, next);
+            return true;
+        }
+        // The writer is the only consumer, so a non-empty queue pops without waiting. It only waits
+        // while it holds nothing else to insert.
+        while (heldCount < maxHeld && (heldCount == 0 || !decoded.Empty()) && decoded.WaitAndPop(next))
+        {
+            if (currentTable.empty() || next.info.tableName == currentTable)
+                return true;
+            heldChunks[next.info.tableName].push_back(std::move(next));
+            ++heldCount;
+        }
+        if (heldCount == 0)
+            return false;
+        // Moves on to the table with the most chunks held back.
+        auto const largest =
+            std::ranges::max_element(heldChunks, {}, [](auto const& entry) { return entry.second.size(); });
+        takeHeld(largest, next);
+        return true;
+    };
+
+    DecodedChunk chunk;
+    try
+    {
+        for (auto const& statement: writerConn.QueryFormatter().SingleWriterImportSettings(ctx.restoreSettings.cacheSizeKB))
+            (void) SqlStatement { writerConn }.ExecuteDirect(statement);
+
+        while (nextChunk(chunk))
+        {
+            ZoneScopedN("Restore::WriteChunk");
+            auto const& tableName = chunk.info.tableName;
+            auto const& tableInfo = *chunk.info.tableInfo;
+
+            if (tableName != currentTable)
+            {
+                finishLoad();
+                recordLoad();
+                batchManager.reset();
+                loader = CreateBulkLoader(writerConn, ctx.schema, tableName, tableInfo, ctx.restoreSettings.bulkLoad);
+                batchManager.emplace(
+                    [&](std::vector<SqlRawColumn> const& cols, size_t rows) {
+                        ZoneScopedN("Restore::ExecuteBatch");
+                        timed([&] { loader->Load(cols, rows); });
+                        loadedRows += rows;
+                    },
+                    tableInfo.columns,
+                    batchCapacity,
+                    writerConn.ServerType());
+                currentTable = tableName;
+            }
+            if (!transaction)
+                transaction.emplace(writerConn, SqlTransactionMode::ROLLBACK);
+
+            for (auto const& batch: chunk.batches)
+            {
+                batchManager->PushBatch(batch);
+                rowsSinceCommit += batch.rowCount;
+
+                size_t const currentTotal = ctx.tableProgress.at(tableName)->fetch_add(batch.rowCount) + batch.rowCount;
+                ctx.progress.Update({ .state = Progress::State::InProgress,
+                                      .tableName = tableName,
+                                      .currentRows = currentTotal,
+                                      .totalRows = chunk.info.displayTotal,
+                                      .message = "Restoring chunk " + chunk.info.chunkPath });
+                ctx.progress.OnItemsProcessed(batch.rowCount);
+            }
+            uncommittedChunks.push_back(tableName);
+
+            if (rowsSinceCommit >= SingleWriterRowsPerCommit)
+                commit();
+        }
+        if (transaction)
+            commit();
+        recordLoad();
+    }
+    catch (std::exception const& e)
+    {
+        // Nothing since the last commit can be trusted (the journal is off), so every chunk of the
+        // open transaction fails. Stopping the inputs lets the decoders run out.
+        reportError(chunk.info.tableName, "Insert failed: "s + e.what());
+        for (auto const& tableName: uncommittedChunks)
+            IncrementChunkCounter(ctx, tableName, false);
+        if (std::ranges::find(uncommittedChunks, chunk.info.tableName) == uncommittedChunks.end()
+            && !chunk.info.tableName.empty())
+            IncrementChunkCounter(ctx, chunk.info.tableName, false);
+        decoded.MarkFinished();
+        if (ctx.scheduler)
+            ctx.scheduler->Stop();
+        if (ctx.streamQueue)
+            ctx.streamQueue->MarkFinished();
+    }
+
+    for (auto& thread: decoderThreads)
+        thread.join();
+
+    batchManager.reset();
+    loader.reset();
+    transaction.reset();
+    writerConn.Close(); // Releases the exclusive lock taken for the import
+}
+
 void RestoreIndexes(SqlConnectionString const& connectionString,
                     std::string const& schema,
                     std::map<std::string, TableInfo> const& tableMap,
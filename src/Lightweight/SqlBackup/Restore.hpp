@@ -3,17 +3,22 @@
 #pragma once
 
 #include "../SqlConnection.hpp"
+#include "../ThreadSafeQueue.hpp"
+#include "../Zip/MappedZipArchive.hpp"
+#include "BulkLoader.hpp"
 #include "Common.hpp"
+#include "RestoreScheduler.hpp"
 #include "SqlBackup.hpp"
+#include "StreamArchive.hpp"
 
 #include <atomic>
-#include <deque>
 #include <expected>
 #include <map>
 #include <memory>
 #include <mutex>
 #include <optional>
 #include <set>
+#include <span>
 #include <string>
 #include <vector>
 
@@ -34,10 +39,17 @@ struct RestoreChunkInfo
 {
     std::string tableName;
     std::string chunkPath;
-    std::vector<uint8_t> content;
+    std::vector<uint8_t> content;           ///< Chunk bytes read into memory (stream frames, libzip reads).
+    std::span<uint8_t const> mappedContent; ///< Chunk bytes borrowed from the worker's MappedZipReader instead.
     TableInfo const* tableInfo {};
     std::optional<size_t> displayTotal;
     bool isEndOfStream {}; ///< True when queue is empty and no more data is available.
+
+    /// The chunk's bytes. Mapped content stays valid until the worker fetches its next chunk.
+    [[nodiscard]] std::span<uint8_t const> Content() const noexcept
+    {
+        return mappedContent.data() ? mappedContent : std::span<uint8_t const> { content };
+    }
 };
 
 /// Error information from FetchNextRestoreChunk.
@@ -53,17 +65,22 @@ struct RestoreContext
     SqlConnectionString connectionString;
     std::string schema;
     std::map<std::string, TableInfo> const& tableMap;
-    std::deque<ZipEntryInfo>& dataQueue;
+    RestoreScheduler* scheduler; // ZIP archive input: hands out the chunks (nullptr for stream archives)
+    std::size_t workerIndex = 0; // this worker's index for the scheduler
     zip_t* zip;
-    std::mutex& queueMutex;
     std::mutex& fileMutex;
     ProgressManager& progress;
     std::map<std::string, std::shared_ptr<std::atomic<size_t>>> tableProgress;
     std::map<std::string, std::shared_ptr<std::atomic<size_t>>> chunksProcessed; // Per-table processed chunk count
     std::map<std::string, size_t> totalChunks;                                   // Per-table total chunk count
-    std::map<std::string, std::string> const* checksums; // entryName -> expected SHA-256 hash (optional)
+    std::map<std::string, std::string> const* checksums; // entryName -> expected checksum (optional)
     RetrySettings const& retrySettings;
     RestoreSettings restoreSettings;
+    ThreadSafeQueue<StreamFrame>* streamQueue = nullptr; // stream archive input (replaces scheduler/zip)
+    ChecksumAlgorithm checksumAlgorithm = ChecksumAlgorithm::Sha256; // of checksums and stream frame checksums
+    BulkLoadCounters* loadCounters = nullptr; // rows and insert time per load method (optional)
+    Zip::MappedZipArchive const* mappedZip = nullptr; // local ZIP archive input: read instead of zip (optional)
+    std::shared_ptr<Zip::MappedZipReader> mappedReader; // this worker's reader of mappedZip, created on first fetch
 };
 
 /// Increments the chunk counter and reports completion status.
@@ -75,8 +92,10 @@ void IncrementChunkCounter(RestoreContext& ctx, std::string const& tableName, bo
 
 /// Fetches the next chunk from the restore queue.
 ///
-/// Handles dequeuing from the work queue, reading zip entry content,
-/// path parsing to extract table name, and checksum verification.
+/// Handles taking the next chunk from the scheduler, reading zip entry content (or decompressing the next
+/// stream archive frame), path parsing to extract table name, and checksum verification.
+/// With a mapped archive, stored entries are returned as views into the mapping and compressed
+/// ones are decompressed into the worker's reusable buffer; neither takes the shared file mutex.
 ///
 /// @param ctx The restore context.
 /// @return The chunk info on success (with isEndOfStream=true when queue is empty), or error details on failure.
@@ -84,8 +103,8 @@ std::expected<RestoreChunkInfo, FetchChunkError> FetchNextRestoreChunk(RestoreCo
 
 /// Restores chunk data to the database with retry logic.
 ///
-/// Handles MSSQL identity insert handling, batch insertion with transaction management,
-/// SQLite intermediate commits, retry logic for transient errors, and progress tracking.
+/// Handles MSSQL identity insert handling, batch insertion through the connection's BulkLoader with
+/// transaction management, SQLite intermediate commits, retry logic for transient errors, and progress tracking.
 ///
 /// @param ctx The restore context.
 /// @param workerConn The database connection.
@@ -96,13 +115,27 @@ bool RestoreChunkData(RestoreContext& ctx, SqlConnection& workerConn, RestoreChu
 
 /// Worker function that processes chunks from the restore queue.
 ///
-/// This function processes restore chunks from the shared queue, using the helper functions
+/// This function processes restore chunks from the scheduler (or stream queue), using the helper functions
 /// FetchNextRestoreChunk() for I/O operations and RestoreChunkData() for database operations.
 ///
 /// @param ctx The restore context containing queue, progress tracking, and settings.
 /// @param workerConn The database connection for this worker.
 void RestoreWorker(RestoreContext ctx, SqlConnection& workerConn);
 
+/// Restores all chunks over a single writing connection, for backends without concurrent writers.
+///
+/// @p decoders threads fetch, verify and decode chunks into ColumnBatch objects and hand them over
+/// a bounded queue to the calling thread. The calling thread inserts them over @p writerConn, tuned by
+/// SqlQueryFormatter::SingleWriterImportSettings(), in transactions spanning many chunks.
+/// Table completion is reported once a table's chunks are committed. The first failed insert
+/// ends the restore. @p writerConn is closed on return, so the constraint and index
+/// phase can connect again.
+///
+/// @param ctx The restore context; its workerIndex is ignored.
+/// @param writerConn The only connection that writes to the database.
+/// @param decoders The number of decoder threads.
+void RestoreWithSingleWriter(RestoreContext ctx, SqlConnection& writerConn, unsigned decoders);
+
 /// Restores indexes for all tables after data has been restored.
 ///
 /// This function creates indexes that were backed up in the metadata.
@@ -0,0 +1,147 @@
+// SPDX-License-Identifier: Apache-2.0
+
+#include "RestoreScheduler.hpp"
+
+#include <algorithm>
+#include <ranges>
+#include <utility>
+
+namespace Lightweight::SqlBackup::detail
+{
+
+RestoreScheduler::RestoreScheduler(std::vector<RestoreChunkEntry> chunks,
+                                   std::map<std::string, TableInfo> const& tables,
+                                   std::size_t workerCount,
+                                   std::size_t maxWritersPerTable):
+    m_workers(std::max<std::size_t>(1, workerCount)),
+    m_maxWritersPerTable { maxWritersPerTable },
+    m_pendingChunks { chunks.size() }
+{
+    for (auto& [tableName, entry]: chunks)
+    {
+        auto& table = m_tables[tableName];
+        table.name = tableName;
+        table.chunks.push_back(std::move(entry));
+    }
+
+    for (auto& [tableName, table]: m_tables)
+    {
+        // The archive records no per-chunk row counts, so each chunk gets an equal share of the table's rows.
+        auto const tableInfo = tables.find(tableName);
+        std::uint64_t const rowsPerChunk =
+            tableInfo != tables.end() ? tableInfo->second.rowCount / table.chunks.size() : 0;
+        for (auto const& chunk: table.chunks)
+        {
+            // + 1: even an empty chunk costs a transaction.
+            std::uint64_t const cost = chunk.compressedSize + (rowsPerChunk * RowCost) + 1;
+            table.costs.push_back(cost);
+            table.pendingCost += cost;
+        }
+    }
+}
+
+RestoreScheduler::TableQueue* RestoreScheduler::PickLocked(bool& anyPending)
+{
+    // Largest remaining cost per writer (counting the one about to join) wins; comparing cross
+    // products avoids the division. Ties go to the first table by name, keeping the order deterministic.
+    TableQueue* best = nullptr;
+    anyPending = false;
+    for (auto& table: m_tables | std::views::values)
+    {
+        if (table.chunks.empty())
+            continue;
+        anyPending = true;
+        if (m_maxWritersPerTable > 0 && table.writers >= m_maxWritersPerTable)
+            continue;
+        if (!best
+            || table.pendingCost * (best->writers + 1) > best->pendingCost * (table.writers + 1))
+            best = &table;
+    }
+    return best;
+}
+
+void RestoreScheduler::ReleaseLocked(WorkerState& worker)
+{
+    if (!worker.table)
+        return;
+    --worker.table->writers;
+    worker.table = nullptr;
+    m_writerReleased.notify_all();
+}
+
+std::optional<RestoreChunkEntry> RestoreScheduler::Acquire(std::size_t worker)
+{
+    auto lock = std::unique_lock(m_mutex);
+    auto& state = m_workers.at(worker);
+    ReleaseLocked(state);
+
+    while (!m_stopped)
+    {
+        bool anyPending = false;
+        if (auto* table = PickLocked(anyPending))
+        {
+            RestoreChunkEntry chunk { .tableName = table->name, .entry = std::move(table->chunks.front()) };
+            table->chunks.pop_front();
+            table->pendingCost -= table->costs.front();
+            table->costs.pop_front();
+            ++table->writers;
+            --m_pendingChunks;
+            state.table = table;
+            return chunk;
+        }
+        if (!anyPending)
+            break;
+
+        // Every table with chunks left is at its writer limit.
+        auto const waitStart = std::chrono::steady_clock::now();
+        m_writerReleased.wait(lock);
+        state.throttled += std::chrono::steady_clock::now() - waitStart;
+    }
+    return std::nullopt;
+}
+
+void RestoreScheduler::Finish(std::size_t worker)
+{
+    auto const lock = std::scoped_lock(m_mutex);
+    auto& state = m_workers.at(worker);
+    ReleaseLocked(state);
+    if (!state.finishedAt)
+        state.finishedAt = std::chrono::steady_clock::now();
+}
+
+void RestoreScheduler::Stop()
+{
+    auto const lock = std::scoped_lock(m_mutex);
+    m_stopped = true;
+    m_writerReleased.notify_all();
+}
+
+std::size_t RestoreScheduler::PendingChunks() const
+{
+    auto const lock = std::scoped_lock(m_mutex);
+    return m_pendingChunks;
+}
+
+std::vector<RestoreWorkerIdleTime> RestoreScheduler::IdleTimes() const
+{
+    auto const lock = std::scoped_lock(m_mutex);
+
+    std::optional<std::chrono::steady_clock::time_point> lastFinish;
+    for (auto const& worker: m_workers)
+        if (worker.finishedAt && (!lastFinish || *worker.finishedAt > *lastFinish))
+            lastFinish = worker.finishedAt;
+
+    std::vector<RestoreWorkerIdleTime> idleTimes;
+    idleTimes.reserve(m_workers.size());
+    for (auto const& worker: m_workers)
+    {
+        auto const tail = worker.finishedAt ? *lastFinish - *worker.finishedAt : std::chrono::steady_clock::duration {};
+        idleTimes.push_back({
+            .throttled = std::chrono::duration_cast<std::chrono::milliseconds>(worker.throttled),
+            .tail = std::chrono::duration_cast<std::chrono::milliseconds>(tail),
+        });
+    }
+    return idleTimes;
+}
+
+} // namespace Lightweight::SqlBackup::detail
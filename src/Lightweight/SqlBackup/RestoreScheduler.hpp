@@ -0,0 +1,101 @@
+// SPDX-License-Identifier: Apache-2.0
+
+#pragma once
+
+#include "../Api.hpp"
+#include "Common.hpp"
+#include "SqlBackup.hpp"
+
+#include <chrono>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <map>
+#include <mutex>
+#include <optional>
+#include <string>
+#include <vector>
+
+namespace Lightweight::SqlBackup::detail
+{
+
+/// A chunk entry of a ZIP archive together with the table it restores into.
+struct RestoreChunkEntry
+{
+    std::string tableName;
+    ZipEntryInfo entry;
+};
+
+/// Hands the chunks of a ZIP restore to the workers, table-aware.
+///
+/// Each chunk is costed by its compressed size plus a per-row share of its table's
+/// `TableInfo::rowCount`. A worker asking for work gets the next chunk of the table with the
+/// most remaining cost per active writer, so the largest tables start first and get the most
+/// workers, while the other workers spread over the remaining tables instead of piling onto
+/// one. With a writer limit, a worker waits while every table that has chunks left is at the
+/// limit. Chunks of one table are handed out in archive order (ascending key windows).
+class RestoreScheduler
+{
+  public:
+    /// Estimated cost of inserting one row, in compressed-byte equivalents.
+    static constexpr std::uint64_t RowCost = 64;
+
+    /// @param chunks The chunks to restore, in archive order.
+    /// @param tables The restored tables; supplies the row counts.
+    /// @param workerCount The number of workers that will call Acquire().
+    /// @param maxWritersPerTable Maximum concurrent workers per table (0 = no limit).
+    LIGHTWEIGHT_API RestoreScheduler(std::vector<RestoreChunkEntry> chunks,
+                                     std::map<std::string, TableInfo> const& tables,
+                                     std::size_t workerCount,
+                                     std::size_t maxWritersPerTable);
+
+    /// Takes the next chunk for @p worker and counts the worker as a writer of its table until
+    /// the next Acquire() or Finish() of the same worker.
+    ///
+    /// @return The chunk, or std::nullopt once no chunks are left (or Stop() was called).
+    [[nodiscard]] LIGHTWEIGHT_API std::optional<RestoreChunkEntry> Acquire(std::size_t worker);
+
+    /// Marks @p worker done: releases its table and records when it ran out of work.
+    /// Must be called on every exit path of the worker, so waiting workers are not left blocked.
+    LIGHTWEIGHT_API void Finish(std::size_t worker);
+
+    /// Makes every pending and future Acquire() return std::nullopt.
+    LIGHTWEIGHT_API void Stop();
+
+    /// Returns the number of chunks not yet handed out.
+    [[nodiscard]] LIGHTWEIGHT_API std::size_t PendingChunks() const;
+
+    /// Returns the idle time of every worker; call after all workers finished.
+    [[nodiscard]] LIGHTWEIGHT_API std::vector<RestoreWorkerIdleTime> IdleTimes() const;
+
+  private:
+    struct TableQueue
+    {
+        std::string name;
+        std::deque<ZipEntryInfo> chunks;
+        std::deque<std::uint64_t> costs; ///< parallel to chunks
+        std::uint64_t pendingCost = 0;
+        std::size_t writers = 0;
+    };
+
+    struct WorkerState
+    {
+        TableQueue* table = nullptr; ///< table the worker currently writes to
+        std::chrono::steady_clock::duration throttled {};
+        std::optional<std::chrono::steady_clock::time_point> finishedAt;
+    };
+
+    void ReleaseLocked(WorkerState& worker);
+    [[nodiscard]] TableQueue* PickLocked(bool& anyPending);
+
+    mutable std::mutex m_mutex;
+    std::condition_variable m_writerReleased;
+    std::map<std::string, TableQueue> m_tables;
+    std::vector<WorkerState> m_workers;
+    std::size_t m_maxWritersPerTable;
+    std::size_t m_pendingChunks = 0;
+    bool m_stopped = false;
+};
+
+} // namespace Lightweight::SqlBackup::detail
@@ -0,0 +1,319 @@
+// SPDX-License-Identifier: Apache-2.0
+#include "Sha256.hpp"
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <ranges>
+
+#if defined(__x86_64__) || defined(__i386__) || defined(_M_X64) || defined(_M_IX86)
+    #define LIGHTWEIGHT_SHA256_X86 1
+    #include <immintrin.h>
+    #if defined(_MSC_VER) && !defined(__clang__)
+        #include <intrin.h>
+    #else
+        #include <cpuid.h>
+    #endif
+#elif defined(__aarch64__) || defined(_M_ARM64)
+    #define LIGHTWEIGHT_SHA256_ARM 1
+    #include <arm_neon.h>
+    #if defined(__linux__)
+        #include <asm/hwcap.h>
+        #include <sys/auxv.h>
+    #elif defined(_WIN32)
+        #ifndef NOMINMAX
+            #define NOMINMAX
+        #endif
+        #ifndef WIN32_LEAN_AND_MEAN
+            #define WIN32_LEAN_AND_MEAN
+        #endif
+        #include <Windows.h>
+    #endif
+#endif
+
+// GCC and Clang only emit the SHA instructions in functions compiled for them; MSVC always does.
+#if defined(LIGHTWEIGHT_SHA256_X86) && (defined(__GNUC__) || defined(__clang__))
+    #define LIGHTWEIGHT_SHA256_TARGET __attribute__((target("sha,sse4.1,ssse3")))
+#elif defined(LIGHTWEIGHT_SHA256_ARM) && defined(__clang__)
+    #define LIGHTWEIGHT_SHA256_TARGET __attribute__((target("sha2")))
+#elif defined(LIGHTWEIGHT_SHA256_ARM) && defined(__GNUC__)
+    #define LIGHTWEIGHT_SHA256_TARGET __attribute__((target("+crypto")))
+#else
+    #define LIGHTWEIGHT_SHA256_TARGET
+#endif
+
+// The round loops must be unrolled so the message words stay in vector registers.
+#if defined(__GNUC__) || defined(__clang__)
+    #define LIGHTWEIGHT_SHA256_UNROLL _Pragma("GCC unroll 16")
+#else
+    #define LIGHTWEIGHT_SHA256_UNROLL
+#endif
+
+namespace Lightweight::SqlBackup::detail
+{
+
+namespace
+{
+    alignas(16) constexpr std::array<std::uint32_t, 64> K = {
+        0x428a2f98, 0x71374491, 0xb5c0fbcf, 0xe9b5dba5, 0x3956c25b, 0x59f111f1, 0x923f82a4, 0xab1c5ed5,
+        0xd807aa98, 0x12835b01, 0x243185be, 0x550c7dc3, 0x72be5d74, 0x80deb1fe, 0x9bdc06a7, 0xc19bf174,
+        0xe49b69c1, 0xefbe4786, 0x0fc19dc6, 0x240ca1cc, 0x2de92c6f, 0x4a7484aa, 0x5cb0a9dc, 0x76f988da,
+        0x983e5152, 0xa831c66d, 0xb00327c8, 0xbf597fc7, 0xc6e00bf3, 0xd5a79147, 0x06ca6351, 0x14292967,
+        0x27b70a85, 0x2e1b2138, 0x4d2c6dfc, 0x53380d13, 0x650a7354, 0x766a0abb, 0x81c2c92e, 0x92722c85,
+        0xa2bfe8a1, 0xa81a664b, 0xc24b8b70, 0xc76c51a3, 0xd192e819, 0xd6990624, 0xf40e3585, 0x106aa070,
+        0x19a4c116, 0x1e376c08, 0x2748774c, 0x34b0bcb5, 0x391c0cb3, 0x4ed8aa4a, 0x5b9cca4f, 0x682e6ff3,
+        0x748f82ee, 0x78a5636f, 0x84c87814, 0x8cc70208, 0x90befffa, 0xa4506ceb, 0xbef9a3f7, 0xc67178f2,
+    };
+
+    constexpr std::uint32_t RotateRight(std::uint32_t x, int n) noexcept
+    {
+        return (x >> n) | (x << (32 - n));
+    }
+
+#if defined(LIGHTWEIGHT_SHA256_X86)
+    bool CpuHasShaExtensions() noexcept
+    {
+        // CPUID leaf 1: ECX bit 9 = SSSE3, bit 19 = SSE4.1; leaf 7: EBX bit 29 = SHA.
+    #if defined(_MSC_VER) && !defined(__clang__)
+        std::array<int, 4> regs {};
+        __cpuid(regs.data(), 0);
+        if (regs[0] < 7)
+            return false;
+        __cpuid(regs.data(), 1);
+        bool const ssse3AndSse41 = (regs[2] & (1 << 9)) != 0 && (regs[2] & (1 << 19)) != 0;
+        __cpuidex(regs.data(), 7, 0);
+        return ssse3AndSse41 && (regs[1] & (1 << 29)) != 0;
+    #else
+        unsigned eax = 0, ebx = 0, ecx = 0, edx = 0;
+        if (__get_cpuid_max(0, nullptr) < 7 || !__get_cpuid(1, &eax, &ebx, &ecx, &edx))
+            return false;
+        bool const ssse3AndSse41 = (ecx & (1U << 9)) != 0 && (ecx & (1U << 19)) != 0;
+        __cpuid_count(7, 0, eax, ebx, ecx, edx);
+        return ssse3AndSse41 && (ebx & (1U << 29)) != 0;
+    #endif
+    }
+
+    // Intel SHA extensions: SHA256RNDS2 performs two rounds on the state held as ABEF/CDGH, and
+    // SHA256MSG1/MSG2 extend the message schedule four words at a time.
+    LIGHTWEIGHT_SHA256_TARGET void Sha256CompressShaNi(std::uint32_t* state,
+                                                       std::uint8_t const* blocks,
+                                                       std::size_t count) noexcept
+    {
+        __m128i const byteSwap = _mm_set_epi64x(0x0c0d0e0f08090a0bLL, 0x0405060700010203LL);
+
+        // Rearrange the state words from ABCD/EFGH into the ABEF/CDGH layout of SHA256RNDS2.
+        __m128i tmp = _mm_shuffle_epi32(_mm_loadu_si128(reinterpret_cast<__m128i const*>(state)), 0xB1);
+        __m128i state1 = _mm_shuffle_epi32(_mm_loadu_si128(reinterpret_cast<__m128i const*>(state + 4)), 0x1B);
+        __m128i state0 = _mm_alignr_epi8(tmp, state1, 8);
+        state1 = _mm_blend_epi16(state1, tmp, 0xF0);
+
+        for (auto const index: std::views::iota(0UZ, count))
+        {
+            auto const* const block = blocks + (index * 64);
+            __m128i const abefSave = state0;
+            __m128i const cdghSave = state1;
+
+            // The four message words in flight, named relative to the current group: msg0 is the one
+            // the group consumes, msg1 the next and msg3 the previous. They rotate after every group.
+            __m128i msg0 = _mm_shuffle_epi8(_mm_loadu_si128(reinterpret_cast<__m128i const*>(block)), byteSwap);
+            __m128i msg1 = _mm_shuffle_epi8(_mm_loadu_si128(reinterpret_cast<__m128i const*>(block + 16)), byteSwap);
+            __m128i msg2 = _mm_shuffle_epi8(_mm_loadu_si128(reinterpret_cast<__m128i const*>(block + 32)), byteSwap);
+            __m128i msg3 = _mm_shuffle_epi8(_mm_loadu_si128(reinterpret_cast<__m128i const*>(block + 48)), byteSwap);
+
+            LIGHTWEIGHT_SHA256_UNROLL
+            for (auto const group: std::views::iota(0, 16))
+            {
+                __m128i roundInput =
+                    _mm_add_epi32(msg0, _mm_load_si128(reinterpret_cast<__m128i const*>(K.data() + (group * 4))));
+                state1 = _mm_sha256rnds2_epu32(state1, state0, roundInput);
+                if (group >= 3 && group < 15)
+                {
+                    msg1 = _mm_add_epi32(msg1, _mm_alignr_epi8(msg0, msg3, 4));
+                    msg1 = _mm_sha256msg2_epu32(msg1, msg0);
+                }
+                roundInput = _mm_shuffle_epi32(roundInput, 0x0E);
+                state0 = _mm_sha256rnds2_epu32(state0, state1, roundInput);
+                if (group >= 1 && group < 13)
+                    msg3 = _mm_sha256msg1_epu32(msg3, msg0);
+
+                auto const consumed = msg0;
+                msg0 = msg1;
+                msg1 = msg2;
+                msg2 = msg3;
+                msg3 = consumed;
+            }
+
+            state0 = _mm_add_epi32(state0, abefSave);
+            state1 = _mm_add_epi32(state1, cdghSave);
+        }
+
+        // Back from ABEF/CDGH to ABCD/EFGH.
+        tmp = _mm_shuffle_epi32(state0, 0x1B);
+        state1 = _mm_shuffle_epi32(state1, 0xB1);
+        state0 = _mm_blend_epi16(tmp, state1, 0xF0);
+        state1 = _mm_alignr_epi8(state1, tmp, 8);
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(state), state0);
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(state + 4), state1);
+    }
+#endif
+
+#if defined(LIGHTWEIGHT_SHA256_ARM)
+    bool CpuHasShaExtensions() noexcept
+    {
+    #if defined(__APPLE__)
+        return true; // every Apple arm64 CPU implements the cryptography extension
+    #elif defined(__linux__) && defined(HWCAP_SHA2)
+        return (getauxval(AT_HWCAP) & HWCAP_SHA2) != 0;
+    #elif defined(_WIN32)
+        return IsProcessorFeaturePresent(PF_ARM_V8_CRYPTO_INSTRUCTIONS_AVAILABLE) != 0;
+    #else
+        return false;
+    #endif
+    }
+
+    // ARMv8 cryptography extension: SHA256H/SHA256H2 perform four rounds on the ABCD/EFGH state,
+    // and SHA256SU0/SU1 extend the message schedule four words at a time.
+    LIGHTWEIGHT_SHA256_TARGET void Sha256CompressArmv8(std::uint32_t* state,
+                                                       std::uint8_t const* blocks,
+                                                       std::size_t count) noexcept
+    {
+        uint32x4_t state0 = vld1q_u32(state);
+        uint32x4_t state1 = vld1q_u32(state + 4);
+
+        for (auto const index: std::views::iota(0UZ, count))
+        {
+            auto const* const block = blocks + (index * 64);
+            uint32x4_t const abcdSave = state0;
+            uint32x4_t const efghSave = state1;
+
+            // The four message words in flight, named relative to the current group: msg0 is the one
+            // the group consumes. They rotate after every group.
+            uint32x4_t msg0 = vreinterpretq_u32_u8(vrev32q_u8(vld1q_u8(block)));
+            uint32x4_t msg1 = vreinterpretq_u32_u8(vrev32q_u8(vld1q_u8(block + 16)));
+            uint32x4_t msg2 = vreinterpretq_u32_u8(vrev32q_u8(vld1q_u8(block + 32)));
+            uint32x4_t msg3 = vreinterpretq_u32_u8(vrev32q_u8(vld1q_u8(block + 48)));
+
+            LIGHTWEIGHT_SHA256_UNROLL
+            for (auto const group: std::views::iota(0, 16))
+            {
+                uint32x4_t const roundInput = vaddq_u32(msg0, vld1q_u32(K.data() + (group * 4)));
+                if (group < 12)
+                    msg0 = vsha256su0q_u32(msg0, msg1);
+                uint32x4_t const abcd = state0;
+                state0 = vsha256hq_u32(state0, state1, roundInput);
+                state1 = vsha256h2q_u32(state1, abcd, roundInput);
+                if (group < 12)
+                    msg0 = vsha256su1q_u32(msg0, msg2, msg3);
+
+                auto const consumed = msg0;
+                msg0 = msg1;
+                msg1 = msg2;
+                msg2 = msg3;
+                msg3 = consumed;
+            }
+
+            state0 = vaddq_u32(state0, abcdSave);
+            state1 = vaddq_u32(state1, efghSave);
+        }
+
+        vst1q_u32(state, state0);
+        vst1q_u32(state + 4, state1);
+    }
+#endif
+
+    Sha256Kernel SelectSha256Kernel() noexcept
+    {
+        if (auto const kernel = Sha256AcceleratedKernel())
+            return kernel;
+        return &Sha256CompressPortable;
+    }
+} // namespace
+
+void Sha256CompressPortable(std::uint32_t* state, std::uint8_t const* blocks, std::size_t count) noexcept
+{
+    for (auto const index: std::views::iota(0UZ, count))
+    {
+        auto const* const block = blocks + (index * 64);
+        std::array<std::uint32_t, 64> w {};
+        for (auto const i: std::views::iota(0UZ, 16UZ))
+        {
+            w[i] = (static_cast<std::uint32_t>(block[i * 4]) << 24)
+                   | (static_cast<std::uint32_t>(block[(i * 4) + 1]) << 16)
+                   | (static_cast<std::uint32_t>(block[(i * 4) + 2]) << 8)
+                   | static_cast<std::uint32_t>(block[(i * 4) + 3]);
+        }
+        for (auto const i: std::views::iota(16UZ, 64UZ))
+        {
+            std::uint32_t const s0 = RotateRight(w[i - 15], 7) ^ RotateRight(w[i - 15], 18) ^ (w[i - 15] >> 3);
+            std::uint32_t const s1 = RotateRight(w[i - 2], 17) ^ RotateRight(w[i - 2], 19) ^ (w[i - 2] >> 10);
+            w[i] = s1 + w[i - 7] + s0 + w[i - 16];
+        }
+
+        std::uint32_t a = state[0];
+        std::uint32_t b = state[1];
+        std::uint32_t c = state[2];
+        std::uint32_t d = state[3];
+        std::uint32_t e = state[4];
+        std::uint32_t f = state[5];
+        std::uint32_t g = state[6];
+        std::uint32_t h = state[7];
+
+        for (auto const i: std::views::iota(0UZ, 64UZ))
+        {
+            std::uint32_t const sigma1 = RotateRight(e, 6) ^ RotateRight(e, 11) ^ RotateRight(e, 25);
+            std::uint32_t const choose = (e & f) ^ (~e & g);
+            std::uint32_t const t1 = h + sigma1 + choose + K[i] + w[i];
+            std::uint32_t const sigma0 = RotateRight(a, 2) ^ RotateRight(a, 13) ^ RotateRight(a, 22);
+            std::uint32_t const majority = (a & b) ^ (a & c) ^ (b & c);
+            std::uint32_t const t2 = sigma0 + majority;
+            h = g;
+            g = f;
+            f = e;
+            e = d + t1;
+            d = c;
+            c = b;
+            b = a;
+            a = t1 + t2;
+        }
+
+        state[0] += a;
+        state[1] += b;
+        state[2] += c;
+        state[3] += d;
+        state[4] += e;
+        state[5] += f;
+        state[6] += g;
+        state[7] += h;
+    }
+}
+
+Sha256Kernel Sha256AcceleratedKernel() noexcept
+{
+#if defined(LIGHTWEIGHT_SHA256_X86)
+    if (CpuHasShaExtensions())
+        return &Sha256CompressShaNi;
+#elif defined(LIGHTWEIGHT_SHA256_ARM)
+    if (CpuHasShaExtensions())
+        return &Sha256CompressArmv8;
+#endif
+    return nullptr;
+}
+
+std::string_view Sha256KernelName() noexcept
+{
+    if (Sha256AcceleratedKernel() == nullptr)
+        return "portable";
+#if defined(LIGHTWEIGHT_SHA256_ARM)
+    return "armv8-sha2";
+#else
+    return "sha-ni";
+#endif
+}
+
+void Sha256Compress(std::uint32_t* state, std::uint8_t const* blocks, std::size_t count) noexcept
+{
+    static Sha256Kernel const kernel = SelectSha256Kernel();
+    kernel(state, blocks, count);
+}
+
+} // namespace Lightweight::SqlBackup::detail
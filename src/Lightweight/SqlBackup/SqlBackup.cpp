@@ -7,14 +7,20 @@
 #include "../SqlStatement.hpp"
 #include "../ThreadSafeQueue.hpp"
 #include "../TracyProfiler.hpp"
+#include "../Zip/MappedZipArchive.hpp"
+#include "AdaptiveCompression.hpp"
 #include "Backup.hpp"
 #include "ChunkPlanner.hpp"
 #include "Common.hpp"
 #include "ConnectionPool.hpp"
+#include "Incremental.hpp"
 #include "Restore.hpp"
+#include "Sha256.hpp"
 #include "SqlBackup.hpp"
 #include "SqlBackupFormats.hpp"
+#include "StreamArchive.hpp"
 #include "TableFilter.hpp"
+#include "Xxh3.hpp"
 
 #include <algorithm>
 #include <array>
@@ -23,11 +29,14 @@
 #include <chrono>
 #include <deque>
 #include <format>
+#include <fstream>
 #include <mutex>
+#include <optional>
 #include <ranges>
 #include <set>
 #include <string_view>
 #include <thread>
+#include <utility>
 #include <variant>
 #include <vector>
 
@@ -151,6 +160,35 @@ std::string_view CompressionMethodName(CompressionMethod method) noexcept
     return "unknown"; // LCOV_EXCL_LINE - unreachable default case
 }
 
+std::string_view ChecksumAlgorithmName(ChecksumAlgorithm algorithm) noexcept
+{
+    switch (algorithm)
+    {
+        case ChecksumAlgorithm::Sha256:
+            return "sha256";
+        case ChecksumAlgorithm::Xxh3:
+            return "xxh3-128";
+    }
+    return "unknown"; // LCOV_EXCL_LINE - unreachable default case
+}
+
+std::optional<ChecksumAlgorithm> ParseChecksumAlgorithm(std::string_view name) noexcept
+{
+    for (auto const algorithm: { ChecksumAlgorithm::Sha256, ChecksumAlgorithm::Xxh3 })
+    {
+        if (ChecksumAlgorithmName(algorithm) == name)
+            return algorithm;
+    }
+    return std::nullopt;
+}
+
+std::string ComputeChecksum(ChecksumAlgorithm algorithm, std::string_view data)
+{
+    if (algorithm == ChecksumAlgorithm::Xxh3)
+        return Xxh3::Hash(data);
+    return Sha256::Hash(data);
+}
+
 namespace
 {
 
@@ -203,6 +241,16 @@ namespace
         return connectionString.size();
     }
 
+    /// Serializes an adaptive compression choice as recorded per table.
+    /// @param compression The choice.
+    /// @return The JSON object (method name, level and trial sample ratio).
+    [[nodiscard]] nlohmann::json TableCompressionJson(TableCompression const& compression)
+    {
+        return { { "method", CompressionMethodName(compression.method) },
+                 { "level", compression.level },
+                 { "sample_ratio", compression.sampleRatio } };
+    }
+
 } // namespace
 
 std::string RedactConnectionStringSecrets(std::string_view connectionString)
@@ -261,10 +309,14 @@ std::string RedactConnectionStringSecrets(std::string_view connectionString)
 // NOLINTNEXTLINE(readability-function-cognitive-complexity)
 std::string CreateMetadata(SqlConnectionString const& connectionString,
                            SqlSchema::TableList const& tables,
-                           std::string const& schema)
+                           std::string const& schema,
+                           bool compactEncodings,
+                           WindowFingerprints const& windowFingerprints,
+                           TableCompressions const& tableCompressions,
+                           WindowGrids const& windowGrids)
 {
     nlohmann::json metadata;
-    metadata["format_version"] = "1.0";
+    metadata["format_version"] = std::string { compactEncodings ? CompactBackupFormatVersion : BackupFormatVersion };
     metadata["creation_time"] = detail::CurrentDateTime();
     // Redact PWD/Password so a secretRef-resolved plaintext credential is never
     // persisted into the archive's metadata. Nothing reads this field back at
@@ -424,12 +476,236 @@ std::string CreateMetadata(SqlConnectionString const& connectionString,
 
         t["primary_keys"] = table.primaryKeys;
 
+        // Workers record windows in completion order; the archive lists them in key order.
+        if (auto const windows = windowFingerprints.find(table.name); windows != windowFingerprints.end())
+        {
+            auto sorted = windows->second;
+            std::ranges::sort(sorted, {}, &WindowFingerprint::window);
+            t["windows"] = nlohmann::json::array();
+            for (auto const& window: sorted)
+                t["windows"].push_back({ { "window", window.window },
+                                         { "lo", window.lo },
+                                         { "hi", window.hi },
+                                         { "fingerprint", window.fingerprint },
+                                         { "sub_chunks", window.subChunks },
+                                         { "rows", window.rows } });
+            if (auto const grid = windowGrids.find(table.name); grid != windowGrids.end())
+                t["window_grid"] = { { "pk_min", grid->second.pkMin }, { "width", grid->second.width } };
+        }
+
+        if (auto const compression = tableCompressions.find(table.name); compression != tableCompressions.end())
+            t["compression"] = TableCompressionJson(compression->second);
+
         metadata["schema"].push_back(t);
     }
 
     return metadata.dump();
 }
 
+namespace
+{
+
+    /// Scans the schema of every table matching @p tableFilter on the main connection, before any
+    /// worker connection exists.
+    /// @param mainConn The main connection.
+    /// @param schema The schema to back up.
+    /// @param tableFilter The table filter patterns.
+    /// @param progress The progress manager.
+    /// @return The scanned tables.
+    std::vector<SqlSchema::Table> ScanBackupTables(SqlConnection& mainConn,
+                                                   std::string const& schema,
+                                                   std::string const& tableFilter,
+                                                   ProgressManager& progress)
+    {
+        // Storage for completed tables (for metadata creation and worker processing)
+        std::vector<SqlSchema::Table> completedTables;
+        std::mutex completedTablesMutex;
+
+        // Parse the table filter
+        auto const filter = TableFilter::Parse(tableFilter);
+
+        // Track max table name length for progress display
+        std::atomic<size_t> maxTableNameLength { 0 };
+
+        // Schema progress callback
+        SqlSchema::ReadAllTablesCallback schemaCallback =
+            [&progress](std::string_view tableName, size_t const current, size_t const total) {
+                progress.Update({ .state = Progress::State::InProgress,
+                                  .tableName = "Scanning schema",
+                                  .currentRows = current,
+                                  .totalRows = total,
+                                  .message = std::format("Scanning table {}", tableName) });
+            };
+
+        // Table-ready callback: called when each table's schema is complete.
+        // Collect tables for later processing (after schema scanning completes).
+        SqlSchema::TableReadyCallback tableReadyCallback = [&](SqlSchema::Table&& table) {
+            // Update max table name length for progress display
+            size_t currentMax = maxTableNameLength.load();
+            while (table.name.size() > currentMax
+                   && !maxTableNameLength.compare_exchange_weak(currentMax, table.name.size()))
+            {
+            }
+
+            // Store for metadata creation, counter thread, AND worker processing
+            std::scoped_lock lock(completedTablesMutex);
+            completedTables.push_back(std::move(table));
+        };
+
+        // Create table filter predicate to skip reading schema for non-matching tables
+        SqlSchema::TableFilterPredicate tableFilterPredicate;
+        if (!filter.MatchesAll())
+        {
+            tableFilterPredicate = [&filter, &schema](std::string_view /*schemaName*/, std::string_view tableName) {
+                return filter.Matches(schema, tableName);
+            };
+        }
+
+        // Run schema scanning FIRST - collect all tables before starting workers.
+        // This avoids data races in the ODBC driver during concurrent query execution.
+        // The MS SQL ODBC driver and OpenSSL have shared internal state that's not thread-safe
+        // when multiple connections are executing queries concurrently with schema queries.
+        auto stmt = SqlStatement { mainConn };
+        {
+            ZoneScopedN("Backup::Phase::SchemaScan");
+            SqlSchema::ReadAllTables(
+                stmt, mainConn.DatabaseName(), schema, schemaCallback, tableReadyCallback, tableFilterPredicate);
+        }
+
+        progress.Update({ .state = Progress::State::Finished,
+                          .tableName = "Scanning schema",
+                          .currentRows = completedTables.size(),
+                          .totalRows = completedTables.size(),
+                          .message = "" });
+
+        progress.SetMaxTableNameLength(maxTableNameLength.load());
+
+        // The schema scan above enumerated every table that will be backed up,
+        // so the denominator for a "n / total tables" readout is known here —
+        // before any data export emits its first per-table Update(). Publishing
+        // it now is what stops a consumer having to infer the total from the
+        // table names it has happened to see, which made the total climb during
+        // the run instead of staying put.
+        progress.SetTotalTables(completedTables.size());
+
+        return completedTables;
+    }
+
+    /// Plans the chunk work-list of @p tables and runs @p concurrency backup workers over it, each
+    /// on its own pooled connection. Returns once every worker has finished.
+    /// @param mainConn The main connection (queries the primary-key window bounds).
+    /// @param tables The tables to back up.
+    /// @param concurrency The number of workers.
+    /// @param ctx The backup context each worker gets a copy of.
+    /// @param archiveDirectory Directory of the workers' chunk archives (unused for stream archives).
+    /// @return The workers' chunk archives, sealed.
+    std::deque<detail::WorkerChunkArchive> RunBackupWorkers(SqlConnection& mainConn,
+                                                            std::vector<SqlSchema::Table> const& tables,
+                                                            unsigned concurrency,
+                                                            detail::BackupContext const& ctx,
+                                                            std::filesystem::path const& archiveDirectory)
+    {
+        auto& progress = ctx.progress;
+
+        // Now that schema scanning is complete, pre-create the worker connection pool.
+        // All connections are established sequentially to avoid ODBC driver races.
+        detail::ConnectionPool pool { ctx.connectionString, concurrency, ctx.retrySettings, progress };
+
+        // Plan the chunk work-list: every PK-range window is its own queue entry so multiple
+        // workers can process one table concurrently. Window bounds (MIN/MAX per PK table) are
+        // queried on the main connection here, before the workers start. The plan owns the
+        // per-table states the chunks point into; it outlives the workers (joined below).
+        auto planStmt = SqlStatement { mainConn };
+        auto const plan = detail::PlanChunks(
+            tables,
+            ctx.backupSettings.rowsPerChunk,
+            [&planStmt](SqlSchema::Table const& table, std::string const& pkColumn) {
+                return detail::QueryPkBounds(planStmt, table, pkColumn);
+            },
+            mainConn.ServerType(),
+            ctx.incrementalBase ? ctx.incrementalBase->grids : WindowGrids {});
+        if (ctx.incrementalLog)
+            ctx.incrementalLog->grids = plan.windowGrids; // the workers have not started yet
+
+        // Plan-time progress: PK-range totals are known now (estimate = key span; their state
+        // carries it). OFFSET tables have totalRows == 0 here and report their exact total
+        // from the worker after COUNT(*), as before. Empty PK tables have no chunks and are
+        // reported done immediately.
+        for (auto const& tableState: plan.tableStates)
+            progress.AddTotalItems(tableState.totalRows.load());
+        for (auto const* emptyTable: plan.emptyTables)
+        {
+            progress.AddTotalItems(0);
+            progress.Update({ .state = Progress::State::Finished,
+                              .tableName = emptyTable->name,
+                              .currentRows = 0,
+                              .totalRows = size_t { 0 },
+                              .message = "Finished table backup" });
+        }
+
+        // Thread-safe queue for streaming chunks of work to the backup workers.
+        ThreadSafeQueue<detail::Chunk> chunkQueue;
+        for (auto const& chunk: plan.chunks)
+            chunkQueue.Push(chunk);
+        chunkQueue.MarkFinished();
+
+        // One private compressed chunk archive per worker (deque: stable addresses for the
+        // thread lambdas). Chunk compression happens inside the workers as rotations fill,
+        // overlapped with the network-bound fetch.
+        std::deque<detail::WorkerChunkArchive> workerArchives;
+        for (auto const workerId: std::views::iota(0U, concurrency))
+            workerArchives.emplace_back(archiveDirectory,
+                                        workerId,
+                                        ctx.backupSettings.workerArchiveBytes,
+                                        ctx.backupSettings.method,
+                                        ctx.backupSettings.level);
+
+        // Start data worker threads - schema scanning is already complete.
+        // Each worker borrows a connection lease from the pool for its lifetime.
+        std::vector<std::thread> workers;
+        workers.reserve(concurrency);
+        for (auto const workerId: std::views::iota(0U, concurrency))
+        {
+            auto& archive = workerArchives[workerId];
+            workers.emplace_back([&chunkQueue, ctx, &pool, &archive] {
+                auto lease = pool.Acquire();
+                detail::ChunkWorker(chunkQueue, ctx, lease.Get(), archive);
+            });
+        }
+
+        // Wait for all workers to complete
+        for (auto& t: workers)
+            t.join();
+
+        return workerArchives;
+    }
+
+    /// Serializes the entry checksums as checksums.json.
+    /// @param checksums Checksum per entry name.
+    /// @param algorithm The algorithm the checksums were computed with.
+    /// @param tableCompressions Adaptive compression choices to record as well (stream archives,
+    ///        whose metadata.json is written before any chunk is compressed).
+    /// @return The JSON document.
+    std::string CreateChecksumsJson(std::map<std::string, std::string> const& checksums,
+                                    ChecksumAlgorithm algorithm,
+                                    TableCompressions const& tableCompressions = {})
+    {
+        nlohmann::json checksumsJson;
+        checksumsJson["algorithm"] = ChecksumAlgorithmName(algorithm);
+        checksumsJson["files"] = nlohmann::json::object();
+        for (auto const& [entryName, hash]: checksums)
+            checksumsJson["files"][entryName] = hash;
+        if (!tableCompressions.empty())
+        {
+            checksumsJson["compression"] = nlohmann::json::object();
+            for (auto const& [tableName, compression]: tableCompressions)
+                checksumsJson["compression"][tableName] = TableCompressionJson(compression);
+        }
+        return checksumsJson.dump();
+    }
+
+} // namespace
+
 // NOLINTNEXTLINE(readability-function-cognitive-complexity)
 void Backup(std::filesystem::path const& outputFile,
             SqlConnectionString const& connectionString,
@@ -460,6 +736,21 @@ void Backup(std::filesystem::path const& outputFile,
     // backup-diff; broader stress validation is ongoing. Re-introduce a clamp if a real race surfaces.)
     concurrency = std::max(1U, concurrency);
 
+    // The output is written in place of the existing file, so it can never be its own base.
+    if (!backupSettings.incrementalFrom.empty())
+    {
+        std::error_code ec;
+        if (std::filesystem::equivalent(backupSettings.incrementalFrom, outputFile, ec))
+        {
+            progress.Update({ .state = Progress::State::Error,
+                              .tableName = "Unknown",
+                              .currentRows = 0,
+                              .totalRows = 0,
+                              .message = "The incremental base archive must differ from the output file" });
+            return;
+        }
+    }
+
     // Create ZIP archive early so workers can write to it
     int err = 0;
     zip_t* zip = zip_open(outputFile.string().c_str(), ZIP_CREATE | ZIP_TRUNCATE, &err);
@@ -550,18 +841,47 @@ void Backup(std::filesystem::path const& outputFile,
         std::map<std::string, std::string> checksums;
         std::mutex checksumMutex;
 
-        // Thread-safe queue for streaming chunks of work to the backup workers.
-        ThreadSafeQueue<detail::Chunk> chunkQueue;
-
-        // Storage for completed tables (for metadata creation after workers finish)
-        std::vector<SqlSchema::Table> completedTables;
-        std::mutex completedTablesMutex;
-
-        // Parse the table filter
-        auto const filter = TableFilter::Parse(tableFilter);
+        // Incremental backups read the base archive's fingerprints up front. Its entries are only
+        // reused if it was written in the same format version and with the same checksum algorithm
+        // as this backup (reused entries keep their base checksums); otherwise every window is
+        // re-read (and fingerprinted, so this archive can be the next base).
+        auto incrementalBase = std::optional<detail::IncrementalBase> {};
+        auto incrementalLog = detail::IncrementalLog {};
+        bool const recordFingerprints = backupSettings.windowFingerprints || !backupSettings.incrementalFrom.empty();
+        if (!backupSettings.incrementalFrom.empty() && !backupSettings.schemaOnly)
+        {
+            incrementalBase = detail::LoadIncrementalBase(backupSettings.incrementalFrom);
+            auto const formatVersion = backupSettings.compactEncodings ? CompactBackupFormatVersion : BackupFormatVersion;
+            if (incrementalBase->formatVersion != formatVersion)
+            {
+                progress.Update({ .state = Progress::State::Warning,
+                                  .tableName = "",
+                                  .currentRows = 0,
+                                  .totalRows = std::nullopt,
+                                  .message = std::format("Incremental base has format version {} (this backup writes "
+                                                         "{}); re-reading all tables",
+                                                         incrementalBase->formatVersion,
+                                                         formatVersion) });
+                incrementalBase.reset();
+            }
+            else if (auto const algorithmName = ChecksumAlgorithmName(backupSettings.checksumAlgorithm);
+                     incrementalBase->checksumAlgorithm != algorithmName)
+            {
+                progress.Update({ .state = Progress::State::Warning,
+                                  .tableName = "",
+                                  .currentRows = 0,
+                                  .totalRows = std::nullopt,
+                                  .message = std::format("Incremental base has {} checksums (this backup writes "
+                                                         "{}); re-reading all tables",
+                                                         incrementalBase->checksumAlgorithm,
+                                                         algorithmName) });
+                incrementalBase.reset();
+            }
+        }
 
-        // Track max table name length for progress display
-        std::atomic<size_t> maxTableNameLength { 0 };
+        auto adaptiveCompression = std::optional<detail::AdaptiveCompression> {};
+        if (backupSettings.adaptiveCompression)
+            adaptiveCompression.emplace(backupSettings.method, backupSettings.compressionTradeoff);
 
         detail::BackupContext ctx {
             .zip = zip,
@@ -573,137 +893,18 @@ void Backup(std::filesystem::path const& outputFile,
             .checksumMutex = &checksumMutex,
             .retrySettings = retrySettings,
             .backupSettings = backupSettings,
+            .incrementalBase = incrementalBase ? &*incrementalBase : nullptr,
+            .incrementalLog = recordFingerprints ? &incrementalLog : nullptr,
+            .compression = adaptiveCompression ? &*adaptiveCompression : nullptr,
         };
 
-        // Schema progress callback
-        SqlSchema::ReadAllTablesCallback schemaCallback =
-            [&progress](std::string_view tableName, size_t const current, size_t const total) {
-                progress.Update({ .state = Progress::State::InProgress,
-                                  .tableName = "Scanning schema",
-                                  .currentRows = current,
-                                  .totalRows = total,
-                                  .message = std::format("Scanning table {}", tableName) });
-            };
-
-        // Table-ready callback: called when each table's schema is complete.
-        // Collect tables for later processing (after schema scanning completes).
-        SqlSchema::TableReadyCallback tableReadyCallback = [&](SqlSchema::Table&& table) {
-            // Update max table name length for progress display
-            size_t currentMax = maxTableNameLength.load();
-            while (table.name.size() > currentMax
-                   && !maxTableNameLength.compare_exchange_weak(currentMax, table.name.size()))
-            {
-            }
-
-            // Store for metadata creation, counter thread, AND worker processing
-            std::scoped_lock lock(completedTablesMutex);
-            completedTables.push_back(std::move(table));
-        };
-
-        // Create table filter predicate to skip reading schema for non-matching tables
-        SqlSchema::TableFilterPredicate tableFilterPredicate;
-        if (!filter.MatchesAll())
-        {
-            tableFilterPredicate = [&filter, &schema](std::string_view /*schemaName*/, std::string_view tableName) {
-                return filter.Matches(schema, tableName);
-            };
-        }
-
-        // Run schema scanning FIRST - collect all tables before starting workers.
-        // This avoids data races in the ODBC driver during concurrent query execution.
-        // The MS SQL ODBC driver and OpenSSL have shared internal state that's not thread-safe
-        // when multiple connections are executing queries concurrently with schema queries.
-        auto stmt = SqlStatement { mainConn };
-        {
-            ZoneScopedN("Backup::Phase::SchemaScan");
-            SqlSchema::ReadAllTables(
-                stmt, mainConn.DatabaseName(), schema, schemaCallback, tableReadyCallback, tableFilterPredicate);
-        }
-
-        progress.Update({ .state = Progress::State::Finished,
-                          .tableName = "Scanning schema",
-                          .currentRows = completedTables.size(),
-                          .totalRows = completedTables.size(),
-                          .message = "" });
-
-        progress.SetMaxTableNameLength(maxTableNameLength.load());
-
-        // The schema scan above enumerated every table that will be backed up,
-        // so the denominator for a "n / total tables" readout is known here —
-        // before any data export emits its first per-table Update(). Publishing
-        // it now is what stops a consumer having to infer the total from the
-        // table names it has happened to see, which made the total climb during
-        // the run instead of staying put.
-        progress.SetTotalTables(completedTables.size());
+        auto const completedTables = ScanBackupTables(mainConn, schema, tableFilter, progress);
 
         // Back up data (unless schema-only mode)
         if (!backupSettings.schemaOnly)
         {
             ZoneScopedN("Backup::Phase::DataExport");
-            // Now that schema scanning is complete, pre-create the worker connection pool.
-            // All connections are established sequentially to avoid ODBC driver races.
-            detail::ConnectionPool pool { connectionString, concurrency, retrySettings, progress };
-
-            // Plan the chunk work-list: every PK-range window is its own queue entry so multiple
-            // workers can process one table concurrently. Window bounds (MIN/MAX per PK table) are
-            // queried on the main connection here, before the workers start. The plan owns the
-            // per-table states the chunks point into; it outlives the workers (joined below).
-            auto planStmt = SqlStatement { mainConn };
-            auto const plan = detail::PlanChunks(
-                completedTables,
-                backupSettings.rowsPerChunk,
-                [&planStmt](SqlSchema::Table const& table, std::string const& pkColumn) {
-                    return detail::QueryPkBounds(planStmt, table, pkColumn);
-                },
-                mainConn.ServerType());
-
-            // Plan-time progress: PK-range totals are known now (estimate = key span; their state
-            // carries it). OFFSET tables have totalRows == 0 here and report their exact total
-            // from the worker after COUNT(*), as before. Empty PK tables have no chunks and are
-            // reported done immediately.
-            for (auto const& tableState: plan.tableStates)
-                progress.AddTotalItems(tableState.totalRows.load());
-            for (auto const* emptyTable: plan.emptyTables)
-            {
-                progress.AddTotalItems(0);
-                progress.Update({ .state = Progress::State::Finished,
-                                  .tableName = emptyTable->name,
-                                  .currentRows = 0,
-                                  .totalRows = size_t { 0 },
-                                  .message = "Finished table backup" });
-            }
-
-            for (auto const& chunk: plan.chunks)
-                chunkQueue.Push(chunk);
-            chunkQueue.MarkFinished();
-
-            // One private compressed chunk archive per worker (deque: stable addresses for the
-            // thread lambdas). Chunk compression happens inside the workers as rotations fill,
-            // overlapped with the network-bound fetch.
-            std::deque<detail::WorkerChunkArchive> workerArchives;
-            for (auto const workerId: std::views::iota(0U, concurrency))
-                workerArchives.emplace_back(tempDirGuard.dir,
-                                            workerId,
-                                            backupSettings.workerArchiveBytes,
-                                            backupSettings.method,
-                                            backupSettings.level);
-
-            // Start data worker threads - schema scanning is already complete.
-            // Each worker borrows a connection lease from the pool for its lifetime.
-            std::vector<std::thread> workers;
-            workers.reserve(concurrency);
-            for (auto const workerId: std::views::iota(0U, concurrency))
-            {
-                auto& archive = workerArchives[workerId];
-                workers.emplace_back([&chunkQueue, ctx, &pool, &archive] {
-                    auto lease = pool.Acquire();
-                    detail::ChunkWorker(chunkQueue, ctx, lease.Get(), archive);
-                });
-            }
-
-            // Wait for all workers to complete
-            for (auto& t: workers)
-                t.join();
+            auto const workerArchives = RunBackupWorkers(mainConn, completedTables, concurrency, ctx, tempDirGuard.dir);
 
             // Raw-merge the workers' sealed archives into the final zip: every entry is copied
             // COMPRESSED (zipmerge-style, ZIP_FL_COMPRESSED carries the source's compression
@@ -713,6 +914,28 @@ void Backup(std::filesystem::path const& outputFile,
             // plus ZIP_FL_OVERWRITE makes a retried window's latest attempt win.
             {
                 ZoneScopedN("Backup::Phase::Merge");
+                auto const mergeEntry = [zip](zip_t* src, zip_int64_t entry, char const* name) {
+                    // zip_source_zip_file (and its trailing password argument) was added in
+                    // libzip 1.8; older libzip (e.g. Ubuntu 24.04's apt libzip 1.7) only has
+                    // the deprecated zip_source_zip with no password parameter. Same guard as
+                    // the round-trip merge in the SqlBackup tests.
+#if LIBZIP_VERSION_MAJOR > 1 || (LIBZIP_VERSION_MAJOR == 1 && LIBZIP_VERSION_MINOR >= 8)
+                    zip_source_t* source = zip_source_zip_file(
+                        zip, src, static_cast<zip_uint64_t>(entry), ZIP_FL_COMPRESSED, 0, -1, nullptr);
+#else
+                    // NOLINTNEXTLINE(clang-diagnostic-deprecated-declarations)
+                    zip_source_t* source =
+                        zip_source_zip(zip, src, static_cast<zip_uint64_t>(entry), ZIP_FL_COMPRESSED, 0, -1);
+#endif
+                    if (!source)
+                        throw std::runtime_error(std::format("Failed to create merge source for {}", name));
+                    if (zip_file_add(zip, name, source, ZIP_FL_OVERWRITE | ZIP_FL_ENC_UTF_8) < 0)
+                    {
+                        zip_source_free(source);
+                        throw std::runtime_error(std::format("Failed to merge {} into the backup archive", name));
+                    }
+                };
+
                 auto tombstones = std::set<std::string> {};
                 for (auto const& archive: workerArchives)
                     tombstones.insert(archive.Tombstones().begin(), archive.Tombstones().end());
@@ -733,27 +956,29 @@ void Backup(std::filesystem::path const& outputFile,
                             char const* name = zip_get_name(src, static_cast<zip_uint64_t>(entry), 0);
                             if (!name || tombstones.contains(name))
                                 continue;
-                        // zip_source_zip_file (and its trailing password argument) was added in
-                        // libzip 1.8; older libzip (e.g. Ubuntu 24.04's apt libzip 1.7) only has
-                        // the deprecated zip_source_zip with no password parameter. Same guard as
-                        // the round-trip merge in the SqlBackup tests.
-#if LIBZIP_VERSION_MAJOR > 1 || (LIBZIP_VERSION_MAJOR == 1 && LIBZIP_VERSION_MINOR >= 8)
-                            zip_source_t* source = zip_source_zip_file(
-                                zip, src, static_cast<zip_uint64_t>(entry), ZIP_FL_COMPRESSED, 0, -1, nullptr);
-#else
-                            // NOLINTNEXTLINE(clang-diagnostic-deprecated-declarations)
-                            zip_source_t* source =
-                                zip_source_zip(zip, src, static_cast<zip_uint64_t>(entry), ZIP_FL_COMPRESSED, 0, -1);
-#endif
-                            if (!source)
-                                throw std::runtime_error(std::format("Failed to create merge source for {}", name));
-                            if (zip_file_add(zip, name, source, ZIP_FL_OVERWRITE | ZIP_FL_ENC_UTF_8) < 0)
-                            {
-                                zip_source_free(source);
-                                throw std::runtime_error(std::format("Failed to merge {} into the backup archive", name));
-                            }
+                            mergeEntry(src, entry, name);
                         }
                     }
+
+                // Windows an incremental backup found unchanged are raw-copied from the base archive
+                // the same way; no worker wrote these names, so nothing above overwrites them.
+                if (!incrementalLog.reusedEntries.empty())
+                {
+                    int baseErr = 0;
+                    zip_t* base = zip_open(backupSettings.incrementalFrom.string().c_str(), ZIP_RDONLY, &baseErr);
+                    if (!base)
+                        throw std::runtime_error("Failed to open incremental base archive for merge: "
+                                                 + backupSettings.incrementalFrom.string());
+                    mergeSources.sources.push_back(base);
+
+                    for (auto const& name: incrementalLog.reusedEntries)
+                    {
+                        zip_int64_t const entry = zip_name_locate(base, name.c_str(), 0);
+                        if (entry < 0)
+                            throw std::runtime_error(std::format("Incremental base archive lacks {}", name));
+                        mergeEntry(base, entry, name.c_str());
+                    }
+                }
             }
         }
         else
@@ -771,7 +996,14 @@ void Backup(std::filesystem::path const& outputFile,
         ZoneScopedN("Backup::Phase::Finalize");
 
         // Create metadata.json from completed tables (moved to end since we need full list)
-        auto const metadataJson = CreateMetadata(connectionString, completedTables, schema);
+        auto const tableCompressions = adaptiveCompression ? adaptiveCompression->Choices() : TableCompressions {};
+        auto const metadataJson = CreateMetadata(connectionString,
+                                                 completedTables,
+                                                 schema,
+                                                 backupSettings.compactEncodings,
+                                                 incrementalLog.windows,
+                                                 tableCompressions,
+                                                 incrementalLog.grids);
 
         // Add metadata.json to ZIP
         // Use malloc for metadata to ensure consistent memory management with chunks.
@@ -808,13 +1040,7 @@ void Backup(std::filesystem::path const& outputFile,
         // Write checksums.json only if we have data
         if (!backupSettings.schemaOnly)
         {
-            nlohmann::json checksumsJson;
-            checksumsJson["algorithm"] = "sha256";
-            checksumsJson["files"] = nlohmann::json::object();
-            for (auto const& [entryName, hash]: checksums)
-                checksumsJson["files"][entryName] = hash;
-
-            std::string const checksumsStr = checksumsJson.dump();
+            std::string const checksumsStr = CreateChecksumsJson(checksums, backupSettings.checksumAlgorithm);
 
             // zip_source_buffer takes ownership when freeData=1, and zip_file_add takes ownership of source on success.
             // NOLINTNEXTLINE(cppcoreguidelines-no-malloc,cppcoreguidelines-owning-memory,clang-analyzer-unix.Malloc)
@@ -883,23 +1109,132 @@ void Backup(std::filesystem::path const& outputFile,
     // LCOV_EXCL_STOP
 }
 
-// NOLINTNEXTLINE(readability-function-cognitive-complexity)
-std::map<std::string, TableInfo> ParseSchema(std::string_view metadataJson, ProgressManager* progress)
+void Backup(std::ostream& output,
+            SqlConnectionString const& connectionString,
+            unsigned concurrency,
+            ProgressManager& progress,
+            std::string const& schema,
+            std::string const& tableFilter,
+            RetrySettings const& retrySettings,
+            BackupSettings const& backupSettings)
 {
-    nlohmann::json metadata = nlohmann::json::parse(metadataJson);
-    auto schema = metadata["schema"];
-
-    std::map<std::string, TableInfo> tableMap;
+    ZoneScopedN("SqlBackup::BackupStream");
+    ZoneValue(concurrency);
 
-    for (auto const& tableJson: schema)
+    // Both need the random-access ZIP container: the fingerprints live in metadata.json, which a
+    // stream writes before any window is read, and reused windows are raw-copied entries.
+    if (!backupSettings.incrementalFrom.empty() || backupSettings.windowFingerprints)
     {
-        std::string tableName = tableJson["name"];
-        TableInfo info;
-        info.rowCount = tableJson.value<size_t>("rows", 0);
-        bool first = true;
+        progress.Update({ .state = Progress::State::Error,
+                          .tableName = "Unknown",
+                          .currentRows = 0,
+                          .totalRows = 0,
+                          .message = "Incremental backups and window fingerprints need a ZIP archive output" });
+        return;
+    }
 
-        for (auto const& colJson: tableJson["columns"])
-        {
+    SqlConnection mainConn { std::nullopt };
+    if (!mainConn.Connect(connectionString))
+    {
+        auto const error = mainConn.LastError();
+        throw std::runtime_error(std::format("Failed to connect to database: {}", error.message));
+    }
+    concurrency = std::max(1U, concurrency);
+
+    try
+    {
+        std::mutex zipMutex;
+        std::map<std::string, std::string> checksums;
+        std::mutex checksumMutex;
+        auto adaptiveCompression = std::optional<detail::AdaptiveCompression> {};
+        if (backupSettings.adaptiveCompression)
+            adaptiveCompression.emplace(backupSettings.method, backupSettings.compressionTradeoff);
+
+        auto const completedTables = ScanBackupTables(mainConn, schema, tableFilter, progress);
+
+        // A couple of compressed chunks per worker may wait for the writer; beyond that the workers
+        // block, so a slow pipe throttles the database reads instead of growing memory.
+        auto stream = detail::StreamArchiveWriter { output, std::size_t { concurrency } * 2 };
+
+        // The restore side needs the schema before the first chunk, so metadata.json leads the stream.
+        // Its checksum field names the algorithm of the chunk checksums that follow.
+        auto const metadataJson = CreateMetadata(connectionString, completedTables, schema, backupSettings.compactEncodings);
+        stream.Write({ .type = detail::StreamFrameType::Metadata,
+                       .name = "metadata.json",
+                       .checksum = std::string { ChecksumAlgorithmName(backupSettings.checksumAlgorithm) },
+                       .payload = { metadataJson.begin(), metadataJson.end() } });
+
+        if (!backupSettings.schemaOnly)
+        {
+            ZoneScopedN("Backup::Phase::DataExport");
+            detail::BackupContext ctx {
+                .zip = nullptr,
+                .zipMutex = zipMutex,
+                .progress = progress,
+                .connectionString = connectionString,
+                .schema = schema,
+                .checksums = &checksums,
+                .checksumMutex = &checksumMutex,
+                .retrySettings = retrySettings,
+                .backupSettings = backupSettings,
+                .stream = &stream,
+                .compression = adaptiveCompression ? &*adaptiveCompression : nullptr,
+            };
+            // The workers' chunk archives stay empty (and create no files) in stream mode.
+            RunBackupWorkers(mainConn, completedTables, concurrency, ctx, {});
+        }
+        else
+        {
+            progress.Update({ .state = Progress::State::InProgress,
+                              .tableName = "",
+                              .currentRows = 0,
+                              .totalRows = std::nullopt,
+                              .message = "Schema-only backup: skipping data export" });
+        }
+
+        // The trailing index tells the reader the stream is complete. It also carries the adaptive
+        // compression choices, which were made after metadata.json had been written.
+        ZoneScopedN("Backup::Phase::Finalize");
+        auto const checksumsJson =
+            CreateChecksumsJson(checksums,
+                                backupSettings.checksumAlgorithm,
+                                adaptiveCompression ? adaptiveCompression->Choices() : TableCompressions {});
+        stream.Write({ .type = detail::StreamFrameType::Index,
+                       .name = "checksums.json",
+                       .checksum = {},
+                       .payload = { checksumsJson.begin(), checksumsJson.end() } });
+        stream.Finish();
+        progress.AllDone();
+    }
+    // LCOV_EXCL_START - Exception handlers for backup failures
+    catch (std::exception const& e)
+    {
+        progress.Update({ .state = Progress::State::Error,
+                          .tableName = "Unknown",
+                          .currentRows = 0,
+                          .totalRows = 0,
+                          .message = "Backup failed: "s + e.what() });
+    }
+    // LCOV_EXCL_STOP
+}
+
+// NOLINTNEXTLINE(readability-function-cognitive-complexity)
+std::map<std::string, TableInfo> ParseSchema(std::string_view metadataJson, ProgressManager* progress)
+{
+    nlohmann::json metadata = nlohmann::json::parse(metadataJson);
+    auto schema = metadata["schema"];
+
+    std::map<std::string, TableInfo> tableMap;
+
+    for (auto const& tableJson: schema)
+    {
+        std::string tableName = tableJson["name"];
+        TableInfo info;
+        info.rowCount = tableJson.value<size_t>("rows", 0);
+        bool first = true;
+
+        for (auto const& colJson: tableJson["columns"])
+        {
             SqlColumnDeclaration col;
             col.name = colJson["name"];
             bool isPk = colJson["is_primary_key"];
@@ -1042,7 +1377,263 @@ std::map<std::string, TableInfo> ParseSchema(std::string_view metadataJson, Prog
     return tableMap;
 }
 
-// NOLINTNEXTLINE(readability-function-cognitive-complexity)
+namespace
+{
+
+    /// The tables a restore loads data into, once their schema has been recreated.
+    struct PreparedRestore
+    {
+        /// The schema the tables were created in.
+        std::string schema;
+
+        /// The tables that were created successfully (the restore skips all others).
+        std::map<std::string, TableInfo> tables;
+    };
+
+    /// Validates the backup metadata and recreates the schema of every table matching
+    /// @p tableFilter. Schema-only restores are completed here.
+    /// @param metadataStr The metadata.json content.
+    /// @param connectionString The target database.
+    /// @param schema The schema to restore into (empty: the backed-up schema).
+    /// @param tableFilter The table filter patterns.
+    /// @param restoreSettings The restore settings.
+    /// @param progress The progress manager.
+    /// @return The created tables, or std::nullopt if the restore ends here (error or schema-only).
+    std::optional<PreparedRestore> PrepareRestore(std::string const& metadataStr,
+                                                  SqlConnectionString const& connectionString,
+                                                  std::string const& schema,
+                                                  std::string const& tableFilter,
+                                                  RestoreSettings const& restoreSettings,
+                                                  ProgressManager& progress)
+    {
+        nlohmann::json const metadata = nlohmann::json::parse(metadataStr);
+
+        // Validate format version
+        std::string const formatVersion = metadata.value("format_version", "");
+        if (!formatVersion.empty() && formatVersion != BackupFormatVersion && formatVersion != CompactBackupFormatVersion)
+        {
+            progress.Update({ .state = Progress::State::Error,
+                              .tableName = "",
+                              .currentRows = 0,
+                              .totalRows = std::nullopt,
+                              .message = std::format("Unsupported backup format version: {}. Expected: {} or {}",
+                                                     formatVersion,
+                                                     BackupFormatVersion,
+                                                     CompactBackupFormatVersion) });
+            return std::nullopt;
+        }
+
+        std::string const effectiveSchema = !schema.empty() ? schema : metadata.value("schema_name", "");
+
+        std::map<std::string, TableInfo> tableMap = ParseSchema(metadataStr, &progress);
+
+        // Apply table filter
+        auto const filter = TableFilter::Parse(tableFilter);
+        if (!filter.MatchesAll())
+        {
+            std::erase_if(tableMap, [&](auto const& pair) { return !filter.Matches(effectiveSchema, pair.first); });
+        }
+
+        std::set<std::string> const createdTables =
+            detail::RecreateDatabaseSchema(connectionString, effectiveSchema, tableMap, progress);
+
+        // Report summary of schema creation
+        size_t const failedTables = tableMap.size() - createdTables.size();
+        if (failedTables > 0)
+        {
+            progress.Update({ .state = Progress::State::Warning,
+                              .tableName = "",
+                              .currentRows = 0,
+                              .totalRows = std::nullopt,
+                              .message = std::format("Schema creation: {} of {} tables created, {} failed",
+                                                     createdTables.size(),
+                                                     tableMap.size(),
+                                                     failedTables) });
+        }
+
+        // Early exit if all tables failed
+        if (createdTables.empty() && !tableMap.empty())
+        {
+            progress.Update({ .state = Progress::State::Error,
+                              .tableName = "",
+                              .currentRows = 0,
+                              .totalRows = std::nullopt,
+                              .message = "Restore aborted: No tables could be created" });
+            progress.AllDone();
+            return std::nullopt;
+        }
+
+        // Filter tableMap to only include created tables
+        std::map<std::string, TableInfo> filteredTableMap;
+        for (auto const& [name, info]: tableMap)
+        {
+            if (createdTables.contains(name))
+                filteredTableMap[name] = info;
+        }
+
+        // Schema-only mode: create schema and apply constraints/indexes, then exit early
+        if (restoreSettings.schemaOnly)
+        {
+            detail::ApplyDatabaseConstraints(connectionString, effectiveSchema, filteredTableMap, progress);
+            detail::RestoreIndexes(connectionString, effectiveSchema, filteredTableMap, progress);
+
+            progress.Update({ .state = Progress::State::Finished,
+                              .tableName = "",
+                              .currentRows = 0,
+                              .totalRows = std::nullopt,
+                              .message = "Schema-only restore complete" });
+            progress.AllDone();
+            return std::nullopt;
+        }
+
+        return PreparedRestore { .schema = effectiveSchema, .tables = std::move(filteredTableMap) };
+    }
+
+    /// Per-table row and chunk counters of a restore.
+    struct RestoreCounters
+    {
+        std::map<std::string, std::shared_ptr<std::atomic<size_t>>> tableProgress;
+        std::map<std::string, std::shared_ptr<std::atomic<size_t>>> chunksProcessed;
+    };
+
+    /// Creates the per-table counters and publishes the restore totals to @p progress.
+    /// @param tables The tables to restore.
+    /// @param progress The progress manager.
+    /// @return The zeroed counters.
+    RestoreCounters InitRestoreCounters(std::map<std::string, TableInfo> const& tables, ProgressManager& progress)
+    {
+        RestoreCounters counters;
+        size_t totalRows = 0;
+        for (auto const& [name, info]: tables)
+        {
+            counters.tableProgress[name] = std::make_shared<std::atomic<size_t>>(0);
+            counters.chunksProcessed[name] = std::make_shared<std::atomic<size_t>>(0);
+            totalRows += info.rowCount;
+        }
+
+        // Set total items for ETA calculation. Even if some tables have unknown row counts (0),
+        // the sum of known counts provides a reasonable approximation for progress display.
+        if (totalRows > 0)
+            progress.SetTotalItems(totalRows);
+
+        // The counters were just created for exactly the tables that will be restored, so — as on
+        // the backup path — the "n / total tables" denominator is known before the first per-table
+        // Update() and is published once here rather than being inferred from the table names a
+        // consumer has seen.
+        progress.SetTotalTables(tables.size());
+        return counters;
+    }
+
+    /// Reconnects @p conn with SQL Server's bulk-copy extensions, or without them if the driver refuses.
+    ///
+    /// @return Whether @p conn now has bulk copy enabled.
+    bool ReconnectWithBulkCopy(SqlConnection& conn, SqlConnectionString const& connectionString)
+    {
+        conn.Close();
+        conn.SetBulkCopyEnabled(true);
+        if (conn.Connect(connectionString))
+            return true;
+
+        conn.SetBulkCopyEnabled(false);
+        if (!conn.Connect(connectionString))
+            throw std::runtime_error(
+                std::format("Failed to reconnect restore worker connection 1: {}", conn.LastError().message));
+        return false;
+    }
+
+    /// Pre-creates the restore worker connections, one at a time, to avoid data races in the ODBC
+    /// driver during concurrent connection establishment.
+    /// @param connectionString The target database.
+    /// @param concurrency The number of workers.
+    /// @param retrySettings The connection retry settings.
+    /// @param bulkLoad Whether to enable SQL Server's bulk copy on the connections (RestoreSettings::bulkLoad).
+    /// @param progress The progress manager.
+    /// @return The connections; a single one if the backend does not support concurrent writers
+    ///         (see detail::RestoreWithSingleWriter).
+    /// @throws std::runtime_error if a connection cannot be established.
+    std::vector<std::unique_ptr<SqlConnection>> ConnectRestoreWorkers(SqlConnectionString const& connectionString,
+                                                                      unsigned concurrency,
+                                                                      RetrySettings const& retrySettings,
+                                                                      bool bulkLoad,
+                                                                      ProgressManager& progress)
+    {
+        // All databases restore multi-threaded. (Historically MS SQL Server was clamped to a single
+        // worker over a suspected ODBC driver data race — the same clamp the backup side dropped.
+        // Each worker uses its own independent SqlConnection and works on its own chunk; restored
+        // data is verified via backup-diff round trips. Re-introduce a clamp if a real race surfaces.)
+        //
+        // The server type is only known once connected, so the first connection reconnects for SQL
+        // Server's bulk copy (a pre-connect attribute), and the others connect with it straight away.
+        std::vector<std::unique_ptr<SqlConnection>> workerConnections;
+        workerConnections.reserve(concurrency);
+        bool bulkCopy = false;
+        for (auto const i: std::views::iota(0U, concurrency))
+        {
+            auto conn = std::make_unique<SqlConnection>(std::nullopt);
+            conn->SetBulkCopyEnabled(bulkCopy);
+            if (!detail::ConnectWithRetry(
+                    *conn, connectionString, retrySettings, progress, std::format("RestoreWorker {}", i + 1)))
+                throw std::runtime_error(
+                    std::format("Failed to create restore worker connection {}: {}", i + 1, conn->LastError().message));
+            if (i == 0 && bulkLoad && conn->SupportsBulkCopy())
+                bulkCopy = ReconnectWithBulkCopy(*conn, connectionString);
+            bool const singleWriter = !conn->SupportsConcurrentWriters();
+            workerConnections.push_back(std::move(conn));
+            if (singleWriter)
+                break;
+        }
+        return workerConnections;
+    }
+
+    /// Applies the constraints and indexes of the restored tables and reports the restore complete.
+    /// @param connectionString The target database.
+    /// @param prepared The restored tables.
+    /// @param progress The progress manager.
+    void FinishRestore(SqlConnectionString const& connectionString,
+                       PreparedRestore const& prepared,
+                       ProgressManager& progress)
+    {
+        detail::ApplyDatabaseConstraints(connectionString, prepared.schema, prepared.tables, progress);
+        detail::RestoreIndexes(connectionString, prepared.schema, prepared.tables, progress);
+
+        progress.Update({ .state = Progress::State::Finished,
+                          .tableName = "",
+                          .currentRows = 0,
+                          .totalRows = std::nullopt,
+                          .message = "Restore complete" });
+        progress.AllDone();
+    }
+
+    /// Extracts the table name from a chunk entry name (`data/<table>/<chunk>.msgpack`).
+    /// @param entryName The entry name.
+    /// @return The table name, or an empty string if @p entryName is not a chunk entry.
+    std::string ChunkEntryTableName(std::string_view entryName)
+    {
+        if (!entryName.starts_with("data/") || !entryName.ends_with(".msgpack"))
+            return {};
+        auto const firstSlash = entryName.find('/');
+        auto const secondSlash = entryName.find('/', firstSlash + 1);
+        if (secondSlash == std::string_view::npos)
+            return {};
+        return std::string { entryName.substr(firstSlash + 1, secondSlash - firstSlash - 1) };
+    }
+
+    /// Reads the magic and the leading metadata frame of a stream archive.
+    /// @param input The stream archive.
+    /// @return The metadata frame; its checksum field names the algorithm of the chunk checksums.
+    /// @throws std::runtime_error if @p input is not a stream archive.
+    detail::StreamFrame ReadStreamMetadataFrame(std::istream& input)
+    {
+        if (!detail::ReadStreamArchiveMagic(input))
+            throw std::runtime_error("Input is not a backup stream archive");
+        auto frame = detail::ReadStreamFrame(input);
+        if (!frame || frame->type != detail::StreamFrameType::Metadata)
+            throw std::runtime_error("Stream archive does not start with metadata.json");
+        return std::move(*frame);
+    }
+
+} // namespace
+
 void Restore(std::filesystem::path const& inputFile,
              SqlConnectionString const& connectionString,
              unsigned concurrency,
@@ -1071,6 +1662,14 @@ void Restore(std::filesystem::path const& inputFile,
         return;
     }
 
+    // A stream archive saved to a file is restored through the sequential reader.
+    if (auto file = std::ifstream { inputFile, std::ios::binary }; detail::ReadStreamArchiveMagic(file))
+    {
+        file.seekg(0);
+        Restore(file, connectionString, concurrency, progress, schema, tableFilter, retrySettings, restoreSettings);
+        return;
+    }
+
     int err = 0;
     zip_t* zip = zip_open(inputFile.string().c_str(), ZIP_RDONLY, &err);
     // LCOV_EXCL_START - Error handling for zip file operations
@@ -1118,25 +1717,10 @@ void Restore(std::filesystem::path const& inputFile,
     // LCOV_EXCL_STOP
 
     auto const metadataStr = detail::ReadZipEntry<std::string>(zip, metadataIndex, metaStat.size);
-    nlohmann::json const metadata = nlohmann::json::parse(metadataStr);
-
-    // Validate format version
-    std::string const formatVersion = metadata.value("format_version", "");
-    if (!formatVersion.empty() && formatVersion != "1.0")
-    {
-        progress.Update({ .state = Progress::State::Error,
-                          .tableName = "",
-                          .currentRows = 0,
-                          .totalRows = std::nullopt,
-                          .message = std::format("Unsupported backup format version: {}. Expected: 1.0", formatVersion) });
-        zip_close(zip);
-        return;
-    }
-
-    std::string const effectiveSchema = !schema.empty() ? schema : metadata.value("schema_name", "");
 
     // Load checksums if available
     std::map<std::string, std::string> checksums;
+    auto checksumAlgorithm = ChecksumAlgorithm::Sha256;
     zip_int64_t const checksumIndex = zip_name_locate(zip, "checksums.json", 0);
     if (checksumIndex >= 0)
     {
@@ -1147,10 +1731,25 @@ void Restore(std::filesystem::path const& inputFile,
             try
             {
                 nlohmann::json const checksumsJson = nlohmann::json::parse(checksumsStr);
-                if (checksumsJson.contains("files") && checksumsJson["files"].is_object())
+                auto const algorithmName = checksumsJson.value("algorithm", std::string { "sha256" });
+                if (auto const algorithm = ParseChecksumAlgorithm(algorithmName))
+                {
+                    checksumAlgorithm = *algorithm;
+                    if (checksumsJson.contains("files") && checksumsJson["files"].is_object())
+                    {
+                        for (auto const& [name, hash]: checksumsJson["files"].items())
+                            checksums[name] = hash.get<std::string>();
+                    }
+                }
+                else
                 {
-                    for (auto const& [name, hash]: checksumsJson["files"].items())
-                        checksums[name] = hash.get<std::string>();
+                    progress.Update({ .state = Progress::State::Warning,
+                                      .tableName = "",
+                                      .currentRows = 0,
+                                      .totalRows = std::nullopt,
+                                      .message = std::format(
+                                          "Unknown checksum algorithm '{}' in checksums.json, skipping verification",
+                                          algorithmName) });
                 }
             }
             // LCOV_EXCL_START - Error handling for checksums parsing failure
@@ -1166,203 +1765,317 @@ void Restore(std::filesystem::path const& inputFile,
         }
     }
 
-    std::map<std::string, TableInfo> tableMap = ParseSchema(metadataStr, &progress);
-
-    // Apply table filter
-    auto const filter = TableFilter::Parse(tableFilter);
-    if (!filter.MatchesAll())
-    {
-        std::erase_if(tableMap, [&](auto const& pair) { return !filter.Matches(effectiveSchema, pair.first); });
-    }
-
-    std::set<std::string> const createdTables =
-        detail::RecreateDatabaseSchema(connectionString, effectiveSchema, tableMap, progress);
-
-    // Report summary of schema creation
-    size_t const failedTables = tableMap.size() - createdTables.size();
-    if (failedTables > 0)
-    {
-        progress.Update({ .state = Progress::State::Warning,
-                          .tableName = "",
-                          .currentRows = 0,
-                          .totalRows = std::nullopt,
-                          .message = std::format("Schema creation: {} of {} tables created, {} failed",
-                                                 createdTables.size(),
-                                                 tableMap.size(),
-                                                 failedTables) });
-    }
-
-    // Early exit if all tables failed
-    if (createdTables.empty() && !tableMap.empty())
-    {
-        progress.Update({ .state = Progress::State::Error,
-                          .tableName = "",
-                          .currentRows = 0,
-                          .totalRows = std::nullopt,
-                          .message = "Restore aborted: No tables could be created" });
-        zip_close(zip);
-        progress.AllDone();
-        return;
-    }
-
-    // Schema-only mode: create schema and apply constraints/indexes, then exit early
-    if (restoreSettings.schemaOnly)
+    auto const prepared = PrepareRestore(metadataStr, connectionString, schema, tableFilter, restoreSettings, progress);
+    if (!prepared)
     {
-        // Filter tableMap to only include created tables
-        std::map<std::string, TableInfo> filteredTableMap;
-        for (auto const& [name, info]: tableMap)
-        {
-            if (createdTables.contains(name))
-                filteredTableMap[name] = info;
-        }
-
-        detail::ApplyDatabaseConstraints(connectionString, effectiveSchema, filteredTableMap, progress);
-        detail::RestoreIndexes(connectionString, effectiveSchema, filteredTableMap, progress);
-
         zip_close(zip);
-        progress.Update({ .state = Progress::State::Finished,
-                          .tableName = "",
-                          .currentRows = 0,
-                          .totalRows = std::nullopt,
-                          .message = "Schema-only restore complete" });
-        progress.AllDone();
         return;
     }
 
-    std::deque<detail::ZipEntryInfo> dataQueue;
+    std::vector<detail::RestoreChunkEntry> chunkEntries;
     std::map<std::string, size_t> totalChunksPerTable; // Count chunks per table for completion detection
     zip_int64_t numEntries = zip_get_num_entries(zip, 0);
+
+    // The workers read the chunks from a mapping of the file, without copying stored entries and
+    // without sharing the libzip handle. libzip stays the fallback where the file cannot be mapped.
+    std::optional<Zip::MappedZipArchive> mappedZip;
+    if (auto mapped = Zip::MappedZipArchive::Open(inputFile); mapped && std::cmp_equal(mapped->Entries().size(), numEntries))
+        mappedZip.emplace(std::move(*mapped));
+
     for (zip_int64_t i = 0; i < numEntries; ++i)
     {
         zip_stat_t stat;
         if (zip_stat_index(zip, static_cast<zip_uint64_t>(i), 0, &stat) < 0)
             continue;
 
-        std::string name = stat.name;
-        if (name.starts_with("data/") && name.ends_with(".msgpack"))
-        {
-            // Extract table name from path: data/TABLE_NAME/chunk.msgpack
-            auto const firstSlash = name.find('/');
-            auto const secondSlash = name.find('/', firstSlash + 1);
-            if (firstSlash != std::string::npos && secondSlash != std::string::npos)
-            {
-                std::string const tableName = name.substr(firstSlash + 1, secondSlash - firstSlash - 1);
-                // Skip chunks for tables that failed to create
-                if (!createdTables.contains(tableName))
-                    continue;
-
-                // Count chunks per table for chunk-based completion detection
-                totalChunksPerTable[tableName]++;
-
-                // Only add entries that pass validation AND are counted
-                dataQueue.push_back(detail::ZipEntryInfo {
-                    .index = i,
-                    .name = std::move(name),
-                    .size = stat.size,
-                    .valid = true,
-                });
-            }
-        }
+        // Skip non-chunk entries and chunks for tables that failed to create
+        std::string const tableName = ChunkEntryTableName(stat.name);
+        if (tableName.empty() || !prepared->tables.contains(tableName))
+            continue;
+
+        // Both index the central directory; should they ever disagree, read through libzip.
+        if (mappedZip && mappedZip->Entries()[static_cast<size_t>(i)].name != stat.name)
+            mappedZip.reset();
+
+        // Count chunks per table for chunk-based completion detection
+        totalChunksPerTable[tableName]++;
+
+        // Only add entries that pass validation AND are counted
+        chunkEntries.push_back(detail::RestoreChunkEntry {
+            .tableName = tableName,
+            .entry = detail::ZipEntryInfo {
+                .index = i,
+                .name = stat.name,
+                .size = stat.size,
+                .valid = true,
+                .compressedSize = stat.comp_size,
+            },
+        });
     }
 
-    std::mutex queueMutex;
+    // Largest tables first, spread over the workers; see RestoreScheduler.
+    detail::RestoreScheduler scheduler(
+        std::move(chunkEntries), prepared->tables, concurrency, restoreSettings.maxWritersPerTable);
     std::mutex fileMutex;
+    auto counters = InitRestoreCounters(prepared->tables, progress);
+
+    // Calculate restore settings based on available memory and concurrency
+    RestoreSettings effectiveSettings = restoreSettings.memoryLimitBytes > 0
+                                            ? restoreSettings
+                                            : CalculateRestoreSettings(GetAvailableSystemMemory(), concurrency);
+    effectiveSettings.bulkLoad = restoreSettings.bulkLoad;
+    detail::BulkLoadCounters loadCounters;
+
+    detail::RestoreContext ctx {
+        .connectionString = connectionString,
+        .schema = prepared->schema,
+        .tableMap = prepared->tables,
+        .scheduler = &scheduler,
+        .workerIndex = 0,
+        .zip = zip,
+        .fileMutex = fileMutex,
+        .progress = progress,
+        .tableProgress = std::move(counters.tableProgress),
+        .chunksProcessed = std::move(counters.chunksProcessed),
+        .totalChunks = totalChunksPerTable,
+        .checksums = checksums.empty() ? nullptr : &checksums,
+        .retrySettings = retrySettings,
+        .restoreSettings = effectiveSettings,
+        .streamQueue = nullptr,
+        .checksumAlgorithm = checksumAlgorithm,
+        .loadCounters = &loadCounters,
+        .mappedZip = mappedZip ? &*mappedZip : nullptr,
+        .mappedReader = nullptr,
+    };
 
-    std::map<std::string, std::shared_ptr<std::atomic<size_t>>> tableProgress;
-    std::map<std::string, std::shared_ptr<std::atomic<size_t>>> chunksProcessed;
-    size_t totalRows = 0;
-    for (auto const& [name, info]: tableMap)
+    std::vector<std::unique_ptr<SqlConnection>> workerConnections;
+    try
+    {
+        workerConnections =
+            ConnectRestoreWorkers(connectionString, concurrency, retrySettings, restoreSettings.bulkLoad, progress);
+    }
+    catch (...)
     {
-        // Only track progress for successfully created tables
-        if (createdTables.contains(name))
+        zip_close(zip);
+        throw;
+    }
+
+    if (!workerConnections.front()->SupportsConcurrentWriters())
+    {
+        // One writer; the workers only decode (SQLite allows a single writer at a time).
+        detail::RestoreWithSingleWriter(ctx, *workerConnections.front(), concurrency);
+    }
+    else
+    {
+        std::vector<std::thread> threads;
+        threads.reserve(concurrency);
+        for (auto const i: std::views::iota(0U, concurrency))
         {
-            tableProgress[name] = std::make_shared<std::atomic<size_t>>(0);
-            chunksProcessed[name] = std::make_shared<std::atomic<size_t>>(0);
-            totalRows += info.rowCount;
+            auto workerCtx = ctx;
+            workerCtx.workerIndex = i;
+            threads.emplace_back(detail::RestoreWorker, std::move(workerCtx), std::ref(*workerConnections[i]));
         }
+
+        for (auto& t: threads)
+            t.join();
     }
 
-    // Set total items for ETA calculation. Even if some tables have unknown row counts (0),
-    // the sum of known counts provides a reasonable approximation for progress display.
-    if (totalRows > 0)
-        progress.SetTotalItems(totalRows);
+    progress.OnRestoreWorkersIdle(scheduler.IdleTimes());
+    progress.OnRestoreLoadStatistics(loadCounters.Statistics());
+    zip_close(zip);
+    FinishRestore(connectionString, *prepared, progress);
+}
+
+// NOLINTNEXTLINE(readability-function-cognitive-complexity)
+void Restore(std::istream& input,
+             SqlConnectionString const& connectionString,
+             unsigned concurrency,
+             ProgressManager& progress,
+             std::string const& schema,
+             std::string const& tableFilter,
+             RetrySettings const& retrySettings,
+             RestoreSettings const& restoreSettings)
+{
+    ZoneScopedN("SqlBackup::RestoreStream");
+    ZoneValue(concurrency);
 
-    // `tableProgress` was just populated with exactly the tables that will be
-    // restored, so — as on the backup path — the "n / total tables" denominator
-    // is known before the first per-table Update() and is published once here
-    // rather than being inferred from the table names a consumer has seen.
-    progress.SetTotalTables(tableProgress.size());
+    concurrency = std::max(1U, concurrency);
 
-    // Filter tableMap to only include created tables for RestoreContext
-    std::map<std::string, TableInfo> filteredTableMap;
-    for (auto const& [name, info]: tableMap)
+    std::string metadataStr;
+    auto checksumAlgorithm = ChecksumAlgorithm::Sha256;
+    try
+    {
+        auto const metadataFrame = ReadStreamMetadataFrame(input);
+        metadataStr.assign(metadataFrame.payload.begin(), metadataFrame.payload.end());
+        if (!metadataFrame.checksum.empty())
+        {
+            auto const algorithm = ParseChecksumAlgorithm(metadataFrame.checksum);
+            if (!algorithm)
+                throw std::runtime_error(
+                    std::format("Unknown checksum algorithm '{}' in stream archive", metadataFrame.checksum));
+            checksumAlgorithm = *algorithm;
+        }
+    }
+    catch (std::exception const& e)
     {
-        if (createdTables.contains(name))
-            filteredTableMap[name] = info;
+        progress.Update({ .state = Progress::State::Error,
+                          .tableName = "",
+                          .currentRows = 0,
+                          .totalRows = 0,
+                          .message = e.what() });
+        return;
     }
 
-    // Calculate restore settings based on available memory and concurrency
-    RestoreSettings const effectiveSettings = restoreSettings.memoryLimitBytes > 0
-                                                  ? restoreSettings
-                                                  : CalculateRestoreSettings(GetAvailableSystemMemory(), concurrency);
+    auto const prepared = PrepareRestore(metadataStr, connectionString, schema, tableFilter, restoreSettings, progress);
+    if (!prepared)
+        return;
+
+    auto counters = InitRestoreCounters(prepared->tables, progress);
+    RestoreSettings effectiveSettings = restoreSettings.memoryLimitBytes > 0
+                                            ? restoreSettings
+                                            : CalculateRestoreSettings(GetAvailableSystemMemory(), concurrency);
+    effectiveSettings.bulkLoad = restoreSettings.bulkLoad;
+    detail::BulkLoadCounters loadCounters;
 
+    // Frames the reader has handed over but no worker has taken yet; a full queue stops the
+    // reader, so memory stays bounded however fast the stream arrives.
+    ThreadSafeQueue<detail::StreamFrame> frameQueue { std::size_t { concurrency } * 2 };
+    std::mutex fileMutex;
     detail::RestoreContext ctx {
         .connectionString = connectionString,
-        .schema = effectiveSchema,
-        .tableMap = filteredTableMap,
-        .dataQueue = dataQueue,
-        .zip = zip,
-        .queueMutex = queueMutex,
+        .schema = prepared->schema,
+        .tableMap = prepared->tables,
+        .scheduler = nullptr,
+        .workerIndex = 0,
+        .zip = nullptr,
         .fileMutex = fileMutex,
         .progress = progress,
-        .tableProgress = tableProgress,
-        .chunksProcessed = chunksProcessed,
-        .totalChunks = totalChunksPerTable,
-        .checksums = checksums.empty() ? nullptr : &checksums,
+        .tableProgress = counters.tableProgress,
+        .chunksProcessed = counters.chunksProcessed,
+        .totalChunks = {}, // known only once the trailing index arrives
+        .checksums = nullptr,
         .retrySettings = retrySettings,
         .restoreSettings = effectiveSettings,
+        .streamQueue = &frameQueue,
+        .checksumAlgorithm = checksumAlgorithm,
+        .loadCounters = &loadCounters,
+        .mappedZip = nullptr,
+        .mappedReader = nullptr,
     };
 
-    // All databases restore multi-threaded. (Historically MS SQL Server was clamped to a single
-    // worker over a suspected ODBC driver data race — the same clamp the backup side dropped.
-    // Each worker uses its own independent SqlConnection and works on its own chunk; restored
-    // data is verified via backup-diff round trips. Re-introduce a clamp if a real race surfaces.)
+    auto workerConnections =
+        ConnectRestoreWorkers(connectionString, concurrency, retrySettings, restoreSettings.bulkLoad, progress);
 
-    // Pre-create worker connections to avoid data races in the ODBC driver
-    // during concurrent connection establishment.
-    std::vector<std::unique_ptr<SqlConnection>> workerConnections;
-    workerConnections.reserve(concurrency);
-    for (auto const i: std::views::iota(0U, concurrency))
+    // A worker aborts on its first failed chunk; closing the queue then also stops the reader
+    // instead of leaving it blocked on a queue nobody drains.
+    std::vector<std::thread> threads;
+    threads.reserve(concurrency);
+    if (!workerConnections.front()->SupportsConcurrentWriters())
+        threads.emplace_back([&frameQueue, ctx, &conn = *workerConnections.front(), concurrency] {
+            detail::RestoreWithSingleWriter(ctx, conn, concurrency);
+            frameQueue.MarkFinished();
+        });
+    else
+        for (auto const i: std::views::iota(0U, concurrency))
+            threads.emplace_back([&frameQueue, ctx, &conn = *workerConnections[i]] {
+                detail::RestoreWorker(ctx, conn);
+                frameQueue.MarkFinished();
+            });
+
+    // Read the stream on this thread, handing chunk frames to the workers as they arrive.
+    std::map<std::string, std::string> receivedChecksums; // every chunk frame read, restored or not
+    std::optional<std::string> indexJson;
+    std::string streamError;
+    try
     {
-        auto conn = std::make_unique<SqlConnection>(std::nullopt);
-        if (!detail::ConnectWithRetry(
-                *conn, connectionString, retrySettings, progress, std::format("RestoreWorker {}", i + 1)))
+        ZoneScopedN("Restore::ReadStream");
+        while (auto frame = detail::ReadStreamFrame(input))
         {
-            zip_close(zip);
-            throw std::runtime_error(
-                std::format("Failed to create restore worker connection {}: {}", i + 1, conn->LastError().message));
+            if (frame->type == detail::StreamFrameType::Index)
+            {
+                indexJson.emplace(frame->payload.begin(), frame->payload.end());
+                break;
+            }
+            if (frame->type != detail::StreamFrameType::Chunk)
+                throw std::runtime_error(std::format("Unexpected frame {} in stream archive", frame->name));
+
+            receivedChecksums[frame->name] = frame->checksum;
+            if (!prepared->tables.contains(ChunkEntryTableName(frame->name)))
+                continue;
+            if (!frameQueue.Push(std::move(*frame)))
+            {
+                streamError = "a restore worker failed";
+                break;
+            }
         }
-        workerConnections.push_back(std::move(conn));
     }
-
-    std::vector<std::thread> threads;
-    threads.reserve(concurrency);
-    for (auto const i: std::views::iota(0U, concurrency))
-        threads.emplace_back(detail::RestoreWorker, ctx, std::ref(*workerConnections[i]));
+    catch (std::exception const& e)
+    {
+        streamError = e.what();
+    }
+    frameQueue.MarkFinished();
 
     for (auto& t: threads)
         t.join();
+    progress.OnRestoreLoadStatistics(loadCounters.Statistics());
+
+    // The trailing index proves the stream is complete: every chunk it lists must have arrived
+    // with the same checksum.
+    std::map<std::string, size_t> indexedChunks;
+    if (streamError.empty() && !indexJson)
+        streamError = "stream archive is truncated (no trailing index)";
+    if (streamError.empty())
+    {
+        try
+        {
+            nlohmann::json const index = nlohmann::json::parse(*indexJson);
+            for (auto const& [name, hash]: index.value("files", nlohmann::json::object()).items())
+            {
+                auto const received = receivedChecksums.find(name);
+                if (received == receivedChecksums.end() || received->second != hash.get<std::string>())
+                    throw std::runtime_error(std::format("stream archive lacks {} or it does not match the index", name));
+                if (auto tableName = ChunkEntryTableName(name); prepared->tables.contains(tableName))
+                    ++indexedChunks[tableName];
+            }
+        }
+        catch (std::exception const& e)
+        {
+            streamError = e.what();
+        }
+    }
 
-    detail::ApplyDatabaseConstraints(connectionString, effectiveSchema, filteredTableMap, progress);
-    detail::RestoreIndexes(connectionString, effectiveSchema, filteredTableMap, progress);
+    // A truncated or mismatched stream leaves the tables partially loaded: constraints and indexes
+    // are not applied to them, and no table is reported complete.
+    if (!streamError.empty())
+    {
+        progress.Update({ .state = Progress::State::Error,
+                          .tableName = "",
+                          .currentRows = 0,
+                          .totalRows = std::nullopt,
+                          .message = "Restore stream incomplete: " + streamError });
+        return;
+    }
 
-    zip_close(zip);
-    progress.Update({ .state = Progress::State::Finished,
-                      .tableName = "",
-                      .currentRows = 0,
-                      .totalRows = std::nullopt,
-                      .message = "Restore complete" });
-    progress.AllDone();
+    for (auto const& name: prepared->tables | std::views::keys)
+    {
+        // Tables with a failed chunk were reported by the worker and stay short of their count.
+        if (counters.chunksProcessed.at(name)->load() < indexedChunks[name])
+            continue;
+        auto const rows = counters.tableProgress.at(name)->load();
+        progress.Update({ .state = Progress::State::Finished,
+                          .tableName = name,
+                          .currentRows = rows,
+                          .totalRows = rows,
+                          .message = "Restore complete" });
+    }
+
+    FinishRestore(connectionString, *prepared, progress);
+}
+
+std::string ReadStreamArchiveMetadata(std::istream& input)
+{
+    auto const frame = ReadStreamMetadataFrame(input);
+    return { frame.payload.begin(), frame.payload.end() };
 }
 
 void Restore(std::filesystem::path const& inputFile,
@@ -9,7 +9,9 @@
 #include <chrono>
 #include <cstdint>
 #include <filesystem>
+#include <iosfwd>
 #include <map>
+#include <optional>
 #include <string>
 #include <string_view>
 #include <vector>
@@ -39,6 +41,13 @@ enum class CompressionMethod : std::int32_t
     Xz = 95,     ///< XZ compression (ZIP_CM_XZ)
 };
 
+/// Algorithms for the per-chunk checksums recorded in checksums.json.
+enum class ChecksumAlgorithm : std::uint8_t
+{
+    Sha256, ///< SHA-256 (default): detects corruption and deliberate tampering.
+    Xxh3,   ///< XXH3 128-bit: several times faster, but detects accidental corruption only.
+};
+
 /// @ingroup Backup
 /// Configuration for backup operations including compression and chunking.
 struct BackupSettings
@@ -53,6 +62,20 @@ struct BackupSettings
     /// - For Store: ignored
     std::uint32_t level = 6;
 
+    /// If true, a sample of each table's first chunk is trial-compressed with #method, and the
+    /// table's chunk entries are stored uncompressed, or compressed at a fast or a strong level of
+    /// #method, whichever the measured ratio and time favour at #compressionTradeoff. #level then only
+    /// applies to metadata.json and checksums.json. The choices are recorded per table.
+    bool adaptiveCompression = false;
+
+    /// CPU/size tradeoff of adaptive compression, from 0 (least CPU) to 1 (smallest archive).
+    /// Higher values compress tables with smaller savings and accept more time per byte saved
+    /// by the strong level.
+    double compressionTradeoff = 0.5;
+
+    /// The algorithm of the chunk checksums, recorded as the `algorithm` of checksums.json.
+    ChecksumAlgorithm checksumAlgorithm = ChecksumAlgorithm::Sha256;
+
     /// The target size in bytes for each chunk before flushing.
     /// Chunks are flushed when the buffer exceeds this size.
     /// Default: 10 MB.
@@ -69,6 +92,21 @@ struct BackupSettings
     /// determines how many temp archives the finalize merge opens. Default: 256 MB.
     std::size_t workerArchiveBytes = 256ULL * 1024 * 1024;
 
+    /// If true, chunks delta-encode integer columns, run-length-encode repeated values and
+    /// dictionary-encode low-cardinality text where that is smaller, and the archive is written as
+    /// format version 1.1, which older readers reject.
+    bool compactEncodings = false;
+
+    /// If true, every primary-key window is fingerprinted on the server before it is read and the
+    /// fingerprint is recorded in metadata.json, so the archive can serve as the base of a later
+    /// incremental backup. Costs one extra aggregate query per window; implied by incrementalFrom.
+    bool windowFingerprints = false;
+
+    /// Base archive of an incremental backup (empty = full backup). Primary-key windows whose
+    /// bounds and server-side fingerprint match the base are copied from it still compressed;
+    /// only changed windows, and tables without a single numeric primary key, are re-read.
+    std::filesystem::path incrementalFrom;
+
     /// If true, only export schema metadata without backing up table data.
     bool schemaOnly = false;
 
@@ -101,6 +139,42 @@ struct RestoreSettings
 
     /// If true, only recreate schema without importing data.
     bool schemaOnly = false;
+
+    /// Maximum number of workers inserting into the same table at once (0 = no limit).
+    /// Chunks are always spread over the tables by their remaining cost; a limit additionally
+    /// keeps workers off a table's page and index locks, at the price of idle workers once only
+    /// capped tables have work left. Applies to ZIP archives; stream archives restore in arrival order.
+    std::size_t maxWritersPerTable = 0;
+
+    /// Insert through the server's native bulk path where the connection offers one: SQL Server's
+    /// bulk copy (when the ODBC driver exports the bcp functions) and multi-row VALUES statements on
+    /// PostgreSQL. Other backends, and a driver without bulk copy, use parameter arrays either way.
+    bool bulkLoad = true;
+};
+
+/// @ingroup Backup
+/// Configuration for direct database-to-database copy operations.
+struct CopySettings
+{
+    /// Number of reader connections fetching chunks from the source database.
+    unsigned readerJobs = 2;
+
+    /// Number of writer connections inserting into the target database.
+    unsigned writerJobs = 2;
+
+    /// Maximum number of decoded batches buffered between readers and writers.
+    /// Readers block once the queue is full, bounding memory at about
+    /// queueCapacity x rowsPerBatch rows regardless of how far the source outpaces the target.
+    std::size_t queueCapacity = 32;
+
+    /// Target rows per chunk window on the source side (see BackupSettings::rowsPerChunk).
+    std::size_t rowsPerChunk = 100'000;
+
+    /// Rows per batch handed from a reader to the writers; also the INSERT array size.
+    std::size_t rowsPerBatch = 4000;
+
+    /// If true, only recreate the schema on the target without copying table data.
+    bool schemaOnly = false;
 };
 
 /// Returns available system memory in bytes.
@@ -125,6 +199,17 @@ LIGHTWEIGHT_API std::vector<CompressionMethod> GetSupportedCompressionMethods()
 /// Returns the human-readable name of a compression method.
 LIGHTWEIGHT_API std::string_view CompressionMethodName(CompressionMethod method) noexcept;
 
+/// Returns the name of a checksum algorithm as recorded in checksums.json ("sha256" or "xxh3-128").
+LIGHTWEIGHT_API std::string_view ChecksumAlgorithmName(ChecksumAlgorithm algorithm) noexcept;
+
+/// Parses a checksum algorithm name as returned by ChecksumAlgorithmName().
+///
+/// @return The algorithm, or std::nullopt if the name is unknown.
+LIGHTWEIGHT_API std::optional<ChecksumAlgorithm> ParseChecksumAlgorithm(std::string_view name) noexcept;
+
+/// Computes the checksum of @p data with @p algorithm as a lowercase hex string.
+LIGHTWEIGHT_API std::string ComputeChecksum(ChecksumAlgorithm algorithm, std::string_view data);
+
 /// Configuration for retry behavior on transient errors during backup/restore operations.
 struct RetrySettings
 {
@@ -163,6 +248,31 @@ struct TableInfo
     size_t rowCount = 0;
 };
 
+/// @ingroup Backup
+/// How long one restore worker had no chunk to insert during the data phase.
+struct RestoreWorkerIdleTime
+{
+    /// Time spent waiting because every table with chunks left was at RestoreSettings::maxWritersPerTable.
+    std::chrono::milliseconds throttled {};
+
+    /// Time between the worker running out of chunks and the last worker finishing.
+    std::chrono::milliseconds tail {};
+};
+
+/// @ingroup Backup
+/// Rows inserted through one load method during the data phase of a restore.
+struct RestoreLoadStatistics
+{
+    /// The load method: "bulk copy", "multi-row insert" or "parameter arrays".
+    std::string method;
+
+    /// Rows inserted through the method.
+    std::size_t rows = 0;
+
+    /// Time spent in the method's insert calls, summed over the writing connections.
+    std::chrono::milliseconds insertTime {};
+};
+
 /// @ingroup Backup
 /// Progress information for backup/restore operations status updates.
 struct Progress
@@ -264,6 +374,28 @@ struct ProgressManager
     {
         (void) totalTables;
     }
+
+    /// Reports the idle time of each restore worker once the data phase of a ZIP restore is done.
+    ///
+    /// A large tail on most workers means one table dominated the end of the restore;
+    /// throttled time means RestoreSettings::maxWritersPerTable kept workers waiting.
+    ///
+    /// @param idleTimes One entry per worker, in worker order.
+    virtual void OnRestoreWorkersIdle(std::vector<RestoreWorkerIdleTime> const& idleTimes)
+    {
+        (void) idleTimes;
+    }
+
+    /// Reports the rows inserted per load method once the data phase of a restore is done.
+    ///
+    /// `rows / insertTime` is the insert rate of one writing connection; it shows whether the
+    /// server's native bulk path was taken, and what it gained.
+    ///
+    /// @param statistics One entry per load method that inserted rows.
+    virtual void OnRestoreLoadStatistics(std::vector<RestoreLoadStatistics> const& statistics)
+    {
+        (void) statistics;
+    }
 };
 
 /// @ingroup Backup
@@ -316,6 +448,31 @@ LIGHTWEIGHT_API void Backup(std::filesystem::path const& outputFile,
                             RetrySettings const& retrySettings = {},
                             BackupSettings const& backupSettings = {});
 
+/// Backs up the database as a stream archive written sequentially to @p output.
+///
+/// Unlike the ZIP container, a stream archive needs neither a seekable output nor temporary
+/// files, so it can go to stdout or a pipe: each worker compresses the chunks it reads and a single
+/// writer thread appends them whole as they complete. metadata.json leads the stream and
+/// checksums.json trails it as an index (see docs/sql-backup-format.md). Incremental backups and
+/// window fingerprints need a ZIP archive and are rejected.
+///
+/// @param output the binary output stream.
+/// @param connectionString the connection string used to connect to the database.
+/// @param concurrency the number of concurrent jobs.
+/// @param progress the progress manager to use for progress updates.
+/// @param schema the database schema to backup (optional).
+/// @param tableFilter comma-separated table filter patterns (default: "*" for all tables).
+/// @param retrySettings configuration for retry behavior on transient errors.
+/// @param backupSettings configuration for compression method, level, and chunk size.
+LIGHTWEIGHT_API void Backup(std::ostream& output,
+                            SqlConnectionString const& connectionString,
+                            unsigned concurrency,
+                            ProgressManager& progress,
+                            std::string const& schema = {},
+                            std::string const& tableFilter = "*",
+                            RetrySettings const& retrySettings = {},
+                            BackupSettings const& backupSettings = {});
+
 /// Restores the database from a file.
 ///
 /// @param inputFile the input file.
@@ -354,6 +511,61 @@ LIGHTWEIGHT_API void Restore(std::filesystem::path const& inputFile,
                              RetrySettings const& retrySettings,
                              RestoreSettings const& restoreSettings);
 
+/// Restores the database from a stream archive read sequentially from @p input (e.g. stdin).
+///
+/// Restore(inputFile, ...) detects stream archives on its own; this overload serves inputs that
+/// cannot be reopened. Chunks are decompressed and inserted by the workers while the stream is
+/// still being read, and each one is verified against the checksum carried in its frame. A
+/// stream that ends before its trailing index is reported as truncated.
+///
+/// @param input the binary input stream.
+/// @param connectionString the connection string used to connect to the database.
+/// @param concurrency the number of concurrent jobs.
+/// @param progress the progress manager to use for progress updates.
+/// @param schema the database schema to restore into (optional, overrides backup metadata).
+/// @param tableFilter comma-separated table filter patterns (default: "*" for all tables).
+/// @param retrySettings configuration for retry behavior on transient errors.
+/// @param restoreSettings configuration for memory management during restore.
+LIGHTWEIGHT_API void Restore(std::istream& input,
+                             SqlConnectionString const& connectionString,
+                             unsigned concurrency,
+                             ProgressManager& progress,
+                             std::string const& schema = {},
+                             std::string const& tableFilter = "*",
+                             RetrySettings const& retrySettings = {},
+                             RestoreSettings const& restoreSettings = {});
+
+/// Reads the metadata.json of a stream archive, consuming the stream up to the end of it.
+///
+/// @param input the binary input stream, positioned at the start of the archive.
+/// @return The metadata JSON.
+/// @throws std::runtime_error if @p input is not a stream archive.
+LIGHTWEIGHT_API std::string ReadStreamArchiveMetadata(std::istream& input);
+
+/// Copies tables directly from one database into another without an intermediate archive.
+///
+/// Readers split the source tables into chunks exactly like Backup() and array-fetch them into
+/// column batches; the batches flow through a bounded in-memory queue to the writers, which insert
+/// them through the same batched insert path Restore() uses. Tables are recreated on the target
+/// first; foreign keys and indexes are applied after all data has been loaded.
+///
+/// @param sourceConnectionString the connection string of the database to copy from.
+/// @param targetConnectionString the connection string of the database to copy into.
+/// @param progress the progress manager to use for progress updates.
+/// @param sourceSchema the schema to read tables from (optional).
+/// @param targetSchema the schema to create tables in (optional, target default schema if empty).
+/// @param tableFilter comma-separated table filter patterns (default: "*" for all tables).
+/// @param retrySettings configuration for retry behavior on transient connection errors.
+/// @param copySettings configuration for reader/writer concurrency and batching.
+LIGHTWEIGHT_API void Copy(SqlConnectionString const& sourceConnectionString,
+                          SqlConnectionString const& targetConnectionString,
+                          ProgressManager& progress,
+                          std::string const& sourceSchema = {},
+                          std::string const& targetSchema = {},
+                          std::string const& tableFilter = "*",
+                          RetrySettings const& retrySettings = {},
+                          CopySettings const& copySettings = {});
+
 /// Returns a copy of `connectionString` with the values of `PWD=` and
 /// `Password=` attributes replaced by `***`.
 ///
@@ -374,14 +586,83 @@ LIGHTWEIGHT_API void Restore(std::filesystem::path const& inputFile,
 /// @return The connection string with password values masked.
 [[nodiscard]] LIGHTWEIGHT_API std::string RedactConnectionStringSecrets(std::string_view connectionString);
 
+/// The backup format version of archives whose chunks use only the plain column encodings.
+constexpr std::string_view BackupFormatVersion = "1.0";
+
+/// The backup format version of archives whose chunks may use compact column encodings.
+constexpr std::string_view CompactBackupFormatVersion = "1.1";
+
+/// Server-side fingerprint of one backed-up primary-key window, as recorded in metadata.json.
+struct WindowFingerprint
+{
+    /// Plan-time window index (the `<window+1>` part of the window's chunk entry names).
+    std::uint32_t window = 0;
+
+    /// Inclusive lower primary-key bound of the window.
+    std::int64_t lo = 0;
+
+    /// Inclusive upper primary-key bound of the window.
+    std::int64_t hi = 0;
+
+    /// The value returned by SqlQueryFormatter::WindowFingerprint() before the window was read.
+    std::string fingerprint;
+
+    /// Number of chunk entries (`_00`, `_01`, ...) the window was written to.
+    std::size_t subChunks = 0;
+
+    /// Number of rows the window contained.
+    std::size_t rows = 0;
+};
+
+/// Window fingerprints keyed by table name.
+using WindowFingerprints = std::map<std::string, std::vector<WindowFingerprint>>;
+
+/// The primary-key grid a table's windows were cut from, as recorded in metadata.json: window `n`
+/// covers the keys [pkMin + n * width, pkMin + (n + 1) * width - 1], the last one ending at MAX(pk).
+struct WindowGrid
+{
+    /// Inclusive lower primary-key bound of window 0.
+    std::int64_t pkMin = 0;
+
+    /// Number of primary-key values per window.
+    std::int64_t width = 1;
+};
+
+/// Window grids keyed by table name.
+using WindowGrids = std::map<std::string, WindowGrid>;
+
+/// The compression adaptive compression chose for the chunk entries of one table.
+struct TableCompression
+{
+    /// The method of the table's chunk entries (Store if trial compression did not pay off).
+    CompressionMethod method = CompressionMethod::Store;
+
+    /// The level of the table's chunk entries.
+    std::uint32_t level = 0;
+
+    /// Compressed size of the trial sample at this method and level, relative to its uncompressed size.
+    double sampleRatio = 1.0;
+};
+
+/// Adaptive compression choices keyed by table name.
+using TableCompressions = std::map<std::string, TableCompression>;
+
 /// Creates the metadata JSON content.
 ///
 /// @param connectionString the connection string used to connect to the database.
 /// @param tables the list of tables to backup.
 /// @param schema the database schema used for these tables (optional).
+/// @param compactEncodings whether the chunks may use compact column encodings (format 1.1).
+/// @param windowFingerprints per-table window fingerprints to record (optional).
+/// @param tableCompressions per-table adaptive compression choices to record (optional).
+/// @param windowGrids per-table grids the fingerprinted windows were cut from (optional).
 LIGHTWEIGHT_API std::string CreateMetadata(SqlConnectionString const& connectionString,
                                            SqlSchema::TableList const& tables,
-                                           std::string const& schema = {});
+                                           std::string const& schema = {},
+                                           bool compactEncodings = false,
+                                           WindowFingerprints const& windowFingerprints = {},
+                                           TableCompressions const& tableCompressions = {},
+                                           WindowGrids const& windowGrids = {});
 
 /// Parses the metadata JSON content and returns a map of table info.
 ///
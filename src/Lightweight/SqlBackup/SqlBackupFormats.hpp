@@ -1,11 +1,14 @@
 // SPDX-License-Identifier: Apache-2.0
 #pragma once
 
+#include "../Api.hpp"
+
 #include <cstdint>
 #include <iostream>
 #include <memory>
 #include <span>
 #include <string>
+#include <string_view>
 #include <variant>
 #include <vector>
 
@@ -21,6 +24,35 @@ using BackupValue = std::variant<std::monostate, // NULL
                                  std::vector<uint8_t> // Binary
                                  >;
 
+/// @ingroup Backup
+/// One column of a block of rows, viewing values that are already laid out column by column (e.g. the
+/// bound buffers of a RowArrayCursor), see @ref ChunkWriter::WriteColumns.
+///
+/// Only the span matching @ref type is used; it and @ref nulls hold one element per row. Values of
+/// NULL rows are ignored. The views need only stay valid during the call they are passed to.
+struct BackupColumnBlock
+{
+    /// How the values of the column are stored.
+    enum class Type : std::uint8_t
+    {
+        Int64,  ///< in @ref int64Values
+        Bool,   ///< in @ref int64Values, non-zero meaning true
+        Double, ///< in @ref doubleValues
+        Text,   ///< in @ref textValues
+    };
+
+    /// How the values of the column are stored.
+    Type type = Type::Int64;
+    /// The values of an Int64 or Bool column.
+    std::span<int64_t const> int64Values;
+    /// The values of a Double column.
+    std::span<double const> doubleValues;
+    /// The values of a Text column.
+    std::span<std::string_view const> textValues;
+    /// Non-zero for each row whose value is NULL.
+    std::span<uint8_t const> nulls;
+};
+
 /// @ingroup Backup
 /// Represents a batch of backup data in column-oriented format.
 struct ColumnBatch
@@ -41,6 +73,24 @@ struct ColumnBatch
     /// Null indicators for each column, parallel to columns.
     std::vector<std::vector<bool>> nullIndicators; // Parallel to columns: true if NULL
 
+    /// Appends a single row, initializing the columns on the first row.
+    ///
+    /// Column types are inferred from the first non-NULL value and promoted to strings on a
+    /// mismatch, exactly as the chunk writer stores them, so a batch built here is pushed through
+    /// the restore insert path unchanged.
+    ///
+    /// @param row The row values, one per column.
+    LIGHTWEIGHT_API void AppendRow(std::span<BackupValue const> row);
+
+    /// Appends @p blockRows rows given column by column, initializing the columns on the first block.
+    ///
+    /// Stores exactly what AppendRow() would store for the same values, but appends whole typed
+    /// blocks instead of going through a BackupValue per cell.
+    ///
+    /// @param blocks    one block per column, each with @p blockRows rows.
+    /// @param blockRows the number of rows in each block.
+    LIGHTWEIGHT_API void AppendColumns(std::span<BackupColumnBlock const> blocks, size_t blockRows);
+
     /// Clears the internal buffer after a flush and releases memory.
     void Clear()
     {
@@ -82,6 +132,13 @@ struct ChunkWriter
     /// @param row The row data to write.
     virtual void WriteRow(std::span<BackupValue const> row) = 0;
 
+    /// Writes a block of rows given column by column (buffers it), producing the same chunk as
+    /// writing each of its rows with WriteRow().
+    ///
+    /// @param blocks   one block per column, each with @p rowCount rows.
+    /// @param rowCount the number of rows in each block.
+    virtual void WriteColumns(std::span<BackupColumnBlock const> blocks, size_t rowCount) = 0;
+
     /// Flushes any buffered data to the output.
     ///
     /// @return The formatted data chunk.
@@ -0,0 +1,254 @@
+// SPDX-License-Identifier: Apache-2.0
+#include "../TracyProfiler.hpp"
+#include "Common.hpp"
+#include "StreamArchive.hpp"
+
+#include <algorithm>
+#include <array>
+#include <format>
+#include <istream>
+#include <limits>
+#include <new>
+#include <ranges>
+#include <ostream>
+#include <stdexcept>
+#include <utility>
+
+#if defined(__clang__)
+    #pragma clang diagnostic push
+    #pragma clang diagnostic ignored "-Wnullability-extension"
+#endif
+#include <zip.h>
+#if defined(__clang__)
+    #pragma clang diagnostic pop
+#endif
+
+namespace Lightweight::SqlBackup::detail
+{
+
+namespace
+{
+    template <typename T>
+    void WriteLittleEndian(std::ostream& output, T value)
+    {
+        auto bytes = std::array<char, sizeof(T)> {};
+        for (auto const i: std::views::iota(0UZ, sizeof(T)))
+            bytes[i] = static_cast<char>((value >> (8 * i)) & 0xFF);
+        output.write(bytes.data(), static_cast<std::streamsize>(bytes.size()));
+    }
+
+    template <typename T>
+    [[nodiscard]] bool ReadLittleEndian(std::istream& input, T& value)
+    {
+        auto bytes = std::array<unsigned char, sizeof(T)> {};
+        if (!input.read(reinterpret_cast<char*>(bytes.data()), static_cast<std::streamsize>(bytes.size())))
+            return false;
+        value = 0;
+        for (auto const i: std::views::iota(0UZ, sizeof(T)))
+            value |= static_cast<T>(static_cast<T>(bytes[i]) << (8 * i));
+        return true;
+    }
+
+    [[nodiscard]] bool ReadString(std::istream& input, std::string& value, std::size_t size)
+    {
+        value.resize(size);
+        return size == 0 || input.read(value.data(), static_cast<std::streamsize>(size));
+    }
+} // namespace
+
+std::vector<std::uint8_t> CompressStreamEntry(std::string_view name,
+                                              std::string_view data,
+                                              CompressionMethod method,
+                                              std::uint32_t level)
+{
+    ZoneScopedN("Backup::CompressStreamEntry");
+    zip_error_t error;
+    zip_error_init(&error);
+    zip_source_t* buffer = zip_source_buffer_create(nullptr, 0, 0, &error);
+    if (!buffer)
+    {
+        zip_error_fini(&error);
+        throw std::bad_alloc();
+    }
+    zip_t* zip = zip_open_from_source(buffer, ZIP_TRUNCATE, &error);
+    if (!zip)
+    {
+        zip_source_free(buffer);
+        auto const message = std::string { zip_error_strerror(&error) };
+        zip_error_fini(&error);
+        throw std::runtime_error("Failed to create in-memory chunk archive: " + message);
+    }
+    zip_error_fini(&error);
+    // zip_close writes the finished archive into the buffer source; keep it alive to read it back.
+    zip_source_keep(buffer);
+
+    zip_source_t* entry = zip_source_buffer(zip, data.data(), data.size(), 0);
+    zip_int64_t const index =
+        entry ? zip_file_add(zip, std::string { name }.c_str(), entry, ZIP_FL_ENC_UTF_8) : zip_int64_t { -1 };
+    if (index < 0)
+    {
+        if (entry)
+            zip_source_free(entry);
+        zip_discard(zip);
+        zip_source_free(buffer);
+        throw std::runtime_error(std::format("Failed to add {} to its in-memory chunk archive", name));
+    }
+    zip_set_file_compression(zip, static_cast<zip_uint64_t>(index), static_cast<zip_int32_t>(method), level);
+    if (zip_close(zip) < 0)
+    {
+        zip_discard(zip);
+        zip_source_free(buffer);
+        throw std::runtime_error(std::format("Failed to compress {}", name));
+    }
+
+    zip_stat_t stat;
+    zip_stat_init(&stat);
+    if (zip_source_stat(buffer, &stat) < 0 || zip_source_open(buffer) < 0)
+    {
+        zip_source_free(buffer);
+        throw std::runtime_error(std::format("Failed to read the in-memory chunk archive of {}", name));
+    }
+    auto archive = std::vector<std::uint8_t>(stat.size);
+    auto const bytesRead = zip_source_read(buffer, archive.data(), archive.size());
+    zip_source_close(buffer);
+    zip_source_free(buffer);
+    if (bytesRead < 0 || std::cmp_not_equal(bytesRead, archive.size()))
+        throw std::runtime_error(std::format("Failed to read the in-memory chunk archive of {}", name));
+    return archive;
+}
+
+std::vector<std::uint8_t> DecompressStreamEntry(std::span<std::uint8_t const> payload)
+{
+    ZoneScopedN("Restore::DecompressStreamEntry");
+    zip_error_t error;
+    zip_error_init(&error);
+    zip_source_t* source = zip_source_buffer_create(payload.data(), payload.size(), 0, &error);
+    zip_t* zip = source ? zip_open_from_source(source, ZIP_RDONLY, &error) : nullptr;
+    zip_error_fini(&error);
+    if (!zip)
+    {
+        if (source)
+            zip_source_free(source);
+        throw std::runtime_error("Corrupt chunk frame in stream archive");
+    }
+
+    // zip_close also releases the buffer source, which zip_open_from_source took over.
+    zip_stat_t stat;
+    if (zip_get_num_entries(zip, 0) != 1 || zip_stat_index(zip, 0, 0, &stat) < 0)
+    {
+        zip_close(zip);
+        throw std::runtime_error("Corrupt chunk frame in stream archive");
+    }
+    auto content = ReadZipEntry<std::vector<std::uint8_t>>(zip, 0, stat.size);
+    zip_close(zip);
+    if (content.size() != stat.size)
+        throw std::runtime_error(std::format("Failed to decompress {} from stream archive", stat.name));
+    return content;
+}
+
+void WriteStreamArchiveMagic(std::ostream& output)
+{
+    output.write(StreamArchiveMagic.data(), static_cast<std::streamsize>(StreamArchiveMagic.size()));
+}
+
+void WriteStreamFrame(std::ostream& output, StreamFrame const& frame)
+{
+    if (frame.name.size() > std::numeric_limits<std::uint16_t>::max()
+        || frame.checksum.size() > std::numeric_limits<std::uint8_t>::max())
+        throw std::invalid_argument(std::format("Stream frame name or checksum too long: {}", frame.name));
+
+    output.put(static_cast<char>(frame.type));
+    WriteLittleEndian(output, static_cast<std::uint16_t>(frame.name.size()));
+    output.write(frame.name.data(), static_cast<std::streamsize>(frame.name.size()));
+    WriteLittleEndian(output, static_cast<std::uint8_t>(frame.checksum.size()));
+    output.write(frame.checksum.data(), static_cast<std::streamsize>(frame.checksum.size()));
+    WriteLittleEndian(output, static_cast<std::uint64_t>(frame.payload.size()));
+    output.write(reinterpret_cast<char const*>(frame.payload.data()), static_cast<std::streamsize>(frame.payload.size()));
+}
+
+bool ReadStreamArchiveMagic(std::istream& input)
+{
+    auto magic = std::string {};
+    return ReadString(input, magic, StreamArchiveMagic.size()) && magic == StreamArchiveMagic;
+}
+
+std::optional<StreamFrame> ReadStreamFrame(std::istream& input)
+{
+    auto const type = input.get();
+    if (type == std::istream::traits_type::eof())
+        return std::nullopt;
+
+    auto frame = StreamFrame {};
+    frame.type = static_cast<StreamFrameType>(type);
+    if (frame.type != StreamFrameType::Metadata && frame.type != StreamFrameType::Chunk
+        && frame.type != StreamFrameType::Index)
+        throw std::runtime_error(std::format("Corrupt stream archive: unknown frame type {}", type));
+
+    std::uint16_t nameSize = 0;
+    std::uint8_t checksumSize = 0;
+    std::uint64_t payloadSize = 0;
+    if (!ReadLittleEndian(input, nameSize) || !ReadString(input, frame.name, nameSize)
+        || !ReadLittleEndian(input, checksumSize) || !ReadString(input, frame.checksum, checksumSize)
+        || !ReadLittleEndian(input, payloadSize))
+        throw std::runtime_error("Truncated stream archive: incomplete frame header");
+    if (payloadSize > MaxStreamFramePayload)
+        throw std::runtime_error(std::format("Corrupt stream archive: frame {} claims {} bytes", frame.name, payloadSize));
+
+    frame.payload.resize(static_cast<std::size_t>(payloadSize));
+    if (payloadSize > 0
+        && !input.read(reinterpret_cast<char*>(frame.payload.data()), static_cast<std::streamsize>(payloadSize)))
+        throw std::runtime_error(std::format("Truncated stream archive: incomplete frame {}", frame.name));
+    return frame;
+}
+
+StreamArchiveWriter::StreamArchiveWriter(std::ostream& output, std::size_t queueCapacity):
+    m_output { output },
+    m_queue { std::max<std::size_t>(queueCapacity, 1) }
+{
+    WriteStreamArchiveMagic(m_output);
+    m_thread = std::thread { [this] { Run(); } };
+}
+
+StreamArchiveWriter::~StreamArchiveWriter() noexcept
+{
+    m_queue.MarkFinished();
+    if (m_thread.joinable())
+        m_thread.join();
+}
+
+void StreamArchiveWriter::Write(StreamFrame frame)
+{
+    if (m_failed.load() || !m_queue.Push(std::move(frame)))
+        throw std::runtime_error("Failed to write the backup stream");
+}
+
+void StreamArchiveWriter::Finish()
+{
+    m_queue.MarkFinished();
+    if (m_thread.joinable())
+        m_thread.join();
+    if (m_failed.load())
+        throw std::runtime_error("Failed to write the backup stream");
+}
+
+void StreamArchiveWriter::Run()
+{
+    TracySetThreadName("BackupStreamWriter");
+    auto frame = StreamFrame {};
+    while (m_queue.WaitAndPop(frame))
+    {
+        ZoneScopedN("Backup::WriteStreamFrame");
+        WriteStreamFrame(m_output, frame);
+        if (!m_output)
+        {
+            // Wakes producers blocked in Write(), which then report the failure.
+            m_failed.store(true);
+            m_queue.MarkFinished();
+            return;
+        }
+    }
+    if (!m_output.flush())
+        m_failed.store(true);
+}
+
+} // namespace Lightweight::SqlBackup::detail
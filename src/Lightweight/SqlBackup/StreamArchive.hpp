@@ -0,0 +1,134 @@
+// SPDX-License-Identifier: Apache-2.0
+#pragma once
+
+#include "../Api.hpp"
+#include "../ThreadSafeQueue.hpp"
+#include "SqlBackup.hpp"
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <iosfwd>
+#include <optional>
+#include <span>
+#include <string>
+#include <string_view>
+#include <thread>
+#include <vector>
+
+namespace Lightweight::SqlBackup::detail
+{
+
+/// Magic bytes a stream archive starts with.
+constexpr std::string_view StreamArchiveMagic = "LWBSTRM1";
+
+/// Upper bound of a frame payload accepted by ReadStreamFrame(), guarding against corrupt lengths.
+constexpr std::uint64_t MaxStreamFramePayload = std::uint64_t { 1 } << 32;
+
+/// Kind of a stream archive frame.
+enum class StreamFrameType : char
+{
+    Metadata = 'M', ///< metadata.json, uncompressed; always the first frame.
+    Chunk = 'C',    ///< One data chunk, compressed as a single-entry in-memory ZIP.
+    Index = 'I',    ///< checksums.json of every chunk, uncompressed; always the last frame.
+};
+
+/// One frame of a stream archive: a sequential, seek-free alternative to the ZIP container for
+/// backups written to pipes and read back from stdin (see docs/sql-backup-format.md).
+struct StreamFrame
+{
+    /// The frame kind.
+    StreamFrameType type = StreamFrameType::Chunk;
+
+    /// The entry name (`metadata.json`, `data/<table>/<window>_<sub>.msgpack`, `checksums.json`).
+    std::string name;
+
+    /// Checksum of the uncompressed chunk bytes (Chunk frames), so a reader can verify each chunk
+    /// before the trailing index has arrived. The Metadata frame carries the name of the checksum
+    /// algorithm here instead (empty means sha256).
+    std::string checksum;
+
+    /// The frame content.
+    std::vector<std::uint8_t> payload;
+};
+
+/// Compresses @p data into a single-entry in-memory ZIP named @p name (a Chunk frame payload).
+///
+/// @param name The entry name.
+/// @param data The uncompressed chunk bytes.
+/// @param method The compression method.
+/// @param level The compression level.
+/// @return The ZIP archive bytes.
+[[nodiscard]] LIGHTWEIGHT_API std::vector<std::uint8_t> CompressStreamEntry(std::string_view name,
+                                                                            std::string_view data,
+                                                                            CompressionMethod method,
+                                                                            std::uint32_t level);
+
+/// Decompresses a Chunk frame payload produced by CompressStreamEntry().
+///
+/// @param payload The ZIP archive bytes.
+/// @return The uncompressed chunk bytes.
+/// @throws std::runtime_error if the payload is not a readable single-entry ZIP.
+[[nodiscard]] LIGHTWEIGHT_API std::vector<std::uint8_t> DecompressStreamEntry(std::span<std::uint8_t const> payload);
+
+/// Writes the stream archive magic.
+LIGHTWEIGHT_API void WriteStreamArchiveMagic(std::ostream& output);
+
+/// Writes one frame: type, 16-bit name length, name, 8-bit checksum length, checksum, 64-bit
+/// payload length and payload, all integers little-endian.
+LIGHTWEIGHT_API void WriteStreamFrame(std::ostream& output, StreamFrame const& frame);
+
+/// Reads and checks the stream archive magic.
+///
+/// @return true if @p input starts with StreamArchiveMagic.
+[[nodiscard]] LIGHTWEIGHT_API bool ReadStreamArchiveMagic(std::istream& input);
+
+/// Reads the next frame.
+///
+/// @return The frame, or std::nullopt at the end of the input.
+/// @throws std::runtime_error on a truncated or malformed frame.
+[[nodiscard]] LIGHTWEIGHT_API std::optional<StreamFrame> ReadStreamFrame(std::istream& input);
+
+/// The single writer of a stream archive.
+///
+/// Backup workers compress their chunks themselves and hand the finished frames to Write(); one
+/// writer thread drains the bounded queue into the output, so frames are written whole and in
+/// order of completion, and a slow consumer (pipe, network) applies back-pressure to the workers
+/// instead of growing memory.
+class LIGHTWEIGHT_API StreamArchiveWriter
+{
+  public:
+    /// Writes the archive magic and starts the writer thread.
+    ///
+    /// @param output The output stream (opened in binary mode).
+    /// @param queueCapacity Frames that may wait for the writer before Write() blocks.
+    StreamArchiveWriter(std::ostream& output, std::size_t queueCapacity);
+
+    /// Stops the writer thread if Finish() was not called (error paths).
+    ~StreamArchiveWriter() noexcept;
+
+    StreamArchiveWriter(StreamArchiveWriter const&) = delete;
+    StreamArchiveWriter& operator=(StreamArchiveWriter const&) = delete;
+    StreamArchiveWriter(StreamArchiveWriter&&) = delete;
+    StreamArchiveWriter& operator=(StreamArchiveWriter&&) = delete;
+
+    /// Queues @p frame for writing; blocks while the queue is full.
+    ///
+    /// @throws std::runtime_error if writing the output has failed.
+    void Write(StreamFrame frame);
+
+    /// Writes all queued frames, flushes the output and stops the writer thread.
+    ///
+    /// @throws std::runtime_error if writing the output has failed.
+    void Finish();
+
+  private:
+    void Run();
+
+    std::ostream& m_output;
+    ThreadSafeQueue<StreamFrame> m_queue;
+    std::atomic<bool> m_failed { false };
+    std::thread m_thread;
+};
+
+} // namespace Lightweight::SqlBackup::detail
@@ -54,6 +54,14 @@ void WorkerChunkArchive::OpenNextArchive()
 }
 
 void WorkerChunkArchive::Add(std::string const& entryName, std::string_view data)
+{
+    Add(entryName, data, m_method, m_level);
+}
+
+void WorkerChunkArchive::Add(std::string const& entryName,
+                             std::string_view data,
+                             CompressionMethod method,
+                             std::uint32_t level)
 {
     if (m_current && m_currentInputBytes >= m_rotationBytes)
         Seal(); // compression of the filled archive runs here, in the worker thread
@@ -75,7 +83,7 @@ void WorkerChunkArchive::Add(std::string const& entryName, std::string_view data
         zip_source_free(source);
         throw std::runtime_error { std::format("Failed to add {} to worker chunk archive", entryName) };
     }
-    zip_set_file_compression(m_current, static_cast<zip_uint64_t>(index), static_cast<zip_int32_t>(m_method), m_level);
+    zip_set_file_compression(m_current, static_cast<zip_uint64_t>(index), static_cast<zip_int32_t>(method), level);
 
     m_currentInputBytes += data.size();
     m_currentNames.insert(entryName);
@@ -36,8 +36,8 @@ class LIGHTWEIGHT_API WorkerChunkArchive
     /// @param directory Existing temp directory the archives are created in.
     /// @param workerId Stable worker index, used in the archive file names.
     /// @param rotationBytes Uncompressed input bytes per archive before it is sealed (clamped to >= 1).
-    /// @param method Compression method applied to every entry.
-    /// @param level Compression level applied to every entry.
+    /// @param method Compression method of entries added without one.
+    /// @param level Compression level of entries added without one.
     WorkerChunkArchive(std::filesystem::path directory,
                        unsigned workerId,
                        std::size_t rotationBytes,
@@ -58,6 +58,14 @@ class LIGHTWEIGHT_API WorkerChunkArchive
     /// @param data The uncompressed chunk bytes.
     void Add(std::string const& entryName, std::string_view data);
 
+    /// Adds @p data under @p entryName like Add(), compressed with @p method at @p level instead of
+    /// the archive's defaults (adaptive compression chooses them per table).
+    /// @param entryName The final backup archive entry name (kept verbatim through the merge).
+    /// @param data The uncompressed chunk bytes.
+    /// @param method Compression method of this entry (kept through the raw-copy merge).
+    /// @param level Compression level of this entry.
+    void Add(std::string const& entryName, std::string_view data, CompressionMethod method, std::uint32_t level);
+
     /// Deletes @p entryName from the current archive if present there; otherwise records a
     /// tombstone so the finalize merge skips the name from earlier sealed archives.
     /// @param entryName The entry name to remove.
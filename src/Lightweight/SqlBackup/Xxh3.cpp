@@ -0,0 +1,321 @@
+// SPDX-License-Identifier: Apache-2.0
+#include "Sha256.hpp"
+#include "Xxh3.hpp"
+
+#include <array>
+#include <bit>
+#include <cstring>
+#include <ranges>
+
+#if defined(_MSC_VER) && defined(_M_X64) && !defined(__clang__)
+    #include <intrin.h>
+#endif
+
+namespace Lightweight::SqlBackup
+{
+
+namespace
+{
+    // Port of the scalar XXH3 reference code (xxhash.h, XXH3_128bits) for seed 0 and the default
+    // secret; the size classes and constants follow the reference implementation one to one.
+
+    constexpr std::uint64_t Prime32_1 = 0x9E3779B1U;
+    constexpr std::uint64_t Prime32_2 = 0x85EBCA77U;
+    constexpr std::uint64_t Prime32_3 = 0xC2B2AE3DU;
+    constexpr std::uint64_t Prime64_1 = 0x9E3779B185EBCA87ULL;
+    constexpr std::uint64_t Prime64_2 = 0xC2B2AE3D27D4EB4FULL;
+    constexpr std::uint64_t Prime64_3 = 0x165667B19E3779F9ULL;
+    constexpr std::uint64_t Prime64_4 = 0x85EBCA77C2B2AE63ULL;
+    constexpr std::uint64_t Prime64_5 = 0x27D4EB2F165667C5ULL;
+
+    constexpr std::size_t StripeLength = 64;
+    constexpr std::size_t SecretConsumeRate = 8;
+    constexpr std::size_t AccumulatorCount = StripeLength / sizeof(std::uint64_t);
+    constexpr std::size_t SecretMergeAccsStart = 11;
+    constexpr std::size_t SecretLastAccStart = 7;
+    constexpr std::size_t SecretSizeMin = 136;
+    constexpr std::size_t MidSizeMax = 240;
+
+    constexpr std::array<std::uint8_t, 192> DefaultSecret = {
+        0xb8, 0xfe, 0x6c, 0x39, 0x23, 0xa4, 0x4b, 0xbe, 0x7c, 0x01, 0x81, 0x2c, 0xf7, 0x21, 0xad, 0x1c,
+        0xde, 0xd4, 0x6d, 0xe9, 0x83, 0x90, 0x97, 0xdb, 0x72, 0x40, 0xa4, 0xa4, 0xb7, 0xb3, 0x67, 0x1f,
+        0xcb, 0x79, 0xe6, 0x4e, 0xcc, 0xc0, 0xe5, 0x78, 0x82, 0x5a, 0xd0, 0x7d, 0xcc, 0xff, 0x72, 0x21,
+        0xb8, 0x08, 0x46, 0x74, 0xf7, 0x43, 0x24, 0x8e, 0xe0, 0x35, 0x90, 0xe6, 0x81, 0x3a, 0x26, 0x4c,
+        0x3c, 0x28, 0x52, 0xbb, 0x91, 0xc3, 0x00, 0xcb, 0x88, 0xd0, 0x65, 0x8b, 0x1b, 0x53, 0x2e, 0xa3,
+        0x71, 0x64, 0x48, 0x97, 0xa2, 0x0d, 0xf9, 0x4e, 0x38, 0x19, 0xef, 0x46, 0xa9, 0xde, 0xac, 0xd8,
+        0xa8, 0xfa, 0x76, 0x3f, 0xe3, 0x9c, 0x34, 0x3f, 0xf9, 0xdc, 0xbb, 0xc7, 0xc7, 0x0b, 0x4f, 0x1d,
+        0x8a, 0x51, 0xe0, 0x4b, 0xcd, 0xb4, 0x59, 0x31, 0xc8, 0x9f, 0x7e, 0xc9, 0xd9, 0x78, 0x73, 0x64,
+        0xea, 0xc5, 0xac, 0x83, 0x34, 0xd3, 0xeb, 0xc3, 0xc5, 0x81, 0xa0, 0xff, 0xfa, 0x13, 0x63, 0xeb,
+        0x17, 0x0d, 0xdd, 0x51, 0xb7, 0xf0, 0xda, 0x49, 0xd3, 0x16, 0x55, 0x26, 0x29, 0xd4, 0x68, 0x9e,
+        0x2b, 0x16, 0xbe, 0x58, 0x7d, 0x47, 0xa1, 0xfc, 0x8f, 0xf8, 0xb8, 0xd1, 0x7a, 0xd0, 0x31, 0xce,
+        0x45, 0xcb, 0x3a, 0x8f, 0x95, 0x16, 0x04, 0x28, 0xaf, 0xd7, 0xfb, 0xca, 0xbb, 0x4b, 0x40, 0x7e,
+    };
+
+    struct Hash128
+    {
+        std::uint64_t low = 0;
+        std::uint64_t high = 0;
+    };
+
+    std::uint32_t Read32(std::uint8_t const* p) noexcept
+    {
+        std::uint32_t value = 0;
+        std::memcpy(&value, p, sizeof(value));
+        if constexpr (std::endian::native == std::endian::big)
+            value = std::byteswap(value);
+        return value;
+    }
+
+    std::uint64_t Read64(std::uint8_t const* p) noexcept
+    {
+        std::uint64_t value = 0;
+        std::memcpy(&value, p, sizeof(value));
+        if constexpr (std::endian::native == std::endian::big)
+            value = std::byteswap(value);
+        return value;
+    }
+
+    Hash128 Multiply64To128(std::uint64_t lhs, std::uint64_t rhs) noexcept
+    {
+#if defined(__SIZEOF_INT128__)
+        __extension__ using Uint128 = unsigned __int128;
+        auto const product = static_cast<Uint128>(lhs) * rhs;
+        return { .low = static_cast<std::uint64_t>(product), .high = static_cast<std::uint64_t>(product >> 64) };
+#elif defined(_MSC_VER) && defined(_M_X64) && !defined(__clang__)
+        Hash128 result;
+        result.low = _umul128(lhs, rhs, &result.high);
+        return result;
+#else
+        std::uint64_t const loLo = (lhs & 0xFFFFFFFF) * (rhs & 0xFFFFFFFF);
+        std::uint64_t const hiLo = (lhs >> 32) * (rhs & 0xFFFFFFFF);
+        std::uint64_t const loHi = (lhs & 0xFFFFFFFF) * (rhs >> 32);
+        std::uint64_t const hiHi = (lhs >> 32) * (rhs >> 32);
+        std::uint64_t const cross = (loLo >> 32) + (hiLo & 0xFFFFFFFF) + loHi;
+        return { .low = (cross << 32) | (loLo & 0xFFFFFFFF), .high = (hiLo >> 32) + (cross >> 32) + hiHi };
+#endif
+    }
+
+    std::uint64_t Multiply128Fold64(std::uint64_t lhs, std::uint64_t rhs) noexcept
+    {
+        auto const product = Multiply64To128(lhs, rhs);
+        return product.low ^ product.high;
+    }
+
+    constexpr std::uint64_t XorShift64(std::uint64_t value, int shift) noexcept
+    {
+        return value ^ (value >> shift);
+    }
+
+    constexpr std::uint64_t Xxh64Avalanche(std::uint64_t hash) noexcept
+    {
+        hash = XorShift64(hash, 33) * Prime64_2;
+        hash = XorShift64(hash, 29) * Prime64_3;
+        return XorShift64(hash, 32);
+    }
+
+    constexpr std::uint64_t Xxh3Avalanche(std::uint64_t hash) noexcept
+    {
+        hash = XorShift64(hash, 37) * 0x165667919E3779F9ULL;
+        return XorShift64(hash, 32);
+    }
+
+    Hash128 Hash1To3(std::uint8_t const* input, std::size_t len, std::uint8_t const* secret) noexcept
+    {
+        auto const c1 = static_cast<std::uint32_t>(input[0]);
+        auto const c2 = static_cast<std::uint32_t>(input[len >> 1]);
+        auto const c3 = static_cast<std::uint32_t>(input[len - 1]);
+        std::uint32_t const combinedLow = (c1 << 16) | (c2 << 24) | c3 | (static_cast<std::uint32_t>(len) << 8);
+        std::uint32_t const combinedHigh = std::rotl(std::byteswap(combinedLow), 13);
+        std::uint64_t const flipLow = Read32(secret) ^ Read32(secret + 4);
+        std::uint64_t const flipHigh = Read32(secret + 8) ^ Read32(secret + 12);
+        return { .low = Xxh64Avalanche(combinedLow ^ flipLow), .high = Xxh64Avalanche(combinedHigh ^ flipHigh) };
+    }
+
+    Hash128 Hash4To8(std::uint8_t const* input, std::size_t len, std::uint8_t const* secret) noexcept
+    {
+        std::uint64_t const inputLow = Read32(input);
+        std::uint64_t const inputHigh = Read32(input + len - 4);
+        std::uint64_t const flip = Read64(secret + 16) ^ Read64(secret + 24);
+        std::uint64_t const keyed = (inputLow + (inputHigh << 32)) ^ flip;
+
+        auto product = Multiply64To128(keyed, Prime64_1 + (static_cast<std::uint64_t>(len) << 2));
+        product.high += product.low << 1;
+        product.low ^= product.high >> 3;
+        product.low = XorShift64(product.low, 35) * 0x9FB21C651E98DF25ULL;
+        product.low = XorShift64(product.low, 28);
+        product.high = Xxh3Avalanche(product.high);
+        return product;
+    }
+
+    Hash128 Hash9To16(std::uint8_t const* input, std::size_t len, std::uint8_t const* secret) noexcept
+    {
+        std::uint64_t const flipLow = Read64(secret + 32) ^ Read64(secret + 40);
+        std::uint64_t const flipHigh = Read64(secret + 48) ^ Read64(secret + 56);
+        std::uint64_t const inputLow = Read64(input);
+        std::uint64_t inputHigh = Read64(input + len - 8);
+
+        auto product = Multiply64To128(inputLow ^ inputHigh ^ flipLow, Prime64_1);
+        product.low += static_cast<std::uint64_t>(len - 1) << 54;
+        inputHigh ^= flipHigh;
+        product.high += inputHigh + ((inputHigh & 0xFFFFFFFF) * (Prime32_2 - 1));
+        product.low ^= std::byteswap(product.high);
+
+        auto result = Multiply64To128(product.low, Prime64_2);
+        result.high += product.high * Prime64_2;
+        return { .low = Xxh3Avalanche(result.low), .high = Xxh3Avalanche(result.high) };
+    }
+
+    Hash128 Hash0To16(std::uint8_t const* input, std::size_t len, std::uint8_t const* secret) noexcept
+    {
+        if (len > 8)
+            return Hash9To16(input, len, secret);
+        if (len >= 4)
+            return Hash4To8(input, len, secret);
+        if (len > 0)
+            return Hash1To3(input, len, secret);
+        return { .low = Xxh64Avalanche(Read64(secret + 64) ^ Read64(secret + 72)),
+                 .high = Xxh64Avalanche(Read64(secret + 80) ^ Read64(secret + 88)) };
+    }
+
+    std::uint64_t Mix16(std::uint8_t const* input, std::uint8_t const* secret) noexcept
+    {
+        return Multiply128Fold64(Read64(input) ^ Read64(secret), Read64(input + 8) ^ Read64(secret + 8));
+    }
+
+    void Mix32(Hash128& acc, std::uint8_t const* input1, std::uint8_t const* input2, std::uint8_t const* secret) noexcept
+    {
+        acc.low += Mix16(input1, secret);
+        acc.low ^= Read64(input2) + Read64(input2 + 8);
+        acc.high += Mix16(input2, secret + 16);
+        acc.high ^= Read64(input1) + Read64(input1 + 8);
+    }
+
+    Hash128 FinalizeMid(Hash128 acc, std::size_t len) noexcept
+    {
+        return { .low = Xxh3Avalanche(acc.low + acc.high),
+                 .high = std::uint64_t { 0 }
+                         - Xxh3Avalanche((acc.low * Prime64_1) + (acc.high * Prime64_4)
+                                         + (static_cast<std::uint64_t>(len) * Prime64_2)) };
+    }
+
+    Hash128 Hash17To128(std::uint8_t const* input, std::size_t len, std::uint8_t const* secret) noexcept
+    {
+        auto acc = Hash128 { .low = len * Prime64_1, .high = 0 };
+        if (len > 32)
+        {
+            if (len > 64)
+            {
+                if (len > 96)
+                    Mix32(acc, input + 48, input + len - 64, secret + 96);
+                Mix32(acc, input + 32, input + len - 48, secret + 64);
+            }
+            Mix32(acc, input + 16, input + len - 32, secret + 32);
+        }
+        Mix32(acc, input, input + len - 16, secret);
+        return FinalizeMid(acc, len);
+    }
+
+    Hash128 Hash129To240(std::uint8_t const* input, std::size_t len, std::uint8_t const* secret) noexcept
+    {
+        constexpr std::size_t StartOffset = 3;
+        constexpr std::size_t LastOffset = 17;
+        std::size_t const rounds = len / 32;
+
+        auto acc = Hash128 { .low = len * Prime64_1, .high = 0 };
+        for (auto const i: std::views::iota(0UZ, 4UZ))
+            Mix32(acc, input + (32 * i), input + (32 * i) + 16, secret + (32 * i));
+        acc.low = Xxh3Avalanche(acc.low);
+        acc.high = Xxh3Avalanche(acc.high);
+        for (auto const i: std::views::iota(4UZ, rounds))
+            Mix32(acc, input + (32 * i), input + (32 * i) + 16, secret + StartOffset + (32 * (i - 4)));
+        Mix32(acc, input + len - 16, input + len - 32, secret + SecretSizeMin - LastOffset - 16);
+        return FinalizeMid(acc, len);
+    }
+
+    using Accumulators = std::array<std::uint64_t, AccumulatorCount>;
+
+    void Accumulate512(Accumulators& acc, std::uint8_t const* input, std::uint8_t const* secret) noexcept
+    {
+        for (auto const i: std::views::iota(0UZ, AccumulatorCount))
+        {
+            std::uint64_t const value = Read64(input + (8 * i));
+            std::uint64_t const key = value ^ Read64(secret + (8 * i));
+            acc[i ^ 1] += value;
+            acc[i] += (key & 0xFFFFFFFF) * (key >> 32);
+        }
+    }
+
+    void ScrambleAccumulators(Accumulators& acc, std::uint8_t const* secret) noexcept
+    {
+        for (auto const i: std::views::iota(0UZ, AccumulatorCount))
+            acc[i] = (XorShift64(acc[i], 47) ^ Read64(secret + (8 * i))) * Prime32_1;
+    }
+
+    std::uint64_t MergeAccumulators(Accumulators const& acc, std::uint8_t const* secret, std::uint64_t start) noexcept
+    {
+        std::uint64_t result = start;
+        for (auto const i: std::views::iota(0UZ, 4UZ))
+            result += Multiply128Fold64(acc[2 * i] ^ Read64(secret + (16 * i)),
+                                        acc[(2 * i) + 1] ^ Read64(secret + (16 * i) + 8));
+        return Xxh3Avalanche(result);
+    }
+
+    Hash128 HashLong(std::uint8_t const* input, std::size_t len) noexcept
+    {
+        auto const* secret = DefaultSecret.data();
+        constexpr std::size_t SecretSize = DefaultSecret.size();
+        constexpr std::size_t StripesPerBlock = (SecretSize - StripeLength) / SecretConsumeRate;
+        constexpr std::size_t BlockLength = StripeLength * StripesPerBlock;
+
+        auto acc = Accumulators { Prime32_3, Prime64_1, Prime64_2, Prime64_3,
+                                  Prime64_4, Prime32_2, Prime64_5, Prime32_1 };
+        std::size_t const blocks = (len - 1) / BlockLength;
+        for (auto const block: std::views::iota(0UZ, blocks))
+        {
+            auto const* blockInput = input + (block * BlockLength);
+            for (auto const stripe: std::views::iota(0UZ, StripesPerBlock))
+                Accumulate512(acc, blockInput + (stripe * StripeLength), secret + (stripe * SecretConsumeRate));
+            ScrambleAccumulators(acc, secret + SecretSize - StripeLength);
+        }
+
+        std::size_t const lastStripes = ((len - 1) - (blocks * BlockLength)) / StripeLength;
+        auto const* lastBlockInput = input + (blocks * BlockLength);
+        for (auto const stripe: std::views::iota(0UZ, lastStripes))
+            Accumulate512(acc, lastBlockInput + (stripe * StripeLength), secret + (stripe * SecretConsumeRate));
+        Accumulate512(acc, input + len - StripeLength, secret + SecretSize - StripeLength - SecretLastAccStart);
+
+        return { .low = MergeAccumulators(acc, secret + SecretMergeAccsStart, len * Prime64_1),
+                 .high = MergeAccumulators(
+                     acc, secret + SecretSize - sizeof(Accumulators) - SecretMergeAccsStart, ~(len * Prime64_2)) };
+    }
+
+    Hash128 Xxh3Hash128(std::uint8_t const* input, std::size_t len) noexcept
+    {
+        if (len <= 16)
+            return Hash0To16(input, len, DefaultSecret.data());
+        if (len <= 128)
+            return Hash17To128(input, len, DefaultSecret.data());
+        if (len <= MidSizeMax)
+            return Hash129To240(input, len, DefaultSecret.data());
+        return HashLong(input, len);
+    }
+} // namespace
+
+std::array<std::uint8_t, Xxh3::DigestSize> Xxh3::Digest(void const* data, std::size_t len) noexcept
+{
+    auto const hash = Xxh3Hash128(static_cast<std::uint8_t const*>(data), len);
+    std::array<std::uint8_t, DigestSize> digest {};
+    for (auto const i: std::views::iota(0UZ, 8UZ))
+    {
+        digest[i] = static_cast<std::uint8_t>(hash.high >> (56 - (8 * i)));
+        digest[8 + i] = static_cast<std::uint8_t>(hash.low >> (56 - (8 * i)));
+    }
+    return digest;
+}
+
+std::string Xxh3::Hash(void const* data, std::size_t len)
+{
+    return Sha256::ToHex(Digest(data, len));
+}
+
+} // namespace Lightweight::SqlBackup
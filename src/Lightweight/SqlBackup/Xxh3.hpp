@@ -0,0 +1,40 @@
+// SPDX-License-Identifier: Apache-2.0
+// XXH3 128-bit hash for fast chunk corruption checks
+#pragma once
+
+#include "../Api.hpp"
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <string_view>
+
+namespace Lightweight::SqlBackup
+{
+
+/// XXH3 128-bit hash (seed 0, default secret), as specified by the xxHash project.
+///
+/// A non-cryptographic alternative to Sha256 for backup checksums: it detects accidental
+/// corruption at memory bandwidth, but offers no protection against deliberate tampering.
+class Xxh3
+{
+  public:
+    /// The size of the XXH3-128 digest in bytes.
+    static constexpr std::size_t DigestSize = 16;
+
+    /// Computes the digest of the given data in canonical (big-endian, high half first) byte order.
+    [[nodiscard]] LIGHTWEIGHT_API static std::array<std::uint8_t, DigestSize> Digest(void const* data,
+                                                                                     std::size_t len) noexcept;
+
+    /// Computes the XXH3-128 hash of the given data and returns it as a hex string, as printed by `xxh128sum`.
+    [[nodiscard]] LIGHTWEIGHT_API static std::string Hash(void const* data, std::size_t len);
+
+    /// Computes the XXH3-128 hash of the given string and returns it as a hex string.
+    [[nodiscard]] static std::string Hash(std::string_view data)
+    {
+        return Hash(data.data(), data.size());
+    }
+};
+
+} // namespace Lightweight::SqlBackup
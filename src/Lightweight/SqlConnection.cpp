@@ -11,6 +11,7 @@
 
 #include <algorithm>
 #include <array>
+#include <charconv>
 #include <mutex>
 #include <optional>
 #include <stdexcept>
@@ -55,6 +56,10 @@ namespace
     constexpr SQLULEN SqlEncryptOff = 0;               // SQL_EN_OFF
     constexpr SQLULEN SqlEncryptOn = 1;                // SQL_EN_ON
 
+    // SQL_COPT_SS_BCP enables the bulk-copy (bcp_*) extensions; same header, same reasoning as above.
+    constexpr SQLINTEGER SqlCoptSsBcp = 1200 + 19; // SQL_COPT_SS_BASE + 19
+    constexpr SQLULEN SqlBcpOn = 1;                // SQL_BCP_ON
+
     /// Maps a SqlEncryptionMode onto the SQL_COPT_SS_ENCRYPT attribute value to set.
     ///
     /// @param mode The requested encryption mode.
@@ -90,6 +95,7 @@ struct SqlConnection::Data
     std::unique_ptr<Async::IAsyncBackend> asyncBackend;      // Async execution backend (null until EnableAsync()).
     std::size_t defaultPrefetchDepth = PrefetchDepthDefault; // Rows requested per SQLFetchScroll on the
                                                              // transparent per-row prefetch path (<= 1 disables).
+    bool bulkCopy = false; // Set SQL_COPT_SS_BCP before connecting (see SetBulkCopyEnabled()).
 };
 
 SqlConnection::SqlConnection():
@@ -216,6 +222,16 @@ void SqlConnection::SetDefaultPrefetchDepth(std::size_t depth) noexcept
     m_data->defaultPrefetchDepth = depth;
 }
 
+bool SqlConnection::BulkCopyEnabled() const noexcept
+{
+    return m_data->bulkCopy;
+}
+
+void SqlConnection::SetBulkCopyEnabled(bool enabled) noexcept
+{
+    m_data->bulkCopy = enabled;
+}
+
 void SqlConnection::EnableAsync(Async::IExecutor& dbWorkers, Async::IResumeScheduler& resume)
 {
     // TODO(async): once the native event backend lands, select it here via a per-connection
@@ -327,6 +343,17 @@ bool SqlConnection::Connect(SqlConnectionDataSource const& info) noexcept
             }
         }
 
+        if (m_data->bulkCopy)
+        {
+            // NOLINTNEXTLINE(performance-no-int-to-ptr)
+            sqlReturn = SQLSetConnectAttrW(m_hDbc, SqlCoptSsBcp, (SQLPOINTER) SqlBcpOn, SQL_IS_INTEGER);
+            if (!SQL_SUCCEEDED(sqlReturn))
+            {
+                SqlLogger::GetLogger().OnError(LastError());
+                return false;
+            }
+        }
+
         sqlReturn = SQLConnectW(m_hDbc,
                                 wDataSource.data(),
                                 wDataSource.length(),
@@ -393,6 +420,14 @@ bool SqlConnection::Connect(SqlConnectionString sqlConnectionString) noexcept
         // Serialize ODBC connection establishment to prevent data races in the ODBC driver
         // and OpenSSL during concurrent TLS handshakes (detected by ThreadSanitizer).
         std::scoped_lock const lock(gConnectionMutex);
+        if (m_data->bulkCopy)
+        {
+            // A pre-connect attribute, like SQL_COPT_SS_ENCRYPT in the data source overload.
+            // NOLINTNEXTLINE(performance-no-int-to-ptr)
+            sqlResult = SQLSetConnectAttrW(m_hDbc, SqlCoptSsBcp, (SQLPOINTER) SqlBcpOn, SQL_IS_INTEGER);
+            if (!SQL_SUCCEEDED(sqlResult))
+                return false;
+        }
         sqlResult = SQLDriverConnectW(m_hDbc,
                                       (SQLHWND) nullptr,
                                       wConnectionString.data(),
@@ -510,6 +545,33 @@ bool SqlConnection::RequiresTableRebuildForSchemaChange() const noexcept
     return QueryFormatter().RequiresTableRebuildForSchemaChange();
 }
 
+bool SqlConnection::SupportsInsertReturning() const noexcept
+{
+    switch (ServerType())
+    {
+        case SqlServerType::MICROSOFT_SQL:
+        case SqlServerType::POSTGRESQL:
+            return true;
+        case SqlServerType::SQLITE: {
+            // The driver reports the linked SQLite library version, e.g. "3.45.1". RETURNING arrived in 3.35.
+            auto const version = GetInfoStringW(m_hDbc, SQL_DBMS_VER);
+            unsigned major {};
+            unsigned minor {};
+            auto const* const end = version.data() + version.size();
+            auto const majorResult = std::from_chars(version.data(), end, major);
+            if (majorResult.ec != std::errc {} || majorResult.ptr == end || *majorResult.ptr != '.')
+                return false;
+            if (std::from_chars(majorResult.ptr + 1, end, minor).ec != std::errc {})
+                return false;
+            return major > 3 || (major == 3 && minor >= 35);
+        }
+        case SqlServerType::MYSQL:
+        case SqlServerType::UNKNOWN:
+            return false;
+    }
+    return false;
+}
+
 bool SqlConnection::TransactionActive() const noexcept
 {
     SQLUINTEGER state {};
@@ -182,6 +182,70 @@ class SqlConnection final
     /// @return `true` if the driver honours row-array fetching.
     [[nodiscard]] bool SupportsNativeRowArrayFetch() const noexcept;
 
+    /// @brief Whether this connection's ODBC driver executes a semicolon-separated batch of parameterized
+    /// SELECTs in one round-trip and exposes each statement's rows as its own result set
+    /// (walked with @c SQLMoreResults).
+    ///
+    /// @c DataMapper::QueryMany consults this to decide whether it may send independent queries as one
+    /// batch or must run them one after another. Only SQL Server qualifies: psqlODBC rejects
+    /// multi-statement batches under server-side prepare, and the SQLite driver returns just the first
+    /// result set.
+    ///
+    /// @return `true` if the driver returns one result set per statement of a batch.
+    [[nodiscard]] bool SupportsMultiResultBatch() const noexcept;
+
+    /// @brief Whether an INSERT on this connection can hand back generated values of the inserted row
+    /// as a result set (`RETURNING` / `OUTPUT INSERTED`, see @c SqlInsertQueryBuilder::Returning).
+    ///
+    /// @c DataMapper::CreateAllReturningIds consults this to read back server-generated primary keys
+    /// without a @c LastInsertId round-trip per row. SQL Server and PostgreSQL always qualify; SQLite
+    /// only from 3.35 on, so the library version reported by the driver is checked.
+    ///
+    /// @return `true` if `INSERT ... RETURNING` (or its SQL Server equivalent) is available.
+    [[nodiscard]] LIGHTWEIGHT_API bool SupportsInsertReturning() const noexcept;
+
+    /// @brief Whether executing an `INSERT ... OUTPUT INSERTED` statement over a parameter array yields
+    /// one result set per parameter set, in parameter-set order (walked with @c SQLMoreResults).
+    ///
+    /// @c SqlStatement::ExecuteBatchReturning consults this to decide whether the generated keys of a
+    /// whole batch can be read back from a single @c SQLExecute, or whether it must execute the
+    /// prepared statement once per row. Only the SQL Server driver documents this behaviour; psqlODBC
+    /// and the SQLite driver are not relied upon for it.
+    ///
+    /// @return `true` if a parameter-array execute returns one result set per row.
+    [[nodiscard]] bool SupportsBatchedReturning() const noexcept;
+
+    /// @brief Whether several connections can write to the database at the same time.
+    ///
+    /// Bulk writers (such as the backup restore) consult this to decide whether to insert over one
+    /// connection per worker, or to keep a single writing connection and use the other threads
+    /// for preparatory work only. SQLite serializes all writers on a database-wide lock, so
+    /// concurrent writer connections only queue up behind each other.
+    ///
+    /// @return `true` if concurrent writers make progress in parallel.
+    [[nodiscard]] bool SupportsConcurrentWriters() const noexcept;
+
+    /// @brief Whether the driver offers SQL Server's bulk-copy extensions (`bcp_init`, `bcp_sendrow`, ...).
+    ///
+    /// The extensions only work on a connection established with @ref SetBulkCopyEnabled, and are
+    /// exported by the driver library itself rather than by the driver manager, so a bulk writer
+    /// still has to look them up and fall back to ordinary inserts when they are missing.
+    ///
+    /// @return `true` if the backend's drivers implement the bulk-copy extensions.
+    [[nodiscard]] bool SupportsBulkCopy() const noexcept;
+
+    /// @brief Requests the bulk-copy extensions (`SQL_COPT_SS_BCP`) on the next @ref Connect.
+    ///
+    /// `SQL_COPT_SS_BCP` is a pre-connect attribute, so enabling it on a connected connection takes
+    /// effect on reconnect only. Only enable it once the server is known to be SQL Server (see
+    /// @ref SupportsBulkCopy); other drivers may refuse the attribute, which fails the connect.
+    ///
+    /// @param enabled Whether to request the bulk-copy extensions.
+    LIGHTWEIGHT_API void SetBulkCopyEnabled(bool enabled) noexcept;
+
+    /// @brief Whether @ref SetBulkCopyEnabled requested the bulk-copy extensions for this connection.
+    [[nodiscard]] LIGHTWEIGHT_API bool BulkCopyEnabled() const noexcept;
+
     /// @brief Server-type overload of @ref SupportsNativeRowArrayFetch, for callers that hold only the
     /// server type (e.g. the DataMapper result reader) and not the connection. Keeps the single source of
     /// truth for this capability on the connection rather than scattering a `switch (serverType)` into
@@ -203,6 +267,23 @@ class SqlConnection final
     /// @return `true` if narrow character data round-trips byte-exact on that backend.
     [[nodiscard]] static bool RoundTripsNarrowTextByteExact(SqlServerType serverType) noexcept;
 
+    /// @brief Whether @p serverType's driver binds @c SQL_C_GUID parameters natively.
+    ///
+    /// SQLite has no GUID type, so the GUID binders store GUIDs there as their 36-character text form.
+    ///
+    /// @param serverType The backend server type to test.
+    /// @return `true` if GUIDs bind as @c SQL_GUID, `false` if they bind as text.
+    [[nodiscard]] static bool BindsGuidNatively(SqlServerType serverType) noexcept;
+
+    /// @brief Whether @p serverType sorts GUIDs by their last six bytes first.
+    ///
+    /// SQL Server compares @c uniqueidentifier values starting at the end of the GUID; the other
+    /// backends compare GUIDs in their textual (RFC 9562) byte order.
+    ///
+    /// @param serverType The backend server type to test.
+    /// @return `true` if GUIDs sort SQL Server style, `false` if they sort in byte order.
+    [[nodiscard]] static bool SortsGuidsFromTheEnd(SqlServerType serverType) noexcept;
+
     /// @brief The default block-prefetch depth applied to statements created on this connection.
     ///
     /// Classic per-row fetch loops (`while (cursor.FetchRow()) ...`, @c SqlRowIterator,
@@ -392,6 +473,66 @@ inline bool SqlConnection::SupportsNativeRowArrayFetch() const noexcept
     return SupportsNativeRowArrayFetch(ServerType());
 }
 
+inline bool SqlConnection::SupportsMultiResultBatch() const noexcept
+{
+    switch (ServerType())
+    {
+        case SqlServerType::MICROSOFT_SQL:
+            return true;
+        case SqlServerType::POSTGRESQL:
+        case SqlServerType::SQLITE:
+        case SqlServerType::MYSQL:
+        case SqlServerType::UNKNOWN:
+            return false;
+    }
+    return false;
+}
+
+inline bool SqlConnection::SupportsConcurrentWriters() const noexcept
+{
+    switch (ServerType())
+    {
+        case SqlServerType::MICROSOFT_SQL:
+        case SqlServerType::POSTGRESQL:
+        case SqlServerType::MYSQL:
+            return true;
+        case SqlServerType::SQLITE:
+        case SqlServerType::UNKNOWN:
+            return false;
+    }
+    return false;
+}
+
+inline bool SqlConnection::SupportsBulkCopy() const noexcept
+{
+    switch (ServerType())
+    {
+        case SqlServerType::MICROSOFT_SQL:
+            return true;
+        case SqlServerType::POSTGRESQL:
+        case SqlServerType::SQLITE:
+        case SqlServerType::MYSQL:
+        case SqlServerType::UNKNOWN:
+            return false;
+    }
+    return false;
+}
+
+inline bool SqlConnection::SupportsBatchedReturning() const noexcept
+{
+    switch (ServerType())
+    {
+        case SqlServerType::MICROSOFT_SQL:
+            return true;
+        case SqlServerType::POSTGRESQL:
+        case SqlServerType::SQLITE:
+        case SqlServerType::MYSQL:
+        case SqlServerType::UNKNOWN:
+            return false;
+    }
+    return false;
+}
+
 inline bool SqlConnection::RoundTripsNarrowTextByteExact(SqlServerType serverType) noexcept
 {
     switch (serverType)
@@ -407,4 +548,34 @@ inline bool SqlConnection::RoundTripsNarrowTextByteExact(SqlServerType serverTyp
     return false;
 }
 
+inline bool SqlConnection::BindsGuidNatively(SqlServerType serverType) noexcept
+{
+    switch (serverType)
+    {
+        case SqlServerType::SQLITE:
+            return false;
+        case SqlServerType::MICROSOFT_SQL:
+        case SqlServerType::POSTGRESQL:
+        case SqlServerType::MYSQL:
+        case SqlServerType::UNKNOWN:
+            return true;
+    }
+    return true;
+}
+
+inline bool SqlConnection::SortsGuidsFromTheEnd(SqlServerType serverType) noexcept
+{
+    switch (serverType)
+    {
+        case SqlServerType::MICROSOFT_SQL:
+            return true;
+        case SqlServerType::POSTGRESQL:
+        case SqlServerType::SQLITE:
+        case SqlServerType::MYSQL:
+        case SqlServerType::UNKNOWN:
+            return false;
+    }
+    return false;
+}
+
 } // namespace Lightweight
@@ -7,6 +7,7 @@
 #include "../Utils.hpp"
 
 #include <algorithm>
+#include <bit>
 #include <concepts>
 #include <optional>
 #include <ranges>
@@ -109,6 +110,15 @@ namespace detail
         return output;
     }
 
+    /// Integral values that WhereInArray() can pass inside a single array parameter.
+    template <typename T>
+    concept SqlIntegerArrayElement =
+        std::integral<T> && !OneOf<T, bool, char, wchar_t, char8_t, char16_t, char32_t>;
+
+    /// Narrow strings that WhereInArray() can pass inside a single array parameter.
+    template <typename T>
+    concept SqlTextArrayElement = std::convertible_to<T const&, std::string_view>;
+
     template <typename T>
     std::string MakeEscapedSqlString(T const& value)
     {
@@ -281,6 +291,17 @@ class [[nodiscard]] SqlWhereClauseBuilder
     template <typename ColumnName, typename T>
     [[nodiscard]] Derived& WhereIn(ColumnName const& columnName, std::initializer_list<T> const& values);
 
+    /// @brief Constructs or extends a WHERE clause to test for a value in @p values, keeping the SQL text
+    /// independent of the number of values.
+    ///
+    /// With input bindings, a list of integers or narrow strings is bound as one array parameter via
+    /// SqlQueryFormatter::InArrayParameter (`= ANY(?)` on PostgreSQL, `OPENJSON(?)` on SQL Server,
+    /// `json_each(?)` on SQLite). Any other element type falls back to `IN (?, ...)` with the marker
+    /// count rounded up to the next power of two, the last value repeated, so that the statement text
+    /// only varies with the logarithm of the list length. Without input bindings this is WhereIn().
+    template <typename ColumnName, std::ranges::input_range InputRange>
+    [[nodiscard]] Derived& WhereInArray(ColumnName const& columnName, InputRange const& values);
+
     /// Constructs or extends an WHERE/OR clause to test for a value, satisfying a sub-select query.
     template <typename ColumnName, typename SubSelectQuery>
         requires(std::is_invocable_r_v<std::string, decltype(&SubSelectQuery::ToSql), SubSelectQuery const&>)
@@ -416,8 +437,10 @@ class [[nodiscard]] SqlWhereClauseBuilder
     template <typename LiteralType, typename TargetType>
     void PopulateLiteralValueInto(LiteralType const& value, TargetType& target);
 
+    /// Builds the `(…)` value list of an IN condition. With @p padToPowerOfTwo, bound lists get their
+    /// marker count rounded up to the next power of two by repeating the last value.
     template <typename LiteralType>
-    detail::RawSqlCondition PopulateSqlSetExpression(LiteralType const& values);
+    detail::RawSqlCondition PopulateSqlSetExpression(LiteralType const& values, bool padToPowerOfTwo = false);
 
     enum class JoinType : uint8_t
     {
@@ -706,6 +729,46 @@ inline LIGHTWEIGHT_FORCE_INLINE Derived& SqlWhereClauseBuilder<Derived>::WhereIn
     return Where(columnName, "IN", PopulateSqlSetExpression(values));
 }
 
+/// Constructs or extends a WHERE IN clause whose SQL text does not depend on the number of values.
+template <typename Derived>
+template <typename ColumnName, std::ranges::input_range InputRange>
+inline LIGHTWEIGHT_FORCE_INLINE Derived& SqlWhereClauseBuilder<Derived>::WhereInArray(ColumnName const& columnName,
+                                                                                      InputRange const& values)
+{
+    using ValueType = std::remove_cvref_t<std::ranges::range_value_t<InputRange>>;
+
+    if (std::ranges::empty(values))
+        return WhereRaw("1 = 0");
+
+    auto& searchCondition = SearchCondition();
+    if (!searchCondition.inputBindings)
+        return WhereIn(columnName, values);
+
+    if constexpr (detail::SqlIntegerArrayElement<ValueType> || detail::SqlTextArrayElement<ValueType>)
+    {
+        constexpr auto elementType =
+            detail::SqlIntegerArrayElement<ValueType> ? SqlArrayElementType::Integer : SqlArrayElementType::Text;
+
+        std::vector<std::string> elements;
+        if constexpr (std::ranges::sized_range<InputRange>)
+            elements.reserve(std::ranges::size(values));
+        for (auto const& value: values)
+        {
+            if constexpr (elementType == SqlArrayElementType::Integer)
+                elements.emplace_back(std::to_string(value));
+            else
+                elements.emplace_back(std::string_view { value });
+        }
+
+        AppendWhereJunctor();
+        searchCondition.condition += Formatter().InArrayParameter(detail::MakeSqlColumnName(columnName), elementType);
+        searchCondition.inputBindings->emplace_back(Formatter().ArrayParameterValue(elements, elementType));
+        return static_cast<Derived&>(*this);
+    }
+    else
+        return Where(columnName, "IN", PopulateSqlSetExpression(values, /*padToPowerOfTwo=*/true));
+}
+
 /// Constructs or extends a WHERE IN clause with a sub-select query.
 template <typename Derived>
 template <typename ColumnName, typename SubSelectQuery>
@@ -1142,7 +1205,8 @@ inline LIGHTWEIGHT_FORCE_INLINE void SqlWhereClauseBuilder<Derived>::PopulateLit
 
 template <typename Derived>
 template <typename LiteralType>
-detail::RawSqlCondition SqlWhereClauseBuilder<Derived>::PopulateSqlSetExpression(LiteralType const& values)
+detail::RawSqlCondition SqlWhereClauseBuilder<Derived>::PopulateSqlSetExpression(LiteralType const& values,
+                                                                                 bool padToPowerOfTwo)
 {
     using namespace std::string_view_literals;
 
@@ -1189,6 +1253,7 @@ detail::RawSqlCondition SqlWhereClauseBuilder<Derived>::PopulateSqlSetExpression
         fragment << valueString;
     };
 
+    std::size_t count = 0;
     fragment << '(';
 #if !defined(__cpp_lib_ranges_enumerate)
     int index { -1 };
@@ -1203,6 +1268,21 @@ detail::RawSqlCondition SqlWhereClauseBuilder<Derived>::PopulateSqlSetExpression
             fragment << ", "sv;
 
         appendValue(value);
+        ++count;
+    }
+    if constexpr (isBindable)
+    {
+        if (padToPowerOfTwo && searchCondition.inputBindings && !searchCondition.inputBindings->empty())
+        {
+            // Repeating a value does not change the outcome of IN, but collapses all list lengths
+            // within a bucket onto the same statement text.
+            auto const last = searchCondition.inputBindings->back();
+            for ([[maybe_unused]] auto const _: std::views::iota(count, std::bit_ceil(count)))
+            {
+                fragment << ", ?"sv;
+                searchCondition.inputBindings->emplace_back(last);
+            }
+        }
     }
     fragment << ')';
     return detail::RawSqlCondition { fragment.str() };
@@ -32,6 +32,10 @@ class [[nodiscard]] SqlInsertQueryBuilder final
     template <std::size_t N>
     inline SqlInsertQueryBuilder& Set(std::string_view columnName, char const (&value)[N]);
 
+    /// Makes the INSERT yield the inserted value of @p columnName as a one-column result set
+    /// (e.g. a server-generated primary key), via the dialect's `RETURNING` / `OUTPUT INSERTED` clause.
+    inline SqlInsertQueryBuilder& Returning(std::string_view columnName);
+
     /// Finalizes building the query as INSERT INTO ... query.
     [[nodiscard]] inline std::string ToSql() const;
 
@@ -40,6 +44,7 @@ class [[nodiscard]] SqlInsertQueryBuilder final
     std::string m_tableName;
     std::string m_fields;
     std::string m_values;
+    std::string m_returningColumn;
     std::vector<SqlVariant>* m_inputBindings;
 };
 
@@ -101,8 +106,16 @@ inline SqlInsertQueryBuilder& SqlInsertQueryBuilder::Set(std::string_view column
     return Set(columnName, std::string_view { value, N - 1 });
 }
 
+inline SqlInsertQueryBuilder& SqlInsertQueryBuilder::Returning(std::string_view columnName)
+{
+    m_returningColumn = columnName;
+    return *this;
+}
+
 inline std::string SqlInsertQueryBuilder::ToSql() const
 {
+    if (!m_returningColumn.empty())
+        return m_formatter.InsertReturning(m_tableName, m_fields, m_values, m_returningColumn);
     return m_formatter.Insert(m_tableName, m_fields, m_values);
 }
 
@@ -22,6 +22,44 @@ std::string SqlQueryFormatter::FormatTableName(std::string_view schema, std::str
     return std::format(R"("{}"."{}")", schema, table);
 }
 
+std::string SqlQueryFormatter::JsonArrayLiteral(std::span<std::string const> elements, SqlArrayElementType elementType)
+{
+    std::string result;
+    result += '[';
+    for (auto const& element: elements)
+    {
+        if (result.size() > 1)
+            result += ',';
+        if (elementType == SqlArrayElementType::Integer)
+        {
+            result += element;
+            continue;
+        }
+        result += '"';
+        for (char const ch: element)
+        {
+            switch (ch)
+            {
+                case '"':
+                    result += R"(\")"sv;
+                    break;
+                case '\\':
+                    result += R"(\\)"sv;
+                    break;
+                default:
+                    if (static_cast<unsigned char>(ch) < 0x20)
+                        result += std::format("\\u{:04x}", static_cast<unsigned>(ch));
+                    else
+                        result += ch;
+                    break;
+            }
+        }
+        result += '"';
+    }
+    result += ']';
+    return result;
+}
+
 SqlQueryFormatter const& SqlQueryFormatter::Sqlite()
 {
     static SQLiteQueryFormatter const formatter {};
@@ -7,6 +7,8 @@
 #include "SqlQuery/MigrationPlan.hpp"
 #include "SqlServerType.hpp"
 
+#include <cstdint>
+#include <span>
 #include <string>
 #include <string_view>
 
@@ -15,6 +17,26 @@ namespace Lightweight
 
 class SqlAdvisoryLockHandler;
 
+/// Element type of a value list that is bound as a single array parameter.
+///
+/// @see SqlQueryFormatter::InArrayParameter
+enum class SqlArrayElementType : uint8_t
+{
+    /// Integral values, passed as decimal numbers.
+    Integer,
+    /// Character strings.
+    Text,
+};
+
+/// A column of the table passed to SqlQueryFormatter::WindowFingerprint.
+struct SqlFingerprintColumn
+{
+    /// The column name.
+    std::string_view name;
+    /// The column type as the server names it (e.g. `ntext`), see SqlSchema::Column::dialectDependantTypeString.
+    std::string_view nativeType;
+};
+
 /// API to format SQL queries for different SQL dialects.
 class [[nodiscard]] LIGHTWEIGHT_API SqlQueryFormatter
 {
@@ -69,6 +91,38 @@ class [[nodiscard]] LIGHTWEIGHT_API SqlQueryFormatter
                                              std::string_view fields,
                                              std::string_view values) const = 0;
 
+    /// Constructs an SQL INSERT query that yields the value of @p returningColumn for the inserted row
+    /// as a one-column result set (`RETURNING` on PostgreSQL/SQLite, `OUTPUT INSERTED` on SQL Server).
+    ///
+    /// @param intoTable The table to insert into.
+    /// @param fields The fields to insert into.
+    /// @param values The values to insert.
+    /// @param returningColumn The (unquoted) column whose inserted value is returned, e.g. the primary key.
+    [[nodiscard]] virtual std::string InsertReturning(std::string_view intoTable,
+                                                      std::string_view fields,
+                                                      std::string_view values,
+                                                      std::string_view returningColumn) const = 0;
+
+    /// Constructs a condition testing @p columnName for membership in a list of values that is bound
+    /// as the single parameter marker of the condition, e.g. `"id" = ANY(CAST(? AS BIGINT[]))`.
+    ///
+    /// Unlike an expanded `IN (?, ?, ...)`, the SQL text does not depend on the length of the list,
+    /// so every list shares one server-side plan and one prepared statement, and long lists are not
+    /// subject to the backend's limit on the number of parameters.
+    ///
+    /// @param columnName The already quoted (and possibly table-qualified) column name.
+    /// @param elementType The type of the list elements.
+    /// @see ArrayParameterValue
+    [[nodiscard]] virtual std::string InArrayParameter(std::string_view columnName,
+                                                       SqlArrayElementType elementType) const = 0;
+
+    /// Encodes @p elements as the value to bind to the parameter marker of @ref InArrayParameter.
+    ///
+    /// @param elements The list elements in their textual form (decimal digits for integers).
+    /// @param elementType The type of the list elements.
+    [[nodiscard]] virtual std::string ArrayParameterValue(std::span<std::string const> elements,
+                                                          SqlArrayElementType elementType) const = 0;
+
     /// Retrieves the last insert ID of the given table.
     [[nodiscard]] virtual std::string QueryLastInsertId(std::string_view tableName) const = 0;
 
@@ -251,6 +305,61 @@ class [[nodiscard]] LIGHTWEIGHT_API SqlQueryFormatter
         return {};
     }
 
+    /// @brief Returns a query that fingerprints the rows of `table` whose `pkColumn` lies in the
+    /// closed window [`lo`, `hi`], computed entirely on the server.
+    ///
+    /// The query yields a single text value that changes whenever a row of the window is inserted,
+    /// deleted or updated, so incremental backups can skip re-fetching unchanged windows.
+    /// SQL Server combines `COUNT_BIG(*)` with `CHECKSUM_AGG(BINARY_CHECKSUM(*))`, and hashes the
+    /// xml, text, ntext and image columns `BINARY_CHECKSUM` skips with `HASHBYTES`; PostgreSQL
+    /// hashes the key-ordered row texts with `md5(string_agg(...))`.
+    ///
+    /// Returns an empty string when the dialect has no suitable server-side aggregate (SQLite).
+    /// Callers must then treat every window as changed.
+    ///
+    /// @param columns All columns of `table`, for dialects whose row checksum does not cover every type.
+    [[nodiscard]] virtual std::string WindowFingerprint(std::string_view schema,
+                                                        std::string_view table,
+                                                        std::string_view pkColumn,
+                                                        int64_t lo,
+                                                        int64_t hi,
+                                                        std::span<SqlFingerprintColumn const> columns) const
+    {
+        (void) schema;
+        (void) table;
+        (void) pkColumn;
+        (void) lo;
+        (void) hi;
+        (void) columns;
+        return {};
+    }
+
+    /// @brief Returns how many parameters a bulk writer may bind to one multi-row
+    /// `INSERT ... VALUES (...), (...)` statement, or 0 to insert through parameter arrays instead.
+    ///
+    /// Drivers that execute a parameter array as one statement per row make the server plan and
+    /// run every row on its own; packing many rows into one statement avoids that. ODBC counts
+    /// parameters in a SQLSMALLINT, so the limit never exceeds 32767.
+    [[nodiscard]] virtual std::size_t MultiRowInsertParameterLimit() const noexcept
+    {
+        return 0;
+    }
+
+    /// @brief Returns the statements that tune a connection for a bulk import during which it is
+    /// the only connection writing to the database, executed before its first insert.
+    ///
+    /// Returns an empty list when the dialect needs no session tuning. SQLite drops the rollback
+    /// journal and fsyncs and holds the database lock for the rest of the session, so a failed
+    /// import leaves the database unusable; callers must only use this on a database they
+    /// recreate anyway, and close the connection afterwards to release the lock.
+    ///
+    /// @param cacheSizeKB Page cache size for the session (0 = keep the default).
+    [[nodiscard]] virtual StringList SingleWriterImportSettings(std::size_t cacheSizeKB) const
+    {
+        (void) cacheSizeKB;
+        return {};
+    }
+
     /// @brief Returns the dialect-specific handler used by `SqlScopedLock` to
     /// acquire and release named cross-process advisory locks.
     ///
@@ -265,6 +374,9 @@ class [[nodiscard]] LIGHTWEIGHT_API SqlQueryFormatter
   protected:
     /// Formats a table name with optional schema prefix.
     static std::string FormatTableName(std::string_view schema, std::string_view table);
+
+    /// Encodes @p elements as a JSON array, quoting and escaping them if they are text.
+    static std::string JsonArrayLiteral(std::span<std::string const> elements, SqlArrayElementType elementType);
 };
 
 } // namespace Lightweight
@@ -1,5 +1,7 @@
 // SPDX-License-Identifier: Apache-2.0
 
+#include "Async/Backend.hpp"
+#include "Async/Generator.hpp"
 #include "DataBinder/SqlRawColumn.hpp"
 #include "DataBinder/UnicodeConverter.hpp"
 #include "SqlOdbcWide.hpp"
@@ -15,9 +17,17 @@
 #include <deque>
 #include <format>
 #include <functional>
+#include <istream>
 #include <limits>
 #include <memory>
+#include <optional>
+#include <ostream>
+#include <ranges>
+#include <span>
 #include <stdexcept>
+#include <stop_token>
+#include <string>
+#include <string_view>
 #include <utility>
 #include <vector>
 
@@ -53,6 +63,16 @@ struct SqlStatement::Data
     bool prefetchBindingUnsupported = false;                  // a bound output column's target type cannot be served
                                                               // from the block buffer, so the set keeps the per-row path
 
+    /// A parameter bound by BindInputStream(); its address is the token SQLParamData() hands back.
+    struct InputStream
+    {
+        SqlLobChunkSource source;
+        SQLLEN indicator {};
+        bool wideText = false;   // UTF-8 text sent as UTF-16 (SQL_C_WCHAR)
+        std::string pendingText; // wideText: the start of a UTF-8 sequence the last chunk cut off
+    };
+    std::deque<InputStream> inputStreams; // the data-at-execution parameters of the next Execute()
+
     static Data const NoData;
 };
 
@@ -84,6 +104,22 @@ namespace
         std::memcpy(static_cast<void*>(&ptr), &value, sizeof(value));
         return ptr;
     }
+
+    /// Returns the length of @p text without a UTF-8 sequence cut off at its end.
+    [[nodiscard]] std::size_t CompleteUtf8Length(std::string_view text) noexcept
+    {
+        // A sequence is at most 4 bytes long: look for its lead byte among the last 4.
+        auto const positions =
+            std::views::iota(text.size() - (std::min) (text.size(), std::size_t { 4 }), text.size()) | std::views::reverse;
+        auto const lead = std::ranges::find_if(
+            positions, [&](std::size_t i) { return (static_cast<unsigned char>(text[i]) & 0xC0) != 0x80; });
+        if (lead == positions.end())
+            return text.size(); // not UTF-8; passed on as is
+
+        auto const leadByte = static_cast<unsigned char>(text[*lead]);
+        auto const sequenceLength = leadByte < 0xC0 ? 1UZ : leadByte < 0xE0 ? 2UZ : leadByte < 0xF0 ? 3UZ : 4UZ;
+        return *lead + sequenceLength > text.size() ? *lead : text.size();
+    }
 } // namespace
 
 void SqlStatement::RequireIndicators()
@@ -230,7 +266,8 @@ SqlStatement::SqlStatement(SqlStatement&& other) noexcept:
     m_connection { other.m_connection },
     m_hStmt { other.m_hStmt },
     m_preparedQuery { std::move(other.m_preparedQuery) },
-    m_expectedParameterCount { other.m_expectedParameterCount }
+    m_expectedParameterCount { other.m_expectedParameterCount },
+    m_keepPendingResultSets { other.m_keepPendingResultSets }
 {
     other.m_data.reset();
     other.m_connection = nullptr;
@@ -247,6 +284,7 @@ SqlStatement& SqlStatement::operator=(SqlStatement&& other) noexcept
     m_hStmt = other.m_hStmt;
     m_preparedQuery = std::move(other.m_preparedQuery);
     m_expectedParameterCount = other.m_expectedParameterCount;
+    m_keepPendingResultSets = other.m_keepPendingResultSets;
 
     other.m_data.reset();
     other.m_connection = nullptr;
@@ -297,6 +335,7 @@ void SqlStatement::Prepare(std::string_view query) &
     m_data->postExecuteCallbacks.clear();
     m_data->postProcessOutputColumnCallbacks.clear();
     m_data->inputIndicators.clear();
+    m_data->inputStreams.clear();
     m_data->batchIndicators.clear();
     m_data->batchStagingBuffers.clear();
 
@@ -321,6 +360,27 @@ void SqlStatement::Prepare(std::string_view query) &
     m_data->indicators.resize(static_cast<size_t>(m_expectedParameterCount) + 1);
 }
 
+void SqlStatement::PrepareIfChanged(std::string_view query) &
+{
+    if (m_preparedQuery != query)
+    {
+        Prepare(query);
+        return;
+    }
+
+    ZoneScopedN("SqlStatement::PrepareIfChanged");
+
+    m_data->postExecuteCallbacks.clear();
+    m_data->postProcessOutputColumnCallbacks.clear();
+    m_data->inputIndicators.clear();
+    m_data->inputStreams.clear();
+
+    RequireSuccess(SQLFreeStmt(m_hStmt, SQL_UNBIND));
+
+    // BindInputParameter() forgets the expected count; restore it for a subsequent Execute(args...).
+    RequireSuccess(SQLNumParams(m_hStmt, &m_expectedParameterCount));
+}
+
 SqlResultCursor SqlStatement::ExecuteDirect(std::string_view const& query, std::source_location location)
 {
     ZoneScopedN("SqlStatement::ExecuteDirect");
@@ -334,6 +394,7 @@ SqlResultCursor SqlStatement::ExecuteDirect(std::string_view const& query, std::
     RequireSuccess(SQLFreeStmt(m_hStmt, SQL_UNBIND));
 
     m_data->inputIndicators.clear();
+    m_data->inputStreams.clear();
     m_data->batchIndicators.clear();
 
     SqlLogger::GetLogger().OnExecuteDirect(query);
@@ -372,13 +433,190 @@ SqlResultCursor SqlStatement::ExecuteWithVariants(std::vector<SqlVariant> const&
         SqlDataBinder<SqlVariant>::InputParameter(m_hStmt, static_cast<SQLUSMALLINT>(1 + i), arg, *this);
     }
 
-    auto const rc = SQLExecute(m_hStmt);
+    auto rc = SQLExecute(m_hStmt);
+    if (rc == SQL_NEED_DATA)
+        rc = SendInputStreams(rc);
     if (rc != SQL_NO_DATA)
         RequireSuccess(rc);
     ProcessPostExecuteCallbacks();
     return SqlResultCursor { *this };
 }
 
+void SqlStatement::BindInputStream(SQLSMALLINT columnIndex,
+                                   SqlLobType type,
+                                   SqlLobChunkSource source,
+                                   std::optional<std::size_t> totalSize)
+{
+    // Drivers that narrow SQL_C_CHAR to the client codepage get the text as UTF-16, like the string binders.
+    auto const isText = type == SqlLobType::Text;
+    auto const wideText = isText && !SqlConnection::RoundTripsNarrowTextByteExact(ServerType());
+    auto& stream = m_data->inputStreams.emplace_back(
+        Data::InputStream { .source = std::move(source), .wideText = wideText });
+    // The UTF-16 size of transcoded text is only known once it is sent.
+    stream.indicator =
+        totalSize && !wideText ? SQL_LEN_DATA_AT_EXEC(static_cast<SQLLEN>(*totalSize)) : SQL_DATA_AT_EXEC;
+
+    RequireSuccess(SQLBindParameter(m_hStmt,
+                                    static_cast<SQLUSMALLINT>(columnIndex),
+                                    SQL_PARAM_INPUT,
+                                    wideText ? SQL_C_WCHAR : isText ? SQL_C_CHAR : SQL_C_BINARY,
+                                    wideText ? SQL_WLONGVARCHAR : isText ? SQL_LONGVARCHAR : SQL_LONGVARBINARY,
+                                    totalSize.value_or(0),
+                                    0,
+                                    &stream, // handed back by SQLParamData() when the value is due
+                                    0,
+                                    &stream.indicator));
+
+    // Like BindInputParameter(), this switches Execute() to not take any arguments.
+    m_expectedParameterCount = (std::numeric_limits<decltype(m_expectedParameterCount)>::max)();
+}
+
+void SqlStatement::BindInputStream(SQLSMALLINT columnIndex,
+                                   SqlLobType type,
+                                   std::istream& input,
+                                   std::optional<std::size_t> totalSize)
+{
+    BindInputStream(
+        columnIndex,
+        type,
+        [&input](std::span<std::byte> buffer) -> std::size_t {
+            input.read(reinterpret_cast<char*>(buffer.data()), static_cast<std::streamsize>(buffer.size()));
+            return static_cast<std::size_t>(input.gcount());
+        },
+        totalSize);
+}
+
+SQLRETURN SqlStatement::SendInputStreams(SQLRETURN result)
+{
+    ZoneScopedN("SqlStatement::SendInputStreams");
+
+    auto buffer = std::vector<std::byte>(DefaultLobChunkSize);
+    while (result == SQL_NEED_DATA)
+    {
+        SQLPOINTER token = nullptr;
+        result = SQLParamData(m_hStmt, &token);
+        if (result != SQL_NEED_DATA)
+            break;
+
+        auto& stream = *static_cast<Data::InputStream*>(token);
+        auto sentAny = false;
+        auto const putWideText = [&](std::string_view utf8) {
+            if (utf8.empty())
+                return;
+            auto utf16 = OdbcUtf8ToUtf16(utf8);
+            RequireSuccess(SQLPutData(m_hStmt, utf16.data(), static_cast<SQLLEN>(utf16.size() * sizeof(char16_t))));
+            sentAny = true;
+        };
+        while (auto const count = stream.source(buffer))
+        {
+            if (!stream.wideText)
+            {
+                RequireSuccess(SQLPutData(m_hStmt, buffer.data(), static_cast<SQLLEN>(count)));
+                sentAny = true;
+                continue;
+            }
+            // A chunk may end inside a UTF-8 sequence; its start waits for the rest in the next chunk.
+            stream.pendingText.append(reinterpret_cast<char const*>(buffer.data()), count);
+            auto const complete = CompleteUtf8Length(stream.pendingText);
+            putWideText(std::string_view { stream.pendingText }.substr(0, complete));
+            stream.pendingText.erase(0, complete);
+        }
+        // Text ending inside a sequence is malformed; the converter decides what is left of it.
+        putWideText(std::exchange(stream.pendingText, {}));
+        // An empty value still has to be sent, or the driver keeps waiting for it.
+        if (!sentAny)
+            RequireSuccess(SQLPutData(m_hStmt, buffer.data(), 0));
+    }
+    return result;
+}
+
+bool SqlStatement::ReadColumnChunks(SQLUSMALLINT column,
+                                    SqlLobType type,
+                                    std::span<std::byte> buffer,
+                                    SqlLobChunkConsumer const& consumer)
+{
+    ZoneScopedN("SqlStatement::ReadColumnChunks");
+
+    // Block-prefetched rows were already materialized; hand out the cell in buffer-sized slices.
+    if (IsPrefetchActive())
+    {
+        auto const value = GetNullableColumn<std::string>(column);
+        if (!value)
+            return false;
+        for (auto const chunk: std::as_bytes(std::span { *value }) | std::views::chunk(buffer.size()))
+            consumer(std::span<std::byte const> { chunk });
+        return true;
+    }
+
+    // psqlODBC narrows SQL_C_CHAR to the client codepage, so there text is read as UTF-16 and
+    // converted chunk by chunk, as the string binders do.
+    auto const wideText = type == SqlLobType::Text && !SqlConnection::RoundTripsNarrowTextByteExact(ServerType());
+    SQLSMALLINT const cType = type == SqlLobType::Binary ? SQL_C_BINARY : wideText ? SQL_C_WCHAR : SQL_C_CHAR;
+    auto const terminatorSize = type == SqlLobType::Binary ? std::size_t { 0 }
+                                : wideText                 ? sizeof(char16_t)
+                                                           : sizeof(char);
+    if (buffer.size() <= terminatorSize + 1)
+        throw std::invalid_argument { "LOB chunk buffer is too small" };
+
+    // The UTF-16 unit a chunk ended with, if it is the first half of a surrogate pair.
+    auto pendingHighSurrogate = std::optional<char16_t> {};
+    auto const deliver = [&](std::size_t count) {
+        if (!wideText)
+        {
+            consumer(buffer.first(count));
+            return;
+        }
+        auto text = std::u16string {};
+        text.reserve((count / sizeof(char16_t)) + 1);
+        if (pendingHighSurrogate)
+            text += *std::exchange(pendingHighSurrogate, std::nullopt);
+        text.append(reinterpret_cast<char16_t const*>(buffer.data()), count / sizeof(char16_t));
+        if (!text.empty() && text.back() >= 0xD800 && text.back() <= 0xDBFF)
+        {
+            pendingHighSurrogate = text.back();
+            text.pop_back();
+        }
+        auto const utf8 = ToUtf8(text);
+        consumer(std::as_bytes(std::span { utf8 }));
+    };
+
+    // Keep whole UTF-16 units per chunk.
+    auto const bufferSize = wideText ? buffer.size() & ~std::size_t { 1 } : buffer.size();
+    while (true)
+    {
+        SQLLEN indicator {};
+        auto const rc = SQLGetData(m_hStmt, column, cType, buffer.data(), static_cast<SQLLEN>(bufferSize), &indicator);
+        if (rc == SQL_NO_DATA)
+            break;
+        RequireSuccess(rc);
+        if (indicator == SQL_NULL_DATA)
+            return false;
+
+        // SQL_SUCCESS_WITH_INFO with a remainder at least as large as the buffer means the chunk was
+        // truncated: the buffer is full, and more data follows.
+        auto const truncated =
+            rc == SQL_SUCCESS_WITH_INFO
+            && (indicator == SQL_NO_TOTAL || std::cmp_greater_equal(indicator, bufferSize - terminatorSize));
+        deliver(truncated ? bufferSize - terminatorSize : static_cast<std::size_t>(indicator));
+        if (!truncated)
+            break;
+    }
+    if (pendingHighSurrogate)
+    {
+        auto const utf8 = ToUtf8(std::u16string(1, *pendingHighSurrogate));
+        consumer(std::as_bytes(std::span { utf8 }));
+    }
+    return true;
+}
+
+bool SqlResultCursor::ReadColumnChunks(SQLUSMALLINT column, SqlLobType type, std::ostream& output, std::size_t chunkSize)
+{
+    auto buffer = std::vector<std::byte>(chunkSize);
+    return m_stmt->ReadColumnChunks(column, type, buffer, [&output](std::span<std::byte const> chunk) {
+        output.write(reinterpret_cast<char const*>(chunk.data()), static_cast<std::streamsize>(chunk.size()));
+    });
+}
+
 SqlResultCursor SqlStatement::ExecuteBatch(std::span<SqlRawColumn const> columns, size_t rowCount)
 {
     ZoneScopedN("SqlStatement::ExecuteBatch");
@@ -425,6 +663,7 @@ RowArrayCursor SqlStatement::ExecuteBatchFetch(std::string_view query, std::size
     RequireSuccess(SQLFreeStmt(m_hStmt, SQL_UNBIND));
 
     m_data->inputIndicators.clear();
+    m_data->inputStreams.clear();
     m_data->batchIndicators.clear();
 
     SqlLogger::GetLogger().OnExecuteDirect(query);
@@ -438,6 +677,93 @@ RowArrayCursor SqlStatement::ExecuteBatchFetch(std::string_view query, std::size
     return RowArrayCursor { *this, arrayDepth };
 }
 
+namespace
+{
+    /// Generator body behind SqlStatement::StreamDirectAsync. Takes its operands by pointer so the
+    /// coroutine frame holds no reference parameters.
+    Async::Generator<std::vector<SqlVariantRow>> StreamDirectRows(SqlStatement* stmt,
+                                                                  Async::IAsyncBackend* asyncBackend,
+                                                                  std::string query,
+                                                                  std::size_t blockRows,
+                                                                  std::stop_token token)
+    {
+        auto& backend = *asyncBackend;
+        blockRows = std::max<std::size_t>(blockRows, 1);
+
+        // The cursor lives in this coroutine frame across suspensions, but is only ever touched from
+        // inside an offloaded step, i.e. on the connection's strand.
+        auto cursor = std::optional<SqlResultCursor> {};
+        auto numColumns = SQLUSMALLINT {};
+        co_await Async::RunAsync(
+            backend,
+            [&] {
+                cursor.emplace(stmt->ExecuteDirect(query));
+                numColumns = static_cast<SQLUSMALLINT>(cursor->NumColumnsAffected());
+            },
+            token);
+
+        auto exhausted = false;
+        while (!exhausted)
+        {
+            if (token.stop_requested())
+            {
+                co_await Async::RunAsync(backend, [&cursor] { cursor.reset(); });
+                throw Async::OperationCancelledError {};
+            }
+
+            auto block = co_await Async::RunAsync(backend, [&] {
+                ZoneScopedN("SqlStatement::StreamDirectAsync block");
+                auto rows = std::vector<SqlVariantRow> {};
+                rows.reserve(blockRows);
+                while (rows.size() < blockRows && cursor->FetchRow())
+                {
+                    auto& row = rows.emplace_back();
+                    row.reserve(numColumns);
+                    for (auto const i: std::views::iota(SQLUSMALLINT(1), SQLUSMALLINT(numColumns + 1)))
+                        row.emplace_back(cursor->GetColumn<SqlVariant>(i));
+                }
+                return rows;
+            });
+
+            exhausted = block.size() < blockRows;
+            if (!block.empty())
+                co_yield std::move(block);
+        }
+
+        co_await Async::RunAsync(backend, [&cursor] { cursor.reset(); });
+    }
+} // namespace
+
+Async::Generator<std::vector<SqlVariantRow>> SqlStatement::StreamDirectAsync(std::string query,
+                                                                             std::size_t blockRows,
+                                                                             std::stop_token token)
+{
+    // Resolve the backend eagerly so a missing EnableAsync() fails at the call site.
+    return StreamDirectRows(this, &Connection().AsyncBackend(), std::move(query), blockRows, std::move(token));
+}
+
+void SqlStatement::KeepPendingResultSets() noexcept
+{
+    m_keepPendingResultSets = true;
+}
+
+bool SqlStatement::NextResultSet()
+{
+    ZoneScopedN("SqlStatement::NextResultSet");
+
+    // Drop the previous result set's prefetch and column bindings: the next one has its own shape.
+    ResetPrefetchState();
+    m_numColumns.reset();
+    m_data->postProcessOutputColumnCallbacks.clear();
+    RequireSuccess(SQLFreeStmt(m_hStmt, SQL_UNBIND));
+
+    auto const rc = SQLMoreResults(m_hStmt);
+    if (rc == SQL_NO_DATA)
+        return false;
+    RequireSuccess(rc);
+    return true;
+}
+
 // Retrieves the number of rows affected by the last query.
 size_t SqlStatement::NumRowsAffected() const
 {
@@ -772,7 +1098,8 @@ std::expected<bool, SqlErrorInfo> SqlStatement::FetchRowPrefetched() noexcept
             m_data->prefetchDeferredBinds.clear();
             m_data->prefetchRowInBlock = NoPrefetchRow;
             m_data->prefetchMode = Data::PrefetchMode::Disabled;
-            SQLCloseCursor(m_hStmt);
+            if (!m_keepPendingResultSets)
+                SQLCloseCursor(m_hStmt);
             m_data->postProcessOutputColumnCallbacks.clear();
             SqlLogger::GetLogger().OnFetchEnd();
             return false;
@@ -839,7 +1166,8 @@ std::expected<bool, SqlErrorInfo> SqlStatement::TryFetchRow(std::source_location
     switch (sqlResult)
     {
         case SQL_NO_DATA:
-            SQLCloseCursor(m_hStmt);
+            if (!m_keepPendingResultSets)
+                SQLCloseCursor(m_hStmt);
             m_data->postProcessOutputColumnCallbacks.clear();
             SqlLogger::GetLogger().OnFetchEnd();
             return false;
@@ -1277,6 +1605,70 @@ std::optional<SqlGuid> RowArrayCursor::GetGuid(std::size_t rowInBatch, SQLUSMALL
     return value;
 }
 
+RowArrayCursor::BoundColumn const& RowArrayCursor::CheckedColumn(SQLUSMALLINT column,
+                                                               BoundType expected,
+                                                               char const* accessorName) const
+{
+    auto const& boundColumn = m_columns.at(column - 1);
+    if (boundColumn.type != expected)
+        throw std::logic_error { std::format("RowArrayCursor::{} called on a mismatched column binding", accessorName) };
+    return boundColumn;
+}
+
+void RowArrayCursor::RequireUntruncatedText(BoundColumn const& boundColumn,
+                                            SQLUSMALLINT column,
+                                            std::size_t unitSize) const
+{
+    // Same guard as GetString(): the usable width excludes the NUL terminator.
+    auto const usableBytes = boundColumn.elementWidth - unitSize;
+    for (auto const indicator: std::span { boundColumn.indicators.data(), m_lastFetched })
+    {
+        if (indicator != SQL_NULL_DATA && (indicator < 0 || std::cmp_greater(indicator, usableBytes)))
+            throw std::runtime_error { std::format(
+                "RowArrayCursor: value in column {} was truncated during bulk fetch (indicator byte length {}, "
+                "buffer holds {} bytes)",
+                column,
+                indicator,
+                usableBytes) };
+    }
+}
+
+// The bound buffers come from operator new, which aligns them for any fundamental type, and every
+// slot of a numeric column was written by the driver as that type.
+
+std::span<std::int64_t const> RowArrayCursor::I64Column(SQLUSMALLINT column) const
+{
+    auto const& boundColumn = CheckedColumn(column, BoundType::Int64, "I64Column");
+    return { reinterpret_cast<std::int64_t const*>(boundColumn.buffer.data()), m_lastFetched };
+}
+
+std::span<double const> RowArrayCursor::F64Column(SQLUSMALLINT column) const
+{
+    auto const& boundColumn = CheckedColumn(column, BoundType::Double, "F64Column");
+    return { reinterpret_cast<double const*>(boundColumn.buffer.data()), m_lastFetched };
+}
+
+std::span<SQLLEN const> RowArrayCursor::ColumnIndicators(SQLUSMALLINT column) const
+{
+    return { m_columns.at(column - 1).indicators.data(), m_lastFetched };
+}
+
+SqlTextColumnView<char> RowArrayCursor::NarrowTextColumn(SQLUSMALLINT column) const
+{
+    auto const& boundColumn = CheckedColumn(column, BoundType::Char, "NarrowTextColumn");
+    RequireUntruncatedText(boundColumn, column, sizeof(char));
+    return { boundColumn.buffer.data(), boundColumn.elementWidth, ColumnIndicators(column) };
+}
+
+SqlTextColumnView<char16_t> RowArrayCursor::WideTextColumn(SQLUSMALLINT column) const
+{
+    auto const& boundColumn = CheckedColumn(column, BoundType::WChar, "WideTextColumn");
+    RequireUntruncatedText(boundColumn, column, sizeof(char16_t));
+    return { reinterpret_cast<char16_t const*>(boundColumn.buffer.data()),
+             boundColumn.elementWidth / sizeof(char16_t),
+             ColumnIndicators(column) };
+}
+
 // }}} RowArrayCursor
 
 } // namespace Lightweight
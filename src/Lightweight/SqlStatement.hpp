@@ -4,6 +4,7 @@
 
 // See SqlOdbcPrelude.hpp's header comment for why this replaces a direct <Windows.h> include.
 #include "Api.hpp"
+#include "DataBinder/BasicStringBinder.hpp"
 #include "DataBinder/Core.hpp"
 #include "DataBinder/SqlDate.hpp"
 #include "DataBinder/SqlDateTime.hpp"
@@ -27,11 +28,15 @@
 #include <cstring>
 #include <expected>
 #include <functional>
+#include <iosfwd>
+#include <limits>
+#include <memory>
 #include <optional>
 #include <ranges>
 #include <source_location>
 #include <span>
 #include <stdexcept>
+#include <string_view>
 #include <type_traits>
 #include <vector>
 
@@ -55,6 +60,26 @@ class SqlResultCursor;
 class SqlVariantRowCursor;
 class RowArrayCursor;
 
+/// @ingroup CoreApi
+/// How a large object (LOB) column is streamed, see @c SqlResultCursor::ReadColumnChunks and
+/// @c SqlStatement::BindInputStream.
+enum class SqlLobType : std::uint8_t
+{
+    /// Raw bytes (@c SQL_C_BINARY), e.g. @c SqlDynamicBinary or @c VARBINARY(MAX) columns.
+    Binary,
+    /// UTF-8 text, e.g. @c SqlText or @c VARCHAR(MAX) columns.
+    Text,
+};
+
+/// @ingroup CoreApi
+/// Receives the chunks of a streamed LOB column value in order; the span is only valid during the call.
+using SqlLobChunkConsumer = std::function<void(std::span<std::byte const>)>;
+
+/// @ingroup CoreApi
+/// Fills the given buffer with the next chunk of a streamed LOB parameter value and returns the number
+/// of bytes written, or 0 once the value is complete.
+using SqlLobChunkSource = std::function<std::size_t(std::span<std::byte>)>;
+
 /// @brief High level API for (prepared) raw SQL statements
 ///
 /// @ingroup CoreApi
@@ -129,6 +154,12 @@ class [[nodiscard]] SqlStatement final: public SqlDataBinderCallback
     /// Prepares the statement from a query object on an rvalue reference and returns the statement.
     SqlStatement Prepare(SqlQueryObject auto const& queryObject) &&;
 
+    /// Prepares the statement for execution, unless @p query is already the prepared statement.
+    ///
+    /// Re-executing an unchanged statement skips the driver's parse and plan; only the bindings of the
+    /// previous execution are dropped, so every parameter must be bound again before Execute().
+    LIGHTWEIGHT_API void PrepareIfChanged(std::string_view query) &;
+
     /// Retrieves the last prepared query string.
     [[nodiscard]] std::string const& PreparedQuery() const noexcept;
 
@@ -140,6 +171,36 @@ class [[nodiscard]] SqlStatement final: public SqlDataBinderCallback
     template <SqlInputParameterBinder Arg, typename ColumnName>
     void BindInputParameter(SQLSMALLINT columnIndex, Arg const& arg, ColumnName&& columnNameHint);
 
+    /// The default size of the chunks in which LOB values are streamed.
+    static constexpr std::size_t DefaultLobChunkSize = 64 * 1024;
+
+    /// Binds an input parameter whose value is streamed to the server in chunks during Execute().
+    ///
+    /// The parameter is bound as data-at-execution (@c SQL_DATA_AT_EXEC): Execute() pulls the value from
+    /// @p source in chunks of up to @ref DefaultLobChunkSize bytes and sends each with @c SQLPutData, so
+    /// the value never has to be in memory as a whole. @p source must stay valid until Execute() returns.
+    ///
+    /// Where the driver does not take narrow text byte-exact (see
+    /// @ref SqlConnection::RoundTripsNarrowTextByteExact), text is transcoded to UTF-16 chunk by chunk and
+    /// bound as @c SQL_C_WCHAR; @p totalSize is then not passed on, as it counts UTF-8 bytes.
+    ///
+    /// @param columnIndex 1-based parameter index.
+    /// @param type        whether the value is raw bytes or UTF-8 text.
+    /// @param source      produces the value chunk by chunk, returning 0 at its end.
+    /// @param totalSize   the value's size in bytes, if known; some drivers require it up front.
+    LIGHTWEIGHT_API void BindInputStream(SQLSMALLINT columnIndex,
+                                         SqlLobType type,
+                                         SqlLobChunkSource source,
+                                         std::optional<std::size_t> totalSize = std::nullopt);
+
+    /// Binds an input parameter whose value is streamed from @p input during Execute(); see above.
+    ///
+    /// Reads @p input until its end. @p input must stay valid until Execute() returns.
+    LIGHTWEIGHT_API void BindInputStream(SQLSMALLINT columnIndex,
+                                         SqlLobType type,
+                                         std::istream& input,
+                                         std::optional<std::size_t> totalSize = std::nullopt);
+
     /// Binds the given arguments to the prepared statement and executes it.
     template <SqlInputParameterBinder... Args>
     [[nodiscard]] SqlResultCursor Execute(Args const&... args);
@@ -202,8 +263,15 @@ class [[nodiscard]] SqlStatement final: public SqlDataBinderCallback
     /// returns an lvalue reference, the row stride satisfies the indicator-alignment requirement, and the
     /// driver advertises parameter-array support (@ref SqlConnection::SupportsNativeRowBatch). A
     /// per-row runtime stride check guards against accessors that are not constant-offset subobjects.
-    /// Otherwise the soft path is used, which correctly binds every supported type (strings, binary,
-    /// variant, @c std::optional of any type, …) one row at a time.
+    ///
+    /// Otherwise, when every column value type can be staged (@c SqlColumnStageableColumn: additionally
+    /// variable-length narrow and wide strings, GUIDs, and @c std::optional of any of them), every
+    /// accessor returns an lvalue reference, and no string exceeds @c SqlOptimalMaxColumnSize, the
+    /// columns are copied into column-wise staging buffers and the batch still executes in a single
+    /// @c SQLExecute.
+    ///
+    /// Otherwise the soft path is used, which correctly binds every supported type (binary, variant,
+    /// long strings, …) one row at a time.
     ///
     /// @param rows Contiguous range of row structs (e.g. @c std::span<Record const>).
     /// @param accessors One invocable per bound column; @c accessor(row) yields that column's value.
@@ -213,6 +281,25 @@ class [[nodiscard]] SqlStatement final: public SqlDataBinderCallback
                  && (std::invocable<ColumnAccessors const&, std::ranges::range_value_t<Rows> const&> && ...))
     [[nodiscard]] SqlResultCursor ExecuteBatch(Rows const& rows, ColumnAccessors const&... accessors);
 
+    /// Executes a prepared single-row statement that returns one value per execution (typically an
+    /// `INSERT ... RETURNING` / `OUTPUT INSERTED` built with @c SqlInsertQueryBuilder::Returning) for every
+    /// row of a row-major batch, and collects the returned values in row order.
+    ///
+    /// When the driver returns one result set per parameter set (@ref SqlConnection::SupportsBatchedReturning)
+    /// and every column can be staged (see @ref ExecuteBatch), the whole batch is bound as column-wise
+    /// parameter arrays and submitted in a single @c SQLExecute. Otherwise the prepared statement is executed
+    /// once per row, which still avoids a re-prepare and a separate last-insert-id query per row.
+    ///
+    /// @tparam Value The type of the single returned column (e.g. the primary key type).
+    /// @param rows Contiguous range of row structs.
+    /// @param accessors One invocable per bound column; @c accessor(row) yields that column's value.
+    /// @return The returned value of each row, in the order of @p rows.
+    /// @throws SqlException if the statement did not return exactly one value per row.
+    template <typename Value, std::ranges::contiguous_range Rows, typename... ColumnAccessors>
+        requires(sizeof...(ColumnAccessors) >= 1
+                 && (std::invocable<ColumnAccessors const&, std::ranges::range_value_t<Rows> const&> && ...))
+    [[nodiscard]] std::vector<Value> ExecuteBatchReturning(Rows const& rows, ColumnAccessors const&... accessors);
+
     /// Executes the given query directly.
     [[nodiscard]] LIGHTWEIGHT_API SqlResultCursor
     ExecuteDirect(std::string_view const& query, std::source_location location = std::source_location::current());
@@ -235,6 +322,32 @@ class [[nodiscard]] SqlStatement final: public SqlDataBinderCallback
     /// @return A RowArrayCursor bound to this statement's result set.
     [[nodiscard]] LIGHTWEIGHT_API RowArrayCursor ExecuteBatchFetch(std::string_view query, std::size_t arrayDepth);
 
+    /// Keeps the result sets that follow the current one pending when the current one is fetched to
+    /// its end, so that @c SqlResultCursor::NextResultSet can advance to them.
+    ///
+    /// Call this right after executing a multi-statement batch (see
+    /// @ref SqlConnection::SupportsMultiResultBatch) and before fetching. Without it, reaching the end of
+    /// a result set closes the cursor and discards every pending one. Reset when the cursor is closed.
+    LIGHTWEIGHT_API void KeepPendingResultSets() noexcept;
+
+    /// Asynchronously executes @p query and streams its result set in blocks of up to @p blockRows rows.
+    ///
+    /// Executing the query and fetching every block are each one offloaded step on the connection's
+    /// strand (see @c SqlConnection::EnableAsync); the next block is only fetched once the consumer
+    /// awaits @c Generator::Next again, so memory stays bounded by one block however large the result.
+    /// If @p token is stopped between blocks, the cursor is closed on the strand and the pending
+    /// @c Next completes with @c Async::OperationCancelledError.
+    ///
+    /// The statement must outlive the returned generator and must not be used for anything else while
+    /// the stream is open. Destroying the generator early closes the cursor on the destroying thread.
+    ///
+    /// @param query The SQL query to execute.
+    /// @param blockRows Maximum number of rows per yielded block (clamped to at least 1).
+    /// @param token Optional cancellation token, checked before each step is dispatched.
+    /// @return A generator yielding the result rows in blocks.
+    [[nodiscard]] LIGHTWEIGHT_API Async::Generator<std::vector<SqlVariantRow>> StreamDirectAsync(
+        std::string query, std::size_t blockRows = 1000, std::stop_token token = {});
+
     /// Executes an SQL migration query, as created b the callback.
     template <typename Callable>
         requires std::invocable<Callable, SqlMigrationQueryBuilder&>
@@ -278,6 +391,7 @@ class [[nodiscard]] SqlStatement final: public SqlDataBinderCallback
     [[nodiscard]] LIGHTWEIGHT_API bool FetchRow();
     [[nodiscard]] LIGHTWEIGHT_API std::expected<bool, SqlErrorInfo> TryFetchRow(
         std::source_location location = std::source_location::current()) noexcept;
+    [[nodiscard]] LIGHTWEIGHT_API bool NextResultSet();
     void CloseCursor() noexcept;
 
     /// @brief Binds the given output column variables to the result columns of this statement.
@@ -307,11 +421,48 @@ class [[nodiscard]] SqlStatement final: public SqlDataBinderCallback
     template <SqlGetColumnNativeType T>
     [[nodiscard]] T GetColumn(SQLUSMALLINT column) const;
 
+    /// @brief Reads the value of @p column of the current row chunk by chunk; see
+    /// @c SqlResultCursor::ReadColumnChunks.
+    [[nodiscard]] LIGHTWEIGHT_API bool ReadColumnChunks(SQLUSMALLINT column,
+                                                        SqlLobType type,
+                                                        std::span<std::byte> buffer,
+                                                        SqlLobChunkConsumer const& consumer);
+
+    /// @brief Sends the values of the data-at-execution parameters bound by BindInputStream() while
+    /// @c SQLExecute asks for them.
+    /// @param result The result of @c SQLExecute.
+    /// @return The result of the execution once all values have been sent.
+    [[nodiscard]] LIGHTWEIGHT_API SQLRETURN SendInputStreams(SQLRETURN result);
+
     /// @brief Native row-wise batch execution: binds each column in place over @p rows and submits the
     /// whole batch in a single @c SQLExecute. Precondition: every column is row-bindable.
     template <std::ranges::contiguous_range Rows, typename... ColumnAccessors>
     [[nodiscard]] SqlResultCursor ExecuteBatchNativeRowWise(Rows const& rows, ColumnAccessors const&... accessors);
 
+    /// @brief Column-wise staged batch execution: copies each column of @p rows into a fixed-stride
+    /// staging buffer (strings sized to the batch's longest value) and submits the whole batch in a
+    /// single @c SQLExecute. Precondition: every column is stageable.
+    template <std::ranges::contiguous_range Rows, typename... ColumnAccessors>
+    [[nodiscard]] SqlResultCursor ExecuteBatchColumnStaged(Rows const& rows, ColumnAccessors const&... accessors);
+
+    /// @brief Configures column-wise parameter-array binding for @p rowCount rows and stages every column of
+    /// @p rowData into it. The caller restores single-row binding (ResetParameterArrayBinding) afterwards.
+    template <typename RowElem, typename... ColumnAccessors>
+    void BindColumnStagedBatch(RowElem const* rowData,
+                               std::size_t rowCount,
+                               SQLULEN* processedCount,
+                               ColumnAccessors const&... accessors);
+
+    /// @brief Appends the first column of every row of every pending result set to @p values, then closes
+    /// the cursor. Result sets without columns (e.g. row counts) are skipped.
+    template <typename Value>
+    void CollectReturnedValues(std::vector<Value>& values);
+
+    /// @brief Binds column @p column of a column-wise staged batch, @p valueAt(i) yielding a pointer to
+    /// the value of row @c i (never @c nullptr for a non-optional @p Value).
+    template <typename Value, typename GetValue>
+    void BindStagedColumn(SQLUSMALLINT column, std::size_t rowCount, GetValue const& valueAt);
+
     /// @brief Soft row-major batch execution: binds and executes each row individually. Works for every
     /// supported column type and is the fallback when native row-wise binding does not apply.
     template <std::ranges::contiguous_range Rows, typename... ColumnAccessors>
@@ -460,6 +611,7 @@ class [[nodiscard]] SqlStatement final: public SqlDataBinderCallback
     std::string m_preparedQuery;                   // The last prepared query
     std::optional<SQLSMALLINT> m_numColumns;       // The number of columns in the result set, if known
     SQLSMALLINT m_expectedParameterCount {};       // The number of parameters expected by the query
+    bool m_keepPendingResultSets = false;          // End of a result set must not discard the following ones
 };
 
 /// @ingroup CoreApi
@@ -532,6 +684,17 @@ class [[nodiscard]] SqlResultCursor
         m_stmt->BindOutputColumn(columnIndex, arg);
     }
 
+    /// Advances to the next result set of a multi-statement batch.
+    ///
+    /// Requires @c SqlStatement::KeepPendingResultSets to have been called after executing the batch.
+    /// Output column bindings of the previous result set are dropped.
+    ///
+    /// @return @c true if another result set is available, @c false if the batch is exhausted.
+    [[nodiscard]] LIGHTWEIGHT_FORCE_INLINE bool NextResultSet()
+    {
+        return m_stmt->NextResultSet();
+    }
+
     /// Fetches the next row of the result set.
     [[nodiscard]] LIGHTWEIGHT_FORCE_INLINE bool FetchRow()
     {
@@ -601,6 +764,34 @@ class [[nodiscard]] SqlResultCursor
         return m_stmt->GetColumnOr(column, std::forward<T>(defaultValue));
     }
 
+    /// Reads the value of the column at the given index for the currently selected row in chunks.
+    ///
+    /// Unlike GetColumn(), which grows a string or binary value until the whole value fits, this
+    /// repeatedly fills @p buffer via @c SQLGetData and hands each chunk to @p consumer, so the memory
+    /// needed is bounded by the buffer however large the value is. Text is delivered as UTF-8.
+    ///
+    /// @param column   1-based column index; the column can be read only once per row.
+    /// @param type     whether to read the value as raw bytes or as text.
+    /// @param buffer   caller-owned scratch buffer that determines the chunk size.
+    /// @param consumer receives each chunk in order.
+    /// @return false if the value is NULL (the consumer is not called), true otherwise.
+    [[nodiscard]] LIGHTWEIGHT_FORCE_INLINE bool ReadColumnChunks(SQLUSMALLINT column,
+                                                                 SqlLobType type,
+                                                                 std::span<std::byte> buffer,
+                                                                 SqlLobChunkConsumer const& consumer)
+    {
+        return m_stmt->ReadColumnChunks(column, type, buffer, consumer);
+    }
+
+    /// Reads the value of the column at the given index for the currently selected row into @p output,
+    /// in chunks of up to @p chunkSize bytes.
+    ///
+    /// @return false if the value is NULL (nothing is written), true otherwise.
+    [[nodiscard]] LIGHTWEIGHT_API bool ReadColumnChunks(SQLUSMALLINT column,
+                                                        SqlLobType type,
+                                                        std::ostream& output,
+                                                        std::size_t chunkSize = SqlStatement::DefaultLobChunkSize);
+
   private:
     SqlStatement* m_stmt;
 };
@@ -619,6 +810,49 @@ class RowArrayCursorUnsupported: public std::runtime_error
     using std::runtime_error::runtime_error;
 };
 
+/// @brief A character column of the last block fetched by a RowArrayCursor: one fixed-width slot
+/// per row, holding the value's code units, plus its length indicator.
+///
+/// Obtained via @ref RowArrayCursor::NarrowTextColumn or @ref RowArrayCursor::WideTextColumn. Viewed
+/// values alias the cursor's bound buffer and are only valid until the next @c FetchArray().
+template <typename Char>
+class SqlTextColumnView
+{
+  public:
+    /// Constructs a view over @p buffer, which holds one @p stride code units wide slot per row.
+    SqlTextColumnView(Char const* buffer, std::size_t stride, std::span<SQLLEN const> indicators) noexcept:
+        _buffer { buffer },
+        _stride { stride },
+        _indicators { indicators }
+    {
+    }
+
+    /// The number of rows in the block.
+    [[nodiscard]] std::size_t size() const noexcept
+    {
+        return _indicators.size();
+    }
+
+    /// Whether the value of @p row is SQL NULL.
+    [[nodiscard]] bool IsNull(std::size_t row) const noexcept
+    {
+        return _indicators[row] == SQL_NULL_DATA;
+    }
+
+    /// The value of @p row, or an empty view if it is SQL NULL.
+    [[nodiscard]] std::basic_string_view<Char> operator[](std::size_t row) const noexcept
+    {
+        if (IsNull(row))
+            return {};
+        return { _buffer + (row * _stride), static_cast<std::size_t>(_indicators[row]) / sizeof(Char) };
+    }
+
+  private:
+    Char const* _buffer;
+    std::size_t _stride;
+    std::span<SQLLEN const> _indicators;
+};
+
 /// @brief A cursor that fetches result rows in bulk (ODBC row-array binding) for fast column reads.
 ///
 /// Created via @ref SqlStatement::ExecuteBatchFetch. Instead of issuing one SQLGetData per cell,
@@ -769,6 +1003,32 @@ class [[nodiscard]] RowArrayCursor
     /// @return @c true if the cell's length indicator is @c SQL_NULL_DATA.
     [[nodiscard]] LIGHTWEIGHT_API bool IsCellNull(std::size_t rowInBatch, SQLUSMALLINT column) const;
 
+    // --- Columnar access: whole columns of the last fetched block, without a per-cell call. Each view
+    // has one element per fetched row and aliases the bound buffers, so it is only valid until the next
+    // FetchArray(). Values of NULL cells are unspecified; check ColumnIndicators() for them.
+
+    /// @brief The values of an Int64-bound column in the last fetched block.
+    /// @param column 1-based result column index.
+    [[nodiscard]] LIGHTWEIGHT_API std::span<std::int64_t const> I64Column(SQLUSMALLINT column) const;
+
+    /// @brief The values of a Double-bound column in the last fetched block.
+    /// @param column 1-based result column index.
+    [[nodiscard]] LIGHTWEIGHT_API std::span<double const> F64Column(SQLUSMALLINT column) const;
+
+    /// @brief The length indicators of a column in the last fetched block (@c SQL_NULL_DATA for NULL).
+    /// @param column 1-based result column index.
+    [[nodiscard]] LIGHTWEIGHT_API std::span<SQLLEN const> ColumnIndicators(SQLUSMALLINT column) const;
+
+    /// @brief The values of a Char-bound column in the last fetched block, as the driver delivered them.
+    /// Throws std::runtime_error if a value was truncated to the bound buffer, like GetString().
+    /// @param column 1-based result column index.
+    [[nodiscard]] LIGHTWEIGHT_API SqlTextColumnView<char> NarrowTextColumn(SQLUSMALLINT column) const;
+
+    /// @brief The UTF-16 values of a WChar-bound column in the last fetched block.
+    /// Throws std::runtime_error if a value was truncated to the bound buffer, like GetString().
+    /// @param column 1-based result column index.
+    [[nodiscard]] LIGHTWEIGHT_API SqlTextColumnView<char16_t> WideTextColumn(SQLUSMALLINT column) const;
+
   private:
     /// Per-column binding metadata + owning buffers.
     struct BoundColumn
@@ -782,6 +1042,12 @@ class [[nodiscard]] RowArrayCursor
 
     void ResetStatementState() noexcept;
 
+    /// Columnar accessor prelude: verifies the column is bound as @p expected and returns it.
+    [[nodiscard]] BoundColumn const& CheckedColumn(SQLUSMALLINT column, BoundType expected, char const* accessorName) const;
+
+    /// Throws if a value of the character column @p boundColumn was truncated in the last fetched block.
+    void RequireUntruncatedText(BoundColumn const& boundColumn, SQLUSMALLINT column, std::size_t unitSize) const;
+
     /// Shared accessor prelude: bounds-checks @p rowInBatch against the last fetched block,
     /// verifies the column is bound as @p expected, and returns the cell's buffer address —
     /// or nullptr when the cell is SQL NULL.
@@ -798,6 +1064,46 @@ class [[nodiscard]] RowArrayCursor
     std::vector<SQLUSMALLINT> m_rowStatus;
 };
 
+/// @brief Count of non-NULL values, sum, minimum and maximum of a numeric result column.
+///
+/// Accumulates whole column blocks of a RowArrayCursor. The loop over a block is free of branches and
+/// per-cell calls, so the compiler can vectorize it.
+///
+/// @code
+/// auto cursor = stmt.ExecuteBatchFetch(R"(SELECT "Amount" FROM "Orders")", 4096);
+/// auto amounts = SqlColumnSummary<double> {};
+/// while (cursor.FetchArray() > 0)
+///     amounts.Add(cursor.F64Column(1), cursor.ColumnIndicators(1));
+/// std::println("{} orders, {} total", amounts.count, amounts.sum);
+/// @endcode
+template <typename T>
+struct SqlColumnSummary
+{
+    /// The number of non-NULL values.
+    std::size_t count {};
+    /// The sum of the non-NULL values.
+    T sum {};
+    /// The smallest non-NULL value; only meaningful if @ref count is not zero.
+    T min = (std::numeric_limits<T>::max)();
+    /// The largest non-NULL value; only meaningful if @ref count is not zero.
+    T max = std::numeric_limits<T>::lowest();
+
+    /// Adds a block of @p values, skipping those whose indicator is @c SQL_NULL_DATA.
+    void Add(std::span<T const> values, std::span<SQLLEN const> indicators) noexcept
+    {
+        auto const rows = (std::min) (values.size(), indicators.size());
+        for (auto const i: std::views::iota(0UZ, rows))
+        {
+            auto const valid = indicators[i] != SQL_NULL_DATA;
+            auto const value = values[i];
+            count += valid ? 1 : 0;
+            sum += valid ? value : T {};
+            min = valid && value < min ? value : min;
+            max = valid && max < value ? value : max;
+        }
+    }
+};
+
 struct [[nodiscard]] SqlSentinelIterator
 {
 };
@@ -1197,7 +1503,9 @@ SqlResultCursor SqlStatement::Execute(Args const&... args)
       RequireSuccess(SqlDataBinder<Args>::InputParameter(m_hStmt, i, args, *this))),
      ...);
 
-    auto const result = SQLExecute(m_hStmt);
+    auto result = SQLExecute(m_hStmt);
+    if (result == SQL_NEED_DATA)
+        result = SendInputStreams(result);
 
     if (result != SQL_NO_DATA && result != SQL_SUCCESS && result != SQL_SUCCESS_WITH_INFO)
         throw SqlException(SqlErrorInfo::FromStatementHandle(m_hStmt), std::source_location::current());
@@ -1278,6 +1586,47 @@ concept SqlHasRowWiseBatchBinder =
         { SqlDataBinder<V>::BatchRowWiseInputParameter(stmt, column, elem0, n, n, cb) } -> std::same_as<SQLRETURN>;
     };
 
+/// @brief Whether @p V's binder can stage a whole column of a batch itself (@c BatchStagedInputParameter),
+/// as the string, GUID and numeric binders do.
+template <typename V>
+concept SqlHasStagedBatchBinder =
+    requires(SQLHSTMT stmt, SQLUSMALLINT column, V const* (*valueAt)(std::size_t), SqlDataBinderCallback& cb) {
+        { SqlDataBinder<V>::BatchStagedInputParameter(stmt, column, std::size_t {}, valueAt, cb) } -> std::same_as<SQLRETURN>;
+    };
+
+/// @brief A fixed-width value that a column-wise staged batch copies into a contiguous array and binds
+/// via its binder's @c BatchInputParameter, exactly like the column-major @c ExecuteBatchNative does.
+template <typename V>
+concept SqlStagedGatherValue = SqlNativeContiguousValueConcept<V> && !SqlHasStagedBatchBinder<V>
+                               && std::is_trivially_copyable_v<V>
+                               && requires(SQLHSTMT stmt, V const* values, SqlDataBinderCallback& cb, SQLLEN* indicators) {
+                                      SqlDataBinder<V>::BatchInputParameter(stmt, 1, values, std::size_t {}, cb, indicators);
+                                  };
+
+/// @brief A column value type usable on the column-wise staged batch path: a stageable value, or a
+/// @c std::optional of one.
+template <typename V>
+concept SqlColumnStageableColumn =
+    SqlHasStagedBatchBinder<V> || SqlStagedGatherValue<V>
+    || (SqlIsStdOptional<V>
+        && (SqlHasStagedBatchBinder<typename V::value_type> || SqlStagedGatherValue<typename V::value_type>));
+
+namespace detail
+{
+    /// Whether @p value can be staged without blowing up the staging buffer: every row of a staged string
+    /// column gets a slot as wide as the longest value, so long (LOB-like) strings stay on the per-row path.
+    template <typename V>
+    [[nodiscard]] bool FitsColumnStaging(V const& value) noexcept
+    {
+        if constexpr (SqlIsStdOptional<V>)
+            return !value.has_value() || FitsColumnStaging(*value);
+        else if constexpr (requires { SqlBasicStringOperations<V>::Size(&value); })
+            return SqlBasicStringOperations<V>::Size(&value) <= SqlOptimalMaxColumnSize;
+        else
+            return true;
+    }
+} // namespace detail
+
 template <SqlInputParameterBatchBinder FirstColumnBatch, std::ranges::contiguous_range... MoreColumnBatches>
 SqlResultCursor SqlStatement::ExecuteBatchNative(FirstColumnBatch const& firstColumnBatch,
                                                  MoreColumnBatches const&... moreColumnBatches)
@@ -1409,9 +1758,201 @@ SqlResultCursor SqlStatement::ExecuteBatch(Rows const& rows, ColumnAccessors con
             return ExecuteBatchNativeRowWise(rows, accessors...);
     }
 
+    // Records with variable-length columns (strings, GUIDs) cannot be bound in place, but can still be
+    // submitted as one parameter array by staging them column by column.
+    constexpr bool allColumnsStageable =
+        (SqlColumnStageableColumn<std::remove_cvref_t<std::invoke_result_t<ColumnAccessors const&, RowElem const&>>> && ...);
+    if constexpr (allColumnsStageable && allAccessorsReturnReference)
+    {
+        auto const fitsStaging = [&] {
+            return std::ranges::all_of(rows, [&](RowElem const& row) {
+                return (detail::FitsColumnStaging(accessors(row)) && ...);
+            });
+        };
+        if (m_connection->SupportsNativeRowBatch() && fitsStaging())
+            return ExecuteBatchColumnStaged(rows, accessors...);
+    }
+
     return ExecuteBatchSoftRowMajor(rows, accessors...);
 }
 
+template <std::ranges::contiguous_range Rows, typename... ColumnAccessors>
+SqlResultCursor SqlStatement::ExecuteBatchColumnStaged(Rows const& rows, ColumnAccessors const&... accessors)
+{
+    ZoneScopedN("SqlStatement::ExecuteBatchColumnStaged");
+    ZoneTextObject(m_preparedQuery);
+
+    auto const rowCount = std::ranges::size(rows);
+    ZoneValue(rowCount);
+    auto const* rowData = std::ranges::data(rows);
+
+    // See ExecuteBatchNativeRowWise for the rationale of the optimistic init and the restore guard.
+    SQLULEN processedCount = rowCount;
+    auto const restoreParameterBinding = detail::Finally([this] {
+        ResetParameterArrayBinding();
+        ClearBatchIndicators();
+    });
+
+    BindColumnStagedBatch(rowData, rowCount, &processedCount, accessors...);
+
+    SqlLogger::GetLogger().OnExecuteBatch();
+    auto const executeResult = SQLExecute(m_hStmt);
+    RequireSuccessfulBatchExecute(executeResult, processedCount, static_cast<SQLULEN>(rowCount));
+    ProcessPostExecuteCallbacks();
+
+    return SqlResultCursor { *this };
+}
+
+template <typename RowElem, typename... ColumnAccessors>
+void SqlStatement::BindColumnStagedBatch(RowElem const* rowData,
+                                         std::size_t rowCount,
+                                         SQLULEN* processedCount,
+                                         ColumnAccessors const&... accessors)
+{
+    // clang-format off
+    // NOLINTNEXTLINE(performance-no-int-to-ptr)
+    RequireSuccess(SQLSetStmtAttr(m_hStmt, SQL_ATTR_PARAMSET_SIZE, (SQLPOINTER) rowCount, 0));
+    RequireSuccess(SQLSetStmtAttr(m_hStmt, SQL_ATTR_PARAM_BIND_TYPE, SQL_PARAM_BIND_BY_COLUMN, 0));
+    RequireSuccess(SQLSetStmtAttr(m_hStmt, SQL_ATTR_PARAM_BIND_OFFSET_PTR, nullptr, 0));
+    RequireSuccess(SQLSetStmtAttr(m_hStmt, SQL_ATTR_PARAM_OPERATION_PTR, SQL_PARAM_PROCEED, 0));
+    RequireSuccess(SQLSetStmtAttr(m_hStmt, SQL_ATTR_PARAMS_PROCESSED_PTR, processedCount, 0));
+    // clang-format on
+
+    SQLUSMALLINT column = 0;
+    auto const bindColumn = [&](auto const& accessor) {
+        using ValueType = std::remove_cvref_t<decltype(accessor(rowData[0]))>;
+        BindStagedColumn<ValueType>(
+            ++column, rowCount, [&](std::size_t i) { return std::addressof(accessor(rowData[i])); });
+    };
+    (bindColumn(accessors), ...);
+}
+
+template <typename Value, std::ranges::contiguous_range Rows, typename... ColumnAccessors>
+    requires(sizeof...(ColumnAccessors) >= 1
+             && (std::invocable<ColumnAccessors const&, std::ranges::range_value_t<Rows> const&> && ...))
+std::vector<Value> SqlStatement::ExecuteBatchReturning(Rows const& rows, ColumnAccessors const&... accessors)
+{
+    ZoneScopedN("SqlStatement::ExecuteBatchReturning");
+    ZoneTextObject(m_preparedQuery);
+
+    using RowElem = std::ranges::range_value_t<Rows>;
+
+    auto const rowCount = std::ranges::size(rows);
+    ZoneValue(rowCount);
+    auto const* rowData = std::ranges::data(rows);
+
+    auto values = std::vector<Value> {};
+    if (rowCount == 0)
+        return values;
+    values.reserve(rowCount);
+
+    if (m_expectedParameterCount != static_cast<SQLSMALLINT>(sizeof...(accessors)))
+        throw std::invalid_argument { "Invalid number of columns" };
+
+    auto const requireOneValuePerRow = [&] {
+        if (values.size() != rowCount)
+            throw SqlException(SqlErrorInfo {
+                .nativeErrorCode = 0,
+                .sqlState = "HY000",
+                .message = std::format("Batch returned {} values for {} rows; expected exactly one per row.",
+                                       values.size(),
+                                       rowCount),
+            });
+    };
+
+    constexpr bool allColumnsStageable =
+        (SqlColumnStageableColumn<std::remove_cvref_t<std::invoke_result_t<ColumnAccessors const&, RowElem const&>>> && ...);
+    constexpr bool allAccessorsReturnReference =
+        (std::is_reference_v<std::invoke_result_t<ColumnAccessors const&, RowElem const&>> && ...);
+    if constexpr (allColumnsStageable && allAccessorsReturnReference)
+    {
+        auto const fitsStaging = [&] {
+            return std::ranges::all_of(rows, [&](RowElem const& row) {
+                return (detail::FitsColumnStaging(accessors(row)) && ...);
+            });
+        };
+        if (m_connection->SupportsBatchedReturning() && fitsStaging())
+        {
+            // The driver reports the processed count as it walks the result sets, so it is not checked
+            // here; one returned value per row is the stronger guarantee.
+            SQLULEN processedCount = rowCount;
+            auto const restoreParameterBinding = detail::Finally([this] {
+                ResetParameterArrayBinding();
+                ClearBatchIndicators();
+            });
+
+            BindColumnStagedBatch(rowData, rowCount, &processedCount, accessors...);
+
+            SqlLogger::GetLogger().OnExecuteBatch();
+            RequireExecuteSucceededOrNoData(SQLExecute(m_hStmt));
+            ProcessPostExecuteCallbacks();
+            CollectReturnedValues(values);
+            requireOneValuePerRow();
+            return values;
+        }
+    }
+
+    for (auto const rowIndex: std::views::iota(std::size_t { 0 }, rowCount))
+    {
+        auto const& row = rowData[rowIndex];
+        SQLUSMALLINT column = 0;
+        ((++column,
+          RequireSuccess(SqlDataBinder<std::remove_cvref_t<decltype(accessors(row))>>::InputParameter(
+              m_hStmt, column, accessors(row), *this))),
+         ...);
+        SqlLogger::GetLogger().OnExecute(m_preparedQuery);
+        RequireExecuteSucceededOrNoData(SQLExecute(m_hStmt));
+        ProcessPostExecuteCallbacks();
+        CollectReturnedValues(values);
+    }
+    requireOneValuePerRow();
+    return values;
+}
+
+template <typename Value>
+void SqlStatement::CollectReturnedValues(std::vector<Value>& values)
+{
+    KeepPendingResultSets();
+    do
+    {
+        SQLSMALLINT columnCount {};
+        RequireSuccess(SQLNumResultCols(m_hStmt, &columnCount));
+        if (columnCount == 0)
+            continue;
+        while (FetchRow())
+            values.emplace_back(GetColumn<Value>(1));
+    } while (NextResultSet());
+    CloseCursor();
+}
+
+template <typename Value, typename GetValue>
+void SqlStatement::BindStagedColumn(SQLUSMALLINT column, std::size_t rowCount, GetValue const& valueAt)
+{
+    if constexpr (SqlIsStdOptional<Value>)
+    {
+        using Inner = Value::value_type;
+        BindStagedColumn<Inner>(column, rowCount, [&](std::size_t i) -> Inner const* {
+            auto const& optional = *valueAt(i);
+            return optional.has_value() ? std::addressof(*optional) : nullptr;
+        });
+    }
+    else if constexpr (SqlHasStagedBatchBinder<Value>)
+        RequireSuccess(SqlDataBinder<Value>::BatchStagedInputParameter(m_hStmt, column, rowCount, valueAt, *this));
+    else
+    {
+        // Fixed-width value: gather the rows into a contiguous array; NULL rows keep a zeroed slot.
+        auto* const values = reinterpret_cast<Value*>(ProvideBatchStagingBuffer(rowCount * sizeof(Value)));
+        auto* const indicators = ProvideInputIndicators(rowCount);
+        for (auto const i: std::views::iota(std::size_t { 0 }, rowCount))
+        {
+            auto const* value = valueAt(i);
+            indicators[i] = value ? SQLLEN { 0 } : SQLLEN { SQL_NULL_DATA };
+            std::construct_at(values + i, value ? *value : Value {});
+        }
+        RequireSuccess(SqlDataBinder<Value>::BatchInputParameter(m_hStmt, column, values, rowCount, *this, indicators));
+    }
+}
+
 template <std::ranges::contiguous_range Rows, typename... ColumnAccessors>
 SqlResultCursor SqlStatement::ExecuteBatchNativeRowWise(Rows const& rows, ColumnAccessors const&... accessors)
 {
@@ -2129,6 +2670,7 @@ inline LIGHTWEIGHT_FORCE_INLINE void SqlStatement::CloseCursor() noexcept
             break;
     }
     SQLFreeStmt(m_hStmt, SQL_CLOSE);
+    m_keepPendingResultSets = false;
     SqlLogger::GetLogger().OnFetchEnd();
 }
 
@@ -24,12 +24,26 @@ template <typename T>
 class ThreadSafeQueue
 {
   public:
+    /// Constructs an unbounded queue.
+    ThreadSafeQueue() = default;
+
+    /// Constructs a bounded queue: Push() blocks while @p capacity items are queued (0 = unbounded).
+    ///
+    /// @param capacity The maximum number of queued items.
+    explicit ThreadSafeQueue(size_t capacity) noexcept:
+        _queue { capacity }
+    {
+    }
+
     /// Pushes an item onto the queue and notifies one waiting consumer.
     ///
+    /// Blocks while a bounded queue is full.
+    ///
     /// @param item The item to push onto the queue.
-    void Push(T item)
+    /// @return true if the item was enqueued; false if a bounded queue was marked finished meanwhile.
+    bool Push(T item)
     {
-        _queue.Push(std::move(item));
+        return _queue.Push(std::move(item));
     }
 
     /// Blocks until an item is available or the queue is finished.
@@ -0,0 +1,410 @@
+// SPDX-License-Identifier: Apache-2.0
+
+#include "MappedZipArchive.hpp"
+
+#include <algorithm>
+#include <cerrno>
+#include <cstdio>
+#include <format>
+#include <memory>
+#include <ranges>
+#include <system_error>
+#include <utility>
+
+#include <zlib.h>
+
+#if defined(_WIN32)
+    #ifndef NOMINMAX
+        #define NOMINMAX
+    #endif
+    #ifndef WIN32_LEAN_AND_MEAN
+        #define WIN32_LEAN_AND_MEAN
+    #endif
+    #include <Windows.h>
+#else
+    #include <sys/mman.h>
+    #include <sys/stat.h>
+#endif
+
+namespace Lightweight::Zip
+{
+
+namespace
+{
+    // Record signatures and fixed sizes, see APPNOTE.TXT sections 4.3.7 to 4.3.16.
+    constexpr uint32_t LocalHeaderSignature = 0x04034b50;
+    constexpr uint32_t CentralHeaderSignature = 0x02014b50;
+    constexpr uint32_t EndOfCentralDirectorySignature = 0x06054b50;
+    constexpr uint32_t Zip64EndOfCentralDirectorySignature = 0x06064b50;
+    constexpr uint32_t Zip64LocatorSignature = 0x07064b50;
+    constexpr uint16_t Zip64ExtraFieldId = 0x0001;
+
+    constexpr size_t LocalHeaderSize = 30;
+    constexpr size_t CentralHeaderSize = 46;
+    constexpr size_t EndOfCentralDirectorySize = 22;
+    constexpr size_t Zip64EndOfCentralDirectorySize = 56;
+    constexpr size_t Zip64LocatorSize = 20;
+    constexpr size_t MaxCommentSize = 0xFFFF;
+
+    constexpr uint16_t EncryptedFlag = 0x0001;
+
+    template <typename T>
+    T ReadLittleEndian(std::span<uint8_t const> bytes, size_t offset) noexcept
+    {
+        T value {};
+        for (auto const i: std::views::iota(0UZ, sizeof(T)))
+            value |= static_cast<T>(static_cast<T>(bytes[offset + i]) << (8 * i));
+        return value;
+    }
+
+    bool Fits(std::span<uint8_t const> bytes, uint64_t offset, uint64_t length) noexcept
+    {
+        return offset <= bytes.size() && length <= bytes.size() - offset;
+    }
+
+    ZipError CorruptArchive(std::string message)
+    {
+        return ZipError::Custom(ZipErrorCode::OpenFailed, "Not a valid ZIP archive: " + std::move(message));
+    }
+
+    /// Replaces the 32-bit sizes and offset of a central directory entry that overflowed them
+    /// with the values of its ZIP64 extra field.
+    void ApplyZip64ExtraField(std::span<uint8_t const> extra, MappedEntryInfo& entry)
+    {
+        size_t pos = 0;
+        while (pos + 4 <= extra.size())
+        {
+            auto const id = ReadLittleEndian<uint16_t>(extra, pos);
+            auto const length = size_t { ReadLittleEndian<uint16_t>(extra, pos + 2) };
+            pos += 4;
+            if (length > extra.size() - pos)
+                return;
+            if (id == Zip64ExtraFieldId)
+            {
+                auto const field = extra.subspan(pos, length);
+                size_t fieldPos = 0;
+                auto const widen = [&](zip_uint64_t& value) {
+                    if (value != 0xFFFF'FFFF || fieldPos + 8 > field.size())
+                        return;
+                    value = ReadLittleEndian<uint64_t>(field, fieldPos);
+                    fieldPos += 8;
+                };
+                // The order is fixed; only the overflowed values are present.
+                widen(entry.size);
+                widen(entry.compressedSize);
+                widen(entry.localHeaderOffset);
+                return;
+            }
+            pos += length;
+        }
+    }
+
+    std::expected<std::vector<MappedEntryInfo>, ZipError> ParseCentralDirectory(std::span<uint8_t const> bytes)
+    {
+        if (bytes.size() < EndOfCentralDirectorySize)
+            return std::unexpected(CorruptArchive("file too small"));
+
+        // The end of central directory record is followed only by the archive comment.
+        auto const last = bytes.size() - EndOfCentralDirectorySize;
+        auto const first = last - std::min(last, MaxCommentSize);
+        std::optional<size_t> eocd;
+        for (auto const pos: std::views::iota(first, last + 1) | std::views::reverse)
+        {
+            if (ReadLittleEndian<uint32_t>(bytes, pos) == EndOfCentralDirectorySignature)
+            {
+                eocd = pos;
+                break;
+            }
+        }
+        if (!eocd)
+            return std::unexpected(CorruptArchive("end of central directory not found"));
+
+        uint64_t entryCount = ReadLittleEndian<uint16_t>(bytes, *eocd + 10);
+        uint64_t directorySize = ReadLittleEndian<uint32_t>(bytes, *eocd + 12);
+        uint64_t directoryOffset = ReadLittleEndian<uint32_t>(bytes, *eocd + 16);
+
+        if (*eocd >= Zip64LocatorSize
+            && ReadLittleEndian<uint32_t>(bytes, *eocd - Zip64LocatorSize) == Zip64LocatorSignature)
+        {
+            auto const zip64Eocd = ReadLittleEndian<uint64_t>(bytes, *eocd - Zip64LocatorSize + 8);
+            if (!Fits(bytes, zip64Eocd, Zip64EndOfCentralDirectorySize)
+                || ReadLittleEndian<uint32_t>(bytes, zip64Eocd) != Zip64EndOfCentralDirectorySignature)
+                return std::unexpected(CorruptArchive("invalid ZIP64 end of central directory"));
+            entryCount = ReadLittleEndian<uint64_t>(bytes, zip64Eocd + 32);
+            directorySize = ReadLittleEndian<uint64_t>(bytes, zip64Eocd + 40);
+            directoryOffset = ReadLittleEndian<uint64_t>(bytes, zip64Eocd + 48);
+        }
+
+        if (!Fits(bytes, directoryOffset, directorySize))
+            return std::unexpected(CorruptArchive("central directory out of bounds"));
+
+        auto const directory = bytes.subspan(directoryOffset, directorySize);
+        std::vector<MappedEntryInfo> entries;
+        entries.reserve(std::min<uint64_t>(entryCount, directory.size() / CentralHeaderSize));
+
+        size_t pos = 0;
+        for (auto const i: std::views::iota(uint64_t { 0 }, entryCount))
+        {
+            if (!Fits(directory, pos, CentralHeaderSize)
+                || ReadLittleEndian<uint32_t>(directory, pos) != CentralHeaderSignature)
+                return std::unexpected(CorruptArchive(std::format("invalid central directory entry {}", i)));
+
+            auto const nameLength = size_t { ReadLittleEndian<uint16_t>(directory, pos + 28) };
+            auto const extraLength = size_t { ReadLittleEndian<uint16_t>(directory, pos + 30) };
+            auto const commentLength = size_t { ReadLittleEndian<uint16_t>(directory, pos + 32) };
+            if (!Fits(directory, pos + CentralHeaderSize, nameLength + extraLength + commentLength))
+                return std::unexpected(CorruptArchive(std::format("truncated central directory entry {}", i)));
+
+            auto const name = directory.subspan(pos + CentralHeaderSize, nameLength);
+            MappedEntryInfo entry {
+                .index = static_cast<zip_int64_t>(i),
+                .name = std::string(reinterpret_cast<char const*>(name.data()), name.size()),
+                .size = ReadLittleEndian<uint32_t>(directory, pos + 24),
+                .crc = ReadLittleEndian<uint32_t>(directory, pos + 16),
+                .compressedSize = ReadLittleEndian<uint32_t>(directory, pos + 20),
+                .method = ReadLittleEndian<uint16_t>(directory, pos + 10),
+                .encrypted = (ReadLittleEndian<uint16_t>(directory, pos + 8) & EncryptedFlag) != 0,
+                .localHeaderOffset = ReadLittleEndian<uint32_t>(directory, pos + 42),
+            };
+            ApplyZip64ExtraField(directory.subspan(pos + CentralHeaderSize + nameLength, extraLength), entry);
+            entries.push_back(std::move(entry));
+
+            pos += CentralHeaderSize + nameLength + extraLength + commentLength;
+        }
+
+        return entries;
+    }
+
+    std::string SystemErrorMessage(std::string_view what, std::filesystem::path const& path, int error)
+    {
+        return std::format("{} {}: {}", what, path.string(), std::error_code(error, std::system_category()).message());
+    }
+
+#if !defined(_WIN32)
+    struct FileCloser
+    {
+        void operator()(std::FILE* file) const noexcept
+        {
+            std::fclose(file);
+        }
+    };
+
+    /// A file opened for reading, closed when it goes out of scope.
+    using ReadOnlyFile = std::unique_ptr<std::FILE, FileCloser>;
+#endif
+} // namespace
+
+MappedZipArchive::MappedZipArchive(void* mapping, size_t size, void* mappingHandle) noexcept:
+    m_mapping { mapping },
+    m_size { size },
+    m_mappingHandle { mappingHandle }
+{
+}
+
+MappedZipArchive::MappedZipArchive(MappedZipArchive&& other) noexcept:
+    m_mapping { std::exchange(other.m_mapping, nullptr) },
+    m_size { std::exchange(other.m_size, 0) },
+    m_mappingHandle { std::exchange(other.m_mappingHandle, nullptr) },
+    m_entries { std::move(other.m_entries) }
+{
+}
+
+MappedZipArchive& MappedZipArchive::operator=(MappedZipArchive&& other) noexcept
+{
+    if (this != &other)
+    {
+        Unmap();
+        m_mapping = std::exchange(other.m_mapping, nullptr);
+        m_size = std::exchange(other.m_size, 0);
+        m_mappingHandle = std::exchange(other.m_mappingHandle, nullptr);
+        m_entries = std::move(other.m_entries);
+    }
+    return *this;
+}
+
+MappedZipArchive::~MappedZipArchive() noexcept
+{
+    Unmap();
+}
+
+void MappedZipArchive::Unmap() noexcept
+{
+    if (!m_mapping)
+        return;
+#if defined(_WIN32)
+    UnmapViewOfFile(m_mapping);
+    CloseHandle(static_cast<HANDLE>(m_mappingHandle));
+#else
+    munmap(m_mapping, m_size);
+#endif
+    m_mapping = nullptr;
+    m_size = 0;
+    m_mappingHandle = nullptr;
+}
+
+std::expected<MappedZipArchive, ZipError> MappedZipArchive::Open(std::filesystem::path const& path)
+{
+#if defined(_WIN32)
+    HANDLE const file = CreateFileW(
+        path.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, nullptr);
+    if (file == INVALID_HANDLE_VALUE)
+        return std::unexpected(ZipError::Custom(
+            ZipErrorCode::OpenFailed, SystemErrorMessage("Cannot open", path, static_cast<int>(GetLastError()))));
+
+    LARGE_INTEGER fileSize {};
+    if (!GetFileSizeEx(file, &fileSize) || fileSize.QuadPart == 0)
+    {
+        CloseHandle(file);
+        return std::unexpected(CorruptArchive("empty file"));
+    }
+
+    HANDLE const mapping = CreateFileMappingW(file, nullptr, PAGE_READONLY, 0, 0, nullptr);
+    CloseHandle(file);
+    if (!mapping)
+        return std::unexpected(ZipError::Custom(
+            ZipErrorCode::OpenFailed, SystemErrorMessage("Cannot map", path, static_cast<int>(GetLastError()))));
+
+    void* const view = MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0);
+    if (!view)
+    {
+        auto const error = static_cast<int>(GetLastError());
+        CloseHandle(mapping);
+        return std::unexpected(ZipError::Custom(ZipErrorCode::OpenFailed, SystemErrorMessage("Cannot map", path, error)));
+    }
+
+    MappedZipArchive archive { view, static_cast<size_t>(fileSize.QuadPart), static_cast<void*>(mapping) };
+#else
+    // std::fopen() instead of the variadic ::open(); the mapping keeps the file referenced once it is closed.
+    auto const file = ReadOnlyFile { std::fopen(path.c_str(), "rb") };
+    if (!file)
+        return std::unexpected(ZipError::Custom(ZipErrorCode::OpenFailed, SystemErrorMessage("Cannot open", path, errno)));
+
+    int const fd = ::fileno(file.get());
+    struct stat status {};
+    if (::fstat(fd, &status) != 0 || !S_ISREG(status.st_mode) || status.st_size == 0)
+        return std::unexpected(CorruptArchive("not a non-empty regular file"));
+
+    auto const size = static_cast<size_t>(status.st_size);
+    void* const view = ::mmap(nullptr, size, PROT_READ, MAP_PRIVATE, fd, 0);
+    if (view == MAP_FAILED)
+        return std::unexpected(ZipError::Custom(ZipErrorCode::OpenFailed, SystemErrorMessage("Cannot map", path, errno)));
+
+    MappedZipArchive archive { view, size, nullptr };
+#endif
+
+    auto entries = ParseCentralDirectory(archive.Bytes());
+    if (!entries)
+        return std::unexpected(std::move(entries.error()));
+    archive.m_entries = std::move(*entries);
+    return archive;
+}
+
+std::vector<MappedEntryInfo> const& MappedZipArchive::Entries() const noexcept
+{
+    return m_entries;
+}
+
+std::optional<zip_int64_t> MappedZipArchive::LocateEntry(std::string_view name) const
+{
+    auto const it = std::ranges::find(m_entries, name, &MappedEntryInfo::name);
+    if (it == m_entries.end())
+        return std::nullopt;
+    return it->index;
+}
+
+std::span<uint8_t const> MappedZipArchive::Bytes() const noexcept
+{
+    return { static_cast<uint8_t const*>(m_mapping), m_size };
+}
+
+std::expected<std::span<uint8_t const>, ZipError> MappedZipArchive::RawEntryData(zip_int64_t index) const
+{
+    if (index < 0 || std::cmp_greater_equal(index, m_entries.size()))
+        return std::unexpected(
+            ZipError::Custom(ZipErrorCode::EntryNotFound, std::format("No entry with index {}", index)));
+
+    auto const bytes = Bytes();
+    auto const& entry = m_entries[static_cast<size_t>(index)];
+    auto const header = entry.localHeaderOffset;
+    if (!Fits(bytes, header, LocalHeaderSize) || ReadLittleEndian<uint32_t>(bytes, header) != LocalHeaderSignature)
+        return std::unexpected(
+            ZipError::Custom(ZipErrorCode::ReadFailed, std::format("Invalid local header of {}", entry.name)));
+
+    // The local header's name and extra field may differ from the central directory's.
+    auto const dataOffset = header + LocalHeaderSize + ReadLittleEndian<uint16_t>(bytes, header + 26)
+                            + ReadLittleEndian<uint16_t>(bytes, header + 28);
+    if (!Fits(bytes, dataOffset, entry.compressedSize))
+        return std::unexpected(
+            ZipError::Custom(ZipErrorCode::ReadFailed, std::format("Data of {} exceeds the archive", entry.name)));
+
+    return bytes.subspan(dataOffset, entry.compressedSize);
+}
+
+MappedZipReader::MappedZipReader(MappedZipArchive const& archive) noexcept:
+    m_archive { &archive }
+{
+}
+
+MappedZipReader::~MappedZipReader() noexcept
+{
+    if (m_zip)
+        zip_discard(m_zip);
+}
+
+std::expected<std::span<uint8_t const>, ZipError> MappedZipReader::Read(zip_int64_t index)
+{
+    auto data = m_archive->RawEntryData(index);
+    if (!data)
+        return data;
+
+    auto const& entry = m_archive->Entries()[static_cast<size_t>(index)];
+    if (entry.method == ZIP_CM_STORE && !entry.encrypted && entry.size == entry.compressedSize)
+    {
+        // libzip checks the CRC-32 of the entries it decompresses; the view skips libzip, so check it here.
+        if (crc32_z(0, data->data(), data->size()) != entry.crc)
+            return std::unexpected(
+                ZipError::Custom(ZipErrorCode::ReadFailed, std::format("CRC-32 mismatch in {}", entry.name)));
+        return data;
+    }
+
+    if (!m_zip)
+    {
+        // The source borrows the mapping (freep = 0); libzip reads it like a file, without copying it.
+        auto const bytes = m_archive->Bytes();
+        zip_error_t error;
+        zip_error_init(&error);
+        zip_source_t* source = zip_source_buffer_create(bytes.data(), bytes.size(), 0, &error);
+        if (source)
+        {
+            m_zip = zip_open_from_source(source, ZIP_RDONLY, &error);
+            if (!m_zip)
+                zip_source_free(source);
+        }
+        if (!m_zip)
+        {
+            auto result = ZipError {
+                .code = ZipErrorCode::OpenFailed,
+                .libzipError = zip_error_code_zip(&error),
+                .message = zip_error_strerror(&error),
+            };
+            zip_error_fini(&error);
+            return std::unexpected(std::move(result));
+        }
+        zip_error_fini(&error);
+    }
+
+    zip_file_t* file = zip_fopen_index(m_zip, static_cast<zip_uint64_t>(index), 0);
+    if (!file)
+        return std::unexpected(ZipError::FromArchive(m_zip, ZipErrorCode::OpenFailed));
+
+    m_buffer.resize(entry.size);
+    zip_int64_t const bytesRead = zip_fread(file, m_buffer.data(), m_buffer.size());
+    zip_fclose(file);
+    if (bytesRead < 0 || std::cmp_not_equal(bytesRead, m_buffer.size()))
+        return std::unexpected(
+            ZipError::Custom(ZipErrorCode::ReadFailed, std::format("Failed to decompress {}", entry.name)));
+
+    return std::span<uint8_t const> { m_buffer };
+}
+
+} // namespace Lightweight::Zip
@@ -0,0 +1,138 @@
+// SPDX-License-Identifier: Apache-2.0
+
+#pragma once
+
+#include "../Api.hpp"
+#include "ZipError.hpp"
+
+#include <cstddef>
+#include <cstdint>
+#include <expected>
+#include <filesystem>
+#include <optional>
+#include <span>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#if defined(__clang__)
+    #pragma clang diagnostic push
+    #pragma clang diagnostic ignored "-Wnullability-extension"
+#endif
+#include <zip.h>
+#if defined(__clang__)
+    #pragma clang diagnostic pop
+#endif
+
+namespace Lightweight::Zip
+{
+
+/// Information about an entry of a MappedZipArchive, as recorded in the central directory.
+struct MappedEntryInfo
+{
+    zip_int64_t index {};              ///< Index of the entry in the archive (central directory order)
+    std::string name;                  ///< Name of the entry
+    zip_uint64_t size {};              ///< Uncompressed size in bytes
+    zip_uint32_t crc {};               ///< CRC-32 of the uncompressed content
+    zip_uint64_t compressedSize {};    ///< Compressed size in bytes
+    zip_int32_t method {};             ///< Compression method (ZIP_CM_*)
+    bool encrypted {};                 ///< True if the entry's data is encrypted
+    zip_uint64_t localHeaderOffset {}; ///< Offset of the entry's local file header
+};
+
+/// A read-only ZIP archive mapped into memory.
+///
+/// The central directory is parsed once on Open(). Stored (uncompressed) entries can then be read
+/// as views straight into the mapping, without a copy and without a lock, from any thread.
+/// Compressed entries are read through a MappedZipReader.
+///
+/// RawEntryData() does not check the CRC-32 of an entry; MappedZipReader::Read() does.
+///
+/// MappedZipArchive objects are non-copyable but movable; views and readers refer to the
+/// mapping, so they must not outlive the archive.
+class LIGHTWEIGHT_API MappedZipArchive final
+{
+  public:
+    MappedZipArchive(MappedZipArchive const&) = delete;
+    MappedZipArchive& operator=(MappedZipArchive const&) = delete;
+
+    /// Move constructor. Transfers ownership of the mapping.
+    MappedZipArchive(MappedZipArchive&& other) noexcept;
+
+    /// Move assignment operator. Transfers ownership of the mapping.
+    MappedZipArchive& operator=(MappedZipArchive&& other) noexcept;
+
+    /// Destructor. Unmaps the archive.
+    ~MappedZipArchive() noexcept;
+
+    /// Maps a local ZIP archive and parses its central directory.
+    ///
+    /// @param path The path to the archive file.
+    /// @return The mapped archive, or a ZipError if the file cannot be mapped or is no ZIP archive.
+    [[nodiscard]] static std::expected<MappedZipArchive, ZipError> Open(std::filesystem::path const& path);
+
+    /// Returns the entries of the archive, in central directory order (the order of libzip's indexes).
+    [[nodiscard]] std::vector<MappedEntryInfo> const& Entries() const noexcept;
+
+    /// Locates an entry by name.
+    ///
+    /// @param name The name of the entry to find.
+    /// @return The entry index, or std::nullopt if not found.
+    [[nodiscard]] std::optional<zip_int64_t> LocateEntry(std::string_view name) const;
+
+    /// Returns the whole mapped file.
+    [[nodiscard]] std::span<uint8_t const> Bytes() const noexcept;
+
+    /// Returns the data of an entry as stored in the archive, a view into the mapping.
+    ///
+    /// For stored entries this is the entry's content; for compressed entries the compressed bytes.
+    ///
+    /// @param index The entry index.
+    /// @return The entry's data, or a ZipError if the index is invalid or the entry's header is corrupt.
+    [[nodiscard]] std::expected<std::span<uint8_t const>, ZipError> RawEntryData(zip_int64_t index) const;
+
+  private:
+    MappedZipArchive(void* mapping, size_t size, void* mappingHandle) noexcept;
+
+    void Unmap() noexcept;
+
+    void* m_mapping {}; ///< The mapped view, mapped read-only
+    size_t m_size {};
+    void* m_mappingHandle {}; ///< Windows file mapping object (unused elsewhere)
+    std::vector<MappedEntryInfo> m_entries;
+};
+
+/// Reads entries of a MappedZipArchive, one reader per thread.
+///
+/// Stored entries are returned as views into the mapping, once their CRC-32 matches the central
+/// directory. Compressed entries are decompressed into the reader's buffer, which is reused from
+/// read to read; their view stays valid until the next Read(). Decompression goes through a libzip
+/// handle opened over the mapping on first use, so it needs neither file I/O nor a lock shared with
+/// other readers.
+class LIGHTWEIGHT_API MappedZipReader final
+{
+  public:
+    /// Creates a reader for @p archive, which must outlive the reader and not be moved meanwhile.
+    explicit MappedZipReader(MappedZipArchive const& archive) noexcept;
+
+    MappedZipReader(MappedZipReader const&) = delete;
+    MappedZipReader& operator=(MappedZipReader const&) = delete;
+    MappedZipReader(MappedZipReader&&) = delete;
+    MappedZipReader& operator=(MappedZipReader&&) = delete;
+
+    /// Destructor. Closes the reader's libzip handle, if any.
+    ~MappedZipReader() noexcept;
+
+    /// Reads the content of an entry.
+    ///
+    /// @param index The entry index.
+    /// @return A view of the entry's content, or a ZipError on failure.
+    [[nodiscard]] std::expected<std::span<uint8_t const>, ZipError> Read(zip_int64_t index);
+
+  private:
+    MappedZipArchive const* m_archive;
+    zip_t* m_zip {};
+    std::vector<uint8_t> m_buffer;
+};
+
+} // namespace Lightweight::Zip
@@ -0,0 +1,179 @@
+// SPDX-License-Identifier: Apache-2.0
+//
+// Executor throughput / latency benchmark.
+//
+// Replays the scheduling pattern of many coroutines sharing a few connections, without a database:
+// every "coroutine" is a chain of hops, each hop being an offloaded ODBC call on its connection's
+// strand (simulated by a short spin) followed by the resumption on the pool, which then offloads
+// the next call. That is the shape Async::RunAsync produces for `co_await dm.XxxAsync(...)` loops.
+//
+// For each ThreadPoolScheduling mode it reports the hop throughput and the p50 / p99 latency from
+// posting a hop to its strand until the hop starts running.
+//
+// Usage: LightweightExecutorBenchmark [workers] [connections] [coroutines] [hops] [spinMicros]
+
+#include <Lightweight/Async/StrandExecutor.hpp>
+#include <Lightweight/Async/ThreadPoolExecutor.hpp>
+
+#include <algorithm>
+#include <chrono>
+#include <cstddef>
+#include <cstdlib>
+#include <latch>
+#include <memory>
+#include <print>
+#include <ranges>
+#include <string_view>
+#include <thread>
+#include <vector>
+
+using namespace Lightweight::Async;
+using Clock = std::chrono::steady_clock;
+
+namespace
+{
+
+struct BenchmarkSettings
+{
+    std::size_t workers = std::max(2U, std::thread::hardware_concurrency());
+    std::size_t connections = 64;
+    std::size_t coroutines = 2000;
+    std::size_t hops = 200;
+    std::chrono::microseconds spin { 2 };
+};
+
+struct BenchmarkResult
+{
+    double hopsPerSecond {};
+    std::chrono::nanoseconds p50 {};
+    std::chrono::nanoseconds p99 {};
+};
+
+/// Busy-waits for @p duration, standing in for the blocking ODBC call of one hop.
+void Spin(std::chrono::microseconds duration)
+{
+    auto const until = Clock::now() + duration;
+    while (Clock::now() < until)
+        ;
+}
+
+/// One simulated coroutine: its connection's strand, and the queue latency of every hop it made.
+struct Chain
+{
+    StrandExecutor* strand {};
+    std::vector<std::chrono::nanoseconds> latencies;
+};
+
+class Runner
+{
+  public:
+    Runner(BenchmarkSettings const& settings, ThreadPoolExecutor& pool, std::latch& done):
+        _settings { settings },
+        _pool { pool },
+        _done { done }
+    {
+    }
+
+    /// Offloads hop @p hop of @p chain to its strand; the hop resumes on the pool and offloads the next.
+    void Offload(Chain& chain, std::size_t hop)
+    {
+        auto const posted = Clock::now();
+        chain.strand->Post([this, &chain, hop, posted] {
+            chain.latencies.push_back(Clock::now() - posted);
+            Spin(_settings.spin);
+            if (hop + 1 == _settings.hops)
+            {
+                _done.count_down();
+                return;
+            }
+            _pool.Post([this, &chain, hop] { Offload(chain, hop + 1); });
+        });
+    }
+
+  private:
+    BenchmarkSettings const& _settings;
+    ThreadPoolExecutor& _pool;
+    std::latch& _done;
+};
+
+BenchmarkResult Run(BenchmarkSettings const& settings, ThreadPoolScheduling scheduling)
+{
+    auto latencies = std::vector<std::chrono::nanoseconds> {};
+    auto elapsed = Clock::duration {};
+    {
+        ThreadPoolExecutor pool { settings.workers, scheduling };
+        auto strands = std::vector<std::unique_ptr<StrandExecutor>> {};
+        for ([[maybe_unused]] auto const _: std::views::iota(std::size_t { 0 }, settings.connections))
+            strands.push_back(std::make_unique<StrandExecutor>(pool));
+
+        auto chains = std::vector<Chain>(settings.coroutines);
+        for (auto&& [index, chain]: chains | std::views::enumerate)
+        {
+            chain.strand = strands[static_cast<std::size_t>(index) % strands.size()].get();
+            chain.latencies.reserve(settings.hops);
+        }
+
+        std::latch done { static_cast<std::ptrdiff_t>(settings.coroutines) };
+        Runner runner { settings, pool, done };
+        auto const start = Clock::now();
+        for (auto& chain: chains)
+            pool.Post([&runner, &chain] { runner.Offload(chain, 0); });
+        done.wait();
+        elapsed = Clock::now() - start;
+
+        for (auto const& chain: chains)
+            latencies.insert(latencies.end(), chain.latencies.begin(), chain.latencies.end());
+    }
+
+    std::ranges::sort(latencies);
+    auto const percentile = [&latencies](double p) {
+        return latencies[static_cast<std::size_t>(p * static_cast<double>(latencies.size() - 1))];
+    };
+    return BenchmarkResult {
+        .hopsPerSecond = static_cast<double>(latencies.size()) / std::chrono::duration<double>(elapsed).count(),
+        .p50 = percentile(0.50),
+        .p99 = percentile(0.99),
+    };
+}
+
+std::size_t ArgOr(int argc, char** argv, int index, std::size_t fallback)
+{
+    return index < argc ? static_cast<std::size_t>(std::strtoull(argv[index], nullptr, 10)) : fallback;
+}
+
+} // namespace
+
+int main(int argc, char** argv)
+{
+    auto settings = BenchmarkSettings {};
+    settings.workers = ArgOr(argc, argv, 1, settings.workers);
+    settings.connections = ArgOr(argc, argv, 2, settings.connections);
+    settings.coroutines = ArgOr(argc, argv, 3, settings.coroutines);
+    settings.hops = ArgOr(argc, argv, 4, settings.hops);
+    settings.spin = std::chrono::microseconds { ArgOr(argc, argv, 5, static_cast<std::size_t>(settings.spin.count())) };
+    if (settings.workers == 0 || settings.connections == 0 || settings.coroutines == 0 || settings.hops == 0)
+    {
+        std::println(stderr, "workers, connections, coroutines and hops must be >= 1");
+        return EXIT_FAILURE;
+    }
+
+    std::println("{} workers, {} connections, {} coroutines x {} hops, {} us per call",
+                 settings.workers,
+                 settings.connections,
+                 settings.coroutines,
+                 settings.hops,
+                 settings.spin.count());
+    std::println("{:<14} {:>14} {:>12} {:>12}", "scheduling", "hops/s", "p50 [us]", "p99 [us]");
+
+    auto const report = [&settings](std::string_view name, ThreadPoolScheduling scheduling) {
+        auto const result = Run(settings, scheduling);
+        std::println("{:<14} {:>14.0f} {:>12.1f} {:>12.1f}",
+                     name,
+                     result.hopsPerSecond,
+                     std::chrono::duration<double, std::micro>(result.p50).count(),
+                     std::chrono::duration<double, std::micro>(result.p99).count());
+    };
+    report("Shared", ThreadPoolScheduling::Shared);
+    report("WorkStealing", ThreadPoolScheduling::WorkStealing);
+    return EXIT_SUCCESS;
+}
@@ -0,0 +1,111 @@
+// SPDX-License-Identifier: Apache-2.0
+//
+// GUID primary key insert throughput benchmark.
+//
+// Inserts the same rows into two tables that differ only in how their GUID primary key is generated:
+// `PrimaryKey::AutoAssign` (SqlGuid::Create(), effectively random index positions) and
+// `PrimaryKey::AutoAssignSequential` (SqlGuid::CreateSequential(), appending to the index). On servers
+// that cluster by primary key, the gap widens with the table size, as random keys keep splitting
+// pages all over the index while sequential keys only ever touch its last page.
+//
+// Usage: LightweightGuidInsertBenchmark <connection-string> [rows] [rowsPerTransaction]
+
+#include <Lightweight/Lightweight.hpp>
+
+#include <algorithm>
+#include <chrono>
+#include <cstddef>
+#include <cstdlib>
+#include <exception>
+#include <format>
+#include <print>
+#include <ranges>
+#include <string_view>
+
+using namespace Lightweight;
+using Clock = std::chrono::steady_clock;
+
+namespace
+{
+
+struct RandomGuidKeyRow
+{
+    Field<SqlGuid, PrimaryKey::AutoAssign> id;
+    Field<int64_t> sequence;
+    Field<SqlAnsiString<64>> payload;
+};
+
+struct SequentialGuidKeyRow
+{
+    Field<SqlGuid, PrimaryKey::AutoAssignSequential> id;
+    Field<int64_t> sequence;
+    Field<SqlAnsiString<64>> payload;
+};
+
+/// Recreates the table of @p Row, inserts @p rows rows and returns the achieved rows per second.
+template <typename Row>
+double InsertRows(DataMapper& dm, std::size_t rows, std::size_t rowsPerTransaction)
+{
+    {
+        auto stmt = SqlStatement { dm.Connection() };
+        (void) stmt.ExecuteDirect(std::format(R"sql(DROP TABLE IF EXISTS "{}")sql", RecordTableName<Row>));
+    }
+    dm.CreateTable<Row>();
+
+    auto const start = Clock::now();
+    for (auto const first: std::views::iota(std::size_t { 0 }, rows) | std::views::stride(rowsPerTransaction))
+    {
+        auto transaction = SqlTransaction { dm.Connection() };
+        for (auto const i: std::views::iota(first, std::min(first + rowsPerTransaction, rows)))
+        {
+            auto row = Row { .sequence = static_cast<int64_t>(i), .payload = "benchmark payload" };
+            dm.Create(row);
+        }
+        transaction.Commit();
+    }
+    auto const elapsed = std::chrono::duration<double>(Clock::now() - start).count();
+    return static_cast<double>(rows) / elapsed;
+}
+
+std::size_t ArgOr(int argc, char** argv, int index, std::size_t fallback)
+{
+    return index < argc ? static_cast<std::size_t>(std::strtoull(argv[index], nullptr, 10)) : fallback;
+}
+
+} // namespace
+
+int main(int argc, char** argv)
+{
+    if (argc < 2)
+    {
+        std::println(stderr, "Usage: {} <connection-string> [rows] [rowsPerTransaction]", argv[0]);
+        return EXIT_FAILURE;
+    }
+
+    auto const rows = ArgOr(argc, argv, 2, 100'000);
+    auto const rowsPerTransaction = ArgOr(argc, argv, 3, 1'000);
+    if (rows == 0 || rowsPerTransaction == 0)
+    {
+        std::println(stderr, "rows and rowsPerTransaction must be >= 1");
+        return EXIT_FAILURE;
+    }
+
+    try
+    {
+        SqlConnection::SetDefaultConnectionString(SqlConnectionString { .value = argv[1] });
+        auto dm = DataMapper {};
+        std::println("{} rows, {} rows per transaction, server: {}",
+                     rows,
+                     rowsPerTransaction,
+                     dm.Connection().ServerName());
+        std::println("{:<12} {:>14}", "key", "rows/s");
+        std::println("{:<12} {:>14.0f}", "random", InsertRows<RandomGuidKeyRow>(dm, rows, rowsPerTransaction));
+        std::println("{:<12} {:>14.0f}", "sequential", InsertRows<SequentialGuidKeyRow>(dm, rows, rowsPerTransaction));
+    }
+    catch (std::exception const& e)
+    {
+        std::println(stderr, "Benchmark failed: {}", e.what());
+        return EXIT_FAILURE;
+    }
+    return EXIT_SUCCESS;
+}
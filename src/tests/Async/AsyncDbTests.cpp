@@ -9,6 +9,7 @@
 
 #include <Lightweight/Async/Backend.hpp>
 #include <Lightweight/Async/Executor.hpp>
+#include <Lightweight/Async/Generator.hpp>
 #include <Lightweight/Async/ManualExecutor.hpp>
 #include <Lightweight/Async/StrandExecutor.hpp>
 #include <Lightweight/Async/SyncWait.hpp>
@@ -21,6 +22,8 @@
 #include <memory>
 #include <ranges>
 #include <stdexcept>
+#include <stop_token>
+#include <vector>
 
 using namespace Lightweight;
 using namespace Lightweight::Async;
@@ -188,3 +191,122 @@ TEST_CASE_METHOD(SqlTestFixture, "Async.DataMapper: async method without EnableA
     dm.CreateTables<Person>();
     CHECK_THROWS_AS((void) dm.QueryAsync<Person>().All(), std::logic_error);
 }
+
+TEST_CASE_METHOD(SqlTestFixture, "Async.DataMapper: Stream() yields the result in blocks", "[Async][DataMapper]")
+{
+    ThreadPoolExecutor dbWorkers { 1 };
+    ManualExecutor appLoop;
+
+    DataMapper dm;
+    dm.Connection().EnableAsync(dbWorkers, appLoop);
+    dm.CreateTables<Person>();
+
+    for (auto const index: std::views::iota(0, 7))
+    {
+        auto person = Person { .id = SqlGuid::Create(), .name = "P", .age = 20 + index };
+        dm.Create(person);
+    }
+
+    SECTION("every record arrives, in blocks of at most blockRows")
+    {
+        auto drain = [&dm]() -> Task<std::vector<size_t>> {
+            auto blockSizes = std::vector<size_t> {};
+            auto stream =
+                dm.QueryAsync<Person>().OrderBy(FieldNameOf<Member(Person::age)>, SqlResultOrdering::ASCENDING).Stream(3);
+            auto expectedAge = 20;
+            while (auto block = co_await stream.Next())
+            {
+                blockSizes.push_back(block->size());
+                for (auto const& person: *block)
+                    CHECK(person.age.Value() == expectedAge++);
+            }
+            co_return blockSizes;
+        };
+        CHECK(RunPumped(drain, appLoop) == std::vector<size_t> { 3, 3, 1 });
+    }
+
+    SECTION("a stopped token closes the cursor mid-stream")
+    {
+        std::stop_source source;
+        auto consume = [&]() -> Task<size_t> {
+            auto stream = dm.QueryAsync<Person>().Stream(2, source.get_token());
+            auto const first = co_await stream.Next();
+            source.request_stop();
+            auto cancelled = false;
+            try
+            {
+                (void) co_await stream.Next();
+            }
+            catch (OperationCancelledError const&)
+            {
+                cancelled = true;
+            }
+            CHECK(cancelled);
+            co_return first ? first->size() : 0;
+        };
+        CHECK(RunPumped(consume, appLoop) == 2);
+
+        // The connection is usable again once the stream is cancelled.
+        CHECK(SyncWaitPumping(dm.QueryAsync<Person>().Count(), appLoop) == 7);
+    }
+}
+
+TEST_CASE_METHOD(SqlTestFixture, "Async.SqlStatement: StreamDirectAsync yields variant rows", "[Async]")
+{
+    ThreadPoolExecutor dbWorkers { 1 };
+    ManualExecutor appLoop;
+
+    DataMapper dm;
+    dm.Connection().EnableAsync(dbWorkers, appLoop);
+    dm.CreateTables<Person>();
+    for (auto const index: std::views::iota(0, 4))
+    {
+        auto person = Person { .id = SqlGuid::Create(), .name = "P", .age = index };
+        dm.Create(person);
+    }
+
+    auto stmt = SqlStatement { dm.Connection() };
+    auto drain = [&stmt]() -> Task<size_t> {
+        auto rows = size_t {};
+        auto stream = stmt.StreamDirectAsync(R"(SELECT "age" FROM "Person")", 3);
+        while (auto block = co_await stream.Next())
+        {
+            CHECK(block->size() <= 3);
+            rows += block->size();
+        }
+        co_return rows;
+    };
+    CHECK(RunPumped(drain, appLoop) == 4);
+}
+
+TEST_CASE_METHOD(SqlTestFixture, "Async.DataMapper: QueryManyAsync runs independent SELECTs together", "[Async][DataMapper]")
+{
+    ThreadPoolExecutor dbWorkers { 1 };
+    ManualExecutor appLoop;
+
+    DataMapper dm;
+    dm.Connection().EnableAsync(dbWorkers, appLoop);
+    dm.CreateTables<Person>();
+    for (auto const index: std::views::iota(0, 5))
+    {
+        auto person = Person { .id = SqlGuid::Create(), .name = "P", .age = 20 + index };
+        dm.Create(person);
+    }
+
+    // Whether this is one multi-result round-trip or back-to-back queries depends on the dialect;
+    // either way the results arrive typed and in argument order.
+    auto const [young, old] =
+        SyncWaitPumping(dm.QueryManyAsync(dm.QueryAsync<Person>().Where(FieldNameOf<Member(Person::age)>, "<", 22),
+                                          dm.QueryAsync<Person>().Where(FieldNameOf<Member(Person::age)>, ">=", 22)),
+                        appLoop);
+    CHECK(young.size() == 2);
+    CHECK(old.size() == 3);
+
+    auto const [syncYoung, syncOld] = dm.QueryMany(dm.Query<Person>().Where(FieldNameOf<Member(Person::age)>, "<", 22),
+                                                   dm.Query<Person>().Where(FieldNameOf<Member(Person::age)>, ">=", 22));
+    CHECK(syncYoung.size() == young.size());
+    CHECK(syncOld.size() == old.size());
+
+    // The connection is usable again after the batch.
+    CHECK(SyncWaitPumping(dm.QueryAsync<Person>().Count(), appLoop) == 5);
+}
@@ -20,8 +20,12 @@
 
 #include <atomic>
 #include <optional>
+#include <ranges>
+#include <string>
 #include <stdexcept>
 #include <thread>
+#include <utility>
+#include <vector>
 
 using namespace Lightweight;
 using namespace Lightweight::Async;
@@ -379,3 +383,173 @@ TEST_CASE_METHOD(SqlTestFixture,
     appLoop.Drain();
     REQUIRE(task.IsReady());
 }
+
+TEST_CASE_METHOD(SqlTestFixture, "Async.Pool: QueryManyAsync fans out and returns every mapper", "[Async][Pool]")
+{
+    ThreadPoolExecutor dbWorkers { 2 };
+    ManualExecutor appLoop;
+    // A two-mapper pool: the fan-out only completes if the probing mapper is returned before both
+    // mappers are reserved for the two queries.
+    auto pool = Pool<PoolConfig { .initialSize = 2, .maxSize = 2, .growthStrategy = GrowthStrategy::BoundedWait }>();
+    pool.SetAsyncExecutors(dbWorkers, appLoop);
+
+    {
+        DataMapper dm;
+        dm.CreateTables<Person>();
+        for (auto const index: std::views::iota(0, 4))
+        {
+            auto person = Person { .id = SqlGuid::Create(), .name = "P", .age = index };
+            dm.Create(person);
+        }
+    }
+
+    auto const counts = RunPumped(
+        [&]() -> Task<std::pair<size_t, size_t>> {
+            auto builder = DataMapper {};
+            auto const [low, high] =
+                co_await pool.QueryManyAsync(builder.Query<Person>().Where(FieldNameOf<Member(Person::age)>, "<", 2),
+                                             builder.Query<Person>().Where(FieldNameOf<Member(Person::age)>, ">=", 2));
+            co_return std::pair { low.size(), high.size() };
+        },
+        appLoop);
+    CHECK(counts == std::pair<size_t, size_t> { 2, 2 });
+    CHECK(pool.IdleCount() == 2);
+}
+
+TEST_CASE_METHOD(SqlTestFixture, "Async.Pool: QueryManyAsync runs on one mapper if the pool is too small", "[Async][Pool]")
+{
+    ThreadPoolExecutor dbWorkers { 2 };
+    ManualExecutor appLoop;
+    // Reserving two mappers from a single-mapper pool could never succeed.
+    auto pool = Pool<PoolConfig { .initialSize = 1, .maxSize = 1, .growthStrategy = GrowthStrategy::BoundedWait }>();
+    pool.SetAsyncExecutors(dbWorkers, appLoop);
+
+    {
+        DataMapper dm;
+        dm.CreateTables<Person>();
+        for (auto const index: std::views::iota(0, 4))
+        {
+            auto person = Person { .id = SqlGuid::Create(), .name = "P", .age = index };
+            dm.Create(person);
+        }
+    }
+
+    auto const counts = RunPumped(
+        [&]() -> Task<std::pair<size_t, size_t>> {
+            auto builder = DataMapper {};
+            auto const [low, high] =
+                co_await pool.QueryManyAsync(builder.Query<Person>().Where(FieldNameOf<Member(Person::age)>, "<", 1),
+                                             builder.Query<Person>().Where(FieldNameOf<Member(Person::age)>, ">=", 1));
+            co_return std::pair { low.size(), high.size() };
+        },
+        appLoop);
+    CHECK(counts == std::pair<size_t, size_t> { 1, 3 });
+    CHECK(pool.IdleCount() == 1);
+}
+
+namespace
+{
+using SingleMapperPool = Pool<PoolConfig { .initialSize = 1, .maxSize = 1, .growthStrategy = GrowthStrategy::BoundedWait }>;
+
+Task<void> AcquireAndRecord(SingleMapperPool* pool,
+                            AcquirePriority priority,
+                            std::string name,
+                            std::vector<std::string>* order)
+{
+    auto dm = co_await pool->AcquireAsync(priority);
+    order->push_back(std::move(name));
+    // dm returns to the pool here, handing off to the next waiter
+}
+} // namespace
+
+TEST_CASE_METHOD(SqlTestFixture, "Async.Pool: interactive waiters are served before queued batch waiters", "[Async][Pool]")
+{
+    ThreadPoolExecutor dbWorkers { 1 };
+    ManualExecutor appLoop;
+    auto pool = SingleMapperPool();
+    pool.SetAsyncExecutors(dbWorkers, appLoop);
+
+    std::optional holder { pool.Acquire() }; // exhaust the pool
+
+    // Two batch jobs park first, then two interactive requests arrive.
+    std::vector<std::string> order;
+    std::vector<Task<void>> tasks;
+    tasks.push_back(AcquireAndRecord(&pool, AcquirePriority::Batch, "batch-1", &order));
+    tasks.push_back(AcquireAndRecord(&pool, AcquirePriority::Batch, "batch-2", &order));
+    tasks.push_back(AcquireAndRecord(&pool, AcquirePriority::Interactive, "interactive-1", &order));
+    tasks.push_back(AcquireAndRecord(&pool, AcquirePriority::Interactive, "interactive-2", &order));
+    for (auto& task: tasks)
+        task.GetHandle().resume(); // park on the exhausted pool
+    REQUIRE(pool.WaiterCount() == 4);
+
+    holder.reset();
+    appLoop.Drain();
+
+    // With the default interactiveWeight (4) both interactive waiters jump the batch queue, which
+    // itself stays in arrival order.
+    CHECK(order == std::vector<std::string> { "interactive-1", "interactive-2", "batch-1", "batch-2" });
+    CHECK(pool.IdleCount() == 1);
+
+    auto const batch = pool.WaitStatistics(AcquirePriority::Batch);
+    CHECK(batch.acquisitions == 2);
+    CHECK(batch.waited == 2);
+    CHECK(batch.maxWait >= batch.totalWait / 2);
+    auto const interactive = pool.WaitStatistics(AcquirePriority::Interactive);
+    CHECK(interactive.acquisitions == 3); // including the synchronous holder, which did not wait
+    CHECK(interactive.waited == 2);
+}
+
+TEST_CASE_METHOD(SqlTestFixture, "Async.Pool: AcquireManyAsync reserves all mappers at once", "[Async][Pool]")
+{
+    ThreadPoolExecutor dbWorkers { 1 };
+    ManualExecutor appLoop;
+    auto pool = Pool<PoolConfig { .initialSize = 3, .maxSize = 3, .growthStrategy = GrowthStrategy::BoundedWait }>();
+    pool.SetAsyncExecutors(dbWorkers, appLoop);
+
+    CHECK_THROWS_AS((void) pool.AcquireManyAsync(4), std::invalid_argument);
+
+    std::optional holder { pool.Acquire() };
+
+    SECTION("the reservation collects returned mappers ahead of later single waiters")
+    {
+        size_t reserved = 0;
+        bool singleAcquired = false;
+        auto many = [](decltype(pool)* p, size_t* count) -> Task<void> {
+            auto mappers = co_await p->AcquireManyAsync(3);
+            for (auto const& dm: mappers)
+                CHECK(dm->Connection().IsAsyncEnabled());
+            *count = mappers.size();
+        }(&pool, &reserved);
+        many.GetHandle().resume();
+        // The two idle mappers are already claimed by the parked reservation.
+        CHECK(pool.IdleCount() == 0);
+        CHECK(pool.WaiterCount() == 1);
+
+        auto single = [](decltype(pool)* p, bool* acquired) -> Task<void> {
+            auto dm = co_await p->AcquireAsync();
+            *acquired = true;
+        }(&pool, &singleAcquired);
+        single.GetHandle().resume();
+        CHECK(pool.WaiterCount() == 2);
+
+        holder.reset();
+        appLoop.Drain();
+        CHECK(reserved == 3);
+        CHECK(singleAcquired);
+        CHECK(pool.IdleCount() == 3);
+    }
+
+    SECTION("dropping a collecting reservation gives its mappers back")
+    {
+        {
+            auto many = pool.AcquireManyAsync(3);
+            many.GetHandle().resume();
+            REQUIRE_FALSE(many.IsReady());
+            CHECK(pool.IdleCount() == 0);
+        }
+        CHECK(pool.IdleCount() == 2);
+        CHECK(pool.WaiterCount() == 0);
+        holder.reset();
+        CHECK(pool.IdleCount() == 3);
+    }
+}
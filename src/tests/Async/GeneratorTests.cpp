@@ -0,0 +1,83 @@
+// SPDX-License-Identifier: Apache-2.0
+
+#include <Lightweight/Async/Generator.hpp>
+#include <Lightweight/Async/SyncWait.hpp>
+#include <Lightweight/Async/Task.hpp>
+
+#include <catch2/catch_test_macros.hpp>
+
+#include <ranges>
+#include <stdexcept>
+#include <vector>
+
+using namespace Lightweight;
+
+namespace
+{
+
+Async::Task<int> Identity(int value)
+{
+    co_return value;
+}
+
+/// Yields 0..count-1, awaiting a Task per value like a block fetch would. Records how far the
+/// producer has run so the tests can observe that it never runs ahead of the consumer.
+Async::Generator<int> Counter(int count, int* produced)
+{
+    for (auto const i: std::views::iota(0, count))
+    {
+        *produced = i + 1;
+        co_yield co_await Identity(i);
+    }
+}
+
+Async::Generator<int> ThrowAfterOne()
+{
+    co_yield 1;
+    throw std::runtime_error("boom-generator");
+}
+
+Async::Task<std::vector<int>> Drain(Async::Generator<int> generator)
+{
+    auto values = std::vector<int> {};
+    while (auto value = co_await generator.Next())
+        values.push_back(*value);
+    co_return values;
+}
+
+} // namespace
+
+TEST_CASE("Async.Generator: yields every value in order, then ends", "[Async][Generator]")
+{
+    int produced = 0;
+    CHECK(Async::SyncWait(Drain(Counter(5, &produced))) == std::vector { 0, 1, 2, 3, 4 });
+    CHECK(produced == 5);
+}
+
+TEST_CASE("Async.Generator: the consumer controls the pace", "[Async][Generator]")
+{
+    int produced = 0;
+    auto generator = Counter(100, &produced);
+    CHECK(produced == 0); // lazy: nothing runs before the first Next()
+
+    auto takeTwo = [&generator]() -> Async::Task<int> {
+        auto const first = co_await generator.Next();
+        auto const second = co_await generator.Next();
+        co_return first.value_or(-1) + second.value_or(-1);
+    };
+    CHECK(Async::SyncWait(takeTwo()) == 1);
+    CHECK(produced == 2); // the producer is suspended at its second co_yield
+    CHECK_FALSE(generator.IsDone());
+}
+
+TEST_CASE("Async.Generator: propagates exceptions from the body", "[Async][Generator]")
+{
+    auto generator = ThrowAfterOne();
+    auto next = [&generator]() -> Async::Task<int> {
+        auto const value = co_await generator.Next();
+        co_return value.value_or(-1);
+    };
+    CHECK(Async::SyncWait(next()) == 1);
+    CHECK_THROWS_AS(Async::SyncWait(next()), std::runtime_error);
+    CHECK(generator.IsDone());
+}
@@ -0,0 +1,76 @@
+// SPDX-License-Identifier: Apache-2.0
+
+#include <Lightweight/Async/SyncWait.hpp>
+#include <Lightweight/Async/Task.hpp>
+#include <Lightweight/Async/ThreadPoolExecutor.hpp>
+#include <Lightweight/Async/WhenAll.hpp>
+
+#include <catch2/catch_test_macros.hpp>
+
+#include <coroutine>
+#include <stdexcept>
+#include <string>
+#include <tuple>
+
+using namespace Lightweight;
+using namespace Lightweight::Async;
+
+namespace
+{
+
+Task<int> Identity(int value)
+{
+    co_return value;
+}
+
+Task<std::string> Text(std::string value)
+{
+    co_return value;
+}
+
+Task<int> Throwing()
+{
+    throw std::runtime_error("boom-whenall");
+    co_return 0;
+}
+
+/// Hops to @p executor before producing @p value, so the child completes on another thread.
+Task<int> OnExecutor(IExecutor* executor, int value)
+{
+    struct Hop
+    {
+        IExecutor* executor;
+        [[nodiscard]] bool await_ready() const noexcept
+        {
+            return false;
+        }
+        void await_suspend(std::coroutine_handle<> handle) const
+        {
+            executor->Post([handle] { handle.resume(); });
+        }
+        void await_resume() const noexcept {}
+    };
+    co_await Hop { executor };
+    co_return value;
+}
+
+} // namespace
+
+TEST_CASE("Async.WhenAll: collects every result in argument order", "[Async][WhenAll]")
+{
+    auto const [number, text] = SyncWait(WhenAll(Identity(42), Text("forty-two")));
+    CHECK(number == 42);
+    CHECK(text == "forty-two");
+}
+
+TEST_CASE("Async.WhenAll: children completing on other threads resume the awaiter once", "[Async][WhenAll]")
+{
+    ThreadPoolExecutor workers { 3 };
+    auto const [a, b, c] = SyncWait(WhenAll(OnExecutor(&workers, 1), OnExecutor(&workers, 2), OnExecutor(&workers, 3)));
+    CHECK(a + b + c == 6);
+}
+
+TEST_CASE("Async.WhenAll: rethrows a child's exception after all children finished", "[Async][WhenAll]")
+{
+    CHECK_THROWS_AS(SyncWait(WhenAll(Identity(1), Throwing(), Identity(3))), std::runtime_error);
+}
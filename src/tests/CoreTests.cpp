@@ -394,7 +394,8 @@ struct NullableBatchRow
 };
 static_assert(sizeof(NullableBatchRow) % alignof(SQLLEN) == 0);
 
-// Row that contains a std::string column: always routed through the soft batch path.
+// Row that contains a std::string column: staged column-wise, or routed through the soft batch path
+// when a value exceeds SqlOptimalMaxColumnSize.
 struct StringBatchRow
 {
     int32_t id {};
@@ -470,7 +471,7 @@ TEST_CASE_METHOD(SqlTestFixture, "SqlStatement.ExecuteBatch: row-major native wi
     REQUIRE(!cursor.FetchRow());
 }
 
-TEST_CASE_METHOD(SqlTestFixture, "SqlStatement.ExecuteBatch: row-major soft (string + optional)", "[SqlStatement]")
+TEST_CASE_METHOD(SqlTestFixture, "SqlStatement.ExecuteBatch: row-major staged (string + optional)", "[SqlStatement]")
 {
     auto stmt = Lightweight::SqlStatement {};
     stmt.MigrateDirect([](Lightweight::SqlMigrationQueryBuilder& migration) {
@@ -504,6 +505,40 @@ TEST_CASE_METHOD(SqlTestFixture, "SqlStatement.ExecuteBatch: row-major soft (str
     REQUIRE(!cursor.FetchRow());
 }
 
+TEST_CASE_METHOD(SqlTestFixture, "SqlStatement.ExecuteBatch: row-major long string falls back to soft", "[SqlStatement]")
+{
+    auto stmt = Lightweight::SqlStatement {};
+    stmt.MigrateDirect([](Lightweight::SqlMigrationQueryBuilder& migration) {
+        migration.CreateTable("RowMajorLongStr")
+            .Column("Id", Lightweight::SqlColumnTypeDefinitions::Integer {})
+            .Column("Name", Lightweight::SqlColumnTypeDefinitions::Text {})
+            .Column("Maybe", Lightweight::SqlColumnTypeDefinitions::Integer {});
+    });
+
+    stmt.Prepare(R"(INSERT INTO "RowMajorLongStr" ("Id", "Name", "Maybe") VALUES (?, ?, ?))");
+
+    // One value beyond SqlOptimalMaxColumnSize: staging would size every slot to it, so the batch runs per row.
+    auto rows = std::vector<StringBatchRow> {};
+    rows.push_back({ .id = 1, .name = "short", .maybe = 1 });
+    rows.push_back({ .id = 2, .name = std::string(Lightweight::SqlOptimalMaxColumnSize + 1, 'x'), .maybe = std::nullopt });
+
+    (void) stmt.ExecuteBatch(
+        std::span<StringBatchRow const> { rows },
+        [](StringBatchRow const& r) -> int32_t const& { return r.id; },
+        [](StringBatchRow const& r) -> std::string const& { return r.name; },
+        [](StringBatchRow const& r) -> std::optional<int32_t> const& { return r.maybe; });
+
+    auto cursor = stmt.ExecuteDirect(R"(SELECT "Id", "Name", "Maybe" FROM "RowMajorLongStr" ORDER BY "Id")");
+    for (auto const& expected: rows)
+    {
+        REQUIRE(cursor.FetchRow());
+        CHECK(cursor.GetColumn<int>(1) == expected.id);
+        CHECK(cursor.GetColumn<std::string>(2) == expected.name);
+        CHECK(cursor.GetColumn<std::optional<int>>(3) == expected.maybe);
+    }
+    REQUIRE(!cursor.FetchRow());
+}
+
 TEST_CASE_METHOD(SqlTestFixture, "SqlStatement.ExecuteBatch: row-major edge cases", "[SqlStatement]")
 {
     auto stmt = Lightweight::SqlStatement {};
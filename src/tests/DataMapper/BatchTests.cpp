@@ -9,14 +9,17 @@
 #include <catch2/catch_test_macros.hpp>
 #include <catch2/matchers/catch_matchers_floating_point.hpp>
 
+#include <array>
 #include <chrono>
 #include <optional>
 #include <ranges>
+#include <span>
 #include <string>
 #include <string_view>
 #include <vector>
 
 using namespace Lightweight;
+using namespace std::string_view_literals;
 
 // NOLINTBEGIN(bugprone-unchecked-optional-access)
 
@@ -30,7 +33,7 @@ struct BatchFixedRecord
     Field<int32_t> count;
 };
 
-// Contains a std::string (aggregate member) and a nullable column: routed through the soft batch path.
+// Contains a std::string (aggregate member) and a nullable column: staged column-wise into one batched execute.
 struct BatchAggregateRecord
 {
     Field<int32_t, PrimaryKey::AutoAssign> id;
@@ -89,8 +92,42 @@ struct BatchMixedColumnRecord
     Field<int32_t> number;
 };
 
-// Counts which batch execution path SqlStatement took: the native row-wise path emits a single
-// OnExecuteBatch(), the soft fallback emits one OnExecute() per row.
+// Variable-length and nullable columns of every stageable kind: CreateAll/UpdateAll stage them
+// column-wise and still submit a single batched execute.
+struct BatchStagedRecord
+{
+    Field<int32_t, PrimaryKey::AutoAssign> id;
+    Field<std::string> name;
+    Field<std::optional<std::string>> note;
+    Field<std::u16string> wide;
+    Field<std::optional<SqlGuid>> reference;
+    Field<std::optional<SqlNumeric<10, 2>>> amount;
+};
+
+// Parent/child pair with server-generated keys, for CreateAllReturningIds over an object graph.
+struct BatchParentRecord
+{
+    Field<uint64_t, PrimaryKey::ServerSideAutoIncrement> id;
+    Field<std::string> name;
+};
+
+struct BatchChildRecord
+{
+    Field<uint64_t, PrimaryKey::ServerSideAutoIncrement> id;
+    Field<std::string> label;
+    BelongsTo<Member(BatchParentRecord::id), SqlRealName { "parent_id" }> parent {};
+};
+
+// Composite primary key (integer + fixed string), for the chunked bulk deletes.
+struct BatchCompositeKeyRecord
+{
+    Field<int32_t, PrimaryKey::AutoAssign> tenant;
+    Field<SqlAnsiString<16>, PrimaryKey::AutoAssign> code;
+    Field<int32_t> value;
+};
+
+// Counts which batch execution path SqlStatement took: the native row-wise and the column-wise staged
+// paths emit a single OnExecuteBatch(), the soft fallback emits one OnExecute() per row.
 class BatchPathCountingLogger: public SqlLogger::Null
 {
   public:
@@ -129,7 +166,7 @@ TEST_CASE_METHOD(SqlTestFixture, "DataMapper.CreateAll: native (all fixed-width)
     }
 }
 
-TEST_CASE_METHOD(SqlTestFixture, "DataMapper.CreateAll: soft (std::string + optional)", "[DataMapper][batch]")
+TEST_CASE_METHOD(SqlTestFixture, "DataMapper.CreateAll: staged (std::string + optional)", "[DataMapper][batch]")
 {
     auto dm = DataMapper {};
     dm.CreateTable<BatchAggregateRecord>();
@@ -151,6 +188,72 @@ TEST_CASE_METHOD(SqlTestFixture, "DataMapper.CreateAll: soft (std::string + opti
     }
 }
 
+TEST_CASE_METHOD(SqlTestFixture,
+                 "DataMapper.CreateAll/UpdateAll: staged strings, GUIDs and numerics",
+                 "[DataMapper][batch]")
+{
+    auto dm = DataMapper {};
+    dm.CreateTable<BatchStagedRecord>();
+
+    auto records = std::vector<BatchStagedRecord> {};
+    records.push_back({ .id = 1,
+                        .name = std::string { "Alice" },
+                        .note = std::string { "first" },
+                        .wide = std::u16string { u"\u00C4rger" },
+                        .reference = SqlGuid::Create(),
+                        .amount = SqlNumeric<10, 2> { 12.34 } });
+    records.push_back({ .id = 2,
+                        .name = std::string {},
+                        .note = std::nullopt,
+                        .wide = std::u16string {},
+                        .reference = std::nullopt,
+                        .amount = std::nullopt });
+    records.push_back({ .id = 3,
+                        .name = std::string { "a considerably longer name than the others" },
+                        .note = std::string {},
+                        .wide = std::u16string { u"wide text" },
+                        .reference = SqlGuid::CreateSequential(),
+                        .amount = SqlNumeric<10, 2> { 99.99 } });
+
+    auto const executeCounted = [&](auto const& action) {
+        BatchPathCountingLogger logger;
+        auto& previousLogger = SqlLogger::GetLogger();
+        SqlLogger::SetLogger(logger);
+        action();
+        SqlLogger::SetLogger(previousLogger);
+        CHECK(logger.executeBatchCount == 1); // staged path: exactly one batched execute
+        CHECK(logger.executeCount == 0);      // and no per-row executes
+    };
+
+    auto const verify = [&] {
+        for (auto const& expected: records)
+        {
+            auto const actual = dm.QuerySingle<BatchStagedRecord>(expected.id.Value());
+            REQUIRE(actual.has_value());
+            CHECK(actual->name.Value() == expected.name.Value());
+            CHECK(actual->note.Value() == expected.note.Value());
+            CHECK(actual->wide.Value() == expected.wide.Value());
+            CHECK(actual->reference.Value() == expected.reference.Value());
+            CHECK(actual->amount.Value().has_value() == expected.amount.Value().has_value());
+            if (expected.amount.Value().has_value())
+                CHECK(actual->amount.Value()->ToString() == expected.amount.Value()->ToString());
+        }
+    };
+
+    executeCounted([&] { dm.CreateAll(records); });
+    verify();
+
+    // Flip value <-> NULL, and grow a string so the slot width changes between batches.
+    records[0].note = std::nullopt;
+    records[0].amount = std::nullopt;
+    records[1].note = std::string { "now set" };
+    records[1].reference = SqlGuid::Create();
+    records[1].amount = SqlNumeric<10, 2> { 1.5 };
+    records[2].name = std::string(200, 'z');
+    executeCounted([&] { dm.UpdateAll(records); });
+    verify();
+}
+
 TEST_CASE_METHOD(SqlTestFixture, "DataMapper.CreateAll: empty and single span", "[DataMapper][batch]")
 {
     auto dm = DataMapper {};
@@ -407,7 +510,7 @@ TEST_CASE_METHOD(SqlTestFixture, "DataMapper.UpdateAll: zero-row match does not
     CHECK(dm.Query<BatchFixedRecord>().Count() == 0);
 }
 
-TEST_CASE_METHOD(SqlTestFixture, "DataMapper.UpdateAll: soft path tolerates non-matching rows", "[DataMapper][batch]")
+TEST_CASE_METHOD(SqlTestFixture, "DataMapper.UpdateAll: staged path tolerates non-matching rows", "[DataMapper][batch]")
 {
     auto dm = DataMapper {};
     dm.CreateTable<BatchAggregateRecord>();
@@ -443,4 +546,161 @@ TEST_CASE_METHOD(SqlTestFixture, "DataMapper.CreateAll: excludes server-side aut
     CHECK(dm.Query<BatchMixedColumnRecord>().Count() == 3);
 }
 
+TEST_CASE_METHOD(SqlTestFixture, "DataMapper.CreateAllReturningIds: server-generated keys", "[DataMapper][batch]")
+{
+    auto dm = DataMapper {};
+    dm.CreateTable<BatchMixedColumnRecord>();
+
+    auto records = std::vector<BatchMixedColumnRecord> {};
+    records.push_back({ .id = {}, .label = std::string { "alpha" }, .number = 1 });
+    records.push_back({ .id = {}, .label = std::string { "beta" }, .number = 2 });
+    records.push_back({ .id = {}, .label = std::string { "gamma" }, .number = 3 });
+
+    auto const keys = dm.CreateAllReturningIds(records);
+
+    REQUIRE(keys.size() == records.size());
+    for (auto const& [key, record]: std::views::zip(keys, records))
+    {
+        CHECK(key != 0);
+        CHECK(record.id.Value() == key);
+        CHECK(!dm.IsModified(record));
+
+        // Keys map back to the very row they were returned for.
+        auto const actual = dm.QuerySingle<BatchMixedColumnRecord>(key);
+        REQUIRE(actual.has_value());
+        CHECK(actual->label.Value() == record.label.Value());
+        CHECK(actual->number.Value() == record.number.Value());
+    }
+    CHECK(keys[0] != keys[1]);
+    CHECK(keys[1] != keys[2]);
+}
+
+TEST_CASE_METHOD(SqlTestFixture, "DataMapper.CreateAllReturningIds: auto-assigned integer keys", "[DataMapper][batch]")
+{
+    auto dm = DataMapper {};
+    dm.CreateTable<BatchFixedRecord>();
+
+    auto seed = BatchFixedRecord { .id = 10, .value = 1.0, .count = 1 };
+    dm.CreateExplicit(seed);
+
+    // Unset keys continue from MAX(id) + 1, one per record, rather than all receiving the same value.
+    auto records = std::vector<BatchFixedRecord> {};
+    for (auto const i: std::views::iota(1, 4))
+        records.push_back({ .id = {}, .value = i * 1.5, .count = i });
+
+    auto const keys = dm.CreateAllReturningIds(records);
+
+    CHECK(keys == std::vector<int64_t> { 11, 12, 13 });
+    CHECK(records[2].id.Value() == 13);
+    CHECK(dm.Query<BatchFixedRecord>().Count() == 4);
+    CHECK(dm.QuerySingle<BatchFixedRecord>(12).value().count.Value() == 2);
+}
+
+TEST_CASE_METHOD(SqlTestFixture,
+                 "DataMapper.CreateAllReturningIds: generated keys skip the explicit keys of the batch",
+                 "[DataMapper][batch]")
+{
+    auto dm = DataMapper {};
+    dm.CreateTable<BatchFixedRecord>();
+
+    auto seed = BatchFixedRecord { .id = 3, .value = 1.0, .count = 1 };
+    dm.CreateExplicit(seed);
+
+    // MAX(id) + 1 is 4; the explicit key 5 later in the batch must not be handed out again.
+    auto records = std::vector<BatchFixedRecord> {
+        { .id = {}, .value = 1.5, .count = 1 },
+        { .id = {}, .value = 3.0, .count = 2 },
+        { .id = 5, .value = 4.5, .count = 3 },
+    };
+
+    auto const keys = dm.CreateAllReturningIds(records);
+
+    CHECK(keys == std::vector<int64_t> { 4, 6, 5 });
+    CHECK(dm.Query<BatchFixedRecord>().Count() == 4);
+    CHECK(dm.QuerySingle<BatchFixedRecord>(5).value().count.Value() == 3);
+    CHECK(dm.QuerySingle<BatchFixedRecord>(6).value().count.Value() == 2);
+}
+
+TEST_CASE_METHOD(SqlTestFixture, "DataMapper.CreateAllReturningIds: parent-first object graph", "[DataMapper][batch]")
+{
+    auto dm = DataMapper {};
+    dm.CreateTables<BatchParentRecord, BatchChildRecord>();
+
+    auto parents = std::vector<BatchParentRecord> {};
+    parents.push_back({ .id = {}, .name = std::string { "first" } });
+    parents.push_back({ .id = {}, .name = std::string { "second" } });
+
+    auto children = std::vector<BatchChildRecord> {};
+    children.push_back({ .id = {}, .label = std::string { "second/a" } });
+    children.push_back({ .id = {}, .label = std::string { "first/a" } });
+    children.push_back({ .id = {}, .label = std::string { "second/b" } });
+    auto const parentOf = std::array<std::size_t, 3> { 1, 0, 1 };
+
+    dm.CreateAllReturningIds(
+        parents, children, [&](BatchChildRecord const& /*child*/, std::size_t index) { return parentOf[index]; });
+
+    for (auto const& [child, parentIndex]: std::views::zip(children, parentOf))
+    {
+        CHECK(child.id.Value() != 0);
+        CHECK(child.parent.Value() == parents[parentIndex].id.Value());
+
+        auto const actual = dm.QuerySingle<BatchChildRecord, DataMapperOptions { .loadRelations = false }>(child.id.Value());
+        REQUIRE(actual.has_value());
+        CHECK(actual->label.Value() == child.label.Value());
+        CHECK(actual->parent.Value() == parents[parentIndex].id.Value());
+    }
+}
+
+TEST_CASE_METHOD(SqlTestFixture, "DataMapper.DeleteByIds: integer keys in chunks", "[DataMapper][batch]")
+{
+    auto dm = DataMapper {};
+    dm.CreateTable<BatchFixedRecord>();
+
+    auto records = std::vector<BatchFixedRecord> {};
+    for (auto const i: std::views::iota(1, 11))
+        records.push_back({ .id = i, .value = i * 1.5, .count = i * 10 });
+    dm.CreateAll(records);
+
+    // Three chunks of at most two keys; the unknown key 99 does not count as deleted.
+    CHECK(dm.DeleteByIds<BatchFixedRecord>(std::vector<int64_t> { 2, 4, 6, 8, 99 }, { .chunkSize = 2 }) == 4);
+    CHECK(dm.Query<BatchFixedRecord>().Count() == 6);
+    CHECK_FALSE(dm.QuerySingle<BatchFixedRecord>(int64_t { 4 }).has_value());
+
+    // Intermediate commits do not change the outcome.
+    CHECK(dm.DeleteByIds<BatchFixedRecord>(std::vector<int64_t> { 1, 3, 5 }, { .chunkSize = 1, .commitEveryChunks = 2 })
+          == 3);
+    CHECK(dm.Query<BatchFixedRecord>().Count() == 3);
+
+    CHECK(dm.DeleteByIds<BatchFixedRecord>(std::vector<int64_t> {}) == 0);
+}
+
+TEST_CASE_METHOD(SqlTestFixture, "DataMapper.DeleteAll: composite keys with padded chunks", "[DataMapper][batch]")
+{
+    auto dm = DataMapper {};
+    dm.CreateTable<BatchCompositeKeyRecord>();
+
+    auto records = std::vector<BatchCompositeKeyRecord> {};
+    for (auto const tenant: std::views::iota(1, 3))
+        for (auto const code: { "a"sv, "b"sv, "c"sv, "d"sv, "e"sv })
+            records.push_back({ .tenant = tenant, .code = SqlAnsiString<16> { code }, .value = tenant * 100 });
+    dm.CreateAll(records);
+
+    // Tenant 1 only: five records, chunked into a full chunk of four keys and one padded to a single key.
+    auto const tenantOne = std::span { records }.first(5);
+    CHECK(dm.DeleteAll(tenantOne, { .chunkSize = 4 }) == 5);
+    CHECK(dm.Query<BatchCompositeKeyRecord>().Count() == 5);
+    CHECK(dm.Query<BatchCompositeKeyRecord>().Where(FieldNameOf<Member(BatchCompositeKeyRecord::tenant)>, "=", 1).Count()
+          == 0);
+
+    // Three keys pad to a chunk of four by repeating the last key, which deletes nothing extra.
+    using Key = RecordPrimaryKeyTuple<BatchCompositeKeyRecord>;
+    auto const keys = std::vector<Key> {
+        Key { 2, SqlAnsiString<16> { "a" } },
+        Key { 2, SqlAnsiString<16> { "c" } },
+        Key { 2, SqlAnsiString<16> { "zz" } },
+    };
+    CHECK(dm.DeleteByIds<BatchCompositeKeyRecord>(keys) == 2);
+    CHECK(dm.Query<BatchCompositeKeyRecord>().Count() == 3);
+}
+
 // NOLINTEND(bugprone-unchecked-optional-access)
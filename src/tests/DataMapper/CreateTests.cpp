@@ -15,7 +15,10 @@
 #include <catch2/matchers/catch_matchers.hpp>
 #include <catch2/matchers/catch_matchers_floating_point.hpp>
 
+#include <algorithm>
+#include <ranges>
 #include <string_view>
+#include <vector>
 
 using namespace std::string_view_literals;
 using namespace std::string_literals;
@@ -276,6 +279,36 @@ TEST_CASE_METHOD(SqlTestFixture, "CreateCopyOf: Auto-assign (GUID) primary key",
     CHECK(dm.Query<CopyTestAutoAssign>().Count() == 2);
 }
 
+struct SequentialKeyRecord
+{
+    Field<SqlGuid, PrimaryKey::AutoAssignSequential> id;
+    Field<int> value;
+};
+
+TEST_CASE_METHOD(SqlTestFixture, "Create: sequential GUID primary key", "[DataMapper]")
+{
+    auto dm = DataMapper();
+    dm.CreateTable<SequentialKeyRecord>();
+
+    auto ids = std::vector<SqlGuid> {};
+    for (auto const i: std::views::iota(0, 5))
+    {
+        auto record = SequentialKeyRecord { .value = i };
+        ids.push_back(dm.Create(record));
+        CHECK(record.id.Value() == ids.back());
+    }
+    CHECK(std::ranges::all_of(ids, [](SqlGuid const& id) { return static_cast<bool>(id); }));
+
+    // The server sorts the keys in creation order, i.e. every insert appended to the index.
+    auto const records = dm.Query<SequentialKeyRecord>().OrderBy(FieldNameOf<Member(SequentialKeyRecord::id)>).All();
+    REQUIRE(records.size() == ids.size());
+    for (auto const& [index, record]: records | std::views::enumerate)
+    {
+        CHECK(record.id.Value() == ids[static_cast<size_t>(index)]);
+        CHECK(record.value.Value() == index);
+    }
+}
+
 TEST_CASE_METHOD(SqlTestFixture, "CreateCopyOf: Multiple copies", "[DataMapper]")
 {
     auto dm = DataMapper();
@@ -17,6 +17,7 @@
 
 #include <algorithm>
 #include <iterator>
+#include <numeric>
 #include <string>
 #include <string_view>
 #include <vector>
@@ -52,6 +53,36 @@ TEST_CASE_METHOD(SqlTestFixture, "Query.WhereIn binds its values", "[DataMapper]
     CHECK(dm.Query<Person>().WhereIn(FieldNameOf<Member(Person::name)>, std::vector<std::string> {}).All().empty());
 }
 
+TEST_CASE_METHOD(SqlTestFixture, "Query.WhereInArray binds the list as one parameter", "[DataMapper]")
+{
+    auto dm = DataMapper();
+
+    dm.CreateTable<Person>();
+    for (auto& person: std::array {
+             Person { .id = SqlGuid::Create(), .name = "O'Brien", .is_active = true, .age = 42 },
+             Person { .id = SqlGuid::Create(), .name = "Jane \"JD\" Doe", .is_active = true, .age = 36 },
+             Person { .id = SqlGuid::Create(), .name = "Jimbo Jones", .is_active = false, .age = 69 },
+         })
+        dm.Create(person);
+
+    CHECK(dm.Query<Person>().WhereInArray(FieldNameOf<Member(Person::age)>, std::vector { 42, 69, 1000 }).All().size()
+          == 2);
+
+    // Quotes and apostrophes must survive the dialect's array encoding.
+    CHECK(dm.Query<Person>()
+              .WhereInArray(FieldNameOf<Member(Person::name)>, std::vector { "O'Brien"s, "Jane \"JD\" Doe"s })
+              .All()
+              .size()
+          == 2);
+
+    // A list far beyond SQL Server's 2100 parameter limit still is a single parameter.
+    auto manyAges = std::vector<int>(5000);
+    std::iota(manyAges.begin(), manyAges.end(), 0);
+    CHECK(dm.Query<Person>().WhereInArray(FieldNameOf<Member(Person::age)>, manyAges).Count() == 3);
+
+    CHECK(dm.Query<Person>().WhereInArray(FieldNameOf<Member(Person::age)>, std::vector<int> {}).All().empty());
+}
+
 TEST_CASE_METHOD(SqlTestFixture, "Query", "[DataMapper]")
 {
     auto dm = DataMapper();
@@ -814,4 +845,244 @@ TEST_CASE_METHOD(SqlTestFixture, "GetMultileTypesAsVectorOfTuples", "[DataMapper
     }
 }
 
+TEST_CASE_METHOD(SqlTestFixture, "QuerySingle: identity map serves repeated lookups", "[DataMapper]")
+{
+    auto dm = DataMapper();
+    dm.CreateTable<Person>();
+
+    auto person = Person { .id = SqlGuid::Create(), .name = "Jane Doe", .is_active = true, .age = 36 };
+    dm.Create(person);
+
+    {
+        auto const unitOfWork = dm.BeginIdentityMap();
+        auto const nested = dm.BeginIdentityMap();
+
+        auto first = dm.QuerySingle<Person>(person.id.Value());
+        REQUIRE(first.has_value());
+        first->name = "Changed locally";
+
+        // The second lookup is a copy of what was read, unaffected by changes to the first copy.
+        auto const second = dm.QuerySingle<Person>(person.id.Value());
+        REQUIRE(second.has_value());
+        CHECK(second->name.Value() == "Jane Doe");
+        CHECK(!second->name.IsModified());
+        CHECK(dm.IdentityMapStatistics().hits == 1);
+        CHECK(dm.IdentityMapStatistics().misses == 1);
+
+        // Update drops the record, so the next lookup reads the new state.
+        person.name = "John Doe";
+        dm.Update(person);
+        CHECK(dm.QuerySingle<Person>(person.id.Value())->name.Value() == "John Doe");
+        CHECK(dm.IdentityMapStatistics().invalidations == 1);
+        CHECK(dm.IdentityMapStatistics().misses == 2);
+
+        dm.Delete(person);
+        CHECK(!dm.QuerySingle<Person>(person.id.Value()).has_value());
+    }
+
+    CHECK(dm.IdentityMapStatistics().hits == 0);
+}
+
+TEST_CASE_METHOD(SqlTestFixture, "QuerySingle: record cache is shared across DataMappers", "[DataMapper]")
+{
+    auto& cache = RecordCache::Instance();
+    cache.Clear();
+    cache.ResetStatistics();
+    cache.Enable<Person>();
+
+    auto dm = DataMapper();
+    dm.CreateTable<Person>();
+
+    auto person = Person { .id = SqlGuid::Create(), .name = "Jane Doe", .is_active = true, .age = 36 };
+    dm.Create(person);
+
+    CHECK(dm.QuerySingle<Person>(person.id.Value())->name.Value() == "Jane Doe");
+    {
+        auto other = DataMapper();
+        CHECK(other.QuerySingle<Person>(person.id.Value())->name.Value() == "Jane Doe");
+    }
+    CHECK(cache.Statistics().hits == 1);
+    CHECK(cache.Statistics().misses == 1);
+    CHECK(cache.Statistics().insertions == 1);
+
+    // A query-builder delete cannot tell which rows it removed and drops the whole table.
+    dm.Query<Person>().Where(FieldNameOf<Member(Person::name)>, "=", "Jane Doe").Delete();
+    CHECK(cache.Statistics().invalidations == 1);
+    CHECK(!dm.QuerySingle<Person>(person.id.Value()).has_value());
+
+    // One record per shard: more records than shards must evict.
+    cache.SetCapacity(RecordCache::ShardCount);
+    dm.Create(person);
+    for (auto const i: std::views::iota(0, static_cast<int>(RecordCache::ShardCount) + 1))
+    {
+        auto other = Person { .id = SqlGuid::Create(), .name = std::format("Other {}", i), .is_active = true };
+        dm.Create(other);
+        std::ignore = dm.QuerySingle<Person>(other.id.Value());
+    }
+    CHECK(cache.Statistics().evictions > 0);
+
+    cache.Disable<Person>();
+    cache.SetCapacity(RecordCache::DefaultCapacity);
+    std::ignore = dm.QuerySingle<Person>(person.id.Value());
+    CHECK(cache.Statistics().hits == 1);
+}
+
+TEST_CASE_METHOD(SqlTestFixture, "QuerySingle: rows read inside a rolled back transaction are not cached", "[DataMapper]")
+{
+    auto& cache = RecordCache::Instance();
+    cache.Clear();
+    cache.ResetStatistics();
+    cache.Enable<Person>();
+
+    auto dm = DataMapper();
+    dm.CreateTable<Person>();
+
+    auto person = Person { .id = SqlGuid::Create(), .name = "Jane Doe", .is_active = true, .age = 36 };
+    dm.Create(person);
+
+    {
+        auto transaction = SqlTransaction { dm.Connection(), SqlTransactionMode::ROLLBACK };
+        person.name = "John Doe";
+        dm.Update(person);
+        CHECK(dm.QuerySingle<Person>(person.id.Value())->name.Value() == "John Doe");
+    }
+    CHECK(cache.Statistics().insertions == 0);
+
+    auto other = DataMapper();
+    CHECK(other.QuerySingle<Person>(person.id.Value())->name.Value() == "Jane Doe");
+    CHECK(cache.Statistics().insertions == 1);
+
+    cache.Disable<Person>();
+}
+
+TEST_CASE("RecordCache: a read invalidated meanwhile is not stored", "[DataMapper]")
+{
+    auto cache = RecordCache {};
+    auto const key = std::string { "Person\x1f" "42\x1f" };
+
+    auto const generation = cache.Generation(key);
+    cache.Invalidate(key); // an Update on another DataMapper while the row is being read
+    CHECK(!cache.Insert(key, std::make_shared<int const>(1), generation));
+    CHECK(cache.Find(key) == nullptr);
+
+    CHECK(cache.Insert(key, std::make_shared<int const>(2), cache.Generation(key)));
+    CHECK(cache.Find(key) != nullptr);
+
+    auto const beforeTableDrop = cache.Generation(key);
+    cache.InvalidateTable("Person");
+    CHECK(!cache.Insert(key, std::make_shared<int const>(3), beforeTableDrop));
+}
+
+TEST_CASE_METHOD(SqlTestFixture, "DataMapper.Compile: renders once and binds typed arguments", "[DataMapper]")
+{
+    auto dm = DataMapper();
+    dm.CreateTable<Person>();
+    for (auto& person: std::array {
+             Person { .id = SqlGuid::Create(), .name = "Alice", .is_active = true, .age = 30 },
+             Person { .id = SqlGuid::Create(), .name = "Bob", .is_active = true, .age = 40 },
+             Person { .id = SqlGuid::Create(), .name = "Carol", .is_active = false, .age = 50 },
+         })
+        dm.Create(person);
+
+    // The constant `true` is bound at compile time, in between the two uses of the argument.
+    auto const olderThan = dm.Compile<Person, int>([](auto& query, auto minAge) {
+        return query.Where(FieldNameOf<Member(Person::age)>, ">", minAge)
+            .Where(FieldNameOf<Member(Person::is_active)>, true)
+            .OrWhere(FieldNameOf<Member(Person::age)>, "=", minAge)
+            .OrderBy(FieldNameOf<Member(Person::name)>, SqlResultOrdering::ASCENDING);
+    });
+
+    auto const& plan = olderThan.AllPlan(dm);
+    CHECK(plan.argumentMarkers.size() == 1);
+    CHECK(plan.argumentMarkers[0] == std::vector<SQLSMALLINT> { 1, 3 });
+    CHECK(plan.constants.size() == 1);
+    CHECK(plan.constants[0].first == 2);
+
+    auto const older = olderThan.All(dm, 35);
+    REQUIRE(older.size() == 1);
+    CHECK(older[0].name.Value() == "Bob");
+
+    // The second call reuses the prepared statement.
+    auto const all = olderThan.All(dm, 20);
+    CHECK(dm.Statement().PreparedQuery() == plan.query);
+    CHECK(all.size() == 2);
+    CHECK(olderThan.All(dm, 50).size() == 1);
+
+    auto const byName = dm.Compile<Person, std::string_view>(
+        [](auto& query, auto name) { return query.Where(FieldNameOf<Member(Person::name)>, name); });
+    CHECK(byName.First(dm, "Carol"sv)->age.Value() == 50);
+    CHECK(!byName.First(dm, "Dave"sv).has_value());
+
+    // The copy shares the rendered statements.
+    auto const copy = byName;
+    CHECK(&copy.FirstPlan(dm) == &byName.FirstPlan(dm));
+}
+
+TEST_CASE_METHOD(SqlTestFixture, "Query.Only reads a subset of fields", "[DataMapper]")
+{
+    auto dm = DataMapper();
+    dm.CreateTable<Person>();
+
+    auto person = Person { .id = SqlGuid::Create(), .name = "Jane Doe", .is_active = true, .age = 42 };
+    dm.Create(person);
+
+    auto people = dm.Query<Person>().Only<Member(Person::id), Member(Person::name)>().All();
+    REQUIRE(people.size() == 1);
+    auto& partial = people.front();
+    CHECK(partial.id.Value() == person.id.Value());
+    CHECK(partial.name.Value() == "Jane Doe");
+    CHECK(partial.name.IsLoaded());
+    CHECK(!partial.age.IsLoaded());
+    CHECK(!partial.age.Value().has_value());
+    CHECK(!partial.age.IsModified());
+
+    // Only what was changed after loading is written back; the unloaded age stays as it is.
+    partial.name = "John Doe";
+    dm.Update(partial);
+    auto const stored = dm.QuerySingle<Person>(person.id.Value());
+    REQUIRE(stored.has_value());
+    CHECK(stored->name.Value() == "John Doe");
+    CHECK(stored->age.Value() == 42);
+
+    CHECK(dm.LoadFields<Member(Person::age), Member(Person::is_active)>(partial));
+    CHECK(partial.age.IsLoaded());
+    CHECK(partial.age.Value() == 42);
+    CHECK(partial.is_active.Value());
+    CHECK(!partial.age.IsModified());
+
+    dm.Delete(person);
+    CHECK(!dm.LoadFields<Member(Person::age)>(partial));
+}
+
+TEST_CASE_METHOD(SqlTestFixture, "Query.Only always reads the primary key", "[DataMapper]")
+{
+    auto dm = DataMapper();
+    dm.CreateTable<Person>();
+
+    auto jane = Person { .id = SqlGuid::Create(), .name = "Jane Doe", .is_active = true, .age = 42 };
+    auto john = Person { .id = SqlGuid::Create(), .name = "John Doe", .is_active = true, .age = 50 };
+    dm.Create(jane);
+    dm.Create(john);
+
+    // The projection leaves out the primary key, which is read anyway, so that Update and Delete
+    // address the row the record was read from.
+    auto first = dm.Query<Person>()
+                     .Where(FieldNameOf<Member(Person::name)>, "=", "John Doe")
+                     .Only<Member(Person::age)>()
+                     .First();
+    REQUIRE(first.has_value());
+    CHECK(first->id.IsLoaded());
+    CHECK(first->id.Value() == john.id.Value());
+    CHECK(!first->name.IsLoaded());
+
+    first->age = 51;
+    dm.Update(*first);
+    CHECK(dm.QuerySingle<Person>(john.id.Value())->age.Value() == 51);
+    CHECK(dm.QuerySingle<Person>(jane.id.Value())->age.Value() == 42);
+
+    CHECK(dm.Delete(*first) == 1);
+    CHECK(!dm.QuerySingle<Person>(john.id.Value()).has_value());
+    CHECK(dm.QuerySingle<Person>(jane.id.Value()).has_value());
+}
+
 // NOLINTEND(bugprone-unchecked-optional-access)
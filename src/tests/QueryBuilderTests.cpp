@@ -777,6 +777,73 @@ TEST_CASE_METHOD(SqlTestFixture, "SqlQueryBuilder.WhereIn binds its values when
         [&]() { REQUIRE(inputBindings.size() == 1); });
 }
 
+TEST_CASE_METHOD(SqlTestFixture, "SqlQueryBuilder.WhereInArray", "[SqlQueryBuilder]")
+{
+    std::vector<SqlVariant> inputBindings;
+
+    // Integers and strings are bound as a single array parameter, whatever the list length.
+    CheckSqlQueryBuilder(
+        [&](SqlQueryBuilder& q) {
+            inputBindings.clear();
+            return q.FromTable("That").Update(&inputBindings).Set("a", 1).WhereInArray("foo", std::vector { 10, 20, 30 });
+        },
+        QueryExpectations {
+            .sqlite = R"(UPDATE "That" SET "a" = ?
+                         WHERE "foo" IN (SELECT value FROM json_each(?)))",
+            .postgres = R"(UPDATE "That" SET "a" = ?
+                           WHERE "foo" = ANY(CAST(? AS BIGINT[])))",
+            .sqlServer = R"(UPDATE "That" SET "a" = ?
+                            WHERE "foo" IN (SELECT value FROM OPENJSON(?) WITH (value BIGINT '$')))",
+        },
+        [&]() {
+            REQUIRE(inputBindings.size() == 2);
+            auto const& value = std::get<std::string>(inputBindings[1].value);
+            CHECK((value == "[10,20,30]" || value == "{10,20,30}"));
+        });
+
+    CheckSqlQueryBuilder(
+        [&](SqlQueryBuilder& q) {
+            inputBindings.clear();
+            return q.FromTable("That")
+                .Update(&inputBindings)
+                .Set("a", 1)
+                .WhereInArray("foo", std::vector<std::string> { R"(a"b)", "c" });
+        },
+        QueryExpectations {
+            .sqlite = R"(UPDATE "That" SET "a" = ?
+                         WHERE "foo" IN (SELECT value FROM json_each(?)))",
+            .postgres = R"(UPDATE "That" SET "a" = ?
+                           WHERE "foo" = ANY(CAST(? AS TEXT[])))",
+            .sqlServer = R"(UPDATE "That" SET "a" = ?
+                            WHERE "foo" IN (SELECT value FROM OPENJSON(?) WITH (value NVARCHAR(4000) '$')))",
+        },
+        [&]() {
+            // Both the JSON and the PostgreSQL array syntax escape the quote with a backslash.
+            REQUIRE(inputBindings.size() == 2);
+            auto const& value = std::get<std::string>(inputBindings[1].value);
+            CHECK((value == R"(["a\"b","c"])" || value == R"({"a\"b","c"})"));
+        });
+
+    // Other element types fall back to a marker list padded to the next power of two.
+    CheckSqlQueryBuilder(
+        [&](SqlQueryBuilder& q) {
+            inputBindings.clear();
+            return q.FromTable("That").Update(&inputBindings).Set("a", 1).WhereInArray("foo", std::vector { 1.5, 2.5, 3.5 });
+        },
+        QueryExpectations::All(R"(UPDATE "That" SET "a" = ?
+                                  WHERE "foo" IN (?, ?, ?, ?))"),
+        [&]() {
+            REQUIRE(inputBindings.size() == 5);
+            CHECK(std::get<double>(inputBindings[4].value) == 3.5);
+        });
+
+    // Without input bindings the values are inlined as with WhereIn.
+    CheckSqlQueryBuilder(
+        [](SqlQueryBuilder& q) { return q.FromTable("That").Delete().WhereInArray("foo", std::vector { 1, 2, 3 }); },
+        QueryExpectations::All(R"(DELETE FROM "That"
+                                  WHERE "foo" IN (1, 2, 3))"));
+}
+
 TEST_CASE_METHOD(SqlTestFixture, "SqlQueryBuilder.WhereIn accepts a range without a member empty()", "[SqlQueryBuilder]")
 {
     // A built-in array is an input_range but has no `.empty()` member, so the emptiness check must
@@ -1153,6 +1220,17 @@ TEST_CASE_METHOD(SqlTestFixture, "SqlQueryBuilder.Insert", "[SqlQueryBuilder]")
         });
 }
 
+TEST_CASE_METHOD(SqlTestFixture, "SqlQueryBuilder.Insert.Returning", "[SqlQueryBuilder]")
+{
+    CheckSqlQueryBuilder(
+        [&](SqlQueryBuilder& q) { return q.FromTable("Other").Insert(nullptr).Set("foo", SqlWildcard).Returning("id"); },
+        {
+            .sqlite = R"(INSERT INTO "Other" ("foo") VALUES (?) RETURNING "id")",
+            .postgres = R"(INSERT INTO "Other" ("foo") VALUES (?) RETURNING "id")",
+            .sqlServer = R"(INSERT INTO "Other" ("foo") OUTPUT INSERTED."id" VALUES (?))",
+        });
+}
+
 TEST_CASE_METHOD(SqlTestFixture, "SqlQueryBuilder.Update", "[SqlQueryBuilder]")
 {
     std::vector<SqlVariant> boundValues;
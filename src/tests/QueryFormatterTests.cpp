@@ -265,3 +265,26 @@ TEST_CASE("SqlQueryFormatter::DropTable on SQL Server with cascade emits a two-s
     CHECK(sqls[0].contains("sys.foreign_keys"));
     CHECK(sqls[1].starts_with("DROP TABLE IF EXISTS"));
 }
+
+// ================================================================================================
+// WindowFingerprint — SQL Server hashes the columns BINARY_CHECKSUM skips
+// ================================================================================================
+
+TEST_CASE("SqlQueryFormatter::WindowFingerprint on SQL Server hashes non-comparable columns", "[SqlQueryFormatter]")
+{
+    auto const comparable = std::array { SqlFingerprintColumn { .name = "id", .nativeType = "int" },
+                                         SqlFingerprintColumn { .name = "body", .nativeType = "nvarchar" } };
+    auto const plain = SqlQueryFormatter::SqlServer().WindowFingerprint({}, "Notes", "id", 1, 100, comparable);
+    CHECK(plain.contains("CHECKSUM_AGG(BINARY_CHECKSUM(*))"));
+    CHECK_FALSE(plain.contains("HASHBYTES"));
+
+    auto const legacy = std::array { SqlFingerprintColumn { .name = "id", .nativeType = "int" },
+                                     SqlFingerprintColumn { .name = "body", .nativeType = "NTEXT" },
+                                     SqlFingerprintColumn { .name = "doc", .nativeType = "xml" } };
+    auto const hashed = SqlQueryFormatter::SqlServer().WindowFingerprint({}, "Notes", "id", 1, 100, legacy);
+    CHECK(hashed.contains(R"(HASHBYTES('SHA2_256', CAST("body" AS varbinary(max))))"));
+    CHECK(hashed.contains(R"(HASHBYTES('SHA2_256', CAST("doc" AS varbinary(max))))"));
+    CHECK_FALSE(hashed.contains(R"(CAST("id")"));
+
+    CHECK(SqlQueryFormatter::Sqlite().WindowFingerprint({}, "Notes", "id", 1, 100, legacy).empty());
+}
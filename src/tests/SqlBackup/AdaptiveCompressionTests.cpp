@@ -0,0 +1,128 @@
+// SPDX-License-Identifier: Apache-2.0
+#include "../../Lightweight/SqlBackup/AdaptiveCompression.hpp"
+
+#include <catch2/catch_test_macros.hpp>
+
+#include <chrono>
+#include <cstdint>
+#include <format>
+#include <random>
+#include <ranges>
+#include <string>
+
+using namespace Lightweight::SqlBackup;
+using namespace Lightweight::SqlBackup::detail;
+using namespace std::chrono_literals;
+
+namespace
+{
+std::string RandomBytes(std::size_t size)
+{
+    auto engine = std::mt19937 { 42 };
+    auto distribution = std::uniform_int_distribution<int> { 0, 255 };
+    auto bytes = std::string(size, '\0');
+    for (auto& byte: bytes)
+        byte = static_cast<char>(distribution(engine));
+    return bytes;
+}
+
+std::string LogLines(std::size_t count)
+{
+    auto lines = std::string {};
+    for (auto const i: std::views::iota(0UZ, count))
+        lines += std::format("2026-10-19T12:{:02}:{:02} INFO request {} served in {} ms\n", i / 60 % 60, i % 60, i, i % 7);
+    return lines;
+}
+} // namespace
+
+TEST_CASE("DecideTableCompression: stores incompressible samples", "[SqlBackup][AdaptiveCompression]")
+{
+    auto const fast = CompressionTrial { .ratio = 0.99, .elapsed = 1ms };
+    auto const choice = DecideTableCompression(CompressionMethod::Zstd, 1.0, fast, std::nullopt);
+    CHECK(choice.method == CompressionMethod::Store);
+    CHECK(choice.level == 0);
+    CHECK(choice.sampleRatio == 1.0);
+}
+
+TEST_CASE("DecideTableCompression: the tradeoff sets the saving worth compressing for", "[SqlBackup][AdaptiveCompression]")
+{
+    // Saves 8%: below the 12% asked for at tradeoff 0, above the 2% asked for at tradeoff 1.
+    auto const fast = CompressionTrial { .ratio = 0.92, .elapsed = 1ms };
+    CHECK(DecideTableCompression(CompressionMethod::Deflate, 0.0, fast, std::nullopt).method == CompressionMethod::Store);
+
+    auto const choice = DecideTableCompression(CompressionMethod::Deflate, 1.0, fast, std::nullopt);
+    CHECK(choice.method == CompressionMethod::Deflate);
+    CHECK(choice.level == 1);
+    CHECK(choice.sampleRatio == 0.92);
+}
+
+TEST_CASE("DecideTableCompression: the strong level must pay for its extra time", "[SqlBackup][AdaptiveCompression]")
+{
+    auto const fast = CompressionTrial { .ratio = 0.40, .elapsed = 10ms };
+    auto const strong = CompressionTrial { .ratio = 0.36, .elapsed = 40ms }; // saves 10% more in 4x the time
+
+    SECTION("tradeoff 0 never takes it")
+    {
+        CHECK(DecideTableCompression(CompressionMethod::Deflate, 0.0, fast, strong).level == 1);
+    }
+    SECTION("balanced tradeoff takes it if the saving is large enough")
+    {
+        // Needs (1 - 0.5) x 3% x 4 = 6% more.
+        auto const choice = DecideTableCompression(CompressionMethod::Deflate, 0.5, fast, strong);
+        CHECK(choice.level == 9);
+        CHECK(choice.sampleRatio == 0.36);
+    }
+    SECTION("balanced tradeoff keeps the fast level for a much slower strong level")
+    {
+        auto const slow = CompressionTrial { .ratio = 0.36, .elapsed = 1s };
+        CHECK(DecideTableCompression(CompressionMethod::Zstd, 0.5, fast, slow).level == 1);
+    }
+    SECTION("tradeoff 1 takes any smaller result")
+    {
+        auto const slow = CompressionTrial { .ratio = 0.399, .elapsed = 1s };
+        CHECK(DecideTableCompression(CompressionMethod::Zstd, 1.0, fast, slow).level == 19);
+    }
+}
+
+TEST_CASE("AdaptiveCompression: Sample spans large chunks", "[SqlBackup][AdaptiveCompression]")
+{
+    CHECK(AdaptiveCompression::Sample("small chunk") == "small chunk");
+
+    auto chunk = std::string(1024 * 1024, 'm');
+    chunk.front() = 'F';
+    chunk.back() = 'L';
+    auto const sample = AdaptiveCompression::Sample(chunk);
+    REQUIRE(sample.size() == 4 * 64 * 1024);
+    CHECK(sample.front() == 'F');
+    CHECK(sample.back() == 'L');
+}
+
+TEST_CASE("AdaptiveCompression: chooses per table and keeps the first decision", "[SqlBackup][AdaptiveCompression]")
+{
+    auto compression = AdaptiveCompression { CompressionMethod::Deflate, 1.0 };
+
+    auto const blobs = compression.ForTable("blobs", RandomBytes(200'000));
+    CHECK(blobs.method == CompressionMethod::Store);
+
+    auto const logs = compression.ForTable("logs", LogLines(5'000));
+    CHECK(logs.method == CompressionMethod::Deflate);
+    CHECK(logs.sampleRatio < 0.5);
+
+    // Later chunks of a table get its first chunk's choice, whatever their content.
+    auto const laterLogs = compression.ForTable("logs", RandomBytes(10'000));
+    CHECK(laterLogs.method == logs.method);
+    CHECK(laterLogs.level == logs.level);
+
+    auto const choices = compression.Choices();
+    REQUIRE(choices.size() == 2);
+    CHECK(choices.at("blobs").method == CompressionMethod::Store);
+    CHECK(choices.at("logs").level == logs.level);
+}
+
+TEST_CASE("AdaptiveCompression: a Store backup runs no trials", "[SqlBackup][AdaptiveCompression]")
+{
+    auto compression = AdaptiveCompression { CompressionMethod::Store, 1.0 };
+    auto const choice = compression.ForTable("logs", LogLines(1'000));
+    CHECK(choice.method == CompressionMethod::Store);
+    CHECK(choice.sampleRatio == 1.0);
+}
@@ -0,0 +1,151 @@
+// SPDX-License-Identifier: Apache-2.0
+
+#include "../../Lightweight/SqlBackup/BulkLoader.hpp"
+
+#include <Lightweight/SqlBackup/BatchManager.hpp>
+#include <Lightweight/SqlConnection.hpp>
+#include <Lightweight/SqlStatement.hpp>
+#include <Lightweight/SqlTransaction.hpp>
+
+#include <catch2/catch_test_macros.hpp>
+
+#include <chrono>
+#include <ranges>
+#include <string>
+#include <vector>
+
+using namespace Lightweight;
+using namespace Lightweight::detail;
+using namespace Lightweight::SqlBackup;
+using namespace Lightweight::SqlBackup::detail;
+
+namespace
+{
+TableInfo MakeTableInfo()
+{
+    TableInfo info;
+    info.fields = R"("id","txt")";
+    info.columns = { { .name = "id", .type = SqlColumnTypeDefinitions::Integer {} },
+                     { .name = "txt", .type = SqlColumnTypeDefinitions::Text { .size = 255 } } };
+    info.isBinaryColumn = { false, false };
+    return info;
+}
+} // namespace
+
+TEST_CASE("BulkLoader: multi-row statements insert every row", "[SqlBackup][BulkLoader]")
+{
+    SqlConnection conn;
+    if (!conn.Connect(SqlConnection::DefaultConnectionString()))
+        return; // Skip if no connection
+
+    SqlStatement stmt { conn };
+    (void) stmt.ExecuteDirect("DROP TABLE IF EXISTS test_bulk_loader");
+    (void) stmt.ExecuteDirect("CREATE TABLE test_bulk_loader (id INTEGER PRIMARY KEY, txt VARCHAR(255))");
+
+    auto const tableInfo = MakeTableInfo();
+    // 7 parameters fit 3 rows of 2 columns, so each flush of 5 rows runs a full and a partial statement.
+    auto const loader = CreateMultiRowInsertLoader(conn, "", "test_bulk_loader", tableInfo, 7);
+    CHECK(loader->Method() == BulkLoadMethod::MultiRowValues);
+
+    BatchManager bm([&](std::vector<SqlRawColumn> const& columns, size_t rows) { loader->Load(columns, rows); },
+                    tableInfo.columns,
+                    5);
+    for (auto const id: std::views::iota(1, 12))
+    {
+        if (id % 4 == 0)
+            bm.PushRow({ id, std::monostate {} });
+        else
+            bm.PushRow({ id, "row " + std::to_string(id) });
+    }
+    bm.Flush();
+    loader->Finish();
+
+    REQUIRE(stmt.ExecuteDirectScalar<int>("SELECT COUNT(*) FROM test_bulk_loader") == 11);
+    CHECK(stmt.ExecuteDirectScalar<int>("SELECT COUNT(*) FROM test_bulk_loader WHERE txt IS NULL") == 2);
+    CHECK(stmt.ExecuteDirectScalar<std::string>("SELECT txt FROM test_bulk_loader WHERE id=1") == "row 1");
+    CHECK(stmt.ExecuteDirectScalar<std::string>("SELECT txt FROM test_bulk_loader WHERE id=6") == "row 6");
+    CHECK(stmt.ExecuteDirectScalar<std::string>("SELECT txt FROM test_bulk_loader WHERE id=11") == "row 11");
+    CHECK_FALSE(stmt.ExecuteDirectScalar<std::string>("SELECT txt FROM test_bulk_loader WHERE id=8").has_value());
+}
+
+TEST_CASE("RestoreSettings: restore picks the native bulk path by default", "[SqlBackup][BulkLoader]")
+{
+    CHECK(RestoreSettings {}.bulkLoad);
+}
+
+TEST_CASE("BulkLoader: a bulk copy left unfinished inserts nothing", "[SqlBackup][BulkLoader]")
+{
+    SqlConnection conn { std::nullopt };
+    conn.SetBulkCopyEnabled(true);
+    if (!conn.Connect(SqlConnection::DefaultConnectionString()) || !conn.SupportsBulkCopy())
+        return; // Skip unless the server offers bulk copy
+
+    SqlStatement stmt { conn };
+    (void) stmt.ExecuteDirect("DROP TABLE IF EXISTS test_bulk_loader");
+    (void) stmt.ExecuteDirect("CREATE TABLE test_bulk_loader (id INTEGER PRIMARY KEY, at DATETIME)");
+
+    TableInfo tableInfo;
+    tableInfo.fields = R"("id","at")";
+    tableInfo.columns = { { .name = "id", .type = SqlColumnTypeDefinitions::Integer {} },
+                          { .name = "at", .type = SqlColumnTypeDefinitions::DateTime {} } };
+    tableInfo.isBinaryColumn = { false, false };
+
+    auto const load = [&](bool finish) {
+        auto const loader = CreateBulkLoader(conn, "", "test_bulk_loader", tableInfo, true);
+        if (loader->Method() != BulkLoadMethod::BulkCopy)
+            return false;
+        auto transaction = SqlTransaction { conn, SqlTransactionMode::ROLLBACK };
+        BatchManager bm([&](std::vector<SqlRawColumn> const& columns, size_t rows) { loader->Load(columns, rows); },
+                        tableInfo.columns,
+                        5);
+        for (auto const id: std::views::iota(1, 12))
+            bm.PushRow({ id, std::string { "2024-05-06 07:08:09.1234567" } });
+        bm.Flush();
+        if (finish)
+        {
+            loader->Finish();
+            transaction.Commit();
+        }
+        return true;
+    };
+
+    // A chunk that fails before Finish() rolls back its transaction without a trace in the table.
+    if (!load(false))
+        return; // Skip if the driver does not export the bulk-copy functions
+    CHECK(stmt.ExecuteDirectScalar<int>("SELECT COUNT(*) FROM test_bulk_loader") == 0);
+
+    REQUIRE(load(true));
+    CHECK(stmt.ExecuteDirectScalar<int>("SELECT COUNT(*) FROM test_bulk_loader") == 11);
+    CHECK(stmt.ExecuteDirectScalar<std::string>("SELECT CONVERT(VARCHAR(23), at, 121) FROM test_bulk_loader WHERE id=3")
+          == "2024-05-06 07:08:09.123");
+}
+
+TEST_CASE("BulkLoader: without preferNative rows go through parameter arrays", "[SqlBackup][BulkLoader]")
+{
+    SqlConnection conn;
+    if (!conn.Connect(SqlConnection::DefaultConnectionString()))
+        return; // Skip if no connection
+
+    SqlStatement stmt { conn };
+    (void) stmt.ExecuteDirect("DROP TABLE IF EXISTS test_bulk_loader");
+    (void) stmt.ExecuteDirect("CREATE TABLE test_bulk_loader (id INTEGER PRIMARY KEY, txt VARCHAR(255))");
+
+    auto const loader = CreateBulkLoader(conn, "", "test_bulk_loader", MakeTableInfo(), false);
+    CHECK(loader->Method() == BulkLoadMethod::ParameterArrays);
+}
+
+TEST_CASE("BulkLoadCounters: reports only the methods that inserted rows", "[SqlBackup][BulkLoader]")
+{
+    BulkLoadCounters counters;
+    CHECK(counters.Statistics().empty());
+
+    counters.Add(BulkLoadMethod::MultiRowValues, 100, std::chrono::milliseconds(30));
+    counters.Add(BulkLoadMethod::MultiRowValues, 50, std::chrono::milliseconds(20));
+    counters.Add(BulkLoadMethod::BulkCopy, 0, std::chrono::milliseconds(5));
+
+    auto const statistics = counters.Statistics();
+    REQUIRE(statistics.size() == 1);
+    CHECK(statistics[0].method == BulkLoadMethodName(BulkLoadMethod::MultiRowValues));
+    CHECK(statistics[0].rows == 150);
+    CHECK(statistics[0].insertTime == std::chrono::milliseconds(50));
+}
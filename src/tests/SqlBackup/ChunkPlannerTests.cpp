@@ -8,6 +8,7 @@
 #include <limits>
 #include <optional>
 #include <string>
+#include <tuple>
 #include <utility>
 #include <vector>
 
@@ -110,6 +111,58 @@ TEST_CASE("PlanChunks: PK table is split into one chunk per window with shared s
     CHECK(plan.chunks[2].hi == 2500);
 }
 
+TEST_CASE("PlanChunks: an incremental base's grid keeps the window bounds when MAX(pk) grows", "[chunkplanner]")
+{
+    auto const makeTable = [](std::string name) {
+        SqlSchema::Table table = MakeTable(std::move(name));
+        table.primaryKeys = { "id" };
+        SqlSchema::Column id;
+        id.name = "id";
+        id.type = SqlColumnTypeDefinitions::Integer {};
+        id.isPrimaryKey = true;
+        table.columns.push_back(id);
+        return table;
+    };
+    auto const tables = std::vector<SqlSchema::Table> { makeTable("Grown"), makeTable("Shrunk"), makeTable("Lower") };
+    // Grown gained rows above the base's MAX(pk), Shrunk lost its lowest rows, Lower got keys below the grid.
+    auto const bounds = [](SqlSchema::Table const& table, std::string const& /*pk*/) {
+        if (table.name == "Grown")
+            return std::optional<std::pair<int64_t, int64_t>> { { 1, 2600 } };
+        if (table.name == "Shrunk")
+            return std::optional<std::pair<int64_t, int64_t>> { { 1700, 2500 } };
+        return std::optional<std::pair<int64_t, int64_t>> { { -10, 2500 } };
+    };
+    auto const baseGrids = WindowGrids {
+        { "Grown", { .pkMin = 1, .width = 834 } },
+        { "Shrunk", { .pkMin = 1, .width = 834 } },
+        { "Lower", { .pkMin = 1, .width = 834 } },
+    };
+    auto const plan = PlanChunks(tables, /*rowsPerChunk=*/1000, bounds, SqlServerType::SQLITE, baseGrids);
+
+    auto const windowsOf = [&](std::string const& name) {
+        auto windows = std::vector<std::tuple<uint32_t, int64_t, int64_t>> {};
+        for (auto const& chunk: plan.chunks)
+            if (chunk.table->name == name)
+                windows.emplace_back(chunk.windowIndex, chunk.lo, chunk.hi);
+        return windows;
+    };
+    using W = std::tuple<uint32_t, int64_t, int64_t>;
+    // Without the grid, [1, 2600] would be cut at width 867 and no window would line up with the base.
+    CHECK(windowsOf("Grown") == std::vector<W> { { 0, 1, 834 }, { 1, 835, 1668 }, { 2, 1669, 2502 }, { 3, 2503, 2600 } });
+    CHECK(windowsOf("Shrunk") == std::vector<W> { { 2, 1669, 2500 } });
+    CHECK(plan.windowGrids.at("Shrunk").pkMin == 1);
+    CHECK(plan.windowGrids.at("Lower").pkMin == -10);
+    CHECK(std::get<1>(windowsOf("Lower").front()) == -10);
+
+    // A grid that would need more than MaxBaseGridWindowsPerTable windows is dropped as well.
+    auto const wideBounds = [](SqlSchema::Table const& /*table*/, std::string const& /*pk*/) {
+        return std::optional<std::pair<int64_t, int64_t>> { { 1, 100'000 } };
+    };
+    auto const narrowGrid = WindowGrids { { "Grown", { .pkMin = 1, .width = 10 } } };
+    auto const replanned = PlanChunks(tables, /*rowsPerChunk=*/1000, wideBounds, SqlServerType::SQLITE, narrowGrid);
+    CHECK(replanned.windowGrids.at("Grown").width == 1000);
+}
+
 TEST_CASE("PlanChunks: full-range PK span saturates the totalRows estimate without UB", "[chunkplanner]")
 {
     SqlSchema::Table table = MakeTable("FullRange");
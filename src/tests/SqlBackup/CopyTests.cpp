@@ -0,0 +1,121 @@
+// SPDX-License-Identifier: Apache-2.0
+
+#include "../../Lightweight/ThreadSafeQueue.hpp"
+#include "../Utils.hpp"
+
+#include <Lightweight/SqlBackup.hpp>
+#include <Lightweight/SqlConnectInfo.hpp>
+#include <Lightweight/SqlConnection.hpp>
+#include <Lightweight/SqlStatement.hpp>
+
+#include <catch2/catch_test_macros.hpp>
+
+#include <atomic>
+#include <chrono>
+#include <filesystem>
+#include <format>
+#include <iostream>
+#include <ranges>
+#include <thread>
+
+#include "TestHelpers.hpp"
+
+using namespace Lightweight;
+using namespace Lightweight::SqlBackup::Tests;
+
+namespace
+{
+
+std::filesystem::path const CopyTargetFile = "copy_target.db";
+
+SqlConnectionString CopyTargetConnectionString()
+{
+    return SqlConnectionString { std::format("DRIVER=SQLite3;Database={}", CopyTargetFile.string()) };
+}
+
+} // namespace
+
+TEST_CASE("ThreadSafeQueue: bounded queue applies backpressure", "[SqlBackup],[Copy]")
+{
+    ThreadSafeQueue<int> queue { 2 };
+    REQUIRE(queue.Push(1));
+    REQUIRE(queue.Push(2));
+
+    std::atomic<bool> thirdPushed { false };
+    auto producer = std::jthread { [&] {
+        (void) queue.Push(3);
+        thirdPushed = true;
+    } };
+
+    std::this_thread::sleep_for(std::chrono::milliseconds(50));
+    CHECK_FALSE(thirdPushed.load());
+
+    int value = 0;
+    REQUIRE(queue.WaitAndPop(value));
+    CHECK(value == 1);
+    producer.join();
+    CHECK(thirdPushed.load());
+
+    // A finished bounded queue rejects new items instead of blocking forever.
+    queue.MarkFinished();
+    CHECK_FALSE(queue.Push(4));
+}
+
+TEST_CASE_METHOD(SqlTestFixture, "SqlBackup: Copy tables into another database", "[SqlBackup],[Copy]")
+{
+    ScopedFileRemoved const targetFileCleaner { CopyTargetFile };
+
+    {
+        SqlConnection conn;
+        conn.Connect(SqlConnection::DefaultConnectionString());
+        SqlStatement stmt { conn };
+        stmt.MigrateDirect([](SqlMigrationQueryBuilder& migration) {
+            migration.DropTableIfExists("copy_source");
+            migration.CreateTable("copy_source")
+                .PrimaryKey("id", SqlColumnTypeDefinitions::Integer {})
+                .Column("content", SqlColumnTypeDefinitions::Varchar { 64 });
+        });
+        stmt.Prepare("INSERT INTO copy_source (id, content) VALUES (?, ?)");
+        for (auto const i: std::views::iota(1, 101))
+            (void) stmt.Execute(i, std::format("row{}", i));
+    }
+
+    {
+        // Creates the target database file.
+        SqlConnection target;
+        if (!target.Connect(CopyTargetConnectionString()))
+            SKIP("SQLite3 ODBC driver not available for the copy target");
+    }
+
+    std::atomic<int> errors { 0 };
+    LambdaProgressManager pm { [&](SqlBackup::Progress const& p) {
+        if (p.state == SqlBackup::Progress::State::Error)
+        {
+            ++errors;
+            std::cerr << "Copy Error: " << p.message << "\n";
+        }
+    } };
+
+    // Small batches and a tiny queue make the readers block on the writers.
+    auto copySettings = SqlBackup::CopySettings {};
+    copySettings.rowsPerChunk = 30;
+    copySettings.rowsPerBatch = 7;
+    copySettings.queueCapacity = 2;
+
+    REQUIRE_NOTHROW(SqlBackup::Copy(SqlConnection::DefaultConnectionString(),
+                                    CopyTargetConnectionString(),
+                                    pm,
+                                    {},
+                                    {},
+                                    "copy_source",
+                                    {},
+                                    copySettings));
+    CHECK(errors.load() == 0);
+
+    SqlConnection target;
+    REQUIRE(target.Connect(CopyTargetConnectionString()));
+    SqlStatement stmt { target };
+    CHECK(stmt.ExecuteDirectScalar<long long>("SELECT COUNT(*) FROM copy_source") == 100);
+    CHECK(stmt.ExecuteDirectScalar<std::string>("SELECT content FROM copy_source WHERE id=1") == "row1");
+    CHECK(stmt.ExecuteDirectScalar<std::string>("SELECT content FROM copy_source WHERE id=100") == "row100");
+}
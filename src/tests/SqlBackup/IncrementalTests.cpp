@@ -0,0 +1,115 @@
+// SPDX-License-Identifier: Apache-2.0
+#include "../../Lightweight/SqlBackup/Incremental.hpp"
+
+#include <catch2/catch_test_macros.hpp>
+
+#include <string>
+#include <utility>
+#include <vector>
+
+using namespace Lightweight::SqlBackup::detail;
+using namespace Lightweight;
+
+namespace
+{
+SqlSchema::Table MakeTable(std::string name)
+{
+    SqlSchema::Table t;
+    t.name = std::move(name);
+    t.primaryKeys = { "id" };
+    SqlSchema::Column id;
+    id.name = "id";
+    id.type = SqlColumnTypeDefinitions::Bigint {};
+    id.isPrimaryKey = true;
+    t.columns.push_back(id);
+    SqlSchema::Column data;
+    data.name = "data";
+    data.type = SqlColumnTypeDefinitions::Varchar { .size = 50 };
+    t.columns.push_back(data);
+    return t;
+}
+
+constexpr auto BaseMetadata = R"({
+    "format_version": "1.0",
+    "schema": [
+        {
+            "name": "Orders",
+            "columns": [ { "name": "id", "type": "bigint" }, { "name": "data", "type": "varchar" } ],
+            "windows": [
+                { "window": 0, "lo": 1, "hi": 1000, "fingerprint": "1000:42", "sub_chunks": 2, "rows": 1000 },
+                { "window": 1, "lo": 1001, "hi": 1500, "fingerprint": "500:7", "sub_chunks": 1, "rows": 500 }
+            ],
+            "window_grid": { "pk_min": 1, "width": 1000 }
+        },
+        {
+            "name": "Log",
+            "columns": [ { "name": "message", "type": "text" } ]
+        }
+    ]
+})";
+
+constexpr auto BaseChecksums = R"({
+    "algorithm": "sha256",
+    "files": { "data/Orders/0001_00.msgpack": "aa", "data/Orders/0001_01.msgpack": "bb" }
+})";
+} // namespace
+
+TEST_CASE("ParseIncrementalBase reads windows, columns and checksums", "[SqlBackup][incremental]")
+{
+    auto const base = ParseIncrementalBase(BaseMetadata, BaseChecksums);
+
+    CHECK(base.formatVersion == "1.0");
+    REQUIRE(base.windows.contains("Orders"));
+    CHECK_FALSE(base.windows.contains("Log"));
+    auto const& windows = base.windows.at("Orders");
+    REQUIRE(windows.size() == 2);
+    CHECK(windows[1].window == 1);
+    CHECK(windows[1].lo == 1001);
+    CHECK(windows[1].hi == 1500);
+    CHECK(windows[1].fingerprint == "500:7");
+    CHECK(windows[1].subChunks == 1);
+    CHECK(windows[1].rows == 500);
+    CHECK(base.grids.at("Orders").pkMin == 1);
+    CHECK(base.grids.at("Orders").width == 1000);
+    CHECK_FALSE(base.grids.contains("Log"));
+    CHECK(base.columns.at("Log") == std::vector<std::string> { "message" });
+    CHECK(base.checksums.size() == 2);
+    CHECK(base.checksums.at("data/Orders/0001_01.msgpack") == "bb");
+    CHECK(base.checksumAlgorithm == "sha256");
+}
+
+TEST_CASE("ParseIncrementalBase records the base's checksum algorithm", "[SqlBackup][incremental]")
+{
+    auto const base = ParseIncrementalBase(BaseMetadata, R"({ "algorithm": "xxh3-128", "files": {} })");
+    CHECK(base.checksumAlgorithm == "xxh3-128");
+}
+
+TEST_CASE("ParseIncrementalBase accepts an archive without checksums", "[SqlBackup][incremental]")
+{
+    auto const base = ParseIncrementalBase(BaseMetadata, "");
+    CHECK(base.checksums.empty());
+    CHECK(base.checksumAlgorithm == "sha256");
+    CHECK(base.windows.at("Orders").size() == 2);
+}
+
+TEST_CASE("FindReusableWindow requires same bounds, fingerprint and columns", "[SqlBackup][incremental]")
+{
+    auto const base = ParseIncrementalBase(BaseMetadata, BaseChecksums);
+    auto const table = MakeTable("Orders");
+
+    auto const* window = base.FindReusableWindow(table, 0, 1, 1000, "1000:42");
+    REQUIRE(window != nullptr);
+    CHECK(window->subChunks == 2);
+
+    CHECK(base.FindReusableWindow(table, 0, 1, 1000, "1000:43") == nullptr); // data changed
+    CHECK(base.FindReusableWindow(table, 1, 1001, 1600, "500:7") == nullptr); // bounds moved
+    CHECK(base.FindReusableWindow(table, 2, 1501, 2000, "500:7") == nullptr); // new window
+    CHECK(base.FindReusableWindow(MakeTable("Unknown"), 0, 1, 1000, "1000:42") == nullptr);
+
+    auto widened = table;
+    SqlSchema::Column extra;
+    extra.name = "extra";
+    extra.type = SqlColumnTypeDefinitions::Integer {};
+    widened.columns.push_back(extra);
+    CHECK(base.FindReusableWindow(widened, 0, 1, 1000, "1000:42") == nullptr); // column added
+}
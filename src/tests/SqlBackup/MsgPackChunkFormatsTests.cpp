@@ -4,11 +4,16 @@
 
 #include <catch2/catch_test_macros.hpp>
 
+#include <algorithm>
 #include <array>
 #include <bit>
 #include <cstring>
+#include <format>
+#include <ranges>
+#include <span>
 #include <sstream>
 #include <string>
+#include <string_view>
 #include <vector>
 
 using namespace Lightweight::SqlBackup;
@@ -755,6 +760,64 @@ TEST_CASE("MsgPack: Multiple flush cycles", "[SqlBackup][MsgPack]")
     }
 }
 
+TEST_CASE("MsgPack: WriteColumns matches WriteRow", "[SqlBackup][MsgPack]")
+{
+    // Two blocks of three rows: ints with a NULL, bools, doubles, text with a NULL, a column that
+    // is NULL in the first block only, and a column that is NULL throughout.
+    auto const ints = std::array<int64_t, 6> { 1, 0, -3, 40000, 5, 1LL << 40 };
+    auto const bools = std::array<int64_t, 6> { 1, 0, 1, 0, 0, 1 };
+    auto const doubles = std::array<double, 6> { 0.5, -1.25, 3.0, 0.0, 1e10, 2.5 };
+    auto const texts = std::array<std::string_view, 6> { "a", "", "ccc", "dd", "", "ffffff" };
+    auto const intNulls = std::array<uint8_t, 6> { 0, 1, 0, 0, 0, 0 };
+    auto const textNulls = std::array<uint8_t, 6> { 0, 0, 0, 1, 0, 0 };
+    auto const lateNulls = std::array<uint8_t, 6> { 1, 1, 1, 0, 0, 0 };
+    auto const allNulls = std::array<uint8_t, 6> { 1, 1, 1, 1, 1, 1 };
+    auto const noNulls = std::array<uint8_t, 6> {};
+
+    auto rowWriter = CreateMsgPackChunkWriter(1024 * 1024);
+    for (auto const r: std::views::iota(0UZ, ints.size()))
+    {
+        auto const row = std::vector<BackupValue> {
+            intNulls[r] ? BackupValue {} : BackupValue { ints[r] },
+            BackupValue { bools[r] != 0 },
+            BackupValue { doubles[r] },
+            textNulls[r] ? BackupValue {} : BackupValue { std::string(texts[r]) },
+            lateNulls[r] ? BackupValue {} : BackupValue { ints[r] },
+            BackupValue {},
+        };
+        rowWriter->WriteRow(row);
+    }
+
+    auto columnWriter = CreateMsgPackChunkWriter(1024 * 1024);
+    for (auto const offset: std::views::iota(0UZ, ints.size()) | std::views::stride(3))
+    {
+        using Type = BackupColumnBlock::Type;
+        auto const blocks = std::array {
+            BackupColumnBlock { .type = Type::Int64,
+                                .int64Values = std::span(ints).subspan(offset, 3),
+                                .nulls = std::span(intNulls).subspan(offset, 3) },
+            BackupColumnBlock { .type = Type::Bool,
+                                .int64Values = std::span(bools).subspan(offset, 3),
+                                .nulls = std::span(noNulls).subspan(offset, 3) },
+            BackupColumnBlock { .type = Type::Double,
+                                .doubleValues = std::span(doubles).subspan(offset, 3),
+                                .nulls = std::span(noNulls).subspan(offset, 3) },
+            BackupColumnBlock { .type = Type::Text,
+                                .textValues = std::span(texts).subspan(offset, 3),
+                                .nulls = std::span(textNulls).subspan(offset, 3) },
+            BackupColumnBlock { .type = Type::Int64,
+                                .int64Values = std::span(ints).subspan(offset, 3),
+                                .nulls = std::span(lateNulls).subspan(offset, 3) },
+            BackupColumnBlock { .type = Type::Text,
+                                .textValues = std::span(texts).subspan(offset, 3),
+                                .nulls = std::span(allNulls).subspan(offset, 3) },
+        };
+        columnWriter->WriteColumns(blocks, 3);
+    }
+
+    REQUIRE(columnWriter->Flush() == rowWriter->Flush());
+}
+
 // =============================================================================
 // Reader Edge Cases
 // =============================================================================
@@ -1821,3 +1884,134 @@ TEST_CASE("MsgPack: Legacy bool array format (Array of True/False)", "[SqlBackup
     REQUIRE(bools[1] == false);
     REQUIRE(bools[2] == true);
 }
+
+// =============================================================================
+// Compact column encodings (format 1.1)
+// =============================================================================
+
+TEST_CASE("MsgPack: Compact encodings roundtrip", "[SqlBackup][MsgPack]")
+{
+    constexpr size_t RowCount = 1000;
+    auto const statuses = std::array<std::string, 3> { "open", "closed", "pending" };
+
+    // id: monotonic (delta); kind: long runs (rle); flag: long runs (rle); status: low cardinality
+    // (dict); name: unique (plain); score: double (plain); parent: monotonic with NULLs (delta).
+    auto rows = std::vector<std::vector<BackupValue>> {};
+    for (auto const i: std::views::iota(0UZ, RowCount))
+    {
+        auto const id = static_cast<int64_t>(1'000'000 + i);
+        rows.push_back({
+            id,
+            static_cast<int64_t>(i / 100) - 3,
+            i >= 400 && i < 900,
+            statuses[i % statuses.size()],
+            std::format("name-{}", i),
+            static_cast<double>(i) / 8,
+            i % 7 == 0 ? BackupValue {} : BackupValue { id * 2 },
+        });
+    }
+
+    auto const serialize = [&](bool compactEncodings) {
+        auto writer = CreateMsgPackChunkWriter(1024 * 1024 * 100, compactEncodings);
+        for (auto const& row: rows)
+            writer->WriteRow(row);
+        return writer->Flush();
+    };
+    auto const plain = serialize(false);
+    auto const compact = serialize(true);
+    CHECK(compact.size() < plain.size() / 2);
+
+    std::stringstream ss(compact);
+    auto reader = CreateMsgPackChunkReader(ss);
+    ColumnBatch batch;
+    REQUIRE(reader->ReadBatch(batch));
+    REQUIRE(batch.rowCount == RowCount);
+    REQUIRE(batch.columns.size() == 7);
+
+    auto const& ids = std::get<std::vector<int64_t>>(batch.columns[0]);
+    auto const& kinds = std::get<std::vector<int64_t>>(batch.columns[1]);
+    auto const& flags = std::get<std::vector<bool>>(batch.columns[2]);
+    auto const& statusColumn = std::get<std::vector<std::string>>(batch.columns[3]);
+    auto const& names = std::get<std::vector<std::string>>(batch.columns[4]);
+    auto const& scores = std::get<std::vector<double>>(batch.columns[5]);
+    auto const& parents = std::get<std::vector<int64_t>>(batch.columns[6]);
+    REQUIRE(ids.size() == RowCount);
+    REQUIRE(kinds.size() == RowCount);
+    REQUIRE(flags.size() == RowCount);
+    REQUIRE(statusColumn.size() == RowCount);
+    REQUIRE(names.size() == RowCount);
+    REQUIRE(scores.size() == RowCount);
+    REQUIRE(parents.size() == RowCount);
+
+    for (auto const i: std::views::iota(0UZ, RowCount))
+    {
+        INFO("row " << i);
+        CHECK(BackupValue { ids[i] } == rows[i][0]);
+        CHECK(BackupValue { kinds[i] } == rows[i][1]);
+        CHECK(BackupValue { static_cast<bool>(flags[i]) } == rows[i][2]);
+        CHECK(BackupValue { statusColumn[i] } == rows[i][3]);
+        CHECK(BackupValue { names[i] } == rows[i][4]);
+        CHECK(BackupValue { scores[i] } == rows[i][5]);
+        CHECK(batch.nullIndicators[6][i] == (i % 7 == 0));
+        if (i % 7 != 0)
+            CHECK(BackupValue { parents[i] } == rows[i][6]);
+    }
+}
+
+TEST_CASE("MsgPack: Compact encodings keep incompressible columns plain", "[SqlBackup][MsgPack]")
+{
+    // Values without deltas, runs or repeats to exploit: the compact writer must not grow them.
+    auto writer = CreateMsgPackChunkWriter(1024 * 1024, true);
+    auto plainWriter = CreateMsgPackChunkWriter(1024 * 1024, false);
+    for (auto const i: std::views::iota(int64_t { 0 }, int64_t { 64 }))
+    {
+        auto const scrambled = static_cast<int64_t>(static_cast<uint64_t>(i) * 0x9E3779B97F4A7C15ULL);
+        auto const row = std::vector<BackupValue> { scrambled, std::format("{:x}", i * 7919) };
+        writer->WriteRow(row);
+        plainWriter->WriteRow(row);
+    }
+    REQUIRE(writer->Flush() == plainWriter->Flush());
+}
+
+TEST_CASE("MsgPack: Bool run-length encoding starting with true", "[SqlBackup][MsgPack]")
+{
+    auto writer = CreateMsgPackChunkWriter(1024 * 1024, true);
+    for (auto const i: std::views::iota(0UZ, 200UZ))
+        writer->WriteRow(std::vector<BackupValue> { i < 150 });
+
+    auto const data = writer->Flush();
+    std::stringstream ss(data);
+    auto reader = CreateMsgPackChunkReader(ss);
+    ColumnBatch batch;
+    REQUIRE(reader->ReadBatch(batch));
+    auto const& bools = std::get<std::vector<bool>>(batch.columns[0]);
+    REQUIRE(bools.size() == 200);
+    CHECK(std::ranges::count(bools, true) == 150);
+    CHECK(bools[149]);
+    CHECK_FALSE(bools[150]);
+}
+
+TEST_CASE("MsgPack: Reader rejects unknown column encodings", "[SqlBackup][MsgPack]")
+{
+    MsgPackBuilder builder;
+    builder.WriteFixArray(1);
+    builder.WriteFixMap(4);
+    builder.WriteFixStr("t");
+    builder.WriteFixStr("i64");
+    builder.WriteFixStr("e");
+    builder.WriteFixStr("zstd");
+    builder.WriteFixStr("d");
+    std::vector<uint8_t> payload = { 0 };
+    builder.WriteBin8(payload);
+    builder.WriteFixStr("n");
+    builder.WriteFixArray(2);
+    builder.WriteFixInt(1);
+    std::vector<uint8_t> bits = { 0 };
+    builder.WriteBin8(bits);
+
+    std::string data = builder.Data();
+    std::stringstream ss(data);
+    auto reader = CreateMsgPackChunkReader(ss);
+    ColumnBatch batch;
+    REQUIRE_THROWS_AS(reader->ReadBatch(batch), std::runtime_error);
+}
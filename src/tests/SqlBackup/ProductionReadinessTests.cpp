@@ -10,7 +10,9 @@
 #include <catch2/catch_test_macros.hpp>
 
 #include <filesystem>
+#include <format>
 #include <fstream>
+#include <ranges>
 
 // NOLINTBEGIN(*) - third-party libzip header
 #if defined(__clang__)
@@ -213,6 +215,113 @@ TEST_CASE_METHOD(SqlTestFixture, "SqlBackup: Checksums in backup", "[SqlBackup][
     REQUIRE(!checksums["files"].empty());
 }
 
+TEST_CASE_METHOD(SqlTestFixture, "SqlBackup: XXH3 checksums are recorded and verified", "[SqlBackup][ProductionReadiness]")
+{
+    ScopedFileRemoved const backupFileCleaner { BackupFile };
+    SetupTestTable();
+
+    ErrorCountingProgressManager backupPm;
+    SqlBackup::Backup(BackupFile,
+                      GetConnectionString(),
+                      1,
+                      backupPm,
+                      "",
+                      "*",
+                      {},
+                      { .checksumAlgorithm = SqlBackup::ChecksumAlgorithm::Xxh3 });
+    REQUIRE(backupPm.ErrorCount() == 0);
+
+    int err = 0;
+    zip_t* zip = zip_open(BackupFile.string().c_str(), ZIP_RDONLY, &err);
+    REQUIRE(zip != nullptr);
+    auto const checksumIndex = static_cast<zip_uint64_t>(zip_name_locate(zip, "checksums.json", 0));
+    zip_stat_t checksumStat;
+    zip_stat_index(zip, checksumIndex, 0, &checksumStat);
+    zip_file_t* file = zip_fopen_index(zip, checksumIndex, 0);
+    REQUIRE(file != nullptr);
+    std::string checksumStr(checksumStat.size, '\0');
+    zip_fread(file, checksumStr.data(), checksumStat.size);
+    zip_fclose(file);
+    zip_close(zip);
+
+    nlohmann::json const checksums = nlohmann::json::parse(checksumStr);
+    CHECK(checksums["algorithm"] == "xxh3-128");
+    REQUIRE(!checksums["files"].empty());
+    for (auto const& [name, hash]: checksums["files"].items())
+        CHECK(hash.get<std::string>().size() == 32);
+
+    // The restore picks the algorithm up from checksums.json and verifies every chunk with it.
+    ErrorCountingProgressManager restorePm;
+    SqlBackup::Restore(BackupFile, GetConnectionString(), 1, restorePm);
+    CHECK(restorePm.ErrorCount() == 0);
+    for (auto const& warning: restorePm.warnings)
+        CHECK_FALSE(warning.contains("checksum"));
+
+    SqlConnection conn;
+    conn.Connect(GetConnectionString());
+    SqlStatement stmt { conn };
+    CHECK(stmt.ExecuteDirectScalar<int>("SELECT COUNT(*) FROM prod_test_table").value_or(0) == 3);
+}
+
+TEST_CASE_METHOD(SqlTestFixture,
+                 "SqlBackup: single-writer restore decodes in parallel and releases the database",
+                 "[SqlBackup][ProductionReadiness]")
+{
+    using namespace SqlColumnTypeDefinitions;
+
+    {
+        SqlConnection conn;
+        conn.Connect(GetConnectionString());
+        if (conn.SupportsConcurrentWriters())
+            SKIP("Backend restores with one writer per worker");
+    }
+
+    ScopedFileRemoved const backupFileCleaner { BackupFile };
+    {
+        SqlConnection conn;
+        conn.Connect(GetConnectionString());
+        SqlStatement stmt { conn };
+        stmt.MigrateDirect([](SqlMigrationQueryBuilder& migration) {
+            migration.DropTableIfExists("writer_a");
+            migration.DropTableIfExists("writer_b");
+            migration.CreateTable("writer_a").PrimaryKey("id", Integer {}).Column("name", Varchar { 50 });
+            migration.CreateTable("writer_b").PrimaryKey("id", Integer {}).Column("amount", Integer {});
+            migration.CreateIndex("idx_writer_a_name", "writer_a", { "name" });
+        });
+
+        stmt.Prepare("INSERT INTO writer_a (id, name) VALUES (?, ?)");
+        for (auto const i: std::views::iota(1, 1201))
+            (void) stmt.Execute(i, std::format("name {}", i % 17));
+        stmt.Prepare("INSERT INTO writer_b (id, amount) VALUES (?, ?)");
+        for (auto const i: std::views::iota(1, 701))
+            (void) stmt.Execute(i, i * 3);
+    }
+
+    // Small windows give each table several chunks for the decoders to spread over.
+    ErrorCountingProgressManager backupPm;
+    SqlBackup::Backup(BackupFile, GetConnectionString(), 2, backupPm, "", "writer_*", {}, { .rowsPerChunk = 250 });
+    REQUIRE(backupPm.ErrorCount() == 0);
+
+    ErrorCountingProgressManager restorePm;
+    SqlBackup::Restore(BackupFile, GetConnectionString(), 4, restorePm, "", "writer_*");
+    REQUIRE(restorePm.ErrorCount() == 0);
+
+    // A fresh connection can write again: the import's exclusive lock ended with the writer.
+    SqlConnection conn;
+    conn.Connect(GetConnectionString());
+    SqlStatement stmt { conn };
+    CHECK(stmt.ExecuteDirectScalar<int>("SELECT COUNT(*) FROM writer_a").value_or(0) == 1200);
+    CHECK(stmt.ExecuteDirectScalar<int>("SELECT COUNT(*) FROM writer_b").value_or(0) == 700);
+    CHECK(stmt.ExecuteDirectScalar<int>("SELECT SUM(amount) FROM writer_b").value_or(0) == 3 * 700 * 701 / 2);
+    (void) stmt.ExecuteDirect("INSERT INTO writer_b (id, amount) VALUES (701, 0)");
+
+    // Indexes are built after the data (single-writer restore only exists for SQLite).
+    CHECK(stmt.ExecuteDirectScalar<int>(
+                  "SELECT COUNT(*) FROM sqlite_master WHERE type = 'index' AND name = 'idx_writer_a_name'")
+              .value_or(0)
+          == 1);
+}
+
 TEST_CASE_METHOD(SqlTestFixture, "SqlBackup: Filter tables in restore", "[SqlBackup][ProductionReadiness]")
 {
     using namespace SqlColumnTypeDefinitions;
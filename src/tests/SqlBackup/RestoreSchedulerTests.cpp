@@ -0,0 +1,156 @@
+// SPDX-License-Identifier: Apache-2.0
+#include "../../Lightweight/SqlBackup/RestoreScheduler.hpp"
+
+#include <catch2/catch_test_macros.hpp>
+
+#include <chrono>
+#include <cstddef>
+#include <future>
+#include <map>
+#include <optional>
+#include <ranges>
+#include <string>
+#include <thread>
+#include <vector>
+
+using namespace Lightweight::SqlBackup::detail;
+using namespace Lightweight::SqlBackup;
+
+namespace
+{
+RestoreChunkEntry MakeChunk(std::string const& table, int index, size_t compressedSize)
+{
+    return RestoreChunkEntry {
+        .tableName = table,
+        .entry = ZipEntryInfo { .index = index,
+                                .name = "data/" + table + "/" + std::to_string(index) + ".msgpack",
+                                .size = 0,
+                                .valid = true,
+                                .compressedSize = compressedSize },
+    };
+}
+
+std::string TableOf(std::optional<RestoreChunkEntry> const& chunk)
+{
+    return chunk ? chunk->tableName : std::string { "<none>" };
+}
+} // namespace
+
+TEST_CASE("RestoreScheduler: starts with the largest table", "[RestoreScheduler]")
+{
+    std::vector<RestoreChunkEntry> chunks {
+        MakeChunk("Small", 0, 100),
+        MakeChunk("Large", 0, 5000),
+        MakeChunk("Medium", 0, 1000),
+    };
+    RestoreScheduler scheduler { std::move(chunks), {}, 1, 0 };
+
+    CHECK(TableOf(scheduler.Acquire(0)) == "Large");
+    CHECK(TableOf(scheduler.Acquire(0)) == "Medium");
+    CHECK(TableOf(scheduler.Acquire(0)) == "Small");
+    CHECK_FALSE(scheduler.Acquire(0).has_value());
+}
+
+TEST_CASE("RestoreScheduler: row counts raise a table's cost", "[RestoreScheduler]")
+{
+    std::vector<RestoreChunkEntry> chunks {
+        MakeChunk("Narrow", 0, 1000),
+        MakeChunk("Wide", 0, 2000),
+    };
+    // By bytes alone Wide would go first; a million rows make Narrow the expensive one.
+    std::map<std::string, TableInfo> tables;
+    tables["Narrow"].rowCount = 1'000'000;
+    tables["Wide"].rowCount = 10;
+    RestoreScheduler scheduler { std::move(chunks), tables, 1, 0 };
+
+    CHECK(TableOf(scheduler.Acquire(0)) == "Narrow");
+}
+
+TEST_CASE("RestoreScheduler: spreads workers by remaining cost per writer", "[RestoreScheduler]")
+{
+    std::vector<RestoreChunkEntry> chunks;
+    for (auto const i: std::views::iota(0, 4))
+        chunks.push_back(MakeChunk("Large", i, 1000));
+    chunks.push_back(MakeChunk("Small", 0, 900));
+    RestoreScheduler scheduler { std::move(chunks), {}, 3, 0 };
+
+    // Large: 4000 pending. After the first take 3000 remain, shared by two writers (1500 each)
+    // beats Small's 900; after the second, 2000 over three writers (667) no longer does.
+    CHECK(TableOf(scheduler.Acquire(0)) == "Large");
+    CHECK(TableOf(scheduler.Acquire(1)) == "Large");
+    CHECK(TableOf(scheduler.Acquire(2)) == "Small");
+}
+
+TEST_CASE("RestoreScheduler: hands out a table's chunks in archive order", "[RestoreScheduler]")
+{
+    std::vector<RestoreChunkEntry> chunks {
+        MakeChunk("Orders", 0, 10),
+        MakeChunk("Orders", 1, 500),
+        MakeChunk("Orders", 2, 20),
+    };
+    RestoreScheduler scheduler { std::move(chunks), {}, 1, 0 };
+
+    for (auto const expected: std::views::iota(0, 3))
+    {
+        auto const chunk = scheduler.Acquire(0);
+        REQUIRE(chunk.has_value());
+        CHECK(chunk->entry.index == expected);
+    }
+    CHECK(scheduler.PendingChunks() == 0);
+}
+
+TEST_CASE("RestoreScheduler: writer limit moves workers to other tables", "[RestoreScheduler]")
+{
+    std::vector<RestoreChunkEntry> chunks;
+    for (auto const i: std::views::iota(0, 4))
+        chunks.push_back(MakeChunk("Large", i, 1000));
+    chunks.push_back(MakeChunk("Small", 0, 10));
+    RestoreScheduler scheduler { std::move(chunks), {}, 3, 1 };
+
+    CHECK(TableOf(scheduler.Acquire(0)) == "Large");
+    CHECK(TableOf(scheduler.Acquire(1)) == "Small");
+
+    // Only Large has chunks left and worker 0 writes to it: worker 2 waits until worker 0 moves on.
+    auto waiting = std::async(std::launch::async, [&] { return scheduler.Acquire(2); });
+    CHECK(waiting.wait_for(std::chrono::milliseconds(50)) == std::future_status::timeout);
+    scheduler.Finish(0);
+    CHECK(TableOf(waiting.get()) == "Large");
+    CHECK(scheduler.PendingChunks() == 2);
+
+    scheduler.Finish(1);
+    scheduler.Finish(2);
+    auto const idleTimes = scheduler.IdleTimes();
+    REQUIRE(idleTimes.size() == 3);
+    CHECK(idleTimes[2].throttled >= std::chrono::milliseconds(50));
+}
+
+TEST_CASE("RestoreScheduler: Stop releases waiting workers", "[RestoreScheduler]")
+{
+    std::vector<RestoreChunkEntry> chunks { MakeChunk("T", 0, 1), MakeChunk("T", 1, 1) };
+    RestoreScheduler scheduler { std::move(chunks), {}, 2, 1 };
+
+    REQUIRE(scheduler.Acquire(0).has_value());
+    auto waiting = std::async(std::launch::async, [&] { return scheduler.Acquire(1); });
+    scheduler.Stop();
+    CHECK_FALSE(waiting.get().has_value());
+    CHECK_FALSE(scheduler.Acquire(0).has_value());
+    CHECK(scheduler.PendingChunks() == 1);
+}
+
+TEST_CASE("RestoreScheduler: tail idle time is measured to the last worker", "[RestoreScheduler]")
+{
+    RestoreScheduler scheduler { { MakeChunk("T", 0, 1) }, {}, 2, 0 };
+
+    REQUIRE(scheduler.Acquire(0).has_value());
+    CHECK_FALSE(scheduler.Acquire(1).has_value());
+    scheduler.Finish(1);
+    std::this_thread::sleep_for(std::chrono::milliseconds(20));
+    CHECK_FALSE(scheduler.Acquire(0).has_value());
+    scheduler.Finish(0);
+
+    auto const idleTimes = scheduler.IdleTimes();
+    REQUIRE(idleTimes.size() == 2);
+    CHECK(idleTimes[0].tail == std::chrono::milliseconds(0));
+    CHECK(idleTimes[1].tail >= std::chrono::milliseconds(20));
+    CHECK(idleTimes[1].throttled == std::chrono::milliseconds(0));
+}
@@ -6,6 +6,7 @@
 
 #include <array>
 #include <cstdint>
+#include <ranges>
 #include <span>
 #include <string>
 #include <string_view>
@@ -140,3 +141,31 @@ TEST_CASE("Sha256: ToHex output is lowercase and zero-padded", "[Sha256]")
     for (char const c: hex)
         CHECK((c >= '0' && c <= '9' || c >= 'a' && c <= 'f'));
 }
+
+TEST_CASE("Sha256: hardware block function matches the portable one", "[Sha256]")
+{
+    namespace detail = Lightweight::SqlBackup::detail;
+
+    auto const accelerated = detail::Sha256AcceleratedKernel();
+    if (accelerated == nullptr)
+    {
+        CHECK(detail::Sha256KernelName() == "portable");
+        SKIP("No SHA-256 instructions on this CPU");
+    }
+    CHECK(detail::Sha256KernelName() != "portable");
+
+    // Several blocks in one call exercise the kernel's multi-block loop, not just a single round trip.
+    std::vector<uint8_t> blocks(Sha256::BlockSize * 17);
+    for (auto const i: std::views::iota(0UZ, blocks.size()))
+        blocks[i] = static_cast<uint8_t>((i * 31) + 7);
+
+    for (size_t const count: { size_t { 1 }, size_t { 2 }, size_t { 17 } })
+    {
+        std::array<uint32_t, 8> portableState { 0x6a09e667, 0xbb67ae85, 0x3c6ef372, 0xa54ff53a,
+                                                0x510e527f, 0x9b05688c, 0x1f83d9ab, 0x5be0cd19 };
+        auto acceleratedState = portableState;
+        detail::Sha256CompressPortable(portableState.data(), blocks.data(), count);
+        accelerated(acceleratedState.data(), blocks.data(), count);
+        CHECK(acceleratedState == portableState);
+    }
+}
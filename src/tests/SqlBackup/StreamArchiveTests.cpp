@@ -0,0 +1,120 @@
+// SPDX-License-Identifier: Apache-2.0
+#include "../../Lightweight/SqlBackup/StreamArchive.hpp"
+
+#include <catch2/catch_test_macros.hpp>
+
+#include <cstdint>
+#include <format>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <vector>
+
+using namespace Lightweight::SqlBackup::detail;
+using namespace Lightweight::SqlBackup;
+
+namespace
+{
+std::vector<std::uint8_t> Bytes(std::string_view text)
+{
+    return { text.begin(), text.end() };
+}
+} // namespace
+
+TEST_CASE("Stream frames round-trip in order", "[SqlBackup][stream]")
+{
+    std::stringstream stream;
+    WriteStreamArchiveMagic(stream);
+    WriteStreamFrame(
+        stream,
+        { .type = StreamFrameType::Metadata, .name = "metadata.json", .checksum = {}, .payload = Bytes("{}") });
+    WriteStreamFrame(stream,
+                     { .type = StreamFrameType::Chunk,
+                       .name = "data/Orders/0001_00.msgpack",
+                       .checksum = "abc",
+                       .payload = Bytes("payload") });
+    WriteStreamFrame(stream, { .type = StreamFrameType::Index, .name = "checksums.json", .checksum = {}, .payload = {} });
+
+    REQUIRE(ReadStreamArchiveMagic(stream));
+    auto const metadata = ReadStreamFrame(stream);
+    REQUIRE(metadata.has_value());
+    CHECK(metadata->type == StreamFrameType::Metadata);
+    CHECK(metadata->payload == Bytes("{}"));
+
+    auto const chunk = ReadStreamFrame(stream);
+    REQUIRE(chunk.has_value());
+    CHECK(chunk->type == StreamFrameType::Chunk);
+    CHECK(chunk->name == "data/Orders/0001_00.msgpack");
+    CHECK(chunk->checksum == "abc");
+    CHECK(chunk->payload == Bytes("payload"));
+
+    auto const index = ReadStreamFrame(stream);
+    REQUIRE(index.has_value());
+    CHECK(index->type == StreamFrameType::Index);
+    CHECK(index->payload.empty());
+
+    CHECK_FALSE(ReadStreamFrame(stream).has_value());
+}
+
+TEST_CASE("Stream reader rejects foreign and truncated input", "[SqlBackup][stream]")
+{
+    SECTION("ZIP archive")
+    {
+        std::stringstream stream { "PK\x03\x04 not a stream archive" };
+        CHECK_FALSE(ReadStreamArchiveMagic(stream));
+    }
+
+    SECTION("Truncated payload")
+    {
+        std::stringstream full;
+        WriteStreamFrame(full,
+                         { .type = StreamFrameType::Chunk,
+                           .name = "data/T/0001_00.msgpack",
+                           .checksum = {},
+                           .payload = Bytes("0123456789") });
+        auto const bytes = full.str();
+        std::stringstream truncated { bytes.substr(0, bytes.size() - 3) };
+        CHECK_THROWS_AS(ReadStreamFrame(truncated), std::runtime_error);
+    }
+
+    SECTION("Unknown frame type")
+    {
+        std::stringstream stream { "X" };
+        CHECK_THROWS_AS(ReadStreamFrame(stream), std::runtime_error);
+    }
+}
+
+TEST_CASE("Stream chunk payloads decompress to the original bytes", "[SqlBackup][stream]")
+{
+    auto const data = std::string(10'000, 'x') + "tail";
+    auto const payload = CompressStreamEntry("data/T/0001_00.msgpack", data, CompressionMethod::Deflate, 6);
+    CHECK(payload.size() < data.size());
+
+    auto const content = DecompressStreamEntry(payload);
+    CHECK(std::string(content.begin(), content.end()) == data);
+
+    CHECK_THROWS_AS(DecompressStreamEntry(Bytes("garbage")), std::runtime_error);
+}
+
+TEST_CASE("StreamArchiveWriter writes queued frames behind the magic", "[SqlBackup][stream]")
+{
+    std::stringstream stream;
+    {
+        auto writer = StreamArchiveWriter { stream, 1 };
+        for (auto const i: { 0, 1, 2, 3 })
+            writer.Write({ .type = StreamFrameType::Chunk,
+                           .name = std::format("data/T/{:04}_00.msgpack", i + 1),
+                           .checksum = {},
+                           .payload = Bytes("x") });
+        writer.Finish();
+    }
+
+    REQUIRE(ReadStreamArchiveMagic(stream));
+    auto frames = std::vector<std::string> {};
+    while (auto frame = ReadStreamFrame(stream))
+        frames.push_back(frame->name);
+    CHECK(frames
+          == std::vector<std::string> {
+              "data/T/0001_00.msgpack", "data/T/0002_00.msgpack", "data/T/0003_00.msgpack", "data/T/0004_00.msgpack" });
+}
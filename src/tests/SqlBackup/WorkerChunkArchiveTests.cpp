@@ -123,6 +123,25 @@ TEST_CASE("WorkerChunkArchive seals compressed entries that round-trip", "[worke
     CHECK(std::filesystem::file_size(archive.SealedArchives().front()) < 5'000);
 }
 
+TEST_CASE("WorkerChunkArchive applies a per-entry compression method", "[workerarchive]")
+{
+    TempDir const dir;
+    auto archive = WorkerChunkArchive { dir.path, 0, 1024 * 1024, CompressionMethod::Deflate, 6 };
+
+    std::string const payload(10'000, 'x');
+    archive.Add("data/blobs/0001_00.msgpack", payload, CompressionMethod::Store, 0);
+    archive.Add("data/logs/0001_00.msgpack", payload, CompressionMethod::Deflate, 9);
+    archive.Add("data/other/0001_00.msgpack", payload);
+    archive.Seal();
+
+    auto const entries = ReadArchive(archive.SealedArchives().front());
+    REQUIRE(entries.size() == 3);
+    CHECK(entries.at("data/blobs/0001_00.msgpack").second == ZIP_CM_STORE);
+    CHECK(entries.at("data/logs/0001_00.msgpack").second == ZIP_CM_DEFLATE);
+    CHECK(entries.at("data/other/0001_00.msgpack").second == ZIP_CM_DEFLATE);
+    CHECK(entries.at("data/blobs/0001_00.msgpack").first == payload);
+}
+
 TEST_CASE("WorkerChunkArchive rotates after the input-byte threshold", "[workerarchive]")
 {
     TempDir const dir;
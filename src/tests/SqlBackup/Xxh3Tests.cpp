@@ -0,0 +1,81 @@
+// SPDX-License-Identifier: Apache-2.0
+
+#include <Lightweight/SqlBackup/Xxh3.hpp>
+
+#include <catch2/catch_test_macros.hpp>
+
+#include <cstdint>
+#include <ranges>
+#include <string>
+#include <string_view>
+#include <vector>
+
+using Lightweight::SqlBackup::Xxh3;
+
+// Reference digests were produced with the xxHash library's XXH3_128bits() (as printed by `xxh128sum`).
+namespace
+{
+struct Xxh3Vector
+{
+    size_t length;
+    std::string_view digest;
+};
+
+// Covers every length class of the algorithm: 0, 1-3, 4-8, 9-16, 17-128, 129-240 and the long-input path,
+// including both sides of each boundary and a partial last stripe/block.
+constexpr Xxh3Vector PatternVectors[] = {
+    { 0, "99aa06d3014798d86001c324468d497f" },    { 1, "495b62073ef70ca44c5cca45d0f4811f" },
+    { 3, "46f66cb93538156515f7093b173d005c" },    { 4, "7fefeeffb4d0eab3b987ca5d9241572a" },
+    { 8, "803c675a846cc6c256bb836ceb6d4baa" },    { 9, "d46556872d230f224376673580310154" },
+    { 16, "650fe308c566747df853dd94614dfa07" },   { 17, "18217300b5132d5a78c349fe81b2f26c" },
+    { 128, "b4f87b99d2db8a511e04fad9f0cacb4d" },  { 129, "6881633650cd8924c51bc887976aef63" },
+    { 240, "de57aab31e77a2ff93e173833f75ab66" },  { 241, "92b991a7192f3f080b3b630948ce4a00" },
+    { 1024, "4c17271c906df79223bc880ebf0d29c6" }, { 1025, "70a4eb1b9691d77fc09fdfbc398c7d82" },
+    { 5000, "3bf60aa89c7feeaa559fff92c2b7f8ee" },
+};
+
+std::vector<uint8_t> MakePattern(size_t length)
+{
+    std::vector<uint8_t> data(length);
+    for (auto const i: std::views::iota(0UZ, length))
+        data[i] = static_cast<uint8_t>((i * 31) + 7);
+    return data;
+}
+} // namespace
+
+TEST_CASE("Xxh3: empty input matches reference", "[Xxh3]")
+{
+    CHECK(Xxh3::Hash(std::string_view {}) == "99aa06d3014798d86001c324468d497f");
+}
+
+TEST_CASE("Xxh3: 'abc' matches reference", "[Xxh3]")
+{
+    CHECK(Xxh3::Hash(std::string_view { "abc" }) == "06b05ab6733a618578af5f94892f3950");
+}
+
+TEST_CASE("Xxh3: every input length class matches reference", "[Xxh3]")
+{
+    for (auto const& [length, digest]: PatternVectors)
+    {
+        INFO("length " << length);
+        auto const data = MakePattern(length);
+        CHECK(Xxh3::Hash(data.data(), data.size()) == digest);
+    }
+}
+
+TEST_CASE("Xxh3: digest is the canonical byte order of the hex string", "[Xxh3]")
+{
+    auto const data = MakePattern(1025);
+    auto const digest = Xxh3::Digest(data.data(), data.size());
+    REQUIRE(digest.size() == Xxh3::DigestSize);
+    CHECK(digest[0] == 0x70);
+    CHECK(digest[Xxh3::DigestSize - 1] == 0x82);
+}
+
+TEST_CASE("Xxh3: digests differ when a single bit flips", "[Xxh3]")
+{
+    auto data = MakePattern(4096);
+    auto const original = Xxh3::Hash(data.data(), data.size());
+    data[2048] ^= 0x01;
+    CHECK(Xxh3::Hash(data.data(), data.size()) != original);
+}
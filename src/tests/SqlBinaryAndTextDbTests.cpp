@@ -9,10 +9,16 @@
 
 #include <catch2/catch_test_macros.hpp>
 
+#include <algorithm>
 #include <array>
+#include <cstddef>
 #include <cstdint>
+#include <cstring>
 #include <ranges>
+#include <span>
+#include <sstream>
 #include <string>
+#include <vector>
 
 using namespace Lightweight;
 
@@ -146,3 +152,111 @@ TEST_CASE("SqlText: comparison operators", "[SqlText]")
     CHECK(a != c);
     CHECK(a < c);
 }
+
+// ================================================================================================
+// Chunked LOB streaming (SqlStatement::BindInputStream / SqlResultCursor::ReadColumnChunks)
+// ================================================================================================
+
+TEST_CASE_METHOD(SqlTestFixture, "SqlText: streamed in and read back in chunks", "[SqlText]")
+{
+    auto stmt = SqlStatement {};
+    stmt.MigrateDirect(
+        [](auto& migration) { migration.CreateTable("TxtStream").Column("body", SqlColumnTypeDefinitions::Text {}); });
+
+    auto const longContent = MakeLargeText<char>(20 * 1024);
+    auto const inputValue = std::string { longContent.begin(), longContent.end() };
+
+    stmt.Prepare(R"(INSERT INTO "TxtStream" ("body") VALUES (?))");
+    auto input = std::istringstream { inputValue };
+    stmt.BindInputStream(1, SqlLobType::Text, input, inputValue.size());
+    (void) stmt.Execute();
+
+    auto cursor = stmt.ExecuteDirect(R"(SELECT "body" FROM "TxtStream")");
+    REQUIRE(cursor.FetchRow());
+    auto output = std::ostringstream {};
+    CHECK(cursor.ReadColumnChunks(1, SqlLobType::Text, output, 1000));
+    CHECK(output.str().size() == inputValue.size());
+    CHECK(output.str() == inputValue);
+}
+
+TEST_CASE_METHOD(SqlTestFixture, "SqlText: streamed chunks may split UTF-8 sequences", "[SqlText]")
+{
+    auto stmt = SqlStatement {};
+    stmt.MigrateDirect(
+        [](auto& migration) { migration.CreateTable("TxtUtf8").Column("body", SqlColumnTypeDefinitions::Text {}); });
+
+    auto inputValue = std::string {};
+    for ([[maybe_unused]] auto const _: std::views::iota(0, 500))
+        inputValue += "a\xC3\xA4\xE2\x82\xAC\xF0\x9F\x98\x80"; // 1-, 2-, 3- and 4-byte sequences
+
+    // 5-byte chunks cut through every multi-byte sequence at some point.
+    stmt.Prepare(R"(INSERT INTO "TxtUtf8" ("body") VALUES (?))");
+    auto offset = size_t { 0 };
+    stmt.BindInputStream(
+        1,
+        SqlLobType::Text,
+        [&](std::span<std::byte> buffer) {
+            auto const count = std::min({ buffer.size(), inputValue.size() - offset, size_t { 5 } });
+            std::memcpy(buffer.data(), inputValue.data() + offset, count);
+            offset += count;
+            return count;
+        },
+        inputValue.size());
+    (void) stmt.Execute();
+
+    auto cursor = stmt.ExecuteDirect(R"(SELECT "body" FROM "TxtUtf8")");
+    REQUIRE(cursor.FetchRow());
+    auto output = std::ostringstream {};
+    CHECK(cursor.ReadColumnChunks(1, SqlLobType::Text, output, 1000));
+    CHECK(output.str() == inputValue);
+}
+
+TEST_CASE_METHOD(SqlTestFixture, "SqlDynamicBinary: streamed in and read back in chunks", "[SqlBinary]")
+{
+    auto stmt = SqlStatement {};
+    stmt.MigrateDirect([](auto& migration) {
+        migration.CreateTable("BinStream").Column("payload", SqlColumnTypeDefinitions::VarBinary { 4000 });
+    });
+
+    auto raw = std::vector<std::byte>(3000);
+    for (auto const i: std::views::iota(size_t { 0 }, raw.size()))
+        raw[i] = static_cast<std::byte>(i % 251);
+
+    stmt.Prepare(R"(INSERT INTO "BinStream" ("payload") VALUES (?))");
+    auto offset = size_t { 0 };
+    stmt.BindInputStream(1, SqlLobType::Binary, [&](std::span<std::byte> buffer) {
+        auto const count = std::min(buffer.size(), raw.size() - offset);
+        std::copy_n(raw.begin() + static_cast<std::ptrdiff_t>(offset), count, buffer.begin());
+        offset += count;
+        return count;
+    });
+    (void) stmt.Execute();
+    CHECK(offset == raw.size());
+
+    auto cursor = stmt.ExecuteDirect(R"(SELECT "payload" FROM "BinStream")");
+    REQUIRE(cursor.FetchRow());
+    auto buffer = std::array<std::byte, 256> {};
+    auto fetched = std::vector<std::byte> {};
+    auto chunkCount = size_t { 0 };
+    CHECK(cursor.ReadColumnChunks(1, SqlLobType::Binary, buffer, [&](std::span<std::byte const> chunk) {
+        CHECK(chunk.size() <= buffer.size());
+        fetched.insert(fetched.end(), chunk.begin(), chunk.end());
+        ++chunkCount;
+    }));
+    CHECK(chunkCount >= raw.size() / buffer.size());
+    CHECK(fetched == raw);
+}
+
+TEST_CASE_METHOD(SqlTestFixture, "SqlText: chunked read of NULL", "[SqlText]")
+{
+    auto stmt = SqlStatement {};
+    stmt.MigrateDirect(
+        [](auto& migration) { migration.CreateTable("TxtNull").Column("body", SqlColumnTypeDefinitions::Text {}); });
+    (void) stmt.ExecuteDirect(R"(INSERT INTO "TxtNull" ("body") VALUES (NULL))");
+
+    auto cursor = stmt.ExecuteDirect(R"(SELECT "body" FROM "TxtNull")");
+    REQUIRE(cursor.FetchRow());
+    auto output = std::ostringstream {};
+    CHECK_FALSE(cursor.ReadColumnChunks(1, SqlLobType::Text, output));
+    CHECK(output.str().empty());
+}
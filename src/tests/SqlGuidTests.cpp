@@ -4,10 +4,18 @@
 
 #include <catch2/catch_test_macros.hpp>
 
+#include <algorithm>
+#include <array>
+#include <chrono>
+#include <cstring>
 #include <format>
 #include <optional>
+#include <ranges>
 #include <stdexcept>
 #include <string_view>
+#include <thread>
+#include <utility>
+#include <vector>
 
 using namespace Lightweight;
 
@@ -23,9 +31,9 @@ TEST_CASE("SqlGuid::TryParse accepts a canonical version-4 UUID", "[SqlGuid]")
         CHECK(static_cast<bool>(*guid));
 }
 
-TEST_CASE("SqlGuid::TryParse accepts each documented version (1..5)", "[SqlGuid]")
+TEST_CASE("SqlGuid::TryParse accepts each documented version (1..8)", "[SqlGuid]")
 {
-    for (char v: { '1', '2', '3', '4', '5' })
+    for (char v: { '1', '2', '3', '4', '5', '6', '7', '8' })
     {
         auto const text = std::format("550E8400-E29B-{}1D4-A716-446655440000", v);
         INFO("input: " << text);
@@ -51,7 +59,7 @@ TEST_CASE("SqlGuid::TryParse rejects malformed dashes", "[SqlGuid]")
 TEST_CASE("SqlGuid::TryParse rejects invalid version digits", "[SqlGuid]")
 {
     CHECK_FALSE(SqlGuid::TryParse("550E8400-E29B-01D4-A716-446655440000").has_value()); // version 0
-    CHECK_FALSE(SqlGuid::TryParse("550E8400-E29B-61D4-A716-446655440000").has_value()); // version 6
+    CHECK_FALSE(SqlGuid::TryParse("550E8400-E29B-91D4-A716-446655440000").has_value()); // version 9
     CHECK_FALSE(SqlGuid::TryParse("550E8400-E29B-X1D4-A716-446655440000").has_value()); // non-digit
 }
 
@@ -153,3 +161,112 @@ TEST_CASE("SqlGuid::Create yields non-empty, non-equal values across calls", "[S
     CHECK(static_cast<bool>(b));
     CHECK(a != b);
 }
+
+// ================================================================================================
+// SqlGuid::CreateSequential — time-ordered GUIDs in the requested sort order
+// ================================================================================================
+
+namespace
+{
+// SQL Server compares uniqueidentifier bytes 10..15 first, then 8..9, 6..7, 4..5 and 0..3.
+std::array<uint8_t, 16> SqlServerSortKey(SqlGuid const& guid)
+{
+    auto key = std::array<uint8_t, 16> {};
+    auto out = key.begin();
+    for (auto const index: { 10, 11, 12, 13, 14, 15, 8, 9, 6, 7, 4, 5, 0, 1, 2, 3 })
+        *out++ = guid.data[index];
+    return key;
+}
+} // namespace
+
+TEST_CASE("SqlGuid::CreateSequential(UuidV7) yields increasing RFC 9562 version-7 GUIDs", "[SqlGuid]")
+{
+    auto guids = std::vector<SqlGuid> {};
+    for ([[maybe_unused]] auto const _: std::views::iota(0, 10'000))
+        guids.push_back(SqlGuid::CreateSequential(SqlGuidSequence::UuidV7));
+
+    CHECK(std::ranges::is_sorted(guids, std::ranges::less {}));
+    CHECK(std::ranges::adjacent_find(guids) == guids.end());
+    CHECK((guids.front().data[6] >> 4) == 7);
+    CHECK((guids.front().data[8] & 0b1100'0000) == 0b1000'0000);
+
+    // The leading 48 bits are the Unix time in milliseconds.
+    auto millis = uint64_t {};
+    for (auto const i: std::views::iota(0, 6))
+        millis = (millis << 8) | guids.front().data[i];
+    auto const now = std::chrono::duration_cast<std::chrono::milliseconds>(
+                         std::chrono::system_clock::now().time_since_epoch())
+                         .count();
+    CHECK(std::cmp_less_equal(now - 60'000, millis));
+    CHECK(std::cmp_less_equal(millis, now + 60'000));
+
+    auto const reparsed = SqlGuid::TryParse(std::format("{}", guids.back()));
+    REQUIRE(reparsed.has_value());
+    if (reparsed.has_value())
+        CHECK(*reparsed == guids.back());
+}
+
+TEST_CASE("SqlGuid::CreateSequential(SqlServer) yields GUIDs increasing in SQL Server sort order", "[SqlGuid]")
+{
+    auto keys = std::vector<std::array<uint8_t, 16>> {};
+    for ([[maybe_unused]] auto const _: std::views::iota(0, 10'000))
+        keys.push_back(SqlServerSortKey(SqlGuid::CreateSequential(SqlGuidSequence::SqlServer)));
+
+    CHECK(std::ranges::is_sorted(keys, std::ranges::less {}));
+    CHECK(std::ranges::adjacent_find(keys) == keys.end());
+}
+
+TEST_CASE("SqlGuid::CreateSequential yields distinct GUIDs across threads", "[SqlGuid]")
+{
+    constexpr auto ThreadCount = 4;
+    constexpr auto PerThread = 5'000;
+    auto perThread = std::vector<std::vector<SqlGuid>>(ThreadCount);
+    {
+        auto threads = std::vector<std::jthread> {};
+        for (auto& guids: perThread)
+            threads.emplace_back([&guids] {
+                for ([[maybe_unused]] auto const _: std::views::iota(0, PerThread))
+                    guids.push_back(SqlGuid::CreateSequential());
+            });
+    }
+
+    auto all = std::vector<SqlGuid> {};
+    for (auto const& guids: perThread)
+    {
+        CHECK(std::ranges::is_sorted(guids, std::ranges::less {}));
+        all.insert(all.end(), guids.begin(), guids.end());
+    }
+    std::ranges::sort(all, std::ranges::less {});
+    CHECK(std::ranges::adjacent_find(all) == all.end());
+}
+
+TEST_CASE("SqlGuid::SequenceFor picks the SQL Server layout only for SQL Server", "[SqlGuid]")
+{
+    CHECK(SqlGuid::SequenceFor(SqlServerType::MICROSOFT_SQL) == SqlGuidSequence::SqlServer);
+    CHECK(SqlGuid::SequenceFor(SqlServerType::SQLITE) == SqlGuidSequence::UuidV7);
+    CHECK(SqlGuid::SequenceFor(SqlServerType::POSTGRESQL) == SqlGuidSequence::UuidV7);
+}
+
+TEST_CASE("SqlGuid::CreateSequentialFor writes natively bound GUIDs as SQLGUID fields", "[SqlGuid]")
+{
+    // SQLite binds GUIDs as text, so the bytes stay in RFC 9562 order.
+    CHECK((SqlGuid::CreateSequentialFor(SqlServerType::SQLITE).data[6] >> 4) == 7);
+
+    // psqlODBC reads Data1, Data2 and Data3 as native-endian integers: the timestamp and the version
+    // must be in those fields, not in the raw bytes.
+    auto const guid = SqlGuid::CreateSequentialFor(SqlServerType::POSTGRESQL);
+    auto data1 = uint32_t {};
+    auto data2 = uint16_t {};
+    auto data3 = uint16_t {};
+    std::memcpy(&data1, guid.data, sizeof(data1));
+    std::memcpy(&data2, guid.data + 4, sizeof(data2));
+    std::memcpy(&data3, guid.data + 6, sizeof(data3));
+    CHECK((data3 >> 12) == 7);
+
+    auto const millis = (uint64_t { data1 } << 16) | data2;
+    auto const now = std::chrono::duration_cast<std::chrono::milliseconds>(
+                         std::chrono::system_clock::now().time_since_epoch())
+                         .count();
+    CHECK(std::cmp_less_equal(now - 60'000, millis));
+    CHECK(std::cmp_less_equal(millis, now + 60'000));
+}
@@ -545,3 +545,56 @@ TEST_CASE_METHOD(SqlTestFixture, "RowArrayCursor throws on a value truncated to
     REQUIRE(fetched == 1);
     CHECK_THROWS_AS((void) cursor.GetString(0, 2), std::runtime_error);
 }
+
+TEST_CASE_METHOD(SqlTestFixture, "RowArrayCursor exposes whole column blocks", "[batchfetch]")
+{
+    auto stmt = SqlStatement {};
+    CreateBatchFetchTable(stmt);
+    FillBatchFetchTable(stmt);
+
+    auto ids = SqlColumnSummary<std::int64_t> {};
+    auto ratios = SqlColumnSummary<double> {};
+    auto names = std::vector<std::optional<std::string>> {};
+    {
+        auto cursor = stmt.ExecuteBatchFetch(kSelectQuery, 4);
+        while (auto const fetched = cursor.FetchArray())
+        {
+            REQUIRE(cursor.I64Column(1).size() == fetched);
+            ids.Add(cursor.I64Column(1), cursor.ColumnIndicators(1));
+            ratios.Add(cursor.F64Column(2), cursor.ColumnIndicators(2));
+
+            // Narrow or wide, depending on how the driver reports the column.
+            auto const collect = [&](auto const& view) {
+                for (auto const r: std::views::iota(std::size_t { 0 }, view.size()))
+                {
+                    if (view.IsNull(r))
+                        names.emplace_back(std::nullopt);
+                    else
+                        names.emplace_back(std::string(view[r].begin(), view[r].end()));
+                }
+            };
+            if (cursor.ColumnBoundType(3) == RowArrayCursor::BoundType::WChar)
+                collect(cursor.WideTextColumn(3));
+            else
+                collect(cursor.NarrowTextColumn(3));
+
+            CHECK_THROWS_AS(cursor.F64Column(1), std::logic_error);
+        }
+    }
+
+    CHECK(ids.count == 10);
+    CHECK(ids.sum == 5500);
+    CHECK(ids.min == 100);
+    CHECK(ids.max == 1000);
+
+    // Row 4 has a NULL Ratio: 1.5 * (1 + ... + 10 - 4).
+    CHECK(ratios.count == 9);
+    CHECK(ratios.sum == 1.5 * 51);
+    CHECK(ratios.min == 1.5);
+    CHECK(ratios.max == 15.0);
+
+    REQUIRE(names.size() == 10);
+    CHECK(names[0] == std::optional<std::string> { "name-1" });
+    CHECK_FALSE(names[6].has_value());
+    CHECK(names[9] == std::optional<std::string> { "name-10" });
+}
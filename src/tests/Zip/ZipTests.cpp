@@ -2,6 +2,7 @@
 
 // NOLINTBEGIN(bugprone-unused-return-value)
 
+#include <Lightweight/Zip/MappedZipArchive.hpp>
 #include <Lightweight/Zip/ZipArchive.hpp>
 #include <Lightweight/Zip/ZipEntry.hpp>
 #include <Lightweight/Zip/ZipError.hpp>
@@ -13,6 +14,9 @@
 #include <cstdlib>
 #include <filesystem>
 #include <format>
+#include <fstream>
+#include <string>
+#include <vector>
 
 using namespace Lightweight::Zip;
 
@@ -724,4 +728,114 @@ TEST_CASE("ZipArchive functional chaining handles errors", "[Zip]")
     CHECK(!result.has_value());
 }
 
+// =============================================================================
+// MappedZipArchive tests
+// =============================================================================
+
+TEST_CASE("MappedZipArchive.Open lists the entries in libzip order", "[Zip]")
+{
+    TempFile temp;
+    {
+        auto result = ZipArchive::CreateOrTruncate(temp.Path());
+        REQUIRE(result.has_value());
+        (void) result->AddString("stored.txt", "Stored content", CompressionMethod::Store, 0);
+        (void) result->AddString("deflated.txt", std::string(1000, 'x'), CompressionMethod::Deflate, 6);
+        (void) result->Close();
+    }
+
+    auto mapped = MappedZipArchive::Open(temp.Path());
+    REQUIRE(mapped.has_value());
+    auto const& entries = mapped->Entries();
+    REQUIRE(entries.size() == 2);
+
+    auto archive = ZipArchive::Open(temp.Path());
+    REQUIRE(archive.has_value());
+    for (auto const& entry: entries)
+    {
+        auto const info = archive->GetEntryInfo(entry.index);
+        REQUIRE(info.has_value());
+        CHECK(entry.name == info->name);
+        CHECK(entry.size == info->size);
+        CHECK(entry.compressedSize == info->compressedSize);
+    }
+    CHECK(entries[0].method == ZIP_CM_STORE);
+    CHECK(entries[1].method == ZIP_CM_DEFLATE);
+    CHECK(mapped->LocateEntry("deflated.txt") == entries[1].index);
+    CHECK_FALSE(mapped->LocateEntry("missing.txt").has_value());
+}
+
+TEST_CASE("MappedZipReader reads stored entries in place and decompresses the others", "[Zip]")
+{
+    TempFile temp;
+    std::string const stored = "Stored content";
+    std::string const deflated(1000, 'x');
+    {
+        auto result = ZipArchive::CreateOrTruncate(temp.Path());
+        REQUIRE(result.has_value());
+        (void) result->AddString("stored.txt", stored, CompressionMethod::Store, 0);
+        (void) result->AddString("deflated.txt", deflated, CompressionMethod::Deflate, 6);
+        (void) result->Close();
+    }
+
+    auto mapped = MappedZipArchive::Open(temp.Path());
+    REQUIRE(mapped.has_value());
+    MappedZipReader reader { *mapped };
+
+    auto const storedBytes = reader.Read(*mapped->LocateEntry("stored.txt"));
+    REQUIRE(storedBytes.has_value());
+    CHECK(std::string(storedBytes->begin(), storedBytes->end()) == stored);
+    // A view into the mapping, not a copy.
+    auto const file = mapped->Bytes();
+    CHECK(storedBytes->data() >= file.data());
+    CHECK(storedBytes->data() + storedBytes->size() <= file.data() + file.size());
+
+    auto const deflatedBytes = reader.Read(*mapped->LocateEntry("deflated.txt"));
+    REQUIRE(deflatedBytes.has_value());
+    CHECK(std::string(deflatedBytes->begin(), deflatedBytes->end()) == deflated);
+
+    CHECK(reader.Read(2).error().code == ZipErrorCode::EntryNotFound);
+}
+
+TEST_CASE("MappedZipReader rejects a stored entry whose CRC-32 does not match", "[Zip]")
+{
+    TempFile temp;
+    {
+        auto result = ZipArchive::CreateOrTruncate(temp.Path());
+        REQUIRE(result.has_value());
+        (void) result->AddString("stored.txt", "Stored content", CompressionMethod::Store, 0);
+        (void) result->Close();
+    }
+
+    std::streamoff contentOffset = 0;
+    {
+        auto mapped = MappedZipArchive::Open(temp.Path());
+        REQUIRE(mapped.has_value());
+        auto const content = mapped->RawEntryData(0);
+        REQUIRE(content.has_value());
+        contentOffset = content->data() - mapped->Bytes().data();
+    }
+    {
+        std::fstream file(temp.Path(), std::ios::binary | std::ios::in | std::ios::out);
+        file.seekp(contentOffset);
+        file.put('s');
+    }
+
+    auto mapped = MappedZipArchive::Open(temp.Path());
+    REQUIRE(mapped.has_value());
+    MappedZipReader reader { *mapped };
+    CHECK(reader.Read(0).error().code == ZipErrorCode::ReadFailed);
+}
+
+TEST_CASE("MappedZipArchive.Open rejects files that are no ZIP archive", "[Zip]")
+{
+    CHECK(MappedZipArchive::Open("/nonexistent/file.zip").error().code == ZipErrorCode::OpenFailed);
+
+    TempFile temp;
+    {
+        std::ofstream out(temp.Path(), std::ios::binary);
+        out << "This is not a ZIP archive, just some text that is long enough to be searched.";
+    }
+    CHECK(MappedZipArchive::Open(temp.Path()).error().code == ZipErrorCode::OpenFailed);
+}
+
 // NOLINTEND(bugprone-unused-return-value)
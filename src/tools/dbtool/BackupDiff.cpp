@@ -5,6 +5,7 @@
 #include <Lightweight/SqlBackup/MsgPackChunkFormats.hpp>
 #include <Lightweight/SqlBackup/Sha256.hpp>
 #include <Lightweight/SqlBackup/SqlBackupFormats.hpp>
+#include <Lightweight/Zip/MappedZipArchive.hpp>
 
 #include <array>
 #include <cstdint>
@@ -40,8 +41,18 @@ using Lightweight::SqlBackup::Sha256;
 namespace
 {
 
-    /// RAII wrapper around a `zip_t*` opened read-only, so the comparison stays exception-safe
+    /// A single data chunk entry inside a backup archive.
+    struct ChunkEntry
+    {
+        zip_uint64_t index = 0;
+        zip_uint64_t size = 0;
+    };
+
+    /// RAII wrapper around a backup archive opened read-only, so the comparison stays exception-safe
     /// and we never leak a libzip handle on an early return.
+    ///
+    /// The archive is also mapped into memory where possible: chunks are then read from the mapping,
+    /// stored ones without any copy. libzip enumerates the entries and is the fallback for reading.
     class ZipReader
     {
       public:
@@ -49,6 +60,15 @@ namespace
         {
             int err = 0;
             _zip = zip_open(path.string().c_str(), ZIP_RDONLY, &err);
+            if (!_zip)
+                return;
+
+            auto mapped = Zip::MappedZipArchive::Open(path);
+            if (mapped && HasSameEntries(*mapped))
+            {
+                _mapped.emplace(std::move(*mapped));
+                _mappedReader.emplace(*_mapped);
+            }
         }
 
         ZipReader(ZipReader const&) = delete;
@@ -72,15 +92,51 @@ namespace
             return _zip;
         }
 
+        /// Reads a chunk entry. The bytes stay valid until the next call; empty optional on any read failure.
+        [[nodiscard]] std::optional<std::span<uint8_t const>> ReadEntryBytes(ChunkEntry const& entry)
+        {
+            if (_mappedReader)
+            {
+                auto const bytes = _mappedReader->Read(static_cast<zip_int64_t>(entry.index));
+                if (!bytes)
+                    return std::nullopt;
+                return *bytes;
+            }
+
+            zip_file_t* file = zip_fopen_index(_zip, entry.index, 0);
+            if (!file)
+                return std::nullopt;
+
+            _buffer.resize(entry.size);
+            zip_int64_t const bytesRead = zip_fread(file, _buffer.data(), entry.size);
+            zip_fclose(file);
+
+            if (bytesRead < 0 || std::cmp_not_equal(bytesRead, entry.size))
+                return std::nullopt;
+
+            return std::span<uint8_t const> { _buffer };
+        }
+
       private:
-        zip_t* _zip = nullptr;
-    };
+        /// True if the mapped central directory lists the same entries, in the same order, as libzip.
+        [[nodiscard]] bool HasSameEntries(Zip::MappedZipArchive const& mapped) const
+        {
+            auto const& entries = mapped.Entries();
+            if (std::cmp_not_equal(entries.size(), zip_get_num_entries(_zip, 0)))
+                return false;
+            for (auto const& entry: entries)
+            {
+                zip_stat_t stat;
+                if (zip_stat_index(_zip, static_cast<zip_uint64_t>(entry.index), 0, &stat) < 0 || entry.name != stat.name)
+                    return false;
+            }
+            return true;
+        }
 
-    /// A single data chunk entry inside a backup archive.
-    struct ChunkEntry
-    {
-        zip_uint64_t index = 0;
-        zip_uint64_t size = 0;
+        zip_t* _zip = nullptr;
+        std::optional<Zip::MappedZipArchive> _mapped;
+        std::optional<Zip::MappedZipReader> _mappedReader;
+        std::vector<uint8_t> _buffer; ///< Reused by libzip reads.
     };
 
     /// Enumerates the data chunks per table from a backup archive.
@@ -120,23 +176,6 @@ namespace
         return result;
     }
 
-    /// Reads a zip entry fully into a byte buffer. Returns an empty optional on any read failure.
-    std::optional<std::vector<uint8_t>> ReadEntryBytes(zip_t* zip, ChunkEntry const& entry)
-    {
-        zip_file_t* file = zip_fopen_index(zip, entry.index, 0);
-        if (!file)
-            return std::nullopt;
-
-        std::vector<uint8_t> data(entry.size);
-        zip_int64_t const bytesRead = zip_fread(file, data.data(), entry.size);
-        zip_fclose(file);
-
-        if (bytesRead < 0 || std::cmp_not_equal(bytesRead, entry.size))
-            return std::nullopt;
-
-        return data;
-    }
-
     /// Appends a length-prefixed, type-tagged encoding of one cell to `out`.
     ///
     /// Canonical encoding rationale: each cell is written as a single type tag byte followed by a
@@ -237,14 +276,14 @@ namespace
     /// Reads every chunk of one table from one archive and folds the rows into a multiset of
     /// per-row SHA-256 digests. Chunks are processed and released one at a time so we never hold
     /// the whole table (let alone the whole archive) in memory.
-    TableRowset BuildTableRowset(zip_t* zip, std::vector<ChunkEntry> const& chunks)
+    TableRowset BuildTableRowset(ZipReader& archive, std::vector<ChunkEntry> const& chunks)
     {
         TableRowset out;
         std::string rowEncoding;
 
         for (auto const& chunk: chunks)
         {
-            auto bytes = ReadEntryBytes(zip, chunk);
+            auto const bytes = archive.ReadEntryBytes(chunk);
             if (!bytes)
             {
                 out.ok = false;
@@ -322,8 +361,8 @@ namespace
     /// Compares one common table's row multiset across both archives and builds the resulting diff
     /// event (Identical / Differing / ReadError). Events are populated by assignment rather than
     /// designated initializers so omitting the kind-specific fields stays valid (and warning-free).
-    BackupDiffEvent CompareCommonTable(zip_t* leftZip,
-                                       zip_t* rightZip,
+    BackupDiffEvent CompareCommonTable(ZipReader& leftZip,
+                                       ZipReader& rightZip,
                                        std::vector<ChunkEntry> const& leftChunks,
                                        std::vector<ChunkEntry> const& rightChunks,
                                        std::string const& name,
@@ -432,7 +471,7 @@ BackupDiffResult BackupDiff(std::filesystem::path const& left,
         ++result.comparedTables;
         bool const ignored = ignoreTables.contains(name);
         auto const event = CompareCommonTable(
-            leftZip.Handle(), rightZip.Handle(), leftChunks.at(name), rightChunks.at(name), name, ignored, MaxExamples);
+            leftZip, rightZip, leftChunks.at(name), rightChunks.at(name), name, ignored, MaxExamples);
         emit(event);
 
         switch (event.kind)
@@ -2,9 +2,11 @@
 
 #include "StandardProgressManager.hpp"
 
+#include <algorithm>
 #include <cmath>
 #include <format>
 #include <iostream>
+#include <ranges>
 
 #ifdef _WIN32
     #include <io.h> // for _isatty, _fileno
@@ -283,6 +285,29 @@ void StandardProgressManager::AllDone()
         _out << std::format("Total time: {:02}:{:02}:{:02}.{:03}\n", h, m, s, ms);
     }
 
+    // Only worth a line when some worker sat idle for a noticeable part of the run.
+    if (std::ranges::any_of(_workerIdleTimes,
+                            [](auto const& idle) { return idle.tail + idle.throttled >= std::chrono::seconds(1); }))
+    {
+        std::string line = "Worker idle time:";
+        for (auto const i: std::views::iota(0UZ, _workerIdleTimes.size()))
+        {
+            auto const& idle = _workerIdleTimes[i];
+            line += std::format(" #{} {:.1f}s", i + 1, std::chrono::duration<double>(idle.tail + idle.throttled).count());
+            if (idle.throttled.count() > 0)
+                line += std::format(" ({:.1f}s at writer limit)", std::chrono::duration<double>(idle.throttled).count());
+        }
+        _out << line << "\n";
+    }
+
+    // Per-connection insert rate of each load method, e.g. bulk copy vs. the parameter-array fallback.
+    for (auto const& entry: _loadStatistics)
+    {
+        auto const seconds = std::chrono::duration<double>(entry.insertTime).count();
+        auto const rate = seconds > 0 ? static_cast<double>(entry.rows) / seconds : 0.0;
+        _out << std::format("Insert via {}: {} rows | {:.0f} rows/s per connection\n", entry.method, entry.rows, rate);
+    }
+
     if (_issuesByTable.empty())
         return;
 
@@ -642,4 +667,16 @@ void StandardProgressManager::PrintSummaryLine()
     _out << "\r";                      // Return carriage
 }
 
+void StandardProgressManager::OnRestoreWorkersIdle(std::vector<SqlBackup::RestoreWorkerIdleTime> const& idleTimes)
+{
+    std::scoped_lock lock(_mutex);
+    _workerIdleTimes = idleTimes;
+}
+
+void StandardProgressManager::OnRestoreLoadStatistics(std::vector<SqlBackup::RestoreLoadStatistics> const& statistics)
+{
+    std::scoped_lock lock(_mutex);
+    _loadStatistics = statistics;
+}
+
 } // namespace Lightweight::Tools
@@ -41,6 +41,8 @@ class StandardProgressManager: public Lightweight::SqlBackup::ErrorTrackingProgr
     void SetTotalItems(size_t totalItems) override;
     void AddTotalItems(size_t additionalItems) override;
     void OnItemsProcessed(size_t count) override;
+    void OnRestoreWorkersIdle(std::vector<SqlBackup::RestoreWorkerIdleTime> const& idleTimes) override;
+    void OnRestoreLoadStatistics(std::vector<SqlBackup::RestoreLoadStatistics> const& statistics) override;
 
   private:
     void PrintSummaryLine();
@@ -78,6 +80,12 @@ class StandardProgressManager: public Lightweight::SqlBackup::ErrorTrackingProgr
     bool _hasSummaryLine = false;
     bool _summaryLineAllocated = false; // True once we've printed "\n" for the summary line
     bool _isFinished = false;           // True when AllDone() is called, allows showing 100%
+
+    // Per-worker idle time of a ZIP restore, printed by AllDone()
+    std::vector<SqlBackup::RestoreWorkerIdleTime> _workerIdleTimes;
+
+    // Rows and insert time per load method of a restore, printed by AllDone()
+    std::vector<SqlBackup::RestoreLoadStatistics> _loadStatistics;
 };
 
 } // namespace Lightweight::Tools
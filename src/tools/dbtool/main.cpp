@@ -49,6 +49,7 @@
 #endif
 
 #ifdef _WIN32
+    #include <fcntl.h>
     #include <io.h>
     #ifndef NOMINMAX
         #define NOMINMAX
@@ -179,6 +180,8 @@ void PrintUsage()
     std::println("                            Pass `-` (or omit the argument) to read the query from stdin.");
     std::println("  {}backup{} --output FILE     Backs up the database to a file", c.command, c.reset);
     std::println("  {}restore{} --input FILE     Restores the database from a file", c.command, c.reset);
+    std::println("  {}copy{} --from A --to B      Copies all tables from profile A's database into profile B's",
+                 c.command, c.reset);
     std::println("  {}backup-diff{} --left A --right B  Compares the row data of two backup archives",
                  c.command, c.reset);
     std::println("                            (order-independent; no DB connection needed)");
@@ -205,9 +208,13 @@ void PrintUsage()
                  c.option, c.reset, c.param, c.reset);
     std::println("  {}--profile{} {}<NAME>{}          Named profile from the config file (default: the file's defaultProfile)",
                  c.option, c.reset, c.param, c.reset);
-    std::println("  {}--output{} {}<FILE>{}           Output file for backup",
+    std::println("  {}--output{} {}<FILE>{}           Output file for backup (- streams to stdout)",
+                 c.option, c.reset, c.param, c.reset);
+    std::println("  {}--input{} {}<FILE>{}            Input file for restore (- reads a stream from stdin)",
                  c.option, c.reset, c.param, c.reset);
-    std::println("  {}--input{} {}<FILE>{}            Input file for restore",
+    std::println("  {}--from{} {}<PROFILE>{}          Source profile for copy",
+                 c.option, c.reset, c.param, c.reset);
+    std::println("  {}--to{} {}<PROFILE>{}            Target profile for copy (tables are recreated there)",
                  c.option, c.reset, c.param, c.reset);
     std::println("  {}--left{} {}<FILE>{}             First backup archive for backup-diff (baseline)",
                  c.option, c.reset, c.param, c.reset);
@@ -229,14 +236,32 @@ void PrintUsage()
     std::println("                            Methods: none, deflate, bzip2, lzma, zstd, xz");
     std::println("  {}--compression-level{} {}<N>{}   Compression level 0-9 (default: 6)",
                  c.option, c.reset, c.param, c.reset);
+    std::println("  {}--adaptive-compression{}    Store, or compress at a fast or strong level, per table from a trial",
+                 c.option, c.reset);
+    std::println("  {}--compression-tradeoff{} {}<X>{}", c.option, c.reset, c.param, c.reset);
+    std::println("                            Adaptive compression CPU/size tradeoff, 0 (least CPU) to 1 (smallest)");
+    std::println("                            (default: 0.5)");
+    std::println("  {}--checksum{} {}<ALGORITHM>{}    Chunk checksum algorithm for backup (default: sha256)",
+                 c.option, c.reset, c.param, c.reset);
+    std::println("                            Algorithms: sha256, xxh3 (faster, corruption detection only)");
     std::println("  {}--chunk-size{} {}<SIZE>{}       Chunk size for backup data (default: 10M)",
                  c.option, c.reset, c.param, c.reset);
     std::println("                            Accepts: bytes, K/KB, M/MB, G/GB suffixes");
+    std::println("  {}--compact-encodings{}       Delta/RLE/dictionary-encode backup columns (format 1.1)",
+                 c.option, c.reset);
+    std::println("  {}--window-fingerprints{}     Record per-window fingerprints for later incremental backups",
+                 c.option, c.reset);
+    std::println("  {}--incremental-from{} {}<ZIP>{}  Reuse unchanged primary-key windows of a base backup",
+                 c.option, c.reset, c.param, c.reset);
     std::println("  {}--memory-limit{} {}<SIZE>{}     Memory limit for restore (default: auto-detect)",
                  c.option, c.reset, c.param, c.reset);
     std::println("                            Accepts: bytes, K/KB, M/MB, G/GB suffixes");
     std::println("  {}--batch-size{} {}<N>{}          Batch size for restore (default: auto-calculated)",
                  c.option, c.reset, c.param, c.reset);
+    std::println("  {}--max-writers-per-table{} {}<N>{}", c.option, c.reset, c.param, c.reset);
+    std::println("                            Restore workers inserting into one table at once (default: no limit)");
+    std::println("  {}--no-bulk-load{}            Restore with parameter-array inserts instead of the server's bulk path",
+                 c.option, c.reset);
     std::println("  {}--progress{} {}<TYPE>{}         Progress output type: unicode (default), ascii, logline",
                  c.option, c.reset, c.param, c.reset);
     std::println("  {}--dry-run{}, {}-n{}             Show what would be done without doing it",
@@ -320,6 +345,14 @@ void PrintExamples()
     std::println("  {}dbtool restore --input backup.zip --schema-only{}", c.code, c.reset);
     std::println("");
 
+    std::println("  {}# Stream a backup through a pipe, without temporary files:{}", c.example, c.reset);
+    std::println("  {}dbtool backup --output - | ssh host 'dbtool restore --input -'{}", c.code, c.reset);
+    std::println("");
+
+    std::println("  {}# Copy a database between two profiles without an intermediate archive:{}", c.example, c.reset);
+    std::println("  {}dbtool copy --from production --to staging --jobs 4{}", c.code, c.reset);
+    std::println("");
+
     std::println("  {}# Compare the data of two backup archives (detect silent corruption):{}", c.example, c.reset);
     std::println("  {}dbtool backup-diff --left backup_st.zip --right backup_mt.zip{}", c.code, c.reset);
     std::println("");
@@ -355,6 +388,8 @@ struct Options
     std::filesystem::path leftFile;     ///< First archive for `backup-diff` (--left)
     std::filesystem::path rightFile;    ///< Second archive for `backup-diff` (--right)
     std::set<std::string> ignoreTables; ///< `backup-diff` tables to report-but-not-fail (--ignore-table)
+    std::string fromProfile;            ///< Source profile for `copy` (--from)
+    std::string toProfile;              ///< Target profile for `copy` (--to)
     ProgressType progressType = ProgressType::Unicode;
     unsigned jobs = 1;
     unsigned maxRetries = 3; ///< Maximum retry attempts for transient errors
@@ -362,14 +397,22 @@ struct Options
     std::string filterTables = "*";            ///< Table filter for backup/restore (default: all tables)
     std::string compressionMethod = "deflate"; ///< Compression method for backup
     unsigned compressionLevel = 6;             ///< Compression level (0-9)
+    bool adaptiveCompression = false;          ///< Choose Store or a fast/strong level per table
+    std::string compressionTradeoff = "0.5";   ///< Adaptive compression CPU/size tradeoff (0-1)
+    std::string checksumAlgorithm = "sha256";  ///< Chunk checksum algorithm for backup
     std::string chunkSize = "10M";             ///< Chunk size for backup (supports K/M/G suffixes)
+    bool compactEncodings = false;             ///< Compact column encodings for backup (format 1.1)
+    bool windowFingerprints = false;           ///< Record window fingerprints in the backup metadata
+    std::string incrementalFrom;               ///< Base archive of an incremental backup
     std::string memoryLimit;                   ///< Memory limit for restore (supports K/M/G suffixes)
     std::string batchSize;                     ///< Batch size for restore (rows per batch)
+    std::string maxWritersPerTable;            ///< Concurrent restore workers per table (0 = no limit)
     bool pluginsDirSet = false;
     bool connectionStringSet = false;
     bool dryRun = false;     ///< If true, show what would be done without actually doing it
     bool noLock = false;     ///< If true, skip migration locking for write operations
     bool schemaOnly = false; ///< If true, backup/restore schema only (no data)
+    bool noBulkLoad = false; ///< If true, restore without the server's native bulk load path
     bool yes = false;        ///< If true, confirm destructive actions (e.g. rewrite-checksums)
     bool verbose = false;    ///< If true, emit extra informational output (e.g. shadowed plugins)
 
@@ -530,6 +573,42 @@ void ApplyProfileToOptions(Options& options)
     }
 }
 
+/// Connection settings of a profile looked up by name, for commands that talk to two
+/// databases at once (`copy --from A --to B`) and therefore cannot use the single
+/// profile `ApplyProfileToOptions` folds into `Options`.
+struct NamedProfileConnection
+{
+    SqlConnectionString connectionString;
+    std::string schema;
+};
+
+/// Looks up profile @p name in the configuration file selected by `--config` (or the
+/// default path) and flattens it via `ProfileToConnectionString`.
+[[nodiscard]] std::expected<NamedProfileConnection, std::string> ResolveNamedProfile(Options const& options,
+                                                                                     std::string const& name)
+{
+    namespace Cfg = Lightweight::Config;
+
+    auto const configPath =
+        options.configFile.empty() ? Cfg::ProfileStore::DefaultPath() : std::filesystem::path { options.configFile };
+    if (!std::filesystem::exists(configPath))
+        return std::unexpected { std::format("Config file not found: {}", configPath.string()) };
+
+    auto storeResult = Cfg::ProfileStore::LoadOrDefault(configPath);
+    if (!storeResult)
+        return std::unexpected { std::format("Error loading config file: {}", storeResult.error()) };
+
+    auto const* profile = storeResult->Find(name);
+    if (!profile)
+        return std::unexpected { std::format("profile '{}' not found in {}.", name, configPath.string()) };
+
+    auto connectionString = ProfileToConnectionString(*profile);
+    if (connectionString.value.empty())
+        return std::unexpected { std::format("profile '{}' has neither a connection string nor a DSN.", name) };
+
+    return NamedProfileConnection { .connectionString = std::move(connectionString), .schema = profile->schema };
+}
+
 // NOLINTNEXTLINE(readability-function-cognitive-complexity)
 std::expected<Options, std::string> ParseArguments(int argc, char** argv)
 {
@@ -606,6 +685,18 @@ std::expected<Options, std::string> ParseArguments(int argc, char** argv)
                 return std::unexpected { "Error: --input requires an argument" };
             options.inputFile = argv[++i];
         }
+        else if (arg == "--from")
+        {
+            if (i + 1 >= argc)
+                return std::unexpected { "Error: --from requires an argument" };
+            options.fromProfile = argv[++i];
+        }
+        else if (arg == "--to")
+        {
+            if (i + 1 >= argc)
+                return std::unexpected { "Error: --to requires an argument" };
+            options.toProfile = argv[++i];
+        }
         else if (arg == "--left")
         {
             if (i + 1 >= argc)
@@ -668,6 +759,30 @@ std::expected<Options, std::string> ParseArguments(int argc, char** argv)
         {
             options.compressionLevel = static_cast<unsigned>(std::stoi(arg.substr(20)));
         }
+        else if (arg == "--adaptive-compression")
+        {
+            options.adaptiveCompression = true;
+        }
+        else if (arg == "--compression-tradeoff")
+        {
+            if (i + 1 >= argc)
+                return std::unexpected { "Error: --compression-tradeoff requires an argument" };
+            options.compressionTradeoff = argv[++i];
+        }
+        else if (arg.starts_with("--compression-tradeoff="))
+        {
+            options.compressionTradeoff = arg.substr(23);
+        }
+        else if (arg == "--checksum")
+        {
+            if (i + 1 >= argc)
+                return std::unexpected { "Error: --checksum requires an argument" };
+            options.checksumAlgorithm = argv[++i];
+        }
+        else if (arg.starts_with("--checksum="))
+        {
+            options.checksumAlgorithm = arg.substr(11);
+        }
         else if (arg == "--chunk-size")
         {
             if (i + 1 >= argc)
@@ -678,6 +793,24 @@ std::expected<Options, std::string> ParseArguments(int argc, char** argv)
         {
             options.chunkSize = arg.substr(13);
         }
+        else if (arg == "--compact-encodings")
+        {
+            options.compactEncodings = true;
+        }
+        else if (arg == "--window-fingerprints")
+        {
+            options.windowFingerprints = true;
+        }
+        else if (arg == "--incremental-from")
+        {
+            if (i + 1 >= argc)
+                return std::unexpected { "Error: --incremental-from requires an argument" };
+            options.incrementalFrom = argv[++i];
+        }
+        else if (arg.starts_with("--incremental-from="))
+        {
+            options.incrementalFrom = arg.substr(19);
+        }
         else if (arg == "--memory-limit")
         {
             if (i + 1 >= argc)
@@ -698,6 +831,16 @@ std::expected<Options, std::string> ParseArguments(int argc, char** argv)
         {
             options.batchSize = arg.substr(13);
         }
+        else if (arg == "--max-writers-per-table")
+        {
+            if (i + 1 >= argc)
+                return std::unexpected { "Error: --max-writers-per-table requires an argument" };
+            options.maxWritersPerTable = argv[++i];
+        }
+        else if (arg.starts_with("--max-writers-per-table="))
+        {
+            options.maxWritersPerTable = arg.substr(24);
+        }
         else if (arg.starts_with("--filter-tables="))
         {
             options.filterTables = arg.substr(16);
@@ -739,6 +882,10 @@ std::expected<Options, std::string> ParseArguments(int argc, char** argv)
         {
             options.schemaOnly = true;
         }
+        else if (arg == "--no-bulk-load")
+        {
+            options.noBulkLoad = true;
+        }
         else if (arg == "--yes" || arg == "-y")
         {
             options.yes = true;
@@ -1696,6 +1843,11 @@ class OptionalScopedLock
 class SimpleEventProgressManager: public Lightweight::SqlBackup::ErrorTrackingProgressManager
 {
   public:
+    explicit SimpleEventProgressManager(std::ostream& out = std::cout):
+        _out { out }
+    {
+    }
+
     void Update(SqlBackup::Progress const& p) override
     {
         ErrorTrackingProgressManager::Update(p);
@@ -1724,11 +1876,11 @@ class SimpleEventProgressManager: public Lightweight::SqlBackup::ErrorTrackingPr
         if (p.totalRows && *p.totalRows > 0)
         {
             auto const pct = (static_cast<double>(p.currentRows) * 100.0) / static_cast<double>(*p.totalRows);
-            std::println("[{}] {} ({:.2f}%) {}", p.tableName, stateStr, pct, p.message);
+            std::println(_out, "[{}] {} ({:.2f}%) {}", p.tableName, stateStr, pct, p.message);
         }
         else
         {
-            std::println("[{}] {} {} rows {}", p.tableName, stateStr, p.currentRows, p.message);
+            std::println(_out, "[{}] {} {} rows {}", p.tableName, stateStr, p.currentRows, p.message);
         }
 
         if (p.state == SqlBackup::Progress::State::Warning)
@@ -1741,6 +1893,26 @@ class SimpleEventProgressManager: public Lightweight::SqlBackup::ErrorTrackingPr
         }
     }
 
+    void OnRestoreWorkersIdle(std::vector<SqlBackup::RestoreWorkerIdleTime> const& idleTimes) override
+    {
+        for (auto const i: std::views::iota(0UZ, idleTimes.size()))
+            std::println(_out,
+                         "[RestoreWorker {}] Idle {} ms ({} ms at writer limit)",
+                         i + 1,
+                         (idleTimes[i].tail + idleTimes[i].throttled).count(),
+                         idleTimes[i].throttled.count());
+    }
+
+    void OnRestoreLoadStatistics(std::vector<SqlBackup::RestoreLoadStatistics> const& statistics) override
+    {
+        for (auto const& entry: statistics)
+            std::println(_out,
+                         "[Restore] {} rows via {} in {} ms of insert time",
+                         entry.rows,
+                         entry.method,
+                         entry.insertTime.count());
+    }
+
     void AllDone() override
     {
         auto const now = std::chrono::steady_clock::now();
@@ -1750,27 +1922,27 @@ class SimpleEventProgressManager: public Lightweight::SqlBackup::ErrorTrackingPr
         auto const m = (total_ms % 3600000) / 60000;
         auto const s = (total_ms % 60000) / 1000;
         auto const ms = total_ms % 1000;
-        std::println("Total time: {:02}:{:02}:{:02}.{:03}", h, m, s, ms);
+        std::println(_out, "Total time: {:02}:{:02}:{:02}.{:03}", h, m, s, ms);
 
         if (!_issuesByTable.empty())
         {
-            std::println("\nIssues:");
+            std::println(_out, "\nIssues:");
             for (auto const& [tableName, issues]: _issuesByTable)
             {
-                std::println("  {}:", tableName);
+                std::println(_out, "  {}:", tableName);
                 for (auto const& issue: issues)
                 {
                     switch (issue.type)
                     {
                         using enum Tools::IssueType;
                         case Error:
-                            std::println("    ❌ {}", issue.message);
+                            std::println(_out, "    ❌ {}", issue.message);
                             break;
                         case Warning:
-                            std::println("    ⚠️  {}", issue.message);
+                            std::println(_out, "    ⚠️  {}", issue.message);
                             break;
                         case Info:
-                            std::println("    ℹ️  {}", issue.message);
+                            std::println(_out, "    ℹ️  {}", issue.message);
                             break;
                     }
                 }
@@ -1779,20 +1951,22 @@ class SimpleEventProgressManager: public Lightweight::SqlBackup::ErrorTrackingPr
     }
 
   private:
+    std::ostream& _out;
     std::map<std::string, std::vector<Tools::TableIssue>> _issuesByTable;
     std::chrono::steady_clock::time_point _startTime = std::chrono::steady_clock::now();
 };
 
-std::unique_ptr<Lightweight::SqlBackup::ProgressManager> CreateProgressManager(Options const& options)
+std::unique_ptr<Lightweight::SqlBackup::ProgressManager> CreateProgressManager(Options const& options,
+                                                                              std::ostream& out = std::cout)
 {
     switch (options.progressType)
     {
         case ProgressType::Unicode:
-            return std::make_unique<Tools::StandardProgressManager>(true);
+            return std::make_unique<Tools::StandardProgressManager>(true, out);
         case ProgressType::Ascii:
-            return std::make_unique<Tools::StandardProgressManager>(false);
+            return std::make_unique<Tools::StandardProgressManager>(false, out);
         case ProgressType::Loglines:
-            return std::make_unique<SimpleEventProgressManager>();
+            return std::make_unique<SimpleEventProgressManager>(out);
         case ProgressType::None:
             return std::make_unique<Lightweight::SqlBackup::NullProgressManager>();
     }
@@ -1894,6 +2068,23 @@ std::expected<Lightweight::SqlBackup::BackupSettings, std::string> ParseBackupSe
     if (options.compressionLevel > 9)
         return std::unexpected { "Compression level must be between 0 and 9" };
 
+    // Parse the adaptive compression tradeoff
+    settings.adaptiveCompression = options.adaptiveCompression;
+    auto const& tradeoff = options.compressionTradeoff;
+    auto const parsedTradeoff = Lightweight::detail::ParseFloat<double>(tradeoff.data(), tradeoff.data() + tradeoff.size());
+    if (!parsedTradeoff || *parsedTradeoff < 0.0 || *parsedTradeoff > 1.0)
+        return std::unexpected { std::format("Compression tradeoff must be between 0 and 1, got '{}'", tradeoff) };
+    settings.compressionTradeoff = *parsedTradeoff;
+
+    // Parse checksum algorithm ("xxh3" is short for "xxh3-128")
+    std::string checksum = options.checksumAlgorithm;
+    std::ranges::transform(checksum, checksum.begin(), [](unsigned char c) { return std::tolower(c); });
+    auto const checksumAlgorithm = ParseChecksumAlgorithm(checksum == "xxh3" ? "xxh3-128" : checksum);
+    if (!checksumAlgorithm)
+        return std::unexpected { std::format("Unknown checksum algorithm '{}'. Use: sha256, xxh3",
+                                             options.checksumAlgorithm) };
+    settings.checksumAlgorithm = *checksumAlgorithm;
+
     // Parse chunk size
     auto chunkSizeResult = ParseSizeWithSuffix(options.chunkSize);
     if (!chunkSizeResult)
@@ -1904,6 +2095,9 @@ std::expected<Lightweight::SqlBackup::BackupSettings, std::string> ParseBackupSe
     if (settings.chunkSizeBytes < 1024)
         return std::unexpected { "Chunk size must be at least 1 KB" };
 
+    settings.compactEncodings = options.compactEncodings;
+    settings.windowFingerprints = options.windowFingerprints;
+    settings.incrementalFrom = options.incrementalFrom;
     settings.schemaOnly = options.schemaOnly;
 
     // No longer has any effect (the MSSQL concurrency clamp was removed); kept until the field is deleted.
@@ -1948,6 +2142,26 @@ std::string FormatConnectionError(std::string_view errorMessage)
     return std::format("{}{}", errorMessage, suggestions);
 }
 
+/// Tests for `-` as --output/--input file name, which streams the backup through stdout/stdin.
+///
+/// @param file The file name given on the command line.
+/// @return true if the backup goes through a standard stream.
+bool IsStandardStream(std::filesystem::path const& file)
+{
+    return file == "-";
+}
+
+/// Switches a standard stream to binary mode, so Windows does not translate line endings inside
+/// a stream archive.
+///
+/// @param stream The C stream (stdin or stdout).
+void SetBinaryMode([[maybe_unused]] FILE* stream)
+{
+#if defined(_WIN32)
+    _setmode(_fileno(stream), _O_BINARY);
+#endif
+}
+
 int Backup(Options const& options)
 {
     if (options.outputFile.empty())
@@ -2033,19 +2247,34 @@ int Backup(Options const& options)
         return EXIT_SUCCESS;
     }
 
-    auto pm = CreateProgressManager(options);
+    // Streaming to stdout: the archive owns stdout, so progress goes to stderr.
+    bool const toStdout = IsStandardStream(options.outputFile);
+    auto pm = CreateProgressManager(options, toStdout ? std::cerr : std::cout);
     Lightweight::SqlBackup::RetrySettings retrySettings { .maxRetries = options.maxRetries };
 
     try
     {
-        Lightweight::SqlBackup::Backup(options.outputFile,
-                                       options.connectionString,
-                                       options.jobs,
-                                       *pm,
-                                       options.schema,
-                                       options.filterTables,
-                                       retrySettings,
-                                       backupSettings);
+        if (toStdout)
+        {
+            SetBinaryMode(stdout);
+            Lightweight::SqlBackup::Backup(std::cout,
+                                           options.connectionString,
+                                           options.jobs,
+                                           *pm,
+                                           options.schema,
+                                           options.filterTables,
+                                           retrySettings,
+                                           backupSettings);
+        }
+        else
+            Lightweight::SqlBackup::Backup(options.outputFile,
+                                           options.connectionString,
+                                           options.jobs,
+                                           *pm,
+                                           options.schema,
+                                           options.filterTables,
+                                           retrySettings,
+                                           backupSettings);
     }
     catch (SqlException const& e)
     {
@@ -2094,59 +2323,105 @@ std::expected<Lightweight::SqlBackup::RestoreSettings, std::string> ParseRestore
         }
     }
 
+    if (!options.maxWritersPerTable.empty())
+    {
+        try
+        {
+            settings.maxWritersPerTable = std::stoull(options.maxWritersPerTable);
+        }
+        catch (std::exception const&)
+        {
+            return std::unexpected { std::format("Invalid writers per table: {}", options.maxWritersPerTable) };
+        }
+    }
+
     settings.schemaOnly = options.schemaOnly;
+    settings.bulkLoad = !options.noBulkLoad;
 
     return settings;
 }
 
-int Restore(Options const& options)
+/// Reads metadata.json of a backup: a ZIP archive, a stream archive file, or a stream archive on
+/// stdin (`-`).
+///
+/// @param inputFile The backup file, or `-` for stdin.
+/// @return The metadata JSON, or an error message.
+std::expected<std::string, std::string> ReadBackupMetadata(std::filesystem::path const& inputFile)
 {
-    if (options.inputFile.empty())
+    if (IsStandardStream(inputFile))
     {
-        std::println(std::cerr, "Error: --input file required for restore.");
-        return EXIT_FAILURE;
+        SetBinaryMode(stdin);
+        try
+        {
+            return Lightweight::SqlBackup::ReadStreamArchiveMetadata(std::cin);
+        }
+        catch (std::exception const& e)
+        {
+            return std::unexpected { std::string { e.what() } };
+        }
     }
 
-    if (options.dryRun)
+    if (!std::filesystem::exists(inputFile))
+        return std::unexpected { std::format("Input file does not exist: {}", inputFile.string()) };
+
+    int err = 0;
+    zip_t* zip = zip_open(inputFile.string().c_str(), ZIP_RDONLY, &err);
+    if (!zip)
     {
-        // Dry run: show what would be restored
-        if (!std::filesystem::exists(options.inputFile))
+        // Not a ZIP archive; a stream archive saved to a file reads the same way as stdin.
+        auto file = std::ifstream { inputFile, std::ios::binary };
+        try
         {
-            std::println(std::cerr, "Error: Input file does not exist: {}", options.inputFile.string());
-            return EXIT_FAILURE;
+            return Lightweight::SqlBackup::ReadStreamArchiveMetadata(file);
         }
-
-        // Read metadata from the backup file
-        int err = 0;
-        zip_t* zip = zip_open(options.inputFile.string().c_str(), ZIP_RDONLY, &err);
-        if (!zip)
+        catch (std::exception const&)
         {
-            std::println(std::cerr, "Error: Failed to open backup file.");
-            return EXIT_FAILURE;
+            return std::unexpected { std::string { "Failed to open backup file." } };
         }
+    }
 
-        zip_int64_t const metadataIndex = zip_name_locate(zip, "metadata.json", 0);
-        if (metadataIndex < 0)
-        {
-            std::println(std::cerr, "Error: metadata.json not found in backup.");
-            zip_close(zip);
-            return EXIT_FAILURE;
-        }
+    zip_int64_t const metadataIndex = zip_name_locate(zip, "metadata.json", 0);
+    if (metadataIndex < 0)
+    {
+        zip_close(zip);
+        return std::unexpected { std::string { "metadata.json not found in backup." } };
+    }
+
+    auto const metadataIndexU = static_cast<zip_uint64_t>(metadataIndex);
+    zip_stat_t metaStat;
+    zip_stat_index(zip, metadataIndexU, 0, &metaStat);
 
-        auto const metadataIndexU = static_cast<zip_uint64_t>(metadataIndex);
-        zip_stat_t metaStat;
-        zip_stat_index(zip, metadataIndexU, 0, &metaStat);
+    zip_file_t* file = zip_fopen_index(zip, metadataIndexU, 0);
+    if (!file)
+    {
+        zip_close(zip);
+        return std::unexpected { std::string { "Failed to open metadata.json in backup." } };
+    }
+    std::string metadataStr(metaStat.size, '\0');
+    zip_fread(file, metadataStr.data(), metaStat.size);
+    zip_fclose(file);
+    zip_close(zip);
+    return metadataStr;
+}
 
-        zip_file_t* file = zip_fopen_index(zip, metadataIndexU, 0);
-        if (!file)
+int Restore(Options const& options)
+{
+    if (options.inputFile.empty())
+    {
+        std::println(std::cerr, "Error: --input file required for restore.");
+        return EXIT_FAILURE;
+    }
+
+    if (options.dryRun)
+    {
+        // Dry run: show what would be restored
+        auto const metadataResult = ReadBackupMetadata(options.inputFile);
+        if (!metadataResult)
         {
-            std::println(std::cerr, "Error: Failed to open metadata.json in backup.");
-            zip_close(zip);
+            std::println(std::cerr, "Error: {}", metadataResult.error());
             return EXIT_FAILURE;
         }
-        std::string metadataStr(metaStat.size, '\0');
-        zip_fread(file, metadataStr.data(), metaStat.size);
-        zip_fclose(file);
+        auto const& metadataStr = *metadataResult;
 
         Lightweight::SqlBackup::NullProgressManager nullPm;
         auto tableMap = Lightweight::SqlBackup::ParseSchema(metadataStr, &nullPm);
@@ -2172,7 +2447,6 @@ int Restore(Options const& options)
         std::println("");
         std::println("Total: {} tables, {} rows", tableMap.size(), totalRows);
 
-        zip_close(zip);
         return EXIT_SUCCESS;
     }
 
@@ -2189,14 +2463,27 @@ int Restore(Options const& options)
 
     try
     {
-        Lightweight::SqlBackup::Restore(options.inputFile,
-                                        options.connectionString,
-                                        options.jobs,
-                                        *pm,
-                                        options.schema,
-                                        options.filterTables,
-                                        retrySettings,
-                                        restoreSettingsResult.value());
+        if (IsStandardStream(options.inputFile))
+        {
+            SetBinaryMode(stdin);
+            Lightweight::SqlBackup::Restore(std::cin,
+                                            options.connectionString,
+                                            options.jobs,
+                                            *pm,
+                                            options.schema,
+                                            options.filterTables,
+                                            retrySettings,
+                                            restoreSettingsResult.value());
+        }
+        else
+            Lightweight::SqlBackup::Restore(options.inputFile,
+                                            options.connectionString,
+                                            options.jobs,
+                                            *pm,
+                                            options.schema,
+                                            options.filterTables,
+                                            retrySettings,
+                                            restoreSettingsResult.value());
     }
     catch (SqlException const& e)
     {
@@ -2217,6 +2504,99 @@ int Restore(Options const& options)
     return pm->ErrorCount() > 0 ? EXIT_FAILURE : EXIT_SUCCESS;
 }
 
+/// Implements the `copy` command: streams every (filtered) table from the `--from`
+/// profile's database into the `--to` profile's database without an intermediate
+/// archive. Both ends are resolved from the configuration file, so — like
+/// `backup-diff` — it is dispatched in `main()` before `SetupConnectionString`.
+int CopyCommand(Options const& options)
+{
+    if (options.fromProfile.empty() || options.toProfile.empty())
+    {
+        std::println(std::cerr, "Error: copy requires both --from <PROFILE> and --to <PROFILE>.");
+        return EXIT_FAILURE;
+    }
+    if (options.fromProfile == options.toProfile)
+    {
+        std::println(std::cerr, "Error: --from and --to must name different profiles.");
+        return EXIT_FAILURE;
+    }
+
+    auto const source = ResolveNamedProfile(options, options.fromProfile);
+    if (!source)
+    {
+        std::println(std::cerr, "Error: {}", source.error());
+        return EXIT_FAILURE;
+    }
+    auto const target = ResolveNamedProfile(options, options.toProfile);
+    if (!target)
+    {
+        std::println(std::cerr, "Error: {}", target.error());
+        return EXIT_FAILURE;
+    }
+
+    Lightweight::SqlBackup::CopySettings copySettings {
+        .readerJobs = options.jobs,
+        .writerJobs = options.jobs,
+        .schemaOnly = options.schemaOnly,
+    };
+    if (!options.batchSize.empty())
+    {
+        try
+        {
+            copySettings.rowsPerBatch = std::stoull(options.batchSize);
+        }
+        catch (std::exception const&)
+        {
+            std::println(std::cerr, "Error: Invalid batch size: {}", options.batchSize);
+            return EXIT_FAILURE;
+        }
+    }
+
+    if (options.dryRun)
+    {
+        std::println("Dry run: Would copy tables matching '{}'{} from profile '{}' to profile '{}'",
+                     options.filterTables,
+                     options.schemaOnly ? " (schema only)" : "",
+                     options.fromProfile,
+                     options.toProfile);
+        std::println("  source: {}", source->connectionString.Sanitized());
+        std::println("  target: {} (existing tables are dropped and recreated)", target->connectionString.Sanitized());
+        return EXIT_SUCCESS;
+    }
+
+    if (!EnsureSqliteDatabaseFileExists(target->connectionString))
+        std::println(std::cerr,
+                     "Warning: could not ensure SQLite database file exists for {}",
+                     target->connectionString.Sanitized());
+
+    auto pm = CreateProgressManager(options);
+    Lightweight::SqlBackup::RetrySettings retrySettings { .maxRetries = options.maxRetries };
+
+    try
+    {
+        Lightweight::SqlBackup::Copy(source->connectionString,
+                                     target->connectionString,
+                                     *pm,
+                                     source->schema,
+                                     target->schema,
+                                     options.filterTables,
+                                     retrySettings,
+                                     copySettings);
+    }
+    catch (SqlException const& e)
+    {
+        std::println(std::cerr, "Error: {}", FormatConnectionError(e.info().message));
+        return EXIT_FAILURE;
+    }
+    catch (std::runtime_error const& e)
+    {
+        std::println(std::cerr, "Error: {}", e.what());
+        return EXIT_FAILURE;
+    }
+
+    return pm->ErrorCount() > 0 ? EXIT_FAILURE : EXIT_SUCCESS;
+}
+
 namespace
 {
 
@@ -2639,6 +3019,9 @@ int main(int argc, char** argv)
         if (options.command == "backup-diff")
             return BackupDiffCommand(options);
 
+        if (options.command == "copy")
+            return CopyCommand(options);
+
         TraceBreadcrumb("main: setting up connection string");
         if (!SetupConnectionString(options.connectionString))
             return EXIT_FAILURE;